@@ -1599,6 +1599,15 @@ ODE_API void dBodyEnable (dBodyID);
  */
 ODE_API void dBodyDisable (dBodyID);
 
+/**
+ * @brief Enable a body without restarting its auto-disable countdown.
+ * @ingroup bodies
+ * @remarks
+ * Use it to enable a body that was disabled for a moment, for example to
+ * keep it out of a step, when that should not delay its auto-disabling.
+ */
+ODE_API void dBodyReenable (dBodyID);
+
 /**
  * @brief Check wether a body is enabled.
  * @ingroup bodies
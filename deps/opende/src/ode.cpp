@@ -903,6 +903,13 @@ void dBodyDisable (dBodyID b)
 }
 
 
+void dBodyReenable (dBodyID b)
+{
+  dAASSERT (b);
+  b->flags &= ~dxBodyDisabled;
+}
+
+
 int dBodyIsEnabled (dBodyID b)
 {
   dAASSERT (b);
@@ -15,9 +15,13 @@
  *
 */
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <thread>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
@@ -33,22 +37,85 @@ using namespace gazebo;
 
 namespace gazebo
 {
+  /// \brief Publishers and subscribers of a single topic.
+  struct TopicEntry
+  {
+    /// \brief Publishers of the topic.
+    Master::PubList publishers;
+
+    /// \brief Subscribers of the topic.
+    Master::SubList subscribers;
+
+    /// \brief Clients with a discovery interest that were told about the
+    /// publishers of this topic, and must be told when they go away.
+    std::set<unsigned int> announced;
+  };
+
+  /// \brief Discovery state of a client connection.
+  struct ClientInfo
+  {
+    /// \brief True until the client declares a discovery interest. The
+    /// client is then told about every publisher.
+    bool catalog = true;
+
+    /// \brief True once the client declared that it handles batched
+    /// announcements. Other clients get one "publisher_add" or
+    /// "publisher_del" per publisher.
+    bool batched = false;
+
+    /// \brief Topic name prefixes the client is interested in.
+    std::vector<std::string> namespaces;
+
+    /// \brief Announcements waiting to be sent, in order. Consecutive
+    /// batched announcements of the same type share a batch.
+    std::list<std::pair<std::string, msgs::Publishers> > pending;
+  };
+
+  /// \brief A message received from a client.
+  struct IncomingMsg
+  {
+    /// \brief Index of the client connection.
+    unsigned int connectionIndex;
+
+    /// \brief Serialized packet.
+    std::string data;
+
+    /// \brief Time the message was received.
+    std::chrono::steady_clock::time_point received;
+  };
+
   struct MasterPrivate
   {
-    /// \brief All the known publishers.
-    gazebo::Master::PubList publishers;
+    /// \brief All the known publishers and subscribers, by topic.
+    std::unordered_map<std::string, TopicEntry> topics;
 
-    /// \brief All the known subscribers.
-    gazebo::Master::SubList subscribers;
+    /// \brief Discovery state of the connections, by connection index.
+    std::map<unsigned int, ClientInfo> clients;
 
     /// \brief All the known connections.
     gazebo::Master::Connection_M connections;
 
+    /// \brief Index given to the next connection.
+    unsigned int connectionCount = 0;
+
     /// \brief All the worlds.
     std::list<std::string> worldNames;
 
     /// \brief Incoming messages.
-    std::list<std::pair<unsigned int, std::string> > msgs;
+    std::list<IncomingMsg> msgs;
+
+    /// \brief Receipt time of the message being processed.
+    std::chrono::steady_clock::time_point received;
+
+    /// \brief Receipt times of the registrations whose announcements were
+    /// not flushed yet.
+    std::vector<std::chrono::steady_clock::time_point> unflushed;
+
+    /// \brief Registration statistics.
+    MasterStatistics stats;
+
+    /// \brief Sum of the registration latencies, in seconds.
+    double latencySum = 0;
 
     /// \brief Our server connection.
     transport::ConnectionPtr connection;
@@ -59,12 +126,69 @@ namespace gazebo
     /// \brief True to stop Master.
     bool stop;
 
-    /// \brief Mutex to protect connections.
+    /// \brief Mutex to protect connections, clients and topics.
     std::recursive_mutex connectionMutex;
 
     /// \brief Mutex to protect msg bufferes.
     std::recursive_mutex msgsMutex;
+
+    /// \brief Mutex to protect the statistics.
+    std::mutex statsMutex;
   };
+
+  /// \brief Get whether a topic is in one of the namespaces of a client.
+  /// \param[in] _client The client.
+  /// \param[in] _topic Name of the topic.
+  /// \return True if the topic name starts with one of the namespaces.
+  static bool InNamespace(const ClientInfo &_client, const std::string &_topic)
+  {
+    for (auto const &ns : _client.namespaces)
+    {
+      if (_topic.compare(0, ns.size(), ns) == 0 &&
+          (_topic.size() == ns.size() || _topic[ns.size()] == '/' ||
+           ns.back() == '/'))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// \brief Queue a publisher announcement for a client.
+  /// \param[in,out] _client The client.
+  /// \param[in] _add True if the publisher was added, false if removed.
+  /// \param[in] _pub The publisher.
+  static void QueueAnnouncement(ClientInfo &_client, const bool _add,
+                                const msgs::Publish &_pub)
+  {
+    if (!_client.batched)
+    {
+      _client.pending.push_back(std::make_pair(
+          _add ? "publisher_add" : "publisher_del", msgs::Publishers()));
+    }
+    else
+    {
+      const std::string type = _add ? "publishers_add" : "publishers_del";
+      if (_client.pending.empty() || _client.pending.back().first != type)
+        _client.pending.push_back(std::make_pair(type, msgs::Publishers()));
+    }
+    _client.pending.back().second.add_publisher()->CopyFrom(_pub);
+  }
+
+  /// \brief Get whether a connection subscribes to a topic.
+  /// \param[in] _entry The topic.
+  /// \param[in] _conn The connection.
+  /// \return True if one of the subscribers uses the connection.
+  static bool Subscribes(const TopicEntry &_entry,
+                         const transport::ConnectionPtr &_conn)
+  {
+    for (auto const &sub : _entry.subscribers)
+    {
+      if (sub.second == _conn)
+        return true;
+    }
+    return false;
+  }
 }
 
 /////////////////////////////////////////////////
@@ -105,6 +229,8 @@ void Master::OnAccept(transport::ConnectionPtr _newConnection)
   versionMsg.set_data(std::string("gazebo ") + GAZEBO_VERSION);
   _newConnection->EnqueueMsg(msgs::Package("version_init", versionMsg), true);
 
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
+
   // Send all the current topic namespaces
   msgs::GzString_V namespacesMsg;
   std::list<std::string>::iterator iter;
@@ -116,29 +242,26 @@ void Master::OnAccept(transport::ConnectionPtr _newConnection)
   _newConnection->EnqueueMsg(msgs::Package("topic_namepaces_init",
                               namespacesMsg), true);
 
-  // Send all the publishers
+  // Send all the publishers. The client is told about every publisher
+  // until it declares a discovery interest.
   msgs::Publishers publishersMsg;
-  PubList::iterator pubiter;
-  for (pubiter = this->dataPtr->publishers.begin();
-       pubiter != this->dataPtr->publishers.end(); ++pubiter)
+  for (auto const &topic : this->dataPtr->topics)
   {
-    msgs::Publish *pub = publishersMsg.add_publisher();
-    pub->CopyFrom(pubiter->first);
+    for (auto const &pub : topic.second.publishers)
+      publishersMsg.add_publisher()->CopyFrom(pub.first);
   }
   _newConnection->EnqueueMsg(
       msgs::Package("publishers_init", publishersMsg), true);
 
   // Add the connection to our list
-  {
-    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
-    int index = this->dataPtr->connections.size();
+  unsigned int index = this->dataPtr->connectionCount++;
 
-    this->dataPtr->connections[index] = _newConnection;
+  this->dataPtr->connections[index] = _newConnection;
+  this->dataPtr->clients[index] = ClientInfo();
 
-    // Start reading from the connection
-    _newConnection->AsyncRead(
-        boost::bind(&Master::OnRead, this, index, _1));
-  }
+  // Start reading from the connection
+  _newConnection->AsyncRead(
+      boost::bind(&Master::OnRead, this, index, _1));
 }
 
 //////////////////////////////////////////////////
@@ -163,7 +286,8 @@ void Master::OnRead(const unsigned int _connectionIndex,
   if (!_data.empty())
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->msgsMutex);
-    this->dataPtr->msgs.push_back(std::make_pair(_connectionIndex, _data));
+    this->dataPtr->msgs.push_back(
+        {_connectionIndex, _data, std::chrono::steady_clock::now()});
   }
   else
   {
@@ -177,17 +301,169 @@ void Master::OnRead(const unsigned int _connectionIndex,
 void Master::SendSubscribers(const std::string &_topic,
                              const std::string &_buffer)
 {
+  auto entry = this->dataPtr->topics.find(_topic);
+  if (entry == this->dataPtr->topics.end())
+    return;
+
   // Find all subscribers for this topic
   std::set<transport::ConnectionPtr> uniqueConnections;
-  for (auto const &subscriber : this->dataPtr->subscribers)
-    if (subscriber.first.topic() == _topic)
-      uniqueConnections.insert(subscriber.second);
+  for (auto const &subscriber : entry->second.subscribers)
+    uniqueConnections.insert(subscriber.second);
 
   // Send message to all unique connections
   for (auto &conn : uniqueConnections)
     conn->EnqueueMsg(_buffer);
 }
 
+//////////////////////////////////////////////////
+void Master::Announce(const std::string &_type, const msgs::Publish &_pub)
+{
+  TopicEntry &entry = this->dataPtr->topics[_pub.topic()];
+  const bool add = _type == "publishers_add";
+
+  uint64_t filtered = 0;
+  for (auto &client : this->dataPtr->clients)
+  {
+    ClientInfo &info = client.second;
+
+    if (!info.catalog)
+    {
+      if (add)
+      {
+        auto conn = this->dataPtr->connections.find(client.first);
+        if (conn == this->dataPtr->connections.end() ||
+            (!InNamespace(info, _pub.topic()) &&
+             !Subscribes(entry, conn->second)))
+        {
+          ++filtered;
+          continue;
+        }
+        entry.announced.insert(client.first);
+      }
+      else if (entry.announced.find(client.first) == entry.announced.end())
+      {
+        ++filtered;
+        continue;
+      }
+    }
+
+    QueueAnnouncement(info, add, _pub);
+  }
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->statsMutex);
+  this->dataPtr->stats.filtered += filtered;
+}
+
+//////////////////////////////////////////////////
+void Master::FlushAnnouncements()
+{
+  uint64_t announcements = 0;
+  uint64_t batches = 0;
+
+  {
+    std::lock_guard<std::recursive_mutex> lock(
+        this->dataPtr->connectionMutex);
+    for (auto &client : this->dataPtr->clients)
+    {
+      auto conn = this->dataPtr->connections.find(client.first);
+      if (conn == this->dataPtr->connections.end() || !conn->second)
+      {
+        client.second.pending.clear();
+        continue;
+      }
+
+      for (auto const &batch : client.second.pending)
+      {
+        // Announcements for a client that doesn't handle batches hold a
+        // single publisher
+        if (batch.first == "publisher_add" || batch.first == "publisher_del")
+        {
+          conn->second->EnqueueMsg(
+              msgs::Package(batch.first, batch.second.publisher(0)));
+        }
+        else
+        {
+          conn->second->EnqueueMsg(msgs::Package(batch.first, batch.second));
+          ++batches;
+        }
+        announcements += batch.second.publisher_size();
+      }
+      client.second.pending.clear();
+    }
+  }
+
+  auto now = std::chrono::steady_clock::now();
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->statsMutex);
+  MasterStatistics &stats = this->dataPtr->stats;
+  stats.announcements += announcements;
+  stats.batches += batches;
+  for (auto const &received : this->dataPtr->unflushed)
+  {
+    double latency = std::chrono::duration<double>(now - received).count();
+    this->dataPtr->latencySum += latency;
+    ++stats.registrations;
+    if (latency > stats.maxLatency.Double())
+      stats.maxLatency = common::Time(latency);
+  }
+  this->dataPtr->unflushed.clear();
+
+  if (stats.registrations > 0)
+  {
+    stats.meanLatency =
+        common::Time(this->dataPtr->latencySum / stats.registrations);
+  }
+}
+
+//////////////////////////////////////////////////
+void Master::SetInterest(const unsigned int _connectionIndex,
+                         const msgs::GzString_V &_namespaces)
+{
+  auto conn = this->dataPtr->connections.find(_connectionIndex);
+  auto client = this->dataPtr->clients.find(_connectionIndex);
+  if (conn == this->dataPtr->connections.end() ||
+      client == this->dataPtr->clients.end())
+  {
+    return;
+  }
+
+  // Clients that declare an interest handle batches
+  ClientInfo &info = client->second;
+  info.catalog = false;
+  info.batched = true;
+  info.namespaces.clear();
+  for (int i = 0; i < _namespaces.data_size(); ++i)
+  {
+    // A bare namespace is a world name
+    std::string ns = _namespaces.data(i);
+    if (ns.empty())
+      continue;
+    if (ns[0] != '/')
+      ns = "/gazebo/" + ns;
+    info.namespaces.push_back(ns);
+  }
+
+  // The snapshot replaces everything the client was told so far
+  info.pending.clear();
+
+  msgs::Publishers publishersMsg;
+  for (auto &topic : this->dataPtr->topics)
+  {
+    TopicEntry &entry = topic.second;
+    if (!entry.publishers.empty() && (InNamespace(info, topic.first) ||
+        Subscribes(entry, conn->second)))
+    {
+      for (auto const &pub : entry.publishers)
+        publishersMsg.add_publisher()->CopyFrom(pub.first);
+      entry.announced.insert(_connectionIndex);
+    }
+    else
+      entry.announced.erase(_connectionIndex);
+  }
+
+  conn->second->EnqueueMsg(msgs::Package("publishers_init", publishersMsg));
+}
+
 //////////////////////////////////////////////////
 void Master::ProcessMessage(const unsigned int _connectionIndex,
                             const std::string &_data)
@@ -224,69 +500,87 @@ void Master::ProcessMessage(const unsigned int _connectionIndex,
       }
     }
   }
+  else if (packet.type() == "announcement_batching")
+  {
+    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
+    auto client = this->dataPtr->clients.find(_connectionIndex);
+    if (client != this->dataPtr->clients.end())
+      client->second.batched = true;
+  }
+  else if (packet.type() == "discovery_interest")
+  {
+    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
+    msgs::GzString_V namespaces;
+    namespaces.ParseFromString(packet.serialized_data());
+    this->SetInterest(_connectionIndex, namespaces);
+  }
   else if (packet.type() == "advertise")
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
     msgs::Publish pub;
     pub.ParseFromString(packet.serialized_data());
 
-    Connection_M::iterator iter2;
-    for (iter2 = this->dataPtr->connections.begin();
-         iter2 != this->dataPtr->connections.end(); ++iter2)
-    {
-      iter2->second->EnqueueMsg(msgs::Package("publisher_add", pub));
-    }
-
-    this->dataPtr->publishers.push_back(std::make_pair(pub, conn));
+    this->dataPtr->topics[pub.topic()].publishers.push_back(
+        std::make_pair(pub, conn));
+    this->Announce("publishers_add", pub);
+    this->dataPtr->unflushed.push_back(this->dataPtr->received);
 
     this->SendSubscribers(pub.topic(),
         msgs::Package("publisher_advertise", pub));
   }
   else if (packet.type() == "unadvertise")
   {
+    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
     msgs::Publish pub;
     pub.ParseFromString(packet.serialized_data());
     this->RemovePublisher(pub);
+    this->dataPtr->unflushed.push_back(this->dataPtr->received);
   }
   else if (packet.type() == "unsubscribe")
   {
+    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
     msgs::Subscribe sub;
     sub.ParseFromString(packet.serialized_data());
     this->RemoveSubscriber(sub);
   }
   else if (packet.type() == "subscribe")
   {
+    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
     msgs::Subscribe sub;
     sub.ParseFromString(packet.serialized_data());
 
-    this->dataPtr->subscribers.push_back(std::make_pair(sub, conn));
+    TopicEntry &entry = this->dataPtr->topics[sub.topic()];
+    entry.subscribers.push_back(std::make_pair(sub, conn));
 
-    PubList::iterator iter;
-
-    // Find all publishers of the topic
-    for (iter = this->dataPtr->publishers.begin();
-        iter != this->dataPtr->publishers.end(); ++iter)
+    // A client with a discovery interest learns about the publishers of
+    // every topic it subscribes to.
+    ClientInfo &info = this->dataPtr->clients[_connectionIndex];
+    if (!info.catalog && !entry.publishers.empty() &&
+        entry.announced.insert(_connectionIndex).second)
     {
-      if (iter->first.topic() == sub.topic())
-      {
-        conn->EnqueueMsg(msgs::Package("publisher_subscribe", iter->first));
-      }
+      for (auto const &pub : entry.publishers)
+        QueueAnnouncement(info, true, pub.first);
     }
+
+    // Find all publishers of the topic
+    for (auto const &pub : entry.publishers)
+      conn->EnqueueMsg(msgs::Package("publisher_subscribe", pub.first));
+
+    this->dataPtr->unflushed.push_back(this->dataPtr->received);
   }
   else if (packet.type() == "request")
   {
+    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
     msgs::Request req;
     req.ParseFromString(packet.serialized_data());
 
     if (req.request() == "get_publishers")
     {
       msgs::Publishers msg;
-      PubList::iterator iter;
-      for (iter = this->dataPtr->publishers.begin();
-          iter != this->dataPtr->publishers.end(); ++iter)
+      for (auto const &topic : this->dataPtr->topics)
       {
-        msgs::Publish *pub = msg.add_publisher();
-        pub->CopyFrom(iter->first);
+        for (auto const &pub : topic.second.publishers)
+          msg.add_publisher()->CopyFrom(pub.first);
       }
       conn->EnqueueMsg(msgs::Package("publisher_list", msg), true);
     }
@@ -295,19 +589,9 @@ void Master::ProcessMessage(const unsigned int _connectionIndex,
       std::set<std::string> topics;
       msgs::GzString_V msg;
 
-      // Add all topics that are published
-      for (PubList::iterator iter = this->dataPtr->publishers.begin();
-          iter != this->dataPtr->publishers.end(); ++iter)
-      {
-        topics.insert(iter->first.topic());
-      }
-
-      // Add all topics that are subscribed
-      for (SubList::iterator iter = this->dataPtr->subscribers.begin();
-           iter != this->dataPtr->subscribers.end(); ++iter)
-      {
-        topics.insert(iter->first.topic());
-      }
+      // Add all topics that are published or subscribed
+      for (auto const &topic : this->dataPtr->topics)
+        topics.insert(topic.first);
 
       // Construct the message of only unique names
       for (std::set<std::string>::iterator iter =
@@ -325,33 +609,26 @@ void Master::ProcessMessage(const unsigned int _connectionIndex,
       msgs::TopicInfo ti;
       ti.set_msg_type(pub.msg_type());
 
-      PubList::iterator piter;
-      SubList::iterator siter;
-
-      // Find all publishers of the topic
-      for (piter = this->dataPtr->publishers.begin();
-          piter != this->dataPtr->publishers.end(); ++piter)
+      auto entry = this->dataPtr->topics.find(req.data());
+      if (entry != this->dataPtr->topics.end())
       {
-        if (piter->first.topic() == req.data())
+        // Find all publishers of the topic
+        for (auto const &piter : entry->second.publishers)
         {
           msgs::Publish *pubPtr = ti.add_publisher();
-          pubPtr->CopyFrom(piter->first);
+          pubPtr->CopyFrom(piter.first);
         }
-      }
 
-      // Find all subscribers of the topic
-      for (siter = this->dataPtr->subscribers.begin();
-          siter != this->dataPtr->subscribers.end(); ++siter)
-      {
-        if (siter->first.topic() == req.data())
+        // Find all subscribers of the topic
+        for (auto const &siter : entry->second.subscribers)
         {
           // If the topic info message type has not been set or the
           // topic info message type is an empty string, then set the topic
           // info message type based on a subscriber's message type.
           if (!ti.has_msg_type() || ti.msg_type().empty())
-            ti.set_msg_type(siter->first.msg_type());
+            ti.set_msg_type(siter.first.msg_type());
           msgs::Subscribe *sub = ti.add_subscriber();
-          sub->CopyFrom(siter->first);
+          sub->CopyFrom(siter.first);
         }
       }
 
@@ -404,12 +681,16 @@ void Master::RunOnce()
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->msgsMutex);
     while (!this->dataPtr->msgs.empty())
     {
-      this->ProcessMessage(this->dataPtr->msgs.front().first,
-                           this->dataPtr->msgs.front().second);
+      this->dataPtr->received = this->dataPtr->msgs.front().received;
+      this->ProcessMessage(this->dataPtr->msgs.front().connectionIndex,
+                           this->dataPtr->msgs.front().data);
       this->dataPtr->msgs.pop_front();
     }
   }
 
+  // Send the publisher announcements of all the processed messages at once
+  this->FlushAnnouncements();
+
   // Process all the connections
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
@@ -432,7 +713,7 @@ void Master::RunOnce()
 /////////////////////////////////////////////////
 void Master::RemoveConnection(Connection_M::iterator _connIter)
 {
-  std::list< std::pair<unsigned int, std::string> >::iterator msgIter;
+  std::list<IncomingMsg>::iterator msgIter;
 
   if (_connIter == this->dataPtr->connections.end() || !_connIter->second)
     return;
@@ -443,111 +724,114 @@ void Master::RemoveConnection(Connection_M::iterator _connIter)
     msgIter = this->dataPtr->msgs.begin();
     while (msgIter != this->dataPtr->msgs.end())
     {
-      if ((*msgIter).first == _connIter->first)
+      if ((*msgIter).connectionIndex == _connIter->first)
         this->dataPtr->msgs.erase(msgIter++);
       else
         ++msgIter;
     }
   }
 
-  // Remove all publishers for this connection
-  bool done = false;
-  while (!done)
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
+
+  // Collect all publishers and subscribers for this connection
+  std::vector<msgs::Publish> pubs;
+  std::vector<msgs::Subscribe> subs;
+  for (auto &topic : this->dataPtr->topics)
   {
-    done = true;
-    PubList::iterator pubIter = this->dataPtr->publishers.begin();
-    while (pubIter != this->dataPtr->publishers.end())
+    for (auto const &pub : topic.second.publishers)
     {
-      if ((*pubIter).second->GetId() == _connIter->second->GetId())
-      {
-        this->RemovePublisher((*pubIter).first);
-        done = false;
-        break;
-      }
-      else
-        ++pubIter;
+      if (pub.second->GetId() == _connIter->second->GetId())
+        pubs.push_back(pub.first);
     }
-  }
-
 
-  done = false;
-  while (!done)
-  {
-    done = true;
-
-    // Remove all subscribers for this connection
-    SubList::iterator subIter = this->dataPtr->subscribers.begin();
-    while (subIter != this->dataPtr->subscribers.end())
+    for (auto const &sub : topic.second.subscribers)
     {
-      if ((*subIter).second->GetId() == _connIter->second->GetId())
-      {
-        this->RemoveSubscriber((*subIter).first);
-        done = false;
-        break;
-      }
-      else
-        ++subIter;
+      if (sub.second->GetId() == _connIter->second->GetId())
+        subs.push_back(sub.first);
     }
+
+    topic.second.announced.erase(_connIter->first);
   }
 
+  this->dataPtr->clients.erase(_connIter->first);
+
+  // Remove all publishers for this connection
+  for (auto const &pub : pubs)
+    this->RemovePublisher(pub);
+
+  // Remove all subscribers for this connection
+  for (auto const &sub : subs)
+    this->RemoveSubscriber(sub);
+
   this->dataPtr->connections.erase(_connIter);
 }
 
 /////////////////////////////////////////////////
 void Master::RemovePublisher(const msgs::Publish _pub)
 {
-  {
-    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
-    Connection_M::iterator iter2;
-    for (iter2 = this->dataPtr->connections.begin();
-        iter2 != this->dataPtr->connections.end(); ++iter2)
-    {
-      iter2->second->EnqueueMsg(msgs::Package("publisher_del", _pub));
-    }
-  }
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
+
+  auto entry = this->dataPtr->topics.find(_pub.topic());
+  if (entry == this->dataPtr->topics.end())
+    return;
+
+  this->Announce("publishers_del", _pub);
 
   this->SendSubscribers(_pub.topic(), msgs::Package("unadvertise", _pub));
 
-  PubList::iterator pubIter = this->dataPtr->publishers.begin();
-  while (pubIter != this->dataPtr->publishers.end())
+  PubList &publishers = entry->second.publishers;
+  PubList::iterator pubIter = publishers.begin();
+  while (pubIter != publishers.end())
   {
-    if (pubIter->first.topic() == _pub.topic() &&
-        pubIter->first.host() == _pub.host() &&
+    if (pubIter->first.host() == _pub.host() &&
         pubIter->first.port() == _pub.port())
     {
-      pubIter = this->dataPtr->publishers.erase(pubIter);
+      pubIter = publishers.erase(pubIter);
     }
     else
       ++pubIter;
   }
+
+  if (publishers.empty())
+  {
+    if (entry->second.subscribers.empty())
+      this->dataPtr->topics.erase(entry);
+    else
+      entry->second.announced.clear();
+  }
 }
 
 /////////////////////////////////////////////////
 void Master::RemoveSubscriber(const msgs::Subscribe _sub)
 {
-  // Find all publishers of the topic, and remove the subscriptions
-  for (PubList::iterator iter = this->dataPtr->publishers.begin();
-      iter != this->dataPtr->publishers.end(); ++iter)
-  {
-    if (iter->first.topic() == _sub.topic())
-    {
-      iter->second->EnqueueMsg(msgs::Package("unsubscribe", _sub));
-    }
-  }
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
+
+  auto entry = this->dataPtr->topics.find(_sub.topic());
+  if (entry == this->dataPtr->topics.end())
+    return;
 
-  // Remove the subscribers from our list
-  SubList::iterator subiter = this->dataPtr->subscribers.begin();
-  while (subiter != this->dataPtr->subscribers.end())
+  // Find all publishers of the topic, and remove the subscriptions
+  for (auto const &pub : entry->second.publishers)
+    pub.second->EnqueueMsg(msgs::Package("unsubscribe", _sub));
+
+  // Remove the subscribers from our list. Clients that were told about
+  // the publishers stay in the announced set, so that they are told when
+  // the publishers go away.
+  SubList &subscribers = entry->second.subscribers;
+  SubList::iterator subiter = subscribers.begin();
+  while (subiter != subscribers.end())
   {
-    if (subiter->first.topic() == _sub.topic() &&
-        subiter->first.host() == _sub.host() &&
+    if (subiter->first.host() == _sub.host() &&
         subiter->first.port() == _sub.port())
     {
-      subiter = this->dataPtr->subscribers.erase(subiter);
+      subiter = subscribers.erase(subiter);
     }
     else
       ++subiter;
   }
+
+  if (subscribers.empty() && entry->second.publishers.empty())
+    this->dataPtr->topics.erase(entry);
 }
 
 //////////////////////////////////////////////////
@@ -575,11 +859,48 @@ void Master::Fini()
   delete this->dataPtr->runThread;
   this->dataPtr->runThread = NULL;
 
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->statsMutex);
+    if (this->dataPtr->stats.registrations > 0)
+    {
+      gzlog << "Master processed " << this->dataPtr->stats.registrations
+            << " registrations, latency mean["
+            << this->dataPtr->stats.meanLatency.Double() << "] max["
+            << this->dataPtr->stats.maxLatency.Double() << "] s, "
+            << this->dataPtr->stats.announcements << " announcements in "
+            << this->dataPtr->stats.batches << " batches, "
+            << this->dataPtr->stats.filtered << " filtered\n";
+    }
+  }
+
   this->dataPtr->msgs.clear();
+  this->dataPtr->unflushed.clear();
   this->dataPtr->worldNames.clear();
   this->dataPtr->connections.clear();
-  this->dataPtr->subscribers.clear();
-  this->dataPtr->publishers.clear();
+  this->dataPtr->clients.clear();
+  this->dataPtr->topics.clear();
+}
+
+//////////////////////////////////////////////////
+MasterStatistics Master::Statistics() const
+{
+  MasterStatistics stats;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->statsMutex);
+    stats = this->dataPtr->stats;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
+  stats.topics = this->dataPtr->topics.size();
+  return stats;
+}
+
+//////////////////////////////////////////////////
+void Master::ResetStatistics()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->statsMutex);
+  this->dataPtr->stats = MasterStatistics();
+  this->dataPtr->latencySum = 0;
 }
 
 //////////////////////////////////////////////////
@@ -587,17 +908,12 @@ msgs::Publish Master::GetPublisher(const std::string &_topic)
 {
   msgs::Publish msg;
 
-  PubList::iterator iter;
-
-  // Find all publishers of the topic
-  for (iter = this->dataPtr->publishers.begin();
-       iter != this->dataPtr->publishers.end(); ++iter)
+  // Find the first publisher of the topic
+  auto entry = this->dataPtr->topics.find(_topic);
+  if (entry != this->dataPtr->topics.end() &&
+      !entry->second.publishers.empty())
   {
-    if (iter->first.topic() == _topic)
-    {
-      msg = iter->first;
-      break;
-    }
+    msg = entry->second.publishers.front().first;
   }
 
   return msg;
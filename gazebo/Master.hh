@@ -24,6 +24,7 @@
 #include <map>
 #include <boost/shared_ptr.hpp>
 
+#include "gazebo/common/Time.hh"
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/transport/Connection.hh"
 #include "gazebo/util/system.hh"
@@ -33,9 +34,50 @@ namespace gazebo
   // Forward declare private data class
   struct MasterPrivate;
 
+  /// \brief Topic registration statistics of a Master.
+  struct GAZEBO_VISIBLE MasterStatistics
+  {
+    /// \brief Number of advertise, unadvertise and subscribe messages
+    /// processed.
+    uint64_t registrations = 0;
+
+    /// \brief Mean time between receiving a registration and handing the
+    /// resulting announcements to the client connections.
+    common::Time meanLatency;
+
+    /// \brief Largest registration latency.
+    common::Time maxLatency;
+
+    /// \brief Number of publishers announced to clients. A batch of
+    /// publishers counts once per publisher.
+    uint64_t announcements = 0;
+
+    /// \brief Number of batched announcement messages sent.
+    uint64_t batches = 0;
+
+    /// \brief Number of announcements not sent because the client is not
+    /// interested in the topic.
+    uint64_t filtered = 0;
+
+    /// \brief Number of topics with a publisher or a subscriber.
+    size_t topics = 0;
+  };
+
   /// \class Master Master.hh gazebo_core.hh
   /// \brief A manager that directs topic connections, enables each gazebo
   /// network client to locate one another for peer-to-peer communication.
+  ///
+  /// Publishers and subscribers are indexed by topic. By default every
+  /// client is told about every publisher, so that it can list all the
+  /// advertised topics. A client can instead send a "discovery_interest"
+  /// message with a list of topic namespaces, after which it is only told
+  /// about publishers in those namespaces and on topics it subscribes to.
+  ///
+  /// Publisher announcements are queued per client and sent once per
+  /// iteration of the master. A client that sends "announcement_batching",
+  /// or a discovery interest, gets them batched as "publishers_add" and
+  /// "publishers_del". Other clients get one "publisher_add" or
+  /// "publisher_del" per publisher, as before.
   class GAZEBO_VISIBLE Master
   {
     /// \def Map of unique id's to connections.
@@ -74,6 +116,14 @@ namespace gazebo
     /// \brief Stop the master
     public: void Stop();
 
+    /// \brief Get the topic registration statistics.
+    /// \return Statistics since the master started or the last call to
+    /// ResetStatistics.
+    public: MasterStatistics Statistics() const;
+
+    /// \brief Reset the topic registration statistics.
+    public: void ResetStatistics();
+
     /// \brief Finalize the master
     public: void Fini();
 
@@ -101,6 +151,25 @@ namespace gazebo
     /// \param[in] _newConnection The new connection
     private: void OnAccept(transport::ConnectionPtr _newConnection);
 
+    /// \brief Set the topic namespaces a client is interested in, and send
+    /// it the publishers it should know about.
+    /// \param[in] _connectionIndex Index of the client connection.
+    /// \param[in] _namespaces Topic namespaces.
+    private: void SetInterest(const unsigned int _connectionIndex,
+                              const msgs::GzString_V &_namespaces);
+
+    /// \brief Queue a publisher announcement for the clients that should
+    /// know about the publisher.
+    /// \param[in] _type "publishers_add" or "publishers_del", sent as
+    /// "publisher_add" or "publisher_del" to clients without batches.
+    /// \param[in] _pub The publisher.
+    private: void Announce(const std::string &_type,
+                           const msgs::Publish &_pub);
+
+    /// \brief Send the queued publisher announcements, and update the
+    /// registration latency.
+    private: void FlushAnnouncements();
+
     /// \brief Get a publisher for the given topic
     /// \param[in] _topic Name of the topic
     /// \return A publish message
@@ -45,6 +45,7 @@
 #include "gazebo/common/CommonIface.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Events.hh"
+#include "gazebo/common/Trace.hh"
 
 #include "gazebo/msgs/msgs.hh"
 
@@ -596,6 +597,9 @@ void Server::Run()
 
   this->dataPtr->initialized = true;
 
+  // Rendering sensors are updated from this thread
+  common::Trace::SetThreadName("rendering");
+
   // Stay on this loop until Gazebo needs to be shut down
   // The server and sensor manager outlive worlds
   while (!this->dataPtr->stop)
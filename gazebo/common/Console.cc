@@ -14,7 +14,18 @@
  * limitations under the License.
  *
  */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string/regex.hpp>
@@ -37,6 +48,506 @@ Logger Console::warn("[Wrn] ", 33, Logger::STDERR);
 
 bool Console::quiet = true;
 
+/// \brief Number of messages each thread can queue in asynchronous mode.
+static const size_t kThreadBufferSize = 1024;
+
+/// \brief Length of an unfinished line after which it is queued anyway.
+static const size_t kMaxPendingLength = 65536;
+
+/// \brief True if messages are written by the console writer.
+static std::atomic<bool> g_async(getenv("GAZEBO_CONSOLE_ASYNC") &&
+    std::string(getenv("GAZEBO_CONSOLE_ASYNC")) == "1");
+
+/// \brief Maximum number of messages per second and logger.
+static std::atomic<unsigned int> g_rateLimit(100);
+
+/// \brief Messages dropped because a thread buffer was full.
+static std::atomic<uint64_t> g_droppedMessages(0);
+
+/// \brief Messages suppressed by the rate limit or as repetitions.
+static std::atomic<uint64_t> g_suppressedMessages(0);
+
+/// \brief True once the console writer has been destroyed at exit, after
+/// which messages are written synchronously again.
+static std::atomic<bool> g_writerDestroyed(false);
+
+/// \brief True on the thread of the console writer, which writes
+/// synchronously.
+static thread_local bool g_writerThread = false;
+
+/// \brief Mutex to protect the log file stream.
+static std::mutex g_fileMutex;
+
+/// \brief Get the wall time, unlike Time::GetWallTime safe to call from
+/// several threads.
+/// \param[in] _time Time point of the system clock.
+/// \return The wall time.
+static Time WallTime(const std::chrono::system_clock::time_point &_time =
+    std::chrono::system_clock::now())
+{
+  const auto sinceEpoch = std::chrono::duration_cast<
+      std::chrono::nanoseconds>(_time.time_since_epoch()).count();
+  return Time(static_cast<int32_t>(sinceEpoch / 1000000000),
+      static_cast<int32_t>(sinceEpoch % 1000000000));
+}
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \internal
+    /// \brief Destination of a queued message.
+    enum ConsoleDest
+    {
+      /// \brief Terminal logger writing to stdout.
+      CONSOLE_STDOUT,
+
+      /// \brief Terminal logger writing to stderr.
+      CONSOLE_STDERR,
+
+      /// \brief File logger.
+      CONSOLE_FILE
+    };
+
+    /// \internal
+    /// \brief Complete lines logged by a thread, waiting to be written.
+    class ConsoleRecord
+    {
+      /// \brief Destination of the message.
+      public: ConsoleDest dest = CONSOLE_FILE;
+
+      /// \brief Color of the terminal output.
+      public: int color = 0;
+
+      /// \brief Wall time of the message, written in front of terminal
+      /// messages in the log file.
+      public: std::chrono::system_clock::time_point time;
+
+      /// \brief Text of the message, made of complete lines.
+      public: std::string text;
+    };
+
+    /// \internal
+    /// \brief Messages queued by one thread. The ring has a single producer,
+    /// the owning thread, and a single consumer, the console writer, so
+    /// neither side locks.
+    class ConsoleThreadBuffer
+    {
+      /// \brief Constructor.
+      public: ConsoleThreadBuffer()
+        : records(kThreadBufferSize)
+      {
+      }
+
+      /// \brief Queue a message, called by the owning thread.
+      /// \param[in] _record The message.
+      /// \return False if the ring is full.
+      public: bool Push(ConsoleRecord &_record)
+      {
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        if (tail - this->head.load(std::memory_order_acquire) >=
+            this->records.size())
+        {
+          return false;
+        }
+        std::swap(this->records[tail % this->records.size()], _record);
+        this->tail.store(tail + 1, std::memory_order_release);
+        return true;
+      }
+
+      /// \brief Take the oldest message, called by the console writer.
+      /// \param[out] _record The message.
+      /// \return False if the ring is empty.
+      public: bool Pop(ConsoleRecord &_record)
+      {
+        const size_t head = this->head.load(std::memory_order_relaxed);
+        if (head == this->tail.load(std::memory_order_acquire))
+          return false;
+        std::swap(this->records[head % this->records.size()], _record);
+        this->head.store(head + 1, std::memory_order_release);
+        return true;
+      }
+
+      /// \brief Ring of messages.
+      public: std::vector<ConsoleRecord> records;
+
+      /// \brief Number of messages taken by the console writer.
+      public: std::atomic<size_t> head{0};
+
+      /// \brief Number of messages queued by the owning thread.
+      public: std::atomic<size_t> tail{0};
+
+      /// \brief Unfinished line of each logger, only used by the owning
+      /// thread.
+      public: std::unordered_map<const void *, ConsoleRecord> pending;
+
+      /// \brief True once the owning thread has exited.
+      public: std::atomic<bool> closed{false};
+    };
+
+    /// \internal
+    /// \brief Background thread writing the messages of all the threads
+    /// in asynchronous mode.
+    class ConsoleWriter
+    {
+      /// \brief Get the writer.
+      /// \return The writer.
+      public: static ConsoleWriter &Instance()
+      {
+        static ConsoleWriter writer;
+        return writer;
+      }
+
+      /// \brief Destructor. Writes the remaining messages.
+      public: ~ConsoleWriter()
+      {
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->stop = true;
+        }
+        this->wakeCondition.notify_all();
+        if (this->thread.joinable())
+          this->thread.join();
+        g_writerDestroyed = true;
+      }
+
+      /// \brief Add characters to the unfinished line of a logger on the
+      /// calling thread.
+      /// \param[in] _source The logger buffer.
+      /// \param[in] _dest Destination of the logger.
+      /// \param[in] _color Color of the logger.
+      /// \param[in] _s Characters.
+      /// \param[in] _n Number of characters.
+      public: void Append(const void *_source, const ConsoleDest _dest,
+                  const int _color, const char *_s, const size_t _n)
+      {
+        ConsoleRecord &record = this->ThreadBuffer().pending[_source];
+        if (record.text.empty())
+        {
+          record.dest = _dest;
+          record.color = _color;
+          record.time = std::chrono::system_clock::now();
+        }
+        record.text.append(_s, _n);
+      }
+
+      /// \brief Queue the complete lines of a logger on the calling thread.
+      /// \param[in] _source The logger buffer.
+      public: void Sync(const void *_source)
+      {
+        ConsoleThreadBuffer &buffer = this->ThreadBuffer();
+        auto iter = buffer.pending.find(_source);
+        if (iter == buffer.pending.end())
+          return;
+
+        ConsoleRecord &pending = iter->second;
+        size_t end = pending.text.find_last_of('\n');
+        if (end == std::string::npos)
+        {
+          if (pending.text.size() < kMaxPendingLength)
+            return;
+          end = pending.text.size() - 1;
+        }
+
+        ConsoleRecord record;
+        record.dest = pending.dest;
+        record.color = pending.color;
+        record.time = pending.time;
+        record.text = pending.text.substr(0, end + 1);
+        pending.text.erase(0, end + 1);
+        pending.time = std::chrono::system_clock::now();
+
+        if (!buffer.Push(record))
+          ++g_droppedMessages;
+      }
+
+      /// \brief Block until the queued messages have been written.
+      public: void Flush()
+      {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        if (!this->thread.joinable())
+          return;
+
+        // Wait for a complete pass that started after this call
+        const uint64_t target = this->passes + 2;
+        this->flushRequested = true;
+        this->wakeCondition.notify_all();
+        this->passCondition.wait(lock, [this, target]
+            {
+              return this->passes >= target || this->stop;
+            });
+      }
+
+      /// \brief Get the buffer of the calling thread, registering it on
+      /// first use.
+      /// \return The buffer.
+      private: ConsoleThreadBuffer &ThreadBuffer()
+      {
+        /// \brief Owner of the buffer of a thread, closing it when the
+        /// thread exits.
+        class Handle
+        {
+          /// \brief Destructor. Queues the unfinished lines.
+          public: ~Handle()
+          {
+            if (!this->buffer)
+              return;
+            for (auto &pending : this->buffer->pending)
+            {
+              if (!pending.second.text.empty())
+                this->buffer->Push(pending.second);
+            }
+            this->buffer->closed = true;
+          }
+
+          /// \brief The buffer, shared with the console writer.
+          public: std::shared_ptr<ConsoleThreadBuffer> buffer;
+        };
+        static thread_local Handle handle;
+
+        if (!handle.buffer)
+        {
+          handle.buffer = std::make_shared<ConsoleThreadBuffer>();
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->buffers.push_back(handle.buffer);
+          if (!this->thread.joinable() && !this->stop)
+            this->thread = std::thread(&ConsoleWriter::Run, this);
+        }
+        return *handle.buffer;
+      }
+
+      /// \brief Main loop of the writer thread.
+      private: void Run()
+      {
+        g_writerThread = true;
+
+        std::unique_lock<std::mutex> lock(this->mutex);
+        while (!this->stop)
+        {
+          lock.unlock();
+          this->Pass();
+          lock.lock();
+
+          ++this->passes;
+          this->passCondition.notify_all();
+
+          this->wakeCondition.wait_for(lock, std::chrono::milliseconds(10),
+              [this] {return this->stop || this->flushRequested;});
+          this->flushRequested = false;
+        }
+        lock.unlock();
+
+        // Write what is left
+        this->Pass();
+        for (auto &stream : this->streams)
+          this->EndRepeats(stream.first, stream.second);
+        this->passCondition.notify_all();
+      }
+
+      /// \brief Write the queued messages of all the threads.
+      private: void Pass()
+      {
+        std::vector<std::shared_ptr<ConsoleThreadBuffer>> current;
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          current = this->buffers;
+        }
+
+        ConsoleRecord record;
+        for (auto &buffer : current)
+        {
+          // Read closed before draining, so that nothing queued before the
+          // thread exited is lost.
+          const bool closed = buffer->closed;
+          while (buffer->Pop(record))
+            this->Write(record);
+
+          if (closed)
+          {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->buffers.erase(std::remove(this->buffers.begin(),
+                  this->buffers.end(), buffer), this->buffers.end());
+          }
+        }
+
+        // Summaries of repeated and rate limited messages
+        const auto now = std::chrono::steady_clock::now();
+        for (auto &stream : this->streams)
+        {
+          if (now - stream.second.windowStart < std::chrono::seconds(1))
+            continue;
+
+          this->EndRepeats(stream.first, stream.second);
+          if (stream.second.limited > 0)
+          {
+            std::ostringstream text;
+            text << stream.second.limited << " messages suppressed by the "
+                 << "console rate limit\n";
+            this->Output(stream.first.first, stream.first.second,
+                std::chrono::system_clock::now(), text.str());
+            stream.second.limited = 0;
+          }
+          stream.second.windowStart = now;
+          stream.second.count = 0;
+        }
+
+        const uint64_t dropped = g_droppedMessages;
+        if (dropped > this->reportedDropped)
+        {
+          std::ostringstream text;
+          text << dropped - this->reportedDropped << " console messages "
+               << "dropped, the buffer of a thread was full\n";
+          this->Output(CONSOLE_STDERR, 31, std::chrono::system_clock::now(),
+              text.str());
+          this->reportedDropped = dropped;
+        }
+
+        std::cout.flush();
+        std::cerr.flush();
+      }
+
+      /// \brief Per logger state of the rate limit and of the collapsing of
+      /// repeated messages.
+      private: class Stream
+      {
+        /// \brief Last message written.
+        public: std::string last;
+
+        /// \brief Number of times the last message was repeated since it
+        /// was written.
+        public: uint64_t repeats = 0;
+
+        /// \brief Start of the current rate limit window.
+        public: std::chrono::steady_clock::time_point windowStart =
+                    std::chrono::steady_clock::now();
+
+        /// \brief Messages written in the current window.
+        public: unsigned int count = 0;
+
+        /// \brief Messages suppressed by the rate limit in the current
+        /// window.
+        public: uint64_t limited = 0;
+      };
+
+      /// \brief Key of a stream, the destination and color of a logger.
+      private: using StreamKey = std::pair<ConsoleDest, int>;
+
+      /// \brief Write a message, unless it repeats the previous one or
+      /// exceeds the rate limit.
+      /// \param[in] _record The message.
+      private: void Write(const ConsoleRecord &_record)
+      {
+        const StreamKey key(_record.dest, _record.color);
+        Stream &stream = this->streams[key];
+
+        if (_record.text == stream.last)
+        {
+          ++stream.repeats;
+          ++g_suppressedMessages;
+          return;
+        }
+        this->EndRepeats(key, stream);
+
+        const unsigned int rateLimit = g_rateLimit;
+        if (rateLimit > 0 && stream.count >= rateLimit)
+        {
+          ++stream.limited;
+          ++g_suppressedMessages;
+          return;
+        }
+        ++stream.count;
+
+        stream.last = _record.text;
+        this->Output(_record.dest, _record.color, _record.time,
+            _record.text);
+      }
+
+      /// \brief Write how many times the last message of a stream was
+      /// repeated, if it was.
+      /// \param[in] _key Key of the stream.
+      /// \param[in] _stream The stream.
+      private: void EndRepeats(const StreamKey &_key, Stream &_stream)
+      {
+        if (_stream.repeats > 0)
+        {
+          std::ostringstream text;
+          text << "Last message repeated " << _stream.repeats << " times\n";
+          this->Output(_key.first, _key.second,
+              std::chrono::system_clock::now(), text.str());
+        }
+        _stream.repeats = 0;
+        _stream.last.clear();
+      }
+
+      /// \brief Write text to the terminal and the log file, as the
+      /// loggers do in synchronous mode.
+      /// \param[in] _dest Destination.
+      /// \param[in] _color Color of the terminal output.
+      /// \param[in] _time Wall time of the message.
+      /// \param[in] _text Text to write.
+      private: void Output(const ConsoleDest _dest, const int _color,
+                   const std::chrono::system_clock::time_point &_time,
+                   const std::string &_text)
+      {
+        if (_dest == CONSOLE_FILE)
+        {
+          Console::log << _text;
+          return;
+        }
+
+        Console::log << "(" << WallTime(_time) << ") " << _text;
+
+        if (Console::GetQuiet())
+          return;
+
+        std::ostream &out = _dest == CONSOLE_STDOUT ? std::cout : std::cerr;
+        #ifndef _WIN32
+        out << "\033[1;" << _color << "m" << _text << "\033[0m";
+        #else
+        out << _text;
+        #endif
+      }
+
+      /// \brief Mutex to protect buffers, passes, flushRequested and stop.
+      private: std::mutex mutex;
+
+      /// \brief Wakes the writer thread up early.
+      private: std::condition_variable wakeCondition;
+
+      /// \brief Notified after each pass.
+      private: std::condition_variable passCondition;
+
+      /// \brief Buffers of the threads that log.
+      private: std::vector<std::shared_ptr<ConsoleThreadBuffer>> buffers;
+
+      /// \brief Writer thread, started by the first queued message.
+      private: std::thread thread;
+
+      /// \brief Number of passes over the buffers.
+      private: uint64_t passes = 0;
+
+      /// \brief True if Flush is waiting.
+      private: bool flushRequested = false;
+
+      /// \brief True to stop the writer thread.
+      private: bool stop = false;
+
+      /// \brief State of each logger, only used by the writer thread.
+      private: std::map<StreamKey, Stream> streams;
+
+      /// \brief Dropped messages already reported.
+      private: uint64_t reportedDropped = 0;
+    };
+  }
+}
+
+/// \brief Get whether the calling thread should queue its messages.
+/// \return True in asynchronous mode, except on the writer thread.
+static bool QueueMessages()
+{
+  return g_async && !g_writerThread && !g_writerDestroyed;
+}
+
 //////////////////////////////////////////////////
 void Console::SetQuiet(bool _quiet)
 {
@@ -49,6 +560,56 @@ bool Console::GetQuiet()
   return quiet;
 }
 
+//////////////////////////////////////////////////
+void Console::SetAsync(const bool _async)
+{
+  if (!_async && g_async)
+  {
+    g_async = false;
+    Console::Flush();
+    return;
+  }
+
+  g_async = _async;
+}
+
+//////////////////////////////////////////////////
+bool Console::Async()
+{
+  return g_async;
+}
+
+//////////////////////////////////////////////////
+void Console::SetRateLimit(const unsigned int _rate)
+{
+  g_rateLimit = _rate;
+}
+
+//////////////////////////////////////////////////
+unsigned int Console::RateLimit()
+{
+  return g_rateLimit;
+}
+
+//////////////////////////////////////////////////
+void Console::Flush()
+{
+  if (!g_writerDestroyed && !g_writerThread)
+    ConsoleWriter::Instance().Flush();
+}
+
+//////////////////////////////////////////////////
+uint64_t Console::DroppedMessageCount()
+{
+  return g_droppedMessages;
+}
+
+//////////////////////////////////////////////////
+uint64_t Console::SuppressedMessageCount()
+{
+  return g_suppressedMessages;
+}
+
 /////////////////////////////////////////////////
 Logger::Logger(const std::string &_prefix, int _color, LogType _type)
   : std::ostream(new Buffer(_type, _color)), color(_color), prefix(_prefix)
@@ -65,7 +626,9 @@ Logger::~Logger()
 /////////////////////////////////////////////////
 Logger &Logger::operator()()
 {
-  Console::log << "(" << Time::GetWallTime() << ") ";
+  // In asynchronous mode the console writer adds the time
+  if (!QueueMessages())
+    Console::log << "(" << WallTime() << ") ";
   (*this) << this->prefix;
 
   return (*this);
@@ -76,7 +639,8 @@ Logger &Logger::operator()(const std::string &_file, int _line)
 {
   int index = _file.find_last_of("/") + 1;
 
-  Console::log << "(" << Time::GetWallTime() << ") ";
+  if (!QueueMessages())
+    Console::log << "(" << WallTime() << ") ";
   std::stringstream prefixString;
   prefixString << this->prefix
     << "[" << _file.substr(index , _file.size() - index) << ":"
@@ -90,6 +654,9 @@ Logger &Logger::operator()(const std::string &_file, int _line)
 Logger::Buffer::Buffer(LogType _type, int _color)
   :  type(_type), color(_color)
 {
+  // Without a put area every character goes through overflow or xsputn,
+  // which queue it in asynchronous mode
+  this->setp(nullptr, nullptr);
 }
 
 /////////////////////////////////////////////////
@@ -106,9 +673,41 @@ Logger::Buffer::~Buffer()
   }
 }
 
+/////////////////////////////////////////////////
+Logger::Buffer::int_type Logger::Buffer::overflow(int_type _c)
+{
+  if (!QueueMessages())
+    return std::stringbuf::overflow(_c);
+
+  if (traits_type::eq_int_type(_c, traits_type::eof()))
+    return traits_type::not_eof(_c);
+
+  const char c = traits_type::to_char_type(_c);
+  ConsoleWriter::Instance().Append(this, this->type == Logger::STDOUT ?
+      CONSOLE_STDOUT : CONSOLE_STDERR, this->color, &c, 1);
+  return _c;
+}
+
+/////////////////////////////////////////////////
+std::streamsize Logger::Buffer::xsputn(const char *_s, std::streamsize _n)
+{
+  if (!QueueMessages())
+    return std::stringbuf::xsputn(_s, _n);
+
+  ConsoleWriter::Instance().Append(this, this->type == Logger::STDOUT ?
+      CONSOLE_STDOUT : CONSOLE_STDERR, this->color, _s, _n);
+  return _n;
+}
+
 /////////////////////////////////////////////////
 int Logger::Buffer::sync()
 {
+  if (QueueMessages())
+  {
+    ConsoleWriter::Instance().Sync(this);
+    return 0;
+  }
+
   // Log messages to disk
   Console::log << this->str();
   Console::log.flush();
@@ -135,6 +734,7 @@ int Logger::Buffer::sync()
   }
 
   this->str("");
+  this->setp(nullptr, nullptr);
   return 0;
 }
 
@@ -162,8 +762,12 @@ void FileLogger::Init(const std::string &_prefix, const std::string &_filename)
     return;
   }
 
+  // Messages queued for the previous file are written there
+  Console::Flush();
+
   FileLogger::Buffer *buf = static_cast<FileLogger::Buffer*>(
       this->rdbuf());
+  std::lock_guard<std::mutex> lock(g_fileMutex);
 
   boost::filesystem::path logPath(getenv("HOME"));
 
@@ -226,7 +830,7 @@ void FileLogger::Init(const std::string &_prefix, const std::string &_filename)
 /////////////////////////////////////////////////
 FileLogger &FileLogger::operator()()
 {
-  (*this) << "(" << Time::GetWallTime() << ") ";
+  (*this) << "(" << WallTime() << ") ";
   return (*this);
 }
 
@@ -234,7 +838,7 @@ FileLogger &FileLogger::operator()()
 FileLogger &FileLogger::operator()(const std::string &_file, int _line)
 {
   int index = _file.find_last_of("/") + 1;
-  (*this) << "(" << Time::GetWallTime() << ") ["
+  (*this) << "(" << WallTime() << ") ["
     << _file.substr(index , _file.size() - index) << ":" << _line << "]";
 
   return (*this);
@@ -271,6 +875,10 @@ FileLogger::Buffer::Buffer(const std::string &_filename)
   {
     this->stream = new std::ofstream(_filename.c_str(), std::ios::out);
   }
+
+  // Without a put area every character goes through overflow or xsputn,
+  // which queue it in asynchronous mode
+  this->setp(nullptr, nullptr);
 }
 
 /////////////////////////////////////////////////
@@ -288,9 +896,41 @@ FileLogger::Buffer::~Buffer()
   }
 }
 
+/////////////////////////////////////////////////
+FileLogger::Buffer::int_type FileLogger::Buffer::overflow(int_type _c)
+{
+  if (!QueueMessages())
+    return std::stringbuf::overflow(_c);
+
+  if (traits_type::eq_int_type(_c, traits_type::eof()))
+    return traits_type::not_eof(_c);
+
+  const char c = traits_type::to_char_type(_c);
+  ConsoleWriter::Instance().Append(this, CONSOLE_FILE, 0, &c, 1);
+  return _c;
+}
+
+/////////////////////////////////////////////////
+std::streamsize FileLogger::Buffer::xsputn(const char *_s,
+    std::streamsize _n)
+{
+  if (!QueueMessages())
+    return std::stringbuf::xsputn(_s, _n);
+
+  ConsoleWriter::Instance().Append(this, CONSOLE_FILE, 0, _s, _n);
+  return _n;
+}
+
 /////////////////////////////////////////////////
 int FileLogger::Buffer::sync()
 {
+  if (QueueMessages())
+  {
+    ConsoleWriter::Instance().Sync(this);
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> lock(g_fileMutex);
   if (!this->stream)
     return -1;
 
@@ -299,5 +939,6 @@ int FileLogger::Buffer::sync()
   this->stream->flush();
 
   this->str("");
+  this->setp(nullptr, nullptr);
   return !(*this->stream);
 }
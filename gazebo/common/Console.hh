@@ -18,6 +18,7 @@
 #ifndef _GAZEBO_CONSOLE_HH_
 #define _GAZEBO_CONSOLE_HH_
 
+#include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -122,6 +123,20 @@ namespace gazebo
                    /// \return Return 0 on success.
                    public: virtual int sync();
 
+                   /// \brief Write a character, into the buffer of the
+                   /// calling thread if the console is asynchronous.
+                   /// \param[in] _c Character to write.
+                   /// \return _c, or EOF on failure.
+                   protected: virtual int_type overflow(int_type _c);
+
+                   /// \brief Write characters, into the buffer of the
+                   /// calling thread if the console is asynchronous.
+                   /// \param[in] _s Characters to write.
+                   /// \param[in] _n Number of characters.
+                   /// \return Number of characters written.
+                   protected: virtual std::streamsize xsputn(const char *_s,
+                                  std::streamsize _n);
+
                    /// \brief Stream to output information into.
                    public: std::ofstream *stream;
                  };
@@ -183,6 +198,20 @@ namespace gazebo
                    /// \return Return 0 on success.
                    public: virtual int sync();
 
+                   /// \brief Write a character, into the buffer of the
+                   /// calling thread if the console is asynchronous.
+                   /// \param[in] _c Character to write.
+                   /// \return _c, or EOF on failure.
+                   protected: virtual int_type overflow(int_type _c);
+
+                   /// \brief Write characters, into the buffer of the
+                   /// calling thread if the console is asynchronous.
+                   /// \param[in] _s Characters to write.
+                   /// \param[in] _n Number of characters.
+                   /// \return Number of characters written.
+                   protected: virtual std::streamsize xsputn(const char *_s,
+                                  std::streamsize _n);
+
                    /// \brief Destination type for the messages.
                    public: LogType type;
 
@@ -202,6 +231,15 @@ namespace gazebo
     /// \class Console Console.hh common/common.hh
     /// \brief Container for loggers, and global logging options
     /// (such as verbose vs. quiet output).
+    ///
+    /// By default messages are written to the terminal and the log file
+    /// by the thread that logs them. In asynchronous mode, enabled with
+    /// SetAsync or by setting the GAZEBO_CONSOLE_ASYNC environment
+    /// variable to 1, each thread queues its complete lines without
+    /// locking and a background thread writes them. The background thread
+    /// also collapses consecutive identical messages of a logger and
+    /// limits the number of messages of each logger per second, see
+    /// SetRateLimit.
     class GZ_COMMON_VISIBLE Console
     {
       /// \brief Set quiet output.
@@ -212,6 +250,42 @@ namespace gazebo
       /// \return True to if quiet output is set.
       public: static bool GetQuiet();
 
+      /// \brief Set whether messages are written by a background thread.
+      /// This should be set before other threads start logging. Pending
+      /// messages are flushed when asynchronous mode is disabled.
+      /// \param[in] _async True to write messages asynchronously.
+      public: static void SetAsync(const bool _async);
+
+      /// \brief Get whether messages are written by a background thread.
+      /// \return True if messages are written asynchronously.
+      public: static bool Async();
+
+      /// \brief Set the maximum number of messages written per second for
+      /// each logger in asynchronous mode. Extra messages are counted and
+      /// summarized once per second. The default is 100.
+      /// \param[in] _rate Messages per second, 0 for no limit.
+      public: static void SetRateLimit(const unsigned int _rate);
+
+      /// \brief Get the maximum number of messages written per second for
+      /// each logger in asynchronous mode.
+      /// \return Messages per second, 0 if there is no limit.
+      public: static unsigned int RateLimit();
+
+      /// \brief Block until the messages queued by all the threads in
+      /// asynchronous mode have been written.
+      public: static void Flush();
+
+      /// \brief Get the number of messages dropped in asynchronous mode
+      /// because the buffer of the logging thread was full.
+      /// \return Number of dropped messages.
+      public: static uint64_t DroppedMessageCount();
+
+      /// \brief Get the number of messages not written in asynchronous
+      /// mode because of the rate limit or because they repeated the
+      /// previous message.
+      /// \return Number of suppressed messages.
+      public: static uint64_t SuppressedMessageCount();
+
       /// \brief Global instance of the message logger.
       public: static Logger msg;
 
@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
 #include <stdlib.h>
+#include <thread>
+#include <vector>
 
 #include "gazebo/common/Time.hh"
 #include "gazebo/common/Console.hh"
@@ -274,6 +276,83 @@ TEST_F(Console_TEST, ColorErr)
   EXPECT_TRUE(logContent.find(logString) != std::string::npos);
 }
 
+/////////////////////////////////////////////////
+/// \brief Test asynchronous logging from several threads
+TEST_F(Console_TEST, Async)
+{
+  gazebo::common::Console::SetRateLimit(0);
+  gazebo::common::Console::SetAsync(true);
+  EXPECT_TRUE(gazebo::common::Console::Async());
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.push_back(std::thread([t]()
+        {
+          for (int i = 0; i < 50; ++i)
+          {
+            gzlog << "async log " << t << " " << i << std::endl;
+            gzmsg << "async msg " << t << " " << i << std::endl;
+          }
+        }));
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  gazebo::common::Console::Flush();
+  gazebo::common::Console::SetAsync(false);
+  gazebo::common::Console::SetRateLimit(100);
+  EXPECT_FALSE(gazebo::common::Console::Async());
+  EXPECT_EQ(0u, gazebo::common::Console::DroppedMessageCount());
+
+  std::string logContent = this->GetLogContent();
+  for (int t = 0; t < 4; ++t)
+  {
+    for (int i = 0; i < 50; ++i)
+    {
+      std::ostringstream log;
+      log << "async log " << t << " " << i;
+      EXPECT_TRUE(logContent.find(log.str()) != std::string::npos);
+
+      std::ostringstream msg;
+      msg << "async msg " << t << " " << i;
+      EXPECT_TRUE(logContent.find(msg.str()) != std::string::npos);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Test collapsing of repeated messages and the rate limit
+TEST_F(Console_TEST, AsyncRepeatAndRateLimit)
+{
+  gazebo::common::Console::SetRateLimit(10);
+  EXPECT_EQ(10u, gazebo::common::Console::RateLimit());
+  gazebo::common::Console::SetAsync(true);
+
+  const uint64_t suppressed =
+    gazebo::common::Console::SuppressedMessageCount();
+  for (int i = 0; i < 50; ++i)
+    gzwarn << "repeated warning" << std::endl;
+  gazebo::common::Console::Flush();
+  EXPECT_EQ(suppressed + 49,
+      gazebo::common::Console::SuppressedMessageCount());
+
+  for (int i = 0; i < 50; ++i)
+    gzwarn << "distinct warning " << i << std::endl;
+
+  gazebo::common::Console::Flush();
+  gazebo::common::Console::SetAsync(false);
+  gazebo::common::Console::SetRateLimit(100);
+  EXPECT_GT(gazebo::common::Console::SuppressedMessageCount(),
+      suppressed + 49);
+
+  std::string logContent = this->GetLogContent();
+  EXPECT_TRUE(logContent.find("Last message repeated 49 times") !=
+      std::string::npos);
+  EXPECT_TRUE(logContent.find("distinct warning 0") != std::string::npos);
+  EXPECT_TRUE(logContent.find("distinct warning 49") == std::string::npos);
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
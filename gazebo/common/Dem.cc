@@ -16,6 +16,8 @@
 */
 
 #include <algorithm>
+#include <functional>
+#include <sstream>
 #include <boost/filesystem.hpp>
 #include <gazebo/gazebo_config.h>
 
@@ -32,12 +34,34 @@
 #include "gazebo/common/DemPrivate.hh"
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/SphericalCoordinates.hh"
+#include "gazebo/common/SystemPaths.hh"
 
 using namespace gazebo;
 using namespace common;
 
 #ifdef HAVE_GDAL
 
+namespace
+{
+  /// \brief Get the nodata value of a band.
+  /// \param[in] _band The band.
+  /// \return Elevations lower or equal to this value are nodata.
+  double NoDataValue(GDALRasterBand *_band)
+  {
+    // Check for nodata value in dem data. This is used when computing the
+    // min elevation. If nodata value is not defined, we assume it will be
+    // one of the commonly used values such as -9999, -32768, etc.
+    // For simplicity, we will treat values <= -9999 as nodata values and
+    // ignore them when computing the min elevation.
+    int validNoData = 0;
+    const double defaultNoDataValue = -9999;
+    double noDataValue = _band->GetNoDataValue(&validNoData);
+    if (validNoData <= 0)
+      noDataValue = defaultNoDataValue;
+    return noDataValue;
+  }
+}
+
 //////////////////////////////////////////////////
 Dem::Dem()
   : dataPtr(new DemPrivate)
@@ -59,10 +83,8 @@ Dem::~Dem()
 }
 
 //////////////////////////////////////////////////
-int Dem::Load(const std::string &_filename)
+int Dem::Open(const std::string &_filename, std::string &_fullName)
 {
-  unsigned int width;
-  unsigned int height;
   int xSize, ySize;
   double upLeftX, upLeftY, upRightX, upRightY, lowLeftX, lowLeftY;
   ignition::math::Angle upLeftLat, upLeftLong, upRightLat, upRightLong;
@@ -126,6 +148,23 @@ int Dem::Load(const std::string &_filename)
      common::SphericalCoordinates::Distance(upLeftLat, upLeftLong,
                                             lowLeftLat, lowLeftLong);
 
+  _fullName = fullName;
+  return 0;
+}
+
+//////////////////////////////////////////////////
+int Dem::Load(const std::string &_filename)
+{
+  unsigned int width;
+  unsigned int height;
+
+  std::string fullName;
+  if (this->Open(_filename, fullName) != 0)
+    return -1;
+
+  int xSize = this->dataPtr->dataSet->GetRasterXSize();
+  int ySize = this->dataPtr->dataSet->GetRasterYSize();
+
   // Set the terrain's side (the terrain will be squared after the padding)
   if (ignition::math::isPowerOfTwo(ySize - 1))
     height = ySize;
@@ -143,16 +182,7 @@ int Dem::Load(const std::string &_filename)
   if (this->LoadData() != 0)
     return -1;
 
-  // Check for nodata value in dem data. This is used when computing the
-  // min elevation. If nodata value is not defined, we assume it will be one
-  // of the commonly used values such as -9999, -32768, etc.
-  // For simplicity, we will treat values <= -9999 as nodata values and
-  // ignore them when computing the min elevation.
-  int validNoData = 0;
-  const double defaultNoDataValue = -9999;
-  double noDataValue = this->dataPtr->band->GetNoDataValue(&validNoData);
-  if (validNoData <= 0)
-    noDataValue = defaultNoDataValue;
+  double noDataValue = NoDataValue(this->dataPtr->band);
 
   double min = ignition::math::MAX_D;
   double max = -ignition::math::MAX_D;
@@ -173,6 +203,101 @@ int Dem::Load(const std::string &_filename)
   return 0;
 }
 
+//////////////////////////////////////////////////
+int Dem::LoadTiles(const std::string &_filename,
+    const unsigned int _tileSize)
+{
+  if (_tileSize == 0)
+  {
+    gzerr << "Illegal DEM tile size (" << _tileSize << ")\n";
+    return -1;
+  }
+
+  std::string fullName;
+  if (this->Open(_filename, fullName) != 0)
+    return -1;
+
+  unsigned int xSize = this->dataPtr->dataSet->GetRasterXSize();
+  unsigned int ySize = this->dataPtr->dataSet->GetRasterYSize();
+  if (xSize == 0 || ySize == 0)
+  {
+    gzerr << "Illegal size loading a DEM file (" << xSize << ","
+          << ySize << ")\n";
+    return -1;
+  }
+
+  this->dataPtr->side = std::max(xSize, ySize);
+
+  // One tile file per DEM file and tile size, rebuilt when the DEM file
+  // changes
+  boost::filesystem::path path(fullName);
+  boost::system::error_code ec;
+  const std::string canonical = boost::filesystem::canonical(path, ec).string();
+  std::ostringstream source;
+  source << canonical << ":" << boost::filesystem::file_size(path, ec) << ":"
+         << boost::filesystem::last_write_time(path, ec);
+  const uint64_t stamp = std::hash<std::string>()(source.str());
+
+  boost::filesystem::path cachePath =
+      common::SystemPaths::Instance()->GetLogPath() / "dem_tiles";
+  boost::filesystem::create_directories(cachePath, ec);
+  std::ostringstream cacheName;
+  cacheName << path.stem().string() << "_" << std::hex
+            << std::hash<std::string>()(canonical) << std::dec << "_"
+            << _tileSize << ".tiles";
+  cachePath /= cacheName.str();
+
+  this->dataPtr->tiles.reset(new HeightmapTiles());
+  HeightmapTiles &tiles = *this->dataPtr->tiles;
+
+  if (!tiles.Load(cachePath.string()) || tiles.Stamp() != stamp ||
+      tiles.Width() != xSize || tiles.Height() != ySize)
+  {
+    gzmsg << "Converting DEM file[" << fullName << "] into tiles["
+          << cachePath.string() << "]" << std::endl;
+
+    GDALRasterBand *band = this->dataPtr->band;
+    auto read = [band](unsigned int _x, unsigned int _y, unsigned int _w,
+        unsigned int _h, unsigned int _outW, unsigned int _outH, float *_out)
+    {
+      return band->RasterIO(GF_Read, _x, _y, _w, _h, _out, _outW, _outH,
+          GDT_Float32, 0, 0) == CE_None;
+    };
+
+    if (!HeightmapTiles::Build(cachePath.string(), xSize, ySize, _tileSize,
+          stamp, NoDataValue(band), read) || !tiles.Load(cachePath.string()))
+    {
+      gzerr << "Unable to convert DEM file[" << fullName << "] into tiles\n";
+      this->dataPtr->tiles.reset();
+      return -1;
+    }
+  }
+
+  this->dataPtr->minElevation = tiles.MinElevation();
+  this->dataPtr->maxElevation = tiles.MaxElevation();
+
+  return 0;
+}
+
+//////////////////////////////////////////////////
+const HeightmapTiles *Dem::Tiles() const
+{
+  return this->dataPtr->tiles.get();
+}
+
+//////////////////////////////////////////////////
+float Dem::Sample(const unsigned int _x, const unsigned int _y) const
+{
+  if (!this->dataPtr->tiles)
+    return this->dataPtr->demData[_y * this->dataPtr->side + _x];
+
+  // Tiles are not padded, the padding is at the minimum elevation
+  const HeightmapTiles &tiles = *this->dataPtr->tiles;
+  if (_x >= tiles.Width() || _y >= tiles.Height())
+    return this->dataPtr->minElevation;
+  return tiles.Sample(_x, _y);
+}
+
 //////////////////////////////////////////////////
 double Dem::GetElevation(double _x, double _y)
 {
@@ -183,7 +308,8 @@ double Dem::GetElevation(double _x, double _y)
            " x " << this->GetHeight() << "]\n");
   }
 
-  return this->dataPtr->demData.at(_y * this->GetWidth() + _x);
+  return this->Sample(static_cast<unsigned int>(_x),
+      static_cast<unsigned int>(_y));
 }
 
 //////////////////////////////////////////////////
@@ -278,42 +404,9 @@ void Dem::FillHeightMap(int _subSampling, unsigned int _vertSize,
   // Iterate over all the vertices
   for (unsigned int y = 0; y < _vertSize; ++y)
   {
-    double yf = y / static_cast<double>(_subSampling);
-    unsigned int y1 = floor(yf);
-    unsigned int y2 = ceil(yf);
-    if (y2 >= this->dataPtr->side)
-      y2 = this->dataPtr->side - 1;
-    double dy = yf - y1;
-
     for (unsigned int x = 0; x < _vertSize; ++x)
     {
-      double xf = x / static_cast<double>(_subSampling);
-      unsigned int x1 = floor(xf);
-      unsigned int x2 = ceil(xf);
-      if (x2 >= this->dataPtr->side)
-        x2 = this->dataPtr->side - 1;
-      double dx = xf - x1;
-
-      double px1 = this->dataPtr->demData[y1 * this->dataPtr->side + x1];
-      double px2 = this->dataPtr->demData[y1 * this->dataPtr->side + x2];
-      float h1 = (px1 - ((px1 - px2) * dx));
-
-      double px3 = this->dataPtr->demData[y2 * this->dataPtr->side + x1];
-      double px4 = this->dataPtr->demData[y2 * this->dataPtr->side + x2];
-      float h2 = (px3 - ((px3 - px4) * dx));
-
-      float h = this->dataPtr->minElevation +
-          (h1 - ((h1 - h2) * dy) - this->dataPtr->minElevation) * _scale.Z();
-
-      // Invert pixel definition so 1=ground, 0=full height,
-      // if the terrain size has a negative z component
-      // this is mainly for backward compatibility
-      if (_size.Z() < 0)
-        h *= -1;
-
-      // Convert to minElevation if a NODATA value is found
-      if (_size.Z() >= 0 && h < this->dataPtr->minElevation)
-        h = this->dataPtr->minElevation;
+      float h = this->VertexHeight(_subSampling, x, y, _size, _scale);
 
       // Store the height for future use
       if (!_flipY)
@@ -324,6 +417,75 @@ void Dem::FillHeightMap(int _subSampling, unsigned int _vertSize,
   }
 }
 
+//////////////////////////////////////////////////
+void Dem::FillHeightMapRegion(const int _subSampling,
+    const unsigned int _x, const unsigned int _y,
+    const unsigned int _width, const unsigned int _height,
+    const ignition::math::Vector3d &_size,
+    const ignition::math::Vector3d &_scale,
+    std::vector<float> &_heights) const
+{
+  if (_subSampling <= 0)
+  {
+    gzerr << "Illegal subsampling value (" << _subSampling << ")\n";
+    return;
+  }
+
+  _heights.resize(_width * _height);
+
+  for (unsigned int y = 0; y < _height; ++y)
+  {
+    for (unsigned int x = 0; x < _width; ++x)
+    {
+      _heights[y * _width + x] =
+          this->VertexHeight(_subSampling, _x + x, _y + y, _size, _scale);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+float Dem::VertexHeight(const int _subSampling, const unsigned int _x,
+    const unsigned int _y, const ignition::math::Vector3d &_size,
+    const ignition::math::Vector3d &_scale) const
+{
+  double yf = _y / static_cast<double>(_subSampling);
+  unsigned int y1 = std::min<unsigned int>(floor(yf), this->dataPtr->side - 1);
+  unsigned int y2 = ceil(yf);
+  if (y2 >= this->dataPtr->side)
+    y2 = this->dataPtr->side - 1;
+  double dy = yf - y1;
+
+  double xf = _x / static_cast<double>(_subSampling);
+  unsigned int x1 = std::min<unsigned int>(floor(xf), this->dataPtr->side - 1);
+  unsigned int x2 = ceil(xf);
+  if (x2 >= this->dataPtr->side)
+    x2 = this->dataPtr->side - 1;
+  double dx = xf - x1;
+
+  double px1 = this->Sample(x1, y1);
+  double px2 = this->Sample(x2, y1);
+  float h1 = (px1 - ((px1 - px2) * dx));
+
+  double px3 = this->Sample(x1, y2);
+  double px4 = this->Sample(x2, y2);
+  float h2 = (px3 - ((px3 - px4) * dx));
+
+  float h = this->dataPtr->minElevation +
+      (h1 - ((h1 - h2) * dy) - this->dataPtr->minElevation) * _scale.Z();
+
+  // Invert pixel definition so 1=ground, 0=full height,
+  // if the terrain size has a negative z component
+  // this is mainly for backward compatibility
+  if (_size.Z() < 0)
+    h *= -1;
+
+  // Convert to minElevation if a NODATA value is found
+  if (_size.Z() >= 0 && h < this->dataPtr->minElevation)
+    h = this->dataPtr->minElevation;
+
+  return h;
+}
+
 //////////////////////////////////////////////////
 int Dem::LoadData()
 {
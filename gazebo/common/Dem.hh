@@ -54,6 +54,25 @@ namespace gazebo
       /// \return 0 when the operation succeeds to open a file.
       public: int Load(const std::string &_filename="");
 
+      /// \brief Load a DEM file without reading it in memory. The first
+      /// time a file is loaded, it is converted into a tile pyramid stored
+      /// in the "dem_tiles" directory of the log path, which is then memory
+      /// mapped. The conversion is redone when the DEM file changes.
+      ///
+      /// Unlike Load, the terrain is neither resampled nor padded to a
+      /// power of two plus one, GetWidth and GetHeight return the largest
+      /// side of the raster and samples past the raster are at the minimum
+      /// elevation.
+      /// \param[in] _filename the path to the terrain file.
+      /// \param[in] _tileSize Number of sample intervals per tile side.
+      /// \return 0 when the operation succeeds to open a file.
+      public: int LoadTiles(const std::string &_filename,
+                  const unsigned int _tileSize = 256);
+
+      /// \brief Get the tile pyramid loaded by LoadTiles.
+      /// \return The tiles, or nullptr if the DEM was loaded by Load.
+      public: const HeightmapTiles *Tiles() const;
+
       /// \brief Get the elevation of a terrain's point in meters.
       /// \param[in] _x X coordinate of the terrain.
       /// \param[in] _y Y coordinate of the terrain.
@@ -118,6 +137,24 @@ namespace gazebo
                   const bool _flipY,
                   std::vector<float> &_heights);
 
+      /// \brief Fill a rectangular region of the lookup table created by
+      /// FillHeightMap, without flipping. This is used to page parts of
+      /// a large terrain.
+      /// \param[in] _subSampling Multiplier used to increase the resolution.
+      /// \param[in] _x Column of the first vertex of the region.
+      /// \param[in] _y Row of the first vertex of the region.
+      /// \param[in] _width Number of vertices per row of the region.
+      /// \param[in] _height Number of rows of the region.
+      /// \param[in] _size Real dimmensions of the terrain in meters.
+      /// \param[in] _scale Vector3 used to scale the height.
+      /// \param[out] _heights Vector containing the region heights.
+      public: void FillHeightMapRegion(const int _subSampling,
+                  const unsigned int _x, const unsigned int _y,
+                  const unsigned int _width, const unsigned int _height,
+                  const ignition::math::Vector3d &_size,
+                  const ignition::math::Vector3d &_scale,
+                  std::vector<float> &_heights) const;
+
       /// \brief Get the georeferenced coordinates (lat, long) of a terrain's
       /// pixel in WGS84.
       /// \param[in] _x X coordinate of the terrain.
@@ -134,6 +171,32 @@ namespace gazebo
       /// \return 0 when the operation succeeds to open a file.
       private: int LoadData();
 
+      /// \brief Open a DEM file and read its georeferenced size.
+      /// \param[in] _filename the path to the terrain file.
+      /// \param[out] _fullName the resolved path to the terrain file.
+      /// \return 0 when the operation succeeds to open a file.
+      private: int Open(const std::string &_filename, std::string &_fullName);
+
+      /// \brief Get a sample of the terrain.
+      /// \param[in] _x Column, less than GetWidth().
+      /// \param[in] _y Row, less than GetHeight().
+      /// \return Elevation in meters.
+      private: float Sample(const unsigned int _x,
+                   const unsigned int _y) const;
+
+      /// \brief Get the height of a vertex of the lookup table created by
+      /// FillHeightMap.
+      /// \param[in] _subSampling Multiplier used to increase the resolution.
+      /// \param[in] _x Column of the vertex.
+      /// \param[in] _y Row of the vertex.
+      /// \param[in] _size Real dimmensions of the terrain in meters.
+      /// \param[in] _scale Vector3 used to scale the height.
+      /// \return The height.
+      private: float VertexHeight(const int _subSampling,
+                   const unsigned int _x, const unsigned int _y,
+                   const ignition::math::Vector3d &_size,
+                   const ignition::math::Vector3d &_scale) const;
+
       /// internal
       /// \brief Pointer to the private data.
       private: DemPrivate *dataPtr;
@@ -23,8 +23,11 @@
 
 #ifdef HAVE_GDAL
 # include <gdal_priv.h>
+# include <memory>
 # include <vector>
 
+# include "gazebo/common/HeightmapTiles.hh"
+
 namespace gazebo
 {
   namespace common
@@ -59,6 +62,9 @@ namespace gazebo
 
       /// \brief DEM data converted to be OGRE-compatible.
       public: std::vector<float> demData;
+
+      /// \brief Tile pyramid used instead of demData by LoadTiles.
+      public: std::unique_ptr<HeightmapTiles> tiles;
     };
     /// \}
   }
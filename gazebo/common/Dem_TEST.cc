@@ -22,6 +22,7 @@
 #include <ignition/math/Vector3.hh>
 
 #include "gazebo/common/Dem.hh"
+#include "gazebo/common/HeightmapTiles.hh"
 #include "test_config.h"
 #include "test/util.hh"
 
@@ -167,6 +168,69 @@ TEST_F(DemTest, FillHeightmap)
   EXPECT_FLOAT_EQ(213.42966, elevations.at(elevations.size() / 2));
 }
 
+/////////////////////////////////////////////////
+TEST_F(DemTest, Tiles)
+{
+  boost::filesystem::path path = TEST_PATH;
+  path /= "data/dem_squared.tif";
+
+  common::Dem dem;
+  EXPECT_EQ(dem.Load(path.string()), 0);
+  EXPECT_EQ(nullptr, dem.Tiles());
+
+  common::Dem tiledDem;
+  EXPECT_NE(tiledDem.LoadTiles(path.string(), 0), 0);
+  EXPECT_EQ(tiledDem.LoadTiles(path.string(), 32), 0);
+
+  // 128 intervals need 4x4 tiles of 32, then 2x2 tiles and a single tile
+  const common::HeightmapTiles *tiles = tiledDem.Tiles();
+  ASSERT_NE(nullptr, tiles);
+  EXPECT_EQ(3u, tiles->Levels());
+  EXPECT_EQ(4u, tiles->TilesX(0));
+  EXPECT_EQ(2u, tiles->TilesY(1));
+
+  // The 129x129 DEM is not resampled, both modes have the same data
+  EXPECT_EQ(dem.GetWidth(), tiledDem.GetWidth());
+  EXPECT_EQ(dem.GetHeight(), tiledDem.GetHeight());
+  EXPECT_FLOAT_EQ(dem.GetMinElevation(), tiledDem.GetMinElevation());
+  EXPECT_FLOAT_EQ(dem.GetMaxElevation(), tiledDem.GetMaxElevation());
+  EXPECT_FLOAT_EQ(dem.GetWorldWidth(), tiledDem.GetWorldWidth());
+  for (unsigned int i = 0; i < dem.GetWidth(); i += 7)
+  {
+    EXPECT_FLOAT_EQ(dem.GetElevation(i, 128 - i),
+        tiledDem.GetElevation(i, 128 - i));
+  }
+
+  int subsampling = 2;
+  unsigned int vertSize = (dem.GetWidth() * subsampling) - 1;
+  ignition::math::Vector3d size(dem.GetWorldWidth(), dem.GetWorldHeight(),
+      dem.GetMaxElevation() - dem.GetMinElevation());
+  ignition::math::Vector3d scale(size.X() / vertSize, size.Y() / vertSize,
+      1.0);
+
+  std::vector<float> elevations;
+  std::vector<float> tiledElevations;
+  dem.FillHeightMap(subsampling, vertSize, size, scale, false, elevations);
+  tiledDem.FillHeightMap(subsampling, vertSize, size, scale, false,
+      tiledElevations);
+  EXPECT_EQ(elevations, tiledElevations);
+
+  // A region is a part of the full heightmap
+  std::vector<float> region;
+  tiledDem.FillHeightMapRegion(subsampling, 64, 100, 65, 20, size, scale,
+      region);
+  ASSERT_EQ(65u * 20u, region.size());
+  EXPECT_FLOAT_EQ(elevations[100 * vertSize + 64], region[0]);
+  EXPECT_FLOAT_EQ(elevations[119 * vertSize + 128], region[19 * 65 + 64]);
+
+  // The tiles are converted once
+  common::Dem cachedDem;
+  EXPECT_EQ(cachedDem.LoadTiles(path.string(), 32), 0);
+  ASSERT_NE(nullptr, cachedDem.Tiles());
+  EXPECT_EQ(tiles->Stamp(), cachedDem.Tiles()->Stamp());
+  EXPECT_FLOAT_EQ(dem.GetElevation(10, 20), cachedDem.GetElevation(10, 20));
+}
+
 /////////////////////////////////////////////////
 TEST_F(DemTest, NegDem)
 {
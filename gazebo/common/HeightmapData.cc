@@ -53,10 +53,12 @@ HeightmapData *HeightmapDataLoader::LoadImageAsTerrain(
 #ifdef HAVE_GDAL
 //////////////////////////////////////////////////
 HeightmapData *HeightmapDataLoader::LoadDEMAsTerrain(
-    const std::string &_filename)
+    const std::string &_filename, const unsigned int _tileSize)
 {
   Dem *dem = new Dem();
-  if (dem->Load(_filename) != 0)
+  int result = _tileSize > 0 ? dem->LoadTiles(_filename, _tileSize) :
+      dem->Load(_filename);
+  if (result != 0)
   {
     gzerr << "Unable to load a DEM file as a terrain [" << _filename << "]\n";
     return nullptr;
@@ -66,7 +68,7 @@ HeightmapData *HeightmapDataLoader::LoadDEMAsTerrain(
 
 //////////////////////////////////////////////////
 HeightmapData *HeightmapDataLoader::LoadTerrainFile(
-    const std::string &_filename)
+    const std::string &_filename, const unsigned int _tileSize)
 {
   // Register the GDAL drivers
   GDALAllRegister();
@@ -92,12 +94,12 @@ HeightmapData *HeightmapDataLoader::LoadTerrainFile(
   else
   {
     // Load the terrain file as a DEM
-    return LoadDEMAsTerrain(_filename);
+    return LoadDEMAsTerrain(_filename, _tileSize);
   }
 }
 #else
 HeightmapData *HeightmapDataLoader::LoadTerrainFile(
-    const std::string &_filename)
+    const std::string &_filename, const unsigned int /*_tileSize*/)
 {
   // Load the terrain file as an image
   return LoadImageAsTerrain(_filename);
@@ -31,6 +31,8 @@ namespace gazebo
 {
   namespace common
   {
+    class HeightmapTiles;
+
     /// \addtogroup gazebo_common Common
     /// \{
 
@@ -67,6 +69,14 @@ namespace gazebo
       /// \brief Get the maximum terrain's elevation.
       /// \return The maximum terrain's elevation.
       public: virtual float GetMaxElevation() const = 0;
+
+      /// \brief Get the tile pyramid the terrain is paged from, when the
+      /// terrain is too large to be held in memory.
+      /// \return The tiles, or nullptr if the whole terrain is in memory.
+      public: virtual const HeightmapTiles *Tiles() const
+              {
+                return nullptr;
+              }
     };
 
     /// \class HeightmapDataLoader HeightmapData.hh common/common.hh
@@ -78,15 +88,19 @@ namespace gazebo
       /// DEM support. For a list of all raster formats supported you can type
       /// the command "gdalinfo --formats".
       /// \param[in] _filename The path to the terrain file.
+      /// \param[in] _tileSize If not zero, a DEM is paged from a tile
+      /// pyramid with this tile size instead of being loaded in memory, see
+      /// Dem::LoadTiles. Images are always loaded in memory.
       /// \return 0 when the operation succeeds to load a file or -1 when fails.
       public: static HeightmapData *LoadTerrainFile(
-          const std::string &_filename);
+          const std::string &_filename, const unsigned int _tileSize = 0);
 
       /// \brief Load a DEM specified by _filename as a terrain file.
       /// \param[in] _filename The path to the terrain file.
+      /// \param[in] _tileSize Tile size, 0 to load the DEM in memory.
       /// \return 0 when the operation succeeds to load a file or -1 when fails.
       private: static HeightmapData *LoadDEMAsTerrain(
-          const std::string &_filename);
+          const std::string &_filename, const unsigned int _tileSize);
 
       /// \brief Load an image specified by _filename as a terrain file.
       /// \param[in] _filename The path to the terrain file.
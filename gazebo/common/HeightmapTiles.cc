@@ -0,0 +1,463 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/HeightmapTiles.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace
+{
+  /// \brief Identifies a gazebo tile file.
+  const uint32_t kMagic = 0x475a4854;
+
+  /// \brief Version of the file layout.
+  const uint32_t kVersion = 1;
+
+  /// \brief Layout of the start of the file, followed by the tiles of all
+  /// levels, level by level and row by row.
+  struct TilesHeader
+  {
+    /// \brief kMagic.
+    uint32_t magic;
+
+    /// \brief kVersion.
+    uint32_t version;
+
+    /// \brief Source samples per row.
+    uint32_t width;
+
+    /// \brief Source rows.
+    uint32_t height;
+
+    /// \brief Sample intervals per tile side.
+    uint32_t tileSize;
+
+    /// \brief Number of levels.
+    uint32_t levels;
+
+    /// \brief Elevation range.
+    float minElevation;
+
+    /// \brief Elevation range.
+    float maxElevation;
+
+    /// \brief Caller provided stamp.
+    uint64_t stamp;
+  };
+
+  /// \brief Get the number of samples along a side of a level.
+  /// \param[in] _samples Number of source samples.
+  /// \param[in] _level Level.
+  /// \return Number of samples.
+  unsigned int LevelSamples(const unsigned int _samples,
+      const unsigned int _level)
+  {
+    return ((_samples - 1) >> _level) + 1;
+  }
+
+  /// \brief Get the number of tiles along a side of a level.
+  /// \param[in] _samples Number of source samples.
+  /// \param[in] _tileSize Sample intervals per tile side.
+  /// \param[in] _level Level.
+  /// \return Number of tiles, at least one.
+  unsigned int LevelTiles(const unsigned int _samples,
+      const unsigned int _tileSize, const unsigned int _level)
+  {
+    const unsigned int intervals = LevelSamples(_samples, _level) - 1;
+    return std::max(1u, (intervals + _tileSize - 1) / _tileSize);
+  }
+
+  /// \brief Get the number of levels needed for the coarsest level to fit
+  /// in a single tile.
+  /// \param[in] _width Source samples per row.
+  /// \param[in] _height Source rows.
+  /// \param[in] _tileSize Sample intervals per tile side.
+  /// \return Number of levels.
+  unsigned int LevelCount(const unsigned int _width,
+      const unsigned int _height, const unsigned int _tileSize)
+  {
+    unsigned int levels = 1;
+    while (LevelTiles(_width, _tileSize, levels - 1) > 1 ||
+           LevelTiles(_height, _tileSize, levels - 1) > 1)
+    {
+      ++levels;
+    }
+    return levels;
+  }
+}
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \internal
+    /// \brief Private data for the HeightmapTiles class.
+    class HeightmapTilesPrivate
+    {
+      /// \brief Start of the mapped file.
+      public: void *mapping = nullptr;
+
+      /// \brief Size of the mapped file.
+      public: size_t mappingSize = 0;
+
+      /// \brief Copy of the file header.
+      public: TilesHeader header;
+
+      /// \brief Index of the first tile of each level.
+      public: std::vector<size_t> levelStart;
+
+      /// \brief Start of the tiles.
+      public: const float *tiles = nullptr;
+    };
+  }
+}
+
+//////////////////////////////////////////////////
+HeightmapTiles::HeightmapTiles()
+  : dataPtr(new HeightmapTilesPrivate)
+{
+  std::memset(&this->dataPtr->header, 0, sizeof(TilesHeader));
+}
+
+//////////////////////////////////////////////////
+HeightmapTiles::~HeightmapTiles()
+{
+#ifndef _WIN32
+  if (this->dataPtr->mapping)
+    munmap(this->dataPtr->mapping, this->dataPtr->mappingSize);
+#endif
+}
+
+//////////////////////////////////////////////////
+bool HeightmapTiles::Build(const std::string &_filename,
+    const unsigned int _width, const unsigned int _height,
+    const unsigned int _tileSize, const uint64_t _stamp, const float _noData,
+    const ReadFunc &_read)
+{
+  if (_width == 0 || _height == 0 || _tileSize == 0)
+  {
+    gzerr << "Illegal size building heightmap tiles (" << _width << ","
+          << _height << "), tile size " << _tileSize << "\n";
+    return false;
+  }
+
+  const std::string tmpFilename = _filename + ".tmp";
+  std::ofstream out(tmpFilename.c_str(),
+      std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!out.is_open())
+  {
+    gzerr << "Unable to open heightmap tile file[" << tmpFilename << "]\n";
+    return false;
+  }
+
+  TilesHeader header;
+  std::memset(&header, 0, sizeof(header));
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.width = _width;
+  header.height = _height;
+  header.tileSize = _tileSize;
+  header.levels = LevelCount(_width, _height, _tileSize);
+  header.stamp = _stamp;
+
+  // The elevation range is only known once all tiles are read, the header
+  // is written again at the end.
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  float minElevation = std::numeric_limits<float>::max();
+  float maxElevation = -std::numeric_limits<float>::max();
+
+  const unsigned int side = _tileSize + 1;
+  std::vector<float> tile(side * side);
+  std::vector<float> window;
+
+  for (unsigned int level = 0; level < header.levels; ++level)
+  {
+    const unsigned int levelWidth = LevelSamples(_width, level);
+    const unsigned int levelHeight = LevelSamples(_height, level);
+    const unsigned int tilesX = LevelTiles(_width, _tileSize, level);
+    const unsigned int tilesY = LevelTiles(_height, _tileSize, level);
+
+    for (unsigned int ty = 0; ty < tilesY; ++ty)
+    {
+      const unsigned int row = ty * _tileSize;
+      const unsigned int rows = std::min(side, levelHeight - row);
+
+      for (unsigned int tx = 0; tx < tilesX; ++tx)
+      {
+        const unsigned int col = tx * _tileSize;
+        const unsigned int cols = std::min(side, levelWidth - col);
+
+        // Read the window covered by the tile, resampled to the level
+        window.resize(cols * rows);
+        if (!_read(col << level, row << level, ((cols - 1) << level) + 1,
+              ((rows - 1) << level) + 1, cols, rows, window.data()))
+        {
+          gzerr << "Unable to read heightmap tile " << tx << "," << ty
+                << " of level " << level << "\n";
+          out.close();
+          std::remove(tmpFilename.c_str());
+          return false;
+        }
+
+        // Samples past the edge of the terrain repeat the edge
+        for (unsigned int y = 0; y < side; ++y)
+        {
+          const float *src = &window[std::min(y, rows - 1) * cols];
+          float *dst = &tile[y * side];
+          for (unsigned int x = 0; x < side; ++x)
+            dst[x] = src[std::min(x, cols - 1)];
+        }
+
+        if (level == 0)
+        {
+          for (const float h : window)
+          {
+            if (h > _noData)
+            {
+              minElevation = std::min(minElevation, h);
+              maxElevation = std::max(maxElevation, h);
+            }
+          }
+        }
+
+        out.write(reinterpret_cast<const char *>(tile.data()),
+            tile.size() * sizeof(float));
+      }
+    }
+  }
+
+  if (minElevation > maxElevation)
+  {
+    gzwarn << "Heightmap tiles are composed of 'nodata' values!" << std::endl;
+    minElevation = 0;
+    maxElevation = 0;
+  }
+  header.minElevation = minElevation;
+  header.maxElevation = maxElevation;
+
+  out.seekp(0);
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.close();
+
+  if (!out)
+  {
+    gzerr << "Unable to write heightmap tile file[" << tmpFilename << "]\n";
+    std::remove(tmpFilename.c_str());
+    return false;
+  }
+
+  std::remove(_filename.c_str());
+  if (std::rename(tmpFilename.c_str(), _filename.c_str()) != 0)
+  {
+    gzerr << "Unable to rename heightmap tile file[" << tmpFilename
+          << "] to [" << _filename << "]\n";
+    std::remove(tmpFilename.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool HeightmapTiles::Load(const std::string &_filename)
+{
+#ifdef _WIN32
+  gzerr << "Heightmap tiles are not supported on Windows\n";
+  return false;
+#else
+  int fd = open(_filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 ||
+      static_cast<size_t>(info.st_size) < sizeof(TilesHeader))
+  {
+    close(fd);
+    return false;
+  }
+
+  const size_t size = static_cast<size_t>(info.st_size);
+  void *mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED)
+  {
+    gzerr << "Unable to map heightmap tile file[" << _filename << "]: "
+          << std::strerror(errno) << "\n";
+    return false;
+  }
+
+  TilesHeader header;
+  std::memcpy(&header, mapping, sizeof(header));
+
+  // Validate the header and the size of the file
+  std::vector<size_t> levelStart;
+  size_t tileCount = 0;
+  bool valid = header.magic == kMagic && header.version == kVersion &&
+      header.width > 0 && header.height > 0 && header.tileSize > 0 &&
+      header.levels == LevelCount(header.width, header.height,
+          header.tileSize);
+  if (valid)
+  {
+    for (unsigned int level = 0; level < header.levels; ++level)
+    {
+      levelStart.push_back(tileCount);
+      tileCount += static_cast<size_t>(
+          LevelTiles(header.width, header.tileSize, level)) *
+          LevelTiles(header.height, header.tileSize, level);
+    }
+    const size_t side = header.tileSize + 1;
+    valid = size == sizeof(header) + tileCount * side * side * sizeof(float);
+  }
+
+  if (!valid)
+  {
+    gzerr << "Invalid heightmap tile file[" << _filename << "]\n";
+    munmap(mapping, size);
+    return false;
+  }
+
+  if (this->dataPtr->mapping)
+    munmap(this->dataPtr->mapping, this->dataPtr->mappingSize);
+
+  this->dataPtr->mapping = mapping;
+  this->dataPtr->mappingSize = size;
+  this->dataPtr->header = header;
+  this->dataPtr->levelStart = levelStart;
+  this->dataPtr->tiles = reinterpret_cast<const float *>(
+      static_cast<const char *>(mapping) + sizeof(header));
+
+  return true;
+#endif
+}
+
+//////////////////////////////////////////////////
+bool HeightmapTiles::Loaded() const
+{
+  return this->dataPtr->tiles != nullptr;
+}
+
+//////////////////////////////////////////////////
+uint64_t HeightmapTiles::Stamp() const
+{
+  return this->dataPtr->header.stamp;
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTiles::Width() const
+{
+  return this->dataPtr->header.width;
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTiles::Height() const
+{
+  return this->dataPtr->header.height;
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTiles::TileSize() const
+{
+  return this->dataPtr->header.tileSize;
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTiles::Levels() const
+{
+  return this->dataPtr->header.levels;
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTiles::TilesX(const unsigned int _level) const
+{
+  if (_level >= this->dataPtr->header.levels)
+    return 0;
+  return LevelTiles(this->dataPtr->header.width,
+      this->dataPtr->header.tileSize, _level);
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTiles::TilesY(const unsigned int _level) const
+{
+  if (_level >= this->dataPtr->header.levels)
+    return 0;
+  return LevelTiles(this->dataPtr->header.height,
+      this->dataPtr->header.tileSize, _level);
+}
+
+//////////////////////////////////////////////////
+const float *HeightmapTiles::Tile(const unsigned int _level,
+    const unsigned int _x, const unsigned int _y) const
+{
+  const unsigned int tilesX = this->TilesX(_level);
+  if (!this->dataPtr->tiles || _x >= tilesX || _y >= this->TilesY(_level))
+    return nullptr;
+
+  const size_t side = this->dataPtr->header.tileSize + 1;
+  const size_t index = this->dataPtr->levelStart[_level] +
+      static_cast<size_t>(_y) * tilesX + _x;
+  return this->dataPtr->tiles + index * side * side;
+}
+
+//////////////////////////////////////////////////
+float HeightmapTiles::Sample(const unsigned int _x,
+    const unsigned int _y) const
+{
+  if (!this->dataPtr->tiles)
+    return 0;
+
+  const unsigned int tileSize = this->dataPtr->header.tileSize;
+  const unsigned int x = std::min(_x, this->dataPtr->header.width - 1);
+  const unsigned int y = std::min(_y, this->dataPtr->header.height - 1);
+
+  // The last sample of a row belongs to the previous tile when the row is
+  // a whole number of tiles.
+  const unsigned int tx = std::min(x / tileSize, this->TilesX(0) - 1);
+  const unsigned int ty = std::min(y / tileSize, this->TilesY(0) - 1);
+
+  const float *tile = this->Tile(0, tx, ty);
+  return tile[(y - ty * tileSize) * (tileSize + 1) + (x - tx * tileSize)];
+}
+
+//////////////////////////////////////////////////
+float HeightmapTiles::MinElevation() const
+{
+  return this->dataPtr->header.minElevation;
+}
+
+//////////////////////////////////////////////////
+float HeightmapTiles::MaxElevation() const
+{
+  return this->dataPtr->header.maxElevation;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_HEIGHTMAPTILES_HH_
+#define GAZEBO_COMMON_HEIGHTMAPTILES_HH_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    // Forward declare private data class
+    class HeightmapTilesPrivate;
+
+    /// \addtogroup gazebo_common Common
+    /// \{
+
+    /// \class HeightmapTiles HeightmapTiles.hh common/common.hh
+    /// \brief A pyramid of square elevation tiles stored in a file that is
+    /// memory mapped when loaded.
+    ///
+    /// Level 0 holds the source samples, and each following level halves
+    /// the resolution until the whole terrain fits in a single tile. A tile
+    /// holds (TileSize() + 1)^2 samples in row major order, so neighbouring
+    /// tiles share their border samples and can be interpolated on their
+    /// own. Samples of the last row and column of tiles that fall outside
+    /// the terrain repeat the terrain's edge.
+    ///
+    /// The file is built once from a large raster, one window at a time,
+    /// and the operating system pages the tiles in and out afterwards, so
+    /// terrains far larger than the available memory can be used.
+    ///
+    /// Memory mapping is not supported on Windows, where Load always fails.
+    class GZ_COMMON_VISIBLE HeightmapTiles
+    {
+      /// \brief Read a window of the source raster.
+      /// The first four arguments are the column, row, width and height of
+      /// the window in source samples. The window is resampled to the size
+      /// given by the next two arguments and written row major to the last
+      /// argument. Return false on failure.
+      public: using ReadFunc = std::function<bool (unsigned int,
+                  unsigned int, unsigned int, unsigned int, unsigned int,
+                  unsigned int, float *)>;
+
+      /// \brief Constructor.
+      public: HeightmapTiles();
+
+      /// \brief Destructor. Unmaps the file.
+      public: ~HeightmapTiles();
+
+      /// \brief Convert a raster into a tile file.
+      /// \param[in] _filename Path of the file to write. The file is written
+      /// next to its final path and renamed once complete.
+      /// \param[in] _width Number of source samples per row.
+      /// \param[in] _height Number of source rows.
+      /// \param[in] _tileSize Number of sample intervals per tile side.
+      /// \param[in] _stamp Value stored in the file to detect a stale
+      /// conversion, see Stamp.
+      /// \param[in] _noData Samples lower or equal to this value are
+      /// ignored when computing the elevation range.
+      /// \param[in] _read Function used to read the source raster.
+      /// \return False if the raster could not be read or the file could not
+      /// be written.
+      public: static bool Build(const std::string &_filename,
+                  const unsigned int _width, const unsigned int _height,
+                  const unsigned int _tileSize, const uint64_t _stamp,
+                  const float _noData, const ReadFunc &_read);
+
+      /// \brief Map a tile file.
+      /// \param[in] _filename Path of a file written by Build.
+      /// \return False if the file is missing, truncated or not a tile file.
+      public: bool Load(const std::string &_filename);
+
+      /// \brief Get whether a file is mapped.
+      /// \return True after a successful Load.
+      public: bool Loaded() const;
+
+      /// \brief Get the stamp given to Build.
+      /// \return The stamp.
+      public: uint64_t Stamp() const;
+
+      /// \brief Get the number of source samples per row.
+      /// \return Width in samples.
+      public: unsigned int Width() const;
+
+      /// \brief Get the number of source rows.
+      /// \return Height in samples.
+      public: unsigned int Height() const;
+
+      /// \brief Get the number of sample intervals per tile side.
+      /// \return Tile size.
+      public: unsigned int TileSize() const;
+
+      /// \brief Get the number of levels in the pyramid.
+      /// \return Number of levels, at least one once loaded.
+      public: unsigned int Levels() const;
+
+      /// \brief Get the number of tiles per row of a level.
+      /// \param[in] _level Level, 0 being the full resolution.
+      /// \return Number of tiles, zero if the level does not exist.
+      public: unsigned int TilesX(const unsigned int _level) const;
+
+      /// \brief Get the number of rows of tiles of a level.
+      /// \param[in] _level Level, 0 being the full resolution.
+      /// \return Number of tiles, zero if the level does not exist.
+      public: unsigned int TilesY(const unsigned int _level) const;
+
+      /// \brief Get the samples of a tile.
+      /// \param[in] _level Level, 0 being the full resolution.
+      /// \param[in] _x Column of the tile.
+      /// \param[in] _y Row of the tile.
+      /// \return (TileSize() + 1)^2 samples, or nullptr if the tile does not
+      /// exist. The pointer is valid until the next Load or destruction.
+      public: const float *Tile(const unsigned int _level,
+                  const unsigned int _x, const unsigned int _y) const;
+
+      /// \brief Get a sample of the full resolution level.
+      /// \param[in] _x Column, clamped to the terrain.
+      /// \param[in] _y Row, clamped to the terrain.
+      /// \return The sample, 0 if nothing is loaded.
+      public: float Sample(const unsigned int _x, const unsigned int _y) const;
+
+      /// \brief Get the smallest sample greater than the nodata value.
+      /// \return Minimum elevation.
+      public: float MinElevation() const;
+
+      /// \brief Get the largest sample greater than the nodata value.
+      /// \return Maximum elevation.
+      public: float MaxElevation() const;
+
+      /// \internal
+      /// \brief Private data pointer
+      private: std::unique_ptr<HeightmapTilesPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
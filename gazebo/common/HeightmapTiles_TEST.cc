@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <string>
+
+#include "gazebo/common/HeightmapTiles.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class HeightmapTilesTest : public gazebo::testing::AutoLogFixture
+{
+  public: void SetUp() override
+          {
+            gazebo::testing::AutoLogFixture::SetUp();
+            this->filename = (boost::filesystem::temp_directory_path() /
+                boost::filesystem::unique_path("gz_tiles_%%%%%%%%")).string();
+          }
+
+  public: void TearDown() override
+          {
+            boost::filesystem::remove(this->filename);
+            gazebo::testing::AutoLogFixture::TearDown();
+          }
+
+  /// \brief Path of the tile file.
+  public: std::string filename;
+};
+
+/////////////////////////////////////////////////
+/// \brief Elevation of a sample of a 10x7 raster, with a nodata sample.
+float Elevation(const unsigned int _x, const unsigned int _y)
+{
+  if (_x == 0 && _y == 0)
+    return -10000;
+  return _x + 100.0f * _y;
+}
+
+/////////////////////////////////////////////////
+/// \brief Read a window of the raster, sampled with a constant stride.
+bool Read(unsigned int _x, unsigned int _y, unsigned int _w,
+    unsigned int _h, unsigned int _outW, unsigned int _outH, float *_out)
+{
+  const unsigned int strideX = _outW > 1 ? (_w - 1) / (_outW - 1) : 1;
+  const unsigned int strideY = _outH > 1 ? (_h - 1) / (_outH - 1) : 1;
+  for (unsigned int y = 0; y < _outH; ++y)
+  {
+    for (unsigned int x = 0; x < _outW; ++x)
+      _out[y * _outW + x] = Elevation(_x + x * strideX, _y + y * strideY);
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+TEST_F(HeightmapTilesTest, BuildLoad)
+{
+  ASSERT_TRUE(common::HeightmapTiles::Build(this->filename, 10, 7, 4, 42,
+      -9999, Read));
+
+  common::HeightmapTiles tiles;
+  EXPECT_FALSE(tiles.Loaded());
+  ASSERT_TRUE(tiles.Load(this->filename));
+  EXPECT_TRUE(tiles.Loaded());
+
+  EXPECT_EQ(42u, tiles.Stamp());
+  EXPECT_EQ(10u, tiles.Width());
+  EXPECT_EQ(7u, tiles.Height());
+  EXPECT_EQ(4u, tiles.TileSize());
+
+  // 9x6 intervals need 3x2 tiles, 5x4 samples of the next level fit in one
+  ASSERT_EQ(2u, tiles.Levels());
+  EXPECT_EQ(3u, tiles.TilesX(0));
+  EXPECT_EQ(2u, tiles.TilesY(0));
+  EXPECT_EQ(1u, tiles.TilesX(1));
+  EXPECT_EQ(1u, tiles.TilesY(1));
+  EXPECT_EQ(0u, tiles.TilesX(2));
+  EXPECT_EQ(nullptr, tiles.Tile(0, 3, 0));
+  EXPECT_EQ(nullptr, tiles.Tile(2, 0, 0));
+
+  // The nodata sample is not part of the range
+  EXPECT_FLOAT_EQ(1, tiles.MinElevation());
+  EXPECT_FLOAT_EQ(609, tiles.MaxElevation());
+
+  for (unsigned int y = 0; y < 7; ++y)
+  {
+    for (unsigned int x = 0; x < 10; ++x)
+      EXPECT_FLOAT_EQ(Elevation(x, y), tiles.Sample(x, y));
+  }
+  EXPECT_FLOAT_EQ(Elevation(9, 6), tiles.Sample(20, 20));
+
+  // Tiles share their borders
+  const float *tile = tiles.Tile(0, 1, 0);
+  ASSERT_NE(nullptr, tile);
+  EXPECT_FLOAT_EQ(Elevation(4, 0), tile[0]);
+  EXPECT_FLOAT_EQ(Elevation(8, 4), tile[4 * 5 + 4]);
+
+  // The last tile repeats the edge of the terrain
+  tile = tiles.Tile(0, 2, 1);
+  ASSERT_NE(nullptr, tile);
+  EXPECT_FLOAT_EQ(Elevation(9, 4), tile[1]);
+  EXPECT_FLOAT_EQ(Elevation(9, 4), tile[4]);
+  EXPECT_FLOAT_EQ(Elevation(9, 6), tile[4 * 5 + 4]);
+
+  // Each level halves the resolution
+  tile = tiles.Tile(1, 0, 0);
+  ASSERT_NE(nullptr, tile);
+  EXPECT_FLOAT_EQ(Elevation(2, 0), tile[1]);
+  EXPECT_FLOAT_EQ(Elevation(8, 6), tile[3 * 5 + 4]);
+}
+
+/////////////////////////////////////////////////
+TEST_F(HeightmapTilesTest, Invalid)
+{
+  common::HeightmapTiles tiles;
+  EXPECT_FALSE(tiles.Load(this->filename));
+
+  // A failed read leaves no file behind
+  EXPECT_FALSE(common::HeightmapTiles::Build(this->filename, 10, 7, 4, 0,
+      -9999, [](unsigned int, unsigned int, unsigned int, unsigned int,
+                unsigned int, unsigned int, float *) {return false;}));
+  EXPECT_FALSE(boost::filesystem::exists(this->filename));
+  EXPECT_FALSE(common::HeightmapTiles::Build(this->filename, 0, 7, 4, 0,
+      -9999, Read));
+
+  // Not a tile file
+  {
+    std::ofstream out(this->filename.c_str());
+    out << "not a tile file, but long enough to hold a header";
+  }
+  EXPECT_FALSE(tiles.Load(this->filename));
+  EXPECT_FALSE(tiles.Loaded());
+
+  // Truncated file
+  ASSERT_TRUE(common::HeightmapTiles::Build(this->filename, 10, 7, 4, 0,
+      -9999, Read));
+  boost::filesystem::resize_file(this->filename,
+      boost::filesystem::file_size(this->filename) - 4);
+  EXPECT_FALSE(tiles.Load(this->filename));
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,8 +16,14 @@
  */
 
 #include <sys/stat.h>
-#include <string>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
 
 #include "gazebo/common/CommonIface.hh"
 #include "gazebo/common/Exception.hh"
@@ -65,6 +71,39 @@ class MeshManagerPrivate
   /// \brief Mutex to protect from loading the same mesh in different threads
   /// at the same time.
   public: boost::mutex mutex;
+
+  /// \brief Load the meshes given to Prepare, until stopPreparing is set.
+  public: void RunPrepare();
+
+  /// \brief Get whether a mesh is loaded, from any thread.
+  /// \param[in] _name Name of the mesh.
+  /// \return True if the mesh is in meshes.
+  public: bool Loaded(const std::string &_name);
+
+  /// \brief Mutex to protect the members used by Prepare.
+  public: mutable std::mutex prepareMutex;
+
+  /// \brief Notified when a mesh is queued or the thread must stop.
+  public: std::condition_variable prepareCondition;
+
+  /// \brief URIs given to Prepare.
+  public: std::set<std::string> prepareRequested;
+
+  /// \brief URIs given to Prepare which are not loaded yet.
+  public: std::set<std::string> preparing;
+
+  /// \brief Queue of URIs to load.
+  public: std::deque<std::string> prepareQueue;
+
+  /// \brief Meshes loaded in the background, indexed by resolved path,
+  /// until Load adds them to meshes.
+  public: std::map<std::string, Mesh *> prepared;
+
+  /// \brief Thread loading the meshes, started by the first Prepare.
+  public: std::thread prepareThread;
+
+  /// \brief True to stop prepareThread.
+  public: bool stopPreparing = false;
 };
 
 // added here for ABI compatibility
@@ -116,6 +155,16 @@ MeshManager::MeshManager()
 //////////////////////////////////////////////////
 MeshManager::~MeshManager()
 {
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->prepareMutex);
+    this->dataPtr->stopPreparing = true;
+  }
+  this->dataPtr->prepareCondition.notify_all();
+  if (this->dataPtr->prepareThread.joinable())
+    this->dataPtr->prepareThread.join();
+  for (auto &pairNameMesh : this->dataPtr->prepared)
+    delete pairNameMesh.second;
+
   delete this->dataPtr->colladaLoader;
   delete this->dataPtr->colladaExporter;
   delete this->dataPtr->stlLoader;
@@ -144,6 +193,16 @@ const Mesh *MeshManager::Load(const std::string &_filename)
 
   if (this->HasMesh(_filename))
   {
+    // The mesh may also have been prepared after it was loaded
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->prepareMutex);
+      auto iter = this->dataPtr->prepared.find(_filename);
+      if (iter != this->dataPtr->prepared.end())
+      {
+        delete iter->second;
+        this->dataPtr->prepared.erase(iter);
+      }
+    }
     return this->dataPtr->meshes[_filename];
 
     // This breaks trimesh geom. Each new trimesh should have a unique name.
@@ -159,6 +218,29 @@ const Mesh *MeshManager::Load(const std::string &_filename)
     */
   }
 
+  // Use the mesh loaded in the background by Prepare, if any
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->prepareMutex);
+    auto iter = this->dataPtr->prepared.find(_filename);
+    if (iter != this->dataPtr->prepared.end())
+    {
+      mesh = iter->second;
+      this->dataPtr->prepared.erase(iter);
+    }
+  }
+  if (mesh)
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    if (this->HasMesh(_filename))
+    {
+      delete mesh;
+      return this->dataPtr->meshes[_filename];
+    }
+    mesh->SetName(_filename);
+    this->dataPtr->meshes.insert(std::make_pair(_filename, mesh));
+    return mesh;
+  }
+
   std::string fullname = common::find_file(_filename);
 
   if (!fullname.empty())
@@ -213,6 +295,116 @@ const Mesh *MeshManager::Load(const std::string &_filename)
   return mesh;
 }
 
+//////////////////////////////////////////////////
+void MeshManager::Prepare(const std::string &_uri)
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->prepareMutex);
+  if (this->dataPtr->stopPreparing ||
+      !this->dataPtr->prepareRequested.insert(_uri).second)
+  {
+    return;
+  }
+  lock.unlock();
+
+  // Meshes that are already loaded are not parsed again
+  if (this->dataPtr->Loaded(common::find_file(_uri)))
+    return;
+
+  lock.lock();
+  if (this->dataPtr->stopPreparing)
+    return;
+
+  this->dataPtr->preparing.insert(_uri);
+  this->dataPtr->prepareQueue.push_back(_uri);
+  if (!this->dataPtr->prepareThread.joinable())
+  {
+    this->dataPtr->prepareThread = std::thread(
+        &MeshManagerPrivate::RunPrepare, this->dataPtr);
+  }
+  this->dataPtr->prepareCondition.notify_one();
+}
+
+//////////////////////////////////////////////////
+bool MeshManager::Preparing(const std::string &_uri) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->prepareMutex);
+  return this->dataPtr->preparing.count(_uri) > 0;
+}
+
+//////////////////////////////////////////////////
+void MeshManagerPrivate::RunPrepare()
+{
+  // Loaders of this thread, since the loaders keep state while parsing
+  ColladaLoader colladaLoader;
+  STLLoader stlLoader;
+  OBJLoader localObjLoader;
+
+  std::unique_lock<std::mutex> lock(this->prepareMutex);
+  while (true)
+  {
+    this->prepareCondition.wait(lock, [this]
+        {
+          return this->stopPreparing || !this->prepareQueue.empty();
+        });
+    if (this->stopPreparing)
+      return;
+
+    const std::string uri = this->prepareQueue.front();
+    this->prepareQueue.pop_front();
+    lock.unlock();
+
+    Mesh *mesh = nullptr;
+    const std::string fullname = common::find_file(uri);
+    const bool loaded = this->Loaded(fullname);
+    std::string extension = fullname.substr(fullname.rfind(".") + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+        ::tolower);
+
+    MeshLoader *loader = nullptr;
+    if (extension == "stl" || extension == "stlb" || extension == "stla")
+      loader = &stlLoader;
+    else if (extension == "dae")
+      loader = &colladaLoader;
+    else if (extension == "obj")
+      loader = &localObjLoader;
+
+    // Errors are reported by Load, which parses the file again
+    if (loader && !fullname.empty() && !loaded)
+    {
+      try
+      {
+        mesh = loader->Load(fullname);
+      }
+      catch(...)
+      {
+        mesh = nullptr;
+      }
+    }
+
+    // Load may have loaded the mesh while it was parsed here
+    if (mesh && this->Loaded(fullname))
+    {
+      delete mesh;
+      mesh = nullptr;
+    }
+
+    lock.lock();
+    this->preparing.erase(uri);
+    if (mesh && !this->prepared.insert(std::make_pair(fullname, mesh)).second)
+      delete mesh;
+  }
+}
+
+//////////////////////////////////////////////////
+bool MeshManagerPrivate::Loaded(const std::string &_name)
+{
+  if (_name.empty())
+    return false;
+
+  boost::mutex::scoped_lock lock(this->mutex);
+  return this->meshes.find(_name) != this->meshes.end();
+}
+
 //////////////////////////////////////////////////
 void MeshManager::Export(const Mesh *_mesh, const std::string &_filename,
     const std::string &_extension, bool _exportTextures)
@@ -62,6 +62,19 @@ namespace gazebo
       /// \return a pointer to the created mesh
       public: const Mesh *Load(const std::string &_filename);
 
+      /// \brief Load a mesh file in a background thread. A later call to
+      /// Load with the resolved path of the file adds the mesh without
+      /// parsing the file again. Calling it again with the same URI, or
+      /// with a mesh that is already loaded, does nothing.
+      /// \param[in] _uri URI or path of the mesh, resolved with find_file.
+      public: void Prepare(const std::string &_uri);
+
+      /// \brief Get whether a mesh given to Prepare is still being loaded
+      /// in the background.
+      /// \param[in] _uri URI given to Prepare.
+      /// \return True until the background load is done.
+      public: bool Preparing(const std::string &_uri) const;
+
       /// \brief Export a mesh to a file
       /// \param[in] _mesh Pointer to the mesh to be exported
       /// \param[in] _filename Exported file's path and name
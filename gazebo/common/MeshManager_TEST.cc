@@ -20,6 +20,7 @@
 #include "test_config.h"
 #include "gazebo/common/Mesh.hh"
 #include "gazebo/common/MeshManager.hh"
+#include "gazebo/common/Time.hh"
 #include "gazebo/gazebo_config.h"
 #include "test/util.hh"
 
@@ -266,6 +267,47 @@ TEST_F(MeshManager, CreateExtrudedPolylineInvalid)
   EXPECT_TRUE(!common::MeshManager::Instance()->HasMesh(meshName));
 }
 
+/////////////////////////////////////////////////
+TEST_F(MeshManager, Prepare)
+{
+  const std::string filename =
+      std::string(PROJECT_SOURCE_PATH) + "/test/data/box_offset.dae";
+  common::MeshManager *meshManager = common::MeshManager::Instance();
+  EXPECT_FALSE(meshManager->Preparing(filename));
+
+  meshManager->Prepare(filename);
+  meshManager->Prepare(filename);
+  for (int i = 0; i < 500 && meshManager->Preparing(filename); ++i)
+    common::Time::MSleep(10);
+  EXPECT_FALSE(meshManager->Preparing(filename));
+
+  // The prepared mesh is added by Load
+  EXPECT_FALSE(meshManager->HasMesh(filename));
+  const common::Mesh *mesh = meshManager->Load(filename);
+  ASSERT_TRUE(mesh != nullptr);
+  EXPECT_EQ(filename, mesh->GetName());
+  EXPECT_TRUE(meshManager->HasMesh(filename));
+  EXPECT_EQ(mesh, meshManager->Load(filename));
+
+  // Meshes that are already loaded are not prepared again
+  const std::string loadedFilename =
+      std::string(PROJECT_SOURCE_PATH) + "/test/data/box.dae";
+  const common::Mesh *loaded = meshManager->Load(loadedFilename);
+  ASSERT_TRUE(loaded != nullptr);
+  meshManager->Prepare(loadedFilename);
+  EXPECT_FALSE(meshManager->Preparing(loadedFilename));
+  EXPECT_EQ(loaded, meshManager->Load(loadedFilename));
+
+  // Unknown files are not prepared, and Load reports the error
+  meshManager->Prepare("file://no_such_mesh.dae");
+  for (int i = 0; i < 500 &&
+      meshManager->Preparing("file://no_such_mesh.dae"); ++i)
+  {
+    common::Time::MSleep(10);
+  }
+  EXPECT_FALSE(meshManager->Preparing("file://no_such_mesh.dae"));
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
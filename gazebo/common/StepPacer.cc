@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "gazebo/common/StepPacer.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \internal
+    /// \brief StepPacer private data
+    class StepPacerPrivate
+    {
+      /// \brief Monotonic clock used for all deadlines.
+      public: using Clock = std::chrono::steady_clock;
+
+      /// \brief Pacing mode. Atomic so that it can be changed while
+      /// another thread is waiting.
+      public: std::atomic<StepPacer::PacingMode> mode{StepPacer::SLEEP};
+
+      /// \brief Time before a deadline to switch from sleeping to spinning.
+      public: std::atomic<Clock::duration> spinThreshold{
+          std::chrono::microseconds(200)};
+
+      /// \brief Current deadline, only used by the thread calling Wait.
+      public: Clock::time_point deadline;
+
+      /// \brief False until the first call to Wait, only used by the
+      /// thread calling Wait.
+      public: bool started = false;
+
+      /// \brief Set by Reset from any thread, consumed by Wait.
+      public: std::atomic<bool> resetRequested{false};
+
+      /// \brief Wake up error of the last call to Wait which slept.
+      public: std::atomic<Clock::duration> lateness{
+          Clock::duration::zero()};
+
+      /// \brief Average wake up error, in seconds.
+      public: std::atomic<double> jitter{0.0};
+    };
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Convert a chrono duration to a common::Time.
+/// \param[in] _d Duration.
+/// \return Equivalent Time.
+static Time ToTime(const StepPacerPrivate::Clock::duration &_d)
+{
+  return Time(std::chrono::duration<double>(_d).count());
+}
+
+/////////////////////////////////////////////////
+StepPacer::StepPacer()
+  : dataPtr(new StepPacerPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+StepPacer::~StepPacer()
+{
+}
+
+/////////////////////////////////////////////////
+void StepPacer::SetMode(const PacingMode _mode)
+{
+  this->dataPtr->mode = _mode;
+}
+
+/////////////////////////////////////////////////
+StepPacer::PacingMode StepPacer::Mode() const
+{
+  return this->dataPtr->mode;
+}
+
+/////////////////////////////////////////////////
+void StepPacer::SetSpinThreshold(const Time &_threshold)
+{
+  this->dataPtr->spinThreshold =
+      std::chrono::duration_cast<StepPacerPrivate::Clock::duration>(
+      std::chrono::seconds(_threshold.sec) +
+      std::chrono::nanoseconds(_threshold.nsec));
+}
+
+/////////////////////////////////////////////////
+Time StepPacer::SpinThreshold() const
+{
+  return ToTime(this->dataPtr->spinThreshold.load());
+}
+
+/////////////////////////////////////////////////
+void StepPacer::Reset()
+{
+  // Wait owns the schedule, it restarts it on its next call
+  this->dataPtr->resetRequested = true;
+}
+
+/////////////////////////////////////////////////
+Time StepPacer::Wait(const double _period)
+{
+  using Clock = StepPacerPrivate::Clock;
+
+  Clock::time_point now = Clock::now();
+  if (this->dataPtr->resetRequested.exchange(false))
+    this->dataPtr->started = false;
+
+  if (_period <= 0.0 || !this->dataPtr->started)
+  {
+    this->dataPtr->started = true;
+    this->dataPtr->deadline = now;
+    this->dataPtr->lateness = Clock::duration::zero();
+    return Time::Zero;
+  }
+
+  Clock::duration period = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(_period));
+  this->dataPtr->deadline += period;
+
+  // Already late, don't wait
+  if (now >= this->dataPtr->deadline)
+  {
+    Clock::duration late = now - this->dataPtr->deadline;
+
+    // Too late to catch up, restart the schedule from now.
+    if (late > period)
+      this->dataPtr->deadline = now;
+
+    this->dataPtr->lateness = Clock::duration::zero();
+    return ToTime(late);
+  }
+
+  const PacingMode mode = this->dataPtr->mode;
+  Clock::time_point spinStart = this->dataPtr->deadline;
+  if (mode == HYBRID)
+    spinStart -= this->dataPtr->spinThreshold.load();
+
+  if (mode != SPIN && now < spinStart)
+    std::this_thread::sleep_until(spinStart);
+
+  if (mode != SLEEP)
+  {
+    while (Clock::now() < this->dataPtr->deadline)
+      std::this_thread::yield();
+  }
+
+  const Clock::duration lateness = Clock::now() - this->dataPtr->deadline;
+  this->dataPtr->lateness = lateness;
+  this->dataPtr->jitter = 0.99 * this->dataPtr->jitter.load() +
+      0.01 * std::chrono::duration<double>(lateness).count();
+
+  return Time::Zero;
+}
+
+/////////////////////////////////////////////////
+Time StepPacer::Lateness() const
+{
+  return ToTime(this->dataPtr->lateness.load());
+}
+
+/////////////////////////////////////////////////
+Time StepPacer::Jitter() const
+{
+  return Time(this->dataPtr->jitter.load());
+}
+
+/////////////////////////////////////////////////
+bool StepPacer::ConvertMode(const std::string &_mode, PacingMode &_result)
+{
+  if (_mode == "sleep")
+    _result = SLEEP;
+  else if (_mode == "hybrid")
+    _result = HYBRID;
+  else if (_mode == "spin")
+    _result = SPIN;
+  else
+    return false;
+
+  return true;
+}
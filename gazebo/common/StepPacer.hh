@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_STEPPACER_HH_
+#define GAZEBO_COMMON_STEPPACER_HH_
+
+#include <memory>
+#include <string>
+
+#include "gazebo/common/Time.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    // Forward declare private data class
+    class StepPacerPrivate;
+
+    /// \addtogroup gazebo_common
+    /// \{
+
+    /// \class StepPacer StepPacer.hh common/common.hh
+    /// \brief Paces a loop to a fixed period against absolute deadlines on a
+    /// monotonic clock.
+    ///
+    /// Each deadline is the previous deadline plus the period, so small
+    /// wake up delays do not accumulate into a drift of the loop rate.
+    /// In hybrid mode the pacer sleeps until shortly before the deadline
+    /// and busy waits for the remainder, which trades some CPU time for a
+    /// wake up jitter in the order of microseconds instead of the
+    /// scheduler granularity.
+    ///
+    /// Wait must always be called from the same thread. The mode, the spin
+    /// threshold and Reset can be used from any thread, as can the
+    /// statistics getters.
+    class GZ_COMMON_VISIBLE StepPacer
+    {
+      /// \brief How to wait for a deadline.
+      public: enum PacingMode
+      {
+        /// \brief Sleep until the deadline.
+        SLEEP,
+
+        /// \brief Sleep until the spin threshold before the deadline, then
+        /// busy wait.
+        HYBRID,
+
+        /// \brief Busy wait until the deadline.
+        SPIN
+      };
+
+      /// \brief Constructor. The default mode is SLEEP with a spin
+      /// threshold of 200 microseconds.
+      public: StepPacer();
+
+      /// \brief Destructor.
+      public: virtual ~StepPacer();
+
+      /// \brief Set the pacing mode.
+      /// \param[in] _mode Pacing mode.
+      public: void SetMode(const PacingMode _mode);
+
+      /// \brief Get the pacing mode.
+      /// \return Pacing mode.
+      public: PacingMode Mode() const;
+
+      /// \brief Set how long before a deadline the hybrid mode stops
+      /// sleeping and starts busy waiting.
+      /// \param[in] _threshold Spin threshold.
+      public: void SetSpinThreshold(const Time &_threshold);
+
+      /// \brief Get the spin threshold.
+      /// \return Spin threshold.
+      public: Time SpinThreshold() const;
+
+      /// \brief Restart the schedule, the next deadline will be one period
+      /// after the next call to Wait. Safe to call while another thread is
+      /// in Wait, the restart then applies to the following call.
+      public: void Reset();
+
+      /// \brief Block until the next deadline. If the caller is late by
+      /// more than one period, the schedule is restarted from now instead
+      /// of trying to catch up with a burst of iterations.
+      /// \param[in] _period Loop period in seconds. A period of zero or less
+      /// returns immediately.
+      /// \return Time by which the deadline was missed, zero if the
+      /// deadline had not passed when Wait was called.
+      public: Time Wait(const double _period);
+
+      /// \brief Get the wake up error of the last call to Wait, i.e. the
+      /// time between the deadline and the return of Wait if it waited.
+      /// It is zero if the last call returned immediately because it
+      /// started the schedule or was already late; how late is then the
+      /// return value of Wait.
+      /// \return Last wake up error.
+      public: Time Lateness() const;
+
+      /// \brief Get an exponential moving average of the wake up error.
+      /// \return Average wake up error.
+      public: Time Jitter() const;
+
+      /// \brief Convert a string to a PacingMode.
+      /// \param[in] _mode "sleep", "hybrid" or "spin".
+      /// \param[out] _result Converted mode.
+      /// \return False if the string is not a valid mode.
+      public: static bool ConvertMode(const std::string &_mode,
+                                      PacingMode &_result);
+
+      /// \internal
+      /// \brief Private data pointer
+      private: std::unique_ptr<StepPacerPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "gazebo/common/StepPacer.hh"
+#include "gazebo/common/Timer.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class StepPacerTest : public gazebo::testing::AutoLogFixture
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(StepPacerTest, Accessors)
+{
+  common::StepPacer pacer;
+  EXPECT_EQ(pacer.Mode(), common::StepPacer::SLEEP);
+  EXPECT_EQ(pacer.SpinThreshold(), common::Time(0, 200000));
+
+  pacer.SetMode(common::StepPacer::HYBRID);
+  EXPECT_EQ(pacer.Mode(), common::StepPacer::HYBRID);
+
+  pacer.SetSpinThreshold(common::Time(0, 500000));
+  EXPECT_EQ(pacer.SpinThreshold(), common::Time(0, 500000));
+
+  common::StepPacer::PacingMode mode;
+  EXPECT_TRUE(common::StepPacer::ConvertMode("spin", mode));
+  EXPECT_EQ(mode, common::StepPacer::SPIN);
+  EXPECT_TRUE(common::StepPacer::ConvertMode("sleep", mode));
+  EXPECT_EQ(mode, common::StepPacer::SLEEP);
+  EXPECT_FALSE(common::StepPacer::ConvertMode("fast", mode));
+  EXPECT_EQ(mode, common::StepPacer::SLEEP);
+}
+
+/////////////////////////////////////////////////
+TEST_F(StepPacerTest, Rate)
+{
+  for (auto mode : {common::StepPacer::SLEEP, common::StepPacer::HYBRID,
+      common::StepPacer::SPIN})
+  {
+    common::StepPacer pacer;
+    pacer.SetMode(mode);
+
+    // 200 iterations at 1 kHz, the first one only starts the schedule
+    common::Timer timer;
+    timer.Start();
+    for (int i = 0; i <= 200; ++i)
+      pacer.Wait(0.001);
+    timer.Stop();
+
+    // deadlines are absolute, so the total time does not drift with the
+    // wake up error of each iteration. The upper bound only catches gross
+    // errors, loaded CI machines can deschedule the thread for a while.
+    EXPECT_GE(timer.GetElapsed().Double(), 0.2);
+    EXPECT_LT(timer.GetElapsed().Double(), 1.0);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(StepPacerTest, Late)
+{
+  common::StepPacer pacer;
+  pacer.Wait(0.01);
+
+  // miss the deadline by more than a period
+  common::Time::MSleep(30);
+  EXPECT_GE(pacer.Wait(0.01).Double(), 0.02);
+
+  // the schedule restarts from the late iteration, no catch up burst
+  common::Timer timer;
+  timer.Start();
+  pacer.Wait(0.01);
+  timer.Stop();
+  EXPECT_GE(timer.GetElapsed().Double(), 0.009);
+
+  // a zero period never blocks
+  timer.Reset();
+  timer.Start();
+  for (int i = 0; i < 10; ++i)
+    pacer.Wait(0.0);
+  timer.Stop();
+  EXPECT_LT(timer.GetElapsed().Double(), 0.1);
+}
+
+/////////////////////////////////////////////////
+TEST_F(StepPacerTest, ResetFromOtherThread)
+{
+  common::StepPacer pacer;
+  pacer.Wait(0.01);
+
+  // a reset requested by another thread restarts the schedule on the
+  // next call, which then returns without waiting
+  std::thread resetter([&pacer]() { pacer.Reset(); });
+  resetter.join();
+  EXPECT_EQ(common::Time::Zero, pacer.Wait(0.01));
+  EXPECT_EQ(common::Time::Zero, pacer.Lateness());
+
+  common::Timer timer;
+  timer.Start();
+  pacer.Wait(0.01);
+  timer.Stop();
+  EXPECT_GE(timer.GetElapsed().Double(), 0.009);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
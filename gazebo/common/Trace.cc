@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef _WIN32
+  #include <unistd.h>
+#else
+  #include <process.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/Trace.hh"
+
+using namespace gazebo;
+using namespace common;
+
+std::atomic<bool> Trace::enabled(false);
+const size_t Trace::BufferSize;
+
+namespace
+{
+  /// \brief A completed scope.
+  struct TraceEvent
+  {
+    /// \brief Start timestamp in nanoseconds.
+    int64_t start;
+
+    /// \brief Duration in nanoseconds.
+    int64_t duration;
+
+    /// \brief Interned scope name.
+    uint32_t id;
+  };
+
+  /// \brief Ring buffer of events written by a single thread.
+  struct TraceBuffer
+  {
+    /// \brief Events, indexed by sequence number modulo the size.
+    std::vector<TraceEvent> events =
+      std::vector<TraceEvent>(Trace::BufferSize);
+
+    /// \brief Sequence number of the next event to write.
+    std::atomic<uint64_t> head{0};
+
+    /// \brief Events before this sequence number were cleared.
+    std::atomic<uint64_t> cleared{0};
+
+    /// \brief Id of the thread in exported traces.
+    uint32_t tid = 0;
+
+    /// \brief Name of the thread in exported traces.
+    std::string name;
+  };
+
+  /// \brief Process wide trace state. Only the hot path in Record runs
+  /// without the mutex.
+  struct TraceRegistry
+  {
+    /// \brief Protects all members.
+    std::mutex mutex;
+
+    /// \brief Interned names, indexed by id.
+    std::vector<std::string> names;
+
+    /// \brief Name to id lookup.
+    std::unordered_map<std::string, uint32_t> ids;
+
+    /// \brief Buffers of all threads that recorded an event or were
+    /// named. Buffers outlive their thread so that the events can still be
+    /// exported.
+    std::vector<std::shared_ptr<TraceBuffer>> buffers;
+  };
+
+  /// \brief Get the registry, which is never destroyed so that threads
+  /// still running at exit can record safely.
+  /// \return The registry.
+  TraceRegistry &Registry()
+  {
+    static TraceRegistry *registry = new TraceRegistry();
+    return *registry;
+  }
+
+  /// \brief Get the calling thread's buffer, creating it on first use.
+  /// \return The buffer.
+  TraceBuffer &ThreadBuffer()
+  {
+    thread_local TraceBuffer *buffer = nullptr;
+    if (!buffer)
+    {
+      auto newBuffer = std::make_shared<TraceBuffer>();
+      TraceRegistry &registry = Registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      newBuffer->tid = static_cast<uint32_t>(registry.buffers.size()) + 1;
+      newBuffer->name = "thread " + std::to_string(newBuffer->tid);
+      registry.buffers.push_back(newBuffer);
+      buffer = newBuffer.get();
+    }
+    return *buffer;
+  }
+
+  /// \brief Write a string as a JSON string literal.
+  /// \param[in] _out Output stream.
+  /// \param[in] _str String to write.
+  void WriteJsonString(std::ostream &_out, const std::string &_str)
+  {
+    _out << '"';
+    for (const char c : _str)
+    {
+      if (c == '"' || c == '\\')
+        _out << '\\' << c;
+      else if (static_cast<unsigned char>(c) < 0x20)
+      {
+        _out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+             << static_cast<int>(c) << std::dec << std::setfill(' ');
+      }
+      else
+        _out << c;
+    }
+    _out << '"';
+  }
+
+  /// \brief Copy the events of a buffer that are not being overwritten.
+  /// \param[in] _buffer Buffer to read.
+  /// \param[out] _events Events, oldest first.
+  void Snapshot(const TraceBuffer &_buffer, std::vector<TraceEvent> &_events)
+  {
+    _events.clear();
+
+    const uint64_t size = _buffer.events.size();
+    const uint64_t head = _buffer.head.load(std::memory_order_acquire);
+    const uint64_t first = std::max(_buffer.cleared.load(),
+        head > size ? head - size : 0);
+
+    for (uint64_t i = first; i < head; ++i)
+      _events.push_back(_buffer.events[i % size]);
+
+    // The owning thread kept writing while copying, drop the events that
+    // may have been overwritten during the copy. The event at newHead may
+    // be half written, so the slot it reuses is dropped too.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t newHead = _buffer.head.load(std::memory_order_relaxed);
+    if (newHead + 1 > first + size)
+    {
+      const size_t overwritten = std::min<uint64_t>(
+          newHead + 1 - size - first, _events.size());
+      _events.erase(_events.begin(), _events.begin() + overwritten);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+uint32_t Trace::Intern(const std::string &_name)
+{
+  TraceRegistry &registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  auto iter = registry.ids.find(_name);
+  if (iter != registry.ids.end())
+    return iter->second;
+
+  uint32_t id = static_cast<uint32_t>(registry.names.size());
+  registry.names.push_back(_name);
+  registry.ids[_name] = id;
+  return id;
+}
+
+/////////////////////////////////////////////////
+std::string Trace::Name(const uint32_t _id)
+{
+  TraceRegistry &registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  if (_id < registry.names.size())
+    return registry.names[_id];
+  return std::string();
+}
+
+/////////////////////////////////////////////////
+void Trace::SetEnabled(const bool _enable)
+{
+  enabled = _enable;
+}
+
+/////////////////////////////////////////////////
+void Trace::SetThreadName(const std::string &_name)
+{
+  TraceBuffer &buffer = ThreadBuffer();
+  std::lock_guard<std::mutex> lock(Registry().mutex);
+  buffer.name = _name;
+}
+
+/////////////////////////////////////////////////
+int64_t Trace::Now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/////////////////////////////////////////////////
+void Trace::Record(const uint32_t _id, const int64_t _start,
+    const int64_t _end)
+{
+  TraceBuffer &buffer = ThreadBuffer();
+
+  const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+  TraceEvent &event = buffer.events[head % buffer.events.size()];
+  event.start = _start;
+  event.duration = _end - _start;
+  event.id = _id;
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////
+void Trace::Clear()
+{
+  TraceRegistry &registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  for (auto &buffer : registry.buffers)
+    buffer->cleared = buffer->head.load();
+}
+
+/////////////////////////////////////////////////
+size_t Trace::EventCount()
+{
+  TraceRegistry &registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  size_t count = 0;
+  for (const auto &buffer : registry.buffers)
+  {
+    const uint64_t head = buffer->head.load();
+    const uint64_t size = buffer->events.size();
+    const uint64_t first = std::max(buffer->cleared.load(),
+        head > size ? head - size : 0);
+    count += head - first;
+  }
+  return count;
+}
+
+/////////////////////////////////////////////////
+void Trace::Export(std::ostream &_out)
+{
+#ifndef _WIN32
+  const int pid = getpid();
+#else
+  const int pid = _getpid();
+#endif
+
+  // Copy the events and names under the lock, and write them after
+  // releasing it, so that threads recording their first event or
+  // interning a name are not blocked by the output stream.
+  std::vector<std::vector<TraceEvent>> events;
+  std::vector<std::pair<uint32_t, std::string>> threads;
+  std::vector<std::string> names;
+  {
+    TraceRegistry &registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    events.resize(registry.buffers.size());
+    for (size_t i = 0; i < registry.buffers.size(); ++i)
+    {
+      Snapshot(*registry.buffers[i], events[i]);
+      threads.emplace_back(registry.buffers[i]->tid,
+          registry.buffers[i]->name);
+    }
+    names = registry.names;
+  }
+
+  // Report timestamps relative to the oldest event
+  int64_t origin = std::numeric_limits<int64_t>::max();
+  for (const auto &threadEvents : events)
+  {
+    if (!threadEvents.empty())
+      origin = std::min(origin, threadEvents.front().start);
+  }
+
+  _out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+  bool first = true;
+  for (size_t i = 0; i < threads.size(); ++i)
+  {
+    const uint32_t tid = threads[i].first;
+
+    _out << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\","
+         << "\"pid\":" << pid << ",\"tid\":" << tid
+         << ",\"args\":{\"name\":";
+    WriteJsonString(_out, threads[i].second);
+    _out << "}}";
+    first = false;
+
+    for (const TraceEvent &event : events[i])
+    {
+      _out << ",\n{\"ph\":\"X\",\"name\":";
+      if (event.id < names.size())
+        WriteJsonString(_out, names[event.id]);
+      else
+        _out << "\"unknown\"";
+
+      // Timestamps are in microseconds
+      _out << ",\"pid\":" << pid << ",\"tid\":" << tid
+           << ",\"ts\":" << (event.start - origin) / 1000
+           << '.' << std::setw(3) << std::setfill('0')
+           << (event.start - origin) % 1000
+           << ",\"dur\":" << event.duration / 1000
+           << '.' << std::setw(3) << (event.duration % 1000)
+           << std::setfill(' ') << "}";
+    }
+  }
+
+  _out << "\n]}\n";
+}
+
+/////////////////////////////////////////////////
+bool Trace::Export(const std::string &_filename)
+{
+  std::ofstream out(_filename.c_str(), std::ios::out | std::ios::trunc);
+  if (!out.is_open())
+  {
+    gzerr << "Unable to open trace file[" << _filename << "]\n";
+    return false;
+  }
+
+  Export(out);
+  return out.good();
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_TRACE_HH_
+#define GAZEBO_COMMON_TRACE_HH_
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "gazebo/util/system.hh"
+
+/// \brief Helper to build unique identifiers for GZ_TRACE_SCOPE.
+#define GZ_TRACE_CONCAT_IMPL(_a, _b) _a ## _b
+#define GZ_TRACE_CONCAT(_a, _b) GZ_TRACE_CONCAT_IMPL(_a, _b)
+
+/// \brief Record the duration of the enclosing scope in the trace. The
+/// name is interned once per call site, so a disabled trace costs a single
+/// relaxed atomic load.
+/// \param[in] _name Name of the scope, usually Class::Function.
+#define GZ_TRACE_SCOPE(_name) \
+  static const uint32_t GZ_TRACE_CONCAT(gzTraceId, __LINE__) = \
+    gazebo::common::Trace::Intern(_name); \
+  gazebo::common::TraceScope GZ_TRACE_CONCAT(gzTraceScope, __LINE__)( \
+    GZ_TRACE_CONCAT(gzTraceId, __LINE__))
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \addtogroup gazebo_common
+    /// \{
+
+    /// \class Trace Trace.hh common/common.hh
+    /// \brief Always compiled in, runtime toggled scope tracing.
+    ///
+    /// Each thread records completed scopes in its own fixed size ring
+    /// buffer, without locks, so the oldest events are overwritten once the
+    /// buffer is full. The buffers of all threads can be exported at any
+    /// time in the Chrome trace event format, which can be opened with
+    /// chrome://tracing or https://ui.perfetto.dev.
+    ///
+    /// Use the GZ_TRACE_SCOPE macro to instrument code, and
+    /// util::DiagnosticManager to control tracing from a topic.
+    class GZ_COMMON_VISIBLE Trace
+    {
+      /// \brief Get the id of a scope name, adding it if needed.
+      /// \param[in] _name Scope name.
+      /// \return Id of the name.
+      public: static uint32_t Intern(const std::string &_name);
+
+      /// \brief Get the name of an interned id.
+      /// \param[in] _id Id returned by Intern.
+      /// \return Scope name, empty if the id is unknown.
+      public: static std::string Name(const uint32_t _id);
+
+      /// \brief Start or stop recording.
+      /// \param[in] _enable True to record scopes.
+      public: static void SetEnabled(const bool _enable);
+
+      /// \brief Get whether scopes are being recorded.
+      /// \return True if enabled.
+      public: static bool Enabled()
+              {
+                return enabled.load(std::memory_order_relaxed);
+              }
+
+      /// \brief Name the calling thread in exported traces.
+      /// \param[in] _name Thread name, e.g. "physics".
+      public: static void SetThreadName(const std::string &_name);
+
+      /// \brief Get a monotonic timestamp for Record.
+      /// \return Nanoseconds since an arbitrary origin.
+      public: static int64_t Now();
+
+      /// \brief Record a completed scope in the calling thread's buffer.
+      /// \param[in] _id Id returned by Intern.
+      /// \param[in] _start Start timestamp from Now.
+      /// \param[in] _end End timestamp from Now.
+      public: static void Record(const uint32_t _id, const int64_t _start,
+                                 const int64_t _end);
+
+      /// \brief Drop all recorded events. Thread names are kept.
+      public: static void Clear();
+
+      /// \brief Get the number of events currently held in all buffers.
+      /// \return Number of events.
+      public: static size_t EventCount();
+
+      /// \brief Write all recorded events as Chrome trace event JSON.
+      /// \param[in] _out Stream to write to.
+      public: static void Export(std::ostream &_out);
+
+      /// \brief Write all recorded events as Chrome trace event JSON.
+      /// \param[in] _filename File to write.
+      /// \return False if the file could not be written.
+      public: static bool Export(const std::string &_filename);
+
+      /// \brief Number of events kept per thread.
+      public: static const size_t BufferSize = 1 << 16;
+
+      /// \brief True while recording.
+      private: static std::atomic<bool> enabled;
+    };
+
+    /// \class TraceScope Trace.hh common/common.hh
+    /// \brief Records its lifetime in the trace, see GZ_TRACE_SCOPE.
+    class TraceScope
+    {
+      /// \brief Constructor.
+      /// \param[in] _id Interned scope name.
+      public: explicit TraceScope(const uint32_t _id)
+              : id(_id), start(Trace::Enabled() ? Trace::Now() : 0)
+              {
+              }
+
+      /// \brief Destructor, records the scope if tracing was enabled when
+      /// it started.
+      public: ~TraceScope()
+              {
+                if (this->start != 0)
+                  Trace::Record(this->id, this->start, Trace::Now());
+              }
+
+      /// \brief Interned scope name.
+      private: const uint32_t id;
+
+      /// \brief Start timestamp, zero if not recording.
+      private: const int64_t start;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gazebo/common/Trace.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class TraceTest : public gazebo::testing::AutoLogFixture
+{
+  public: void TearDown() override
+          {
+            common::Trace::SetEnabled(false);
+            common::Trace::Clear();
+          }
+};
+
+/////////////////////////////////////////////////
+/// \brief A traced function.
+void TracedFunction()
+{
+  GZ_TRACE_SCOPE("TracedFunction");
+}
+
+/////////////////////////////////////////////////
+TEST_F(TraceTest, Intern)
+{
+  uint32_t id = common::Trace::Intern("scope_a");
+  EXPECT_EQ(id, common::Trace::Intern("scope_a"));
+  EXPECT_NE(id, common::Trace::Intern("scope_b"));
+  EXPECT_EQ("scope_a", common::Trace::Name(id));
+  EXPECT_EQ("", common::Trace::Name(1000000));
+}
+
+/////////////////////////////////////////////////
+TEST_F(TraceTest, Enable)
+{
+  common::Trace::Clear();
+
+  // Nothing is recorded while disabled
+  EXPECT_FALSE(common::Trace::Enabled());
+  TracedFunction();
+  EXPECT_EQ(0u, common::Trace::EventCount());
+
+  common::Trace::SetEnabled(true);
+  for (int i = 0; i < 10; ++i)
+    TracedFunction();
+  EXPECT_EQ(10u, common::Trace::EventCount());
+
+  common::Trace::SetEnabled(false);
+  TracedFunction();
+  EXPECT_EQ(10u, common::Trace::EventCount());
+
+  common::Trace::Clear();
+  EXPECT_EQ(0u, common::Trace::EventCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(TraceTest, Overflow)
+{
+  common::Trace::Clear();
+  common::Trace::SetEnabled(true);
+
+  // Each thread keeps its most recent events
+  std::thread thread([]()
+  {
+    for (size_t i = 0; i < common::Trace::BufferSize + 100; ++i)
+      TracedFunction();
+  });
+  thread.join();
+
+  EXPECT_EQ(common::Trace::BufferSize, common::Trace::EventCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(TraceTest, Export)
+{
+  common::Trace::Clear();
+  common::Trace::SetEnabled(true);
+
+  std::thread thread([]()
+  {
+    common::Trace::SetThreadName("worker \"1\"");
+    TracedFunction();
+  });
+  thread.join();
+
+  std::ostringstream stream;
+  common::Trace::Export(stream);
+  std::string json = stream.str();
+
+  EXPECT_EQ(0u, json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+  EXPECT_NE(std::string::npos, json.find(
+      "\"args\":{\"name\":\"worker \\\"1\\\"\"}"));
+  EXPECT_NE(std::string::npos, json.find(
+      "{\"ph\":\"X\",\"name\":\"TracedFunction\""));
+  EXPECT_EQ(json.size() - 4, json.rfind("\n]}\n"));
+}
+
+/////////////////////////////////////////////////
+/// \brief Parse a duration exported in microseconds back to nanoseconds.
+/// \param[in] _json Exported trace.
+/// \param[in] _key Key of the duration, followed by its value.
+/// \param[in] _pos Position to search from.
+/// \return Duration in nanoseconds.
+int64_t ParseNanoseconds(const std::string &_json, const std::string &_key,
+    const size_t _pos)
+{
+  const size_t start = _json.find(_key, _pos) + _key.size();
+  const size_t dot = _json.find('.', start);
+  return std::stoll(_json.substr(start, dot - start)) * 1000 +
+      std::stoll(_json.substr(dot + 1, 3));
+}
+
+/////////////////////////////////////////////////
+TEST_F(TraceTest, ExportWhileRecording)
+{
+  common::Trace::Clear();
+  common::Trace::SetEnabled(true);
+
+  // Every event lasts as long as its start timestamp, so an event torn
+  // between two writes has a duration that does not match its start
+  const uint32_t id = common::Trace::Intern("Recording");
+  std::atomic<bool> stop(false);
+  std::thread thread([&]()
+  {
+    for (int64_t i = 1; !stop; ++i)
+      common::Trace::Record(id, i, 2 * i);
+  });
+
+  for (int n = 0; n < 20; ++n)
+  {
+    std::ostringstream stream;
+    common::Trace::Export(stream);
+    const std::string json = stream.str();
+
+    // Timestamps are relative to the oldest event, so the difference
+    // between duration and timestamp is the same for every event
+    bool first = true;
+    int64_t origin = 0;
+    for (size_t pos = json.find("\"name\":\"Recording\"");
+        pos != std::string::npos;
+        pos = json.find("\"name\":\"Recording\"", pos + 1))
+    {
+      const int64_t offset = ParseNanoseconds(json, "\"dur\":", pos) -
+          ParseNanoseconds(json, "\"ts\":", pos);
+      if (first)
+        origin = offset;
+      first = false;
+      ASSERT_EQ(origin, offset);
+    }
+  }
+
+  stop = true;
+  thread.join();
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
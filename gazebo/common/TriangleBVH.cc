@@ -0,0 +1,538 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/TriangleBVH.hh"
+
+using namespace gazebo;
+using namespace common;
+
+/// \brief Maximum number of triangles in a leaf.
+static const uint32_t kMaxLeafSize = 4;
+
+/// \brief Maximum depth of the tree, which bounds the traversal stack.
+static const uint32_t kMaxDepth = 48;
+
+/// \brief Number of bins used to find the best split of a node.
+static const int kBinCount = 12;
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \internal
+    /// \brief A triangle, stored as its first vertex and two edges.
+    class BVHTriangle
+    {
+      /// \brief First vertex.
+      public: float v0[3];
+
+      /// \brief Edge from the first to the second vertex.
+      public: float e1[3];
+
+      /// \brief Edge from the first to the third vertex.
+      public: float e2[3];
+    };
+
+    /// \internal
+    /// \brief A node of the tree.
+    class BVHNode
+    {
+      /// \brief Minimum corner of the box of the node.
+      public: float min[3];
+
+      /// \brief Maximum corner of the box of the node.
+      public: float max[3];
+
+      /// \brief First triangle of a leaf, or first child of an inner
+      /// node. The second child follows the first.
+      public: uint32_t first = 0;
+
+      /// \brief Number of triangles of a leaf, zero for an inner node.
+      public: uint32_t count = 0;
+
+      /// \brief Axis along which an inner node is split.
+      public: uint32_t axis = 0;
+    };
+
+    /// \internal
+    /// \brief Private data for TriangleBVH.
+    class TriangleBVHPrivate
+    {
+      /// \brief Triangles, sorted by leaf once built.
+      public: std::vector<BVHTriangle> triangles;
+
+      /// \brief Nodes of the tree, the root first.
+      public: std::vector<BVHNode> nodes;
+    };
+  }
+}
+
+/// \brief Box and center of a triangle, used while building the tree.
+struct BuildItem
+{
+  /// \brief Minimum corner of the box.
+  float min[3];
+
+  /// \brief Maximum corner of the box.
+  float max[3];
+
+  /// \brief Center of the box.
+  float center[3];
+
+  /// \brief Index of the triangle.
+  uint32_t index;
+};
+
+/// \brief Range of items to turn into a node.
+struct BuildTask
+{
+  /// \brief Index of the node.
+  uint32_t node;
+
+  /// \brief First item.
+  uint32_t begin;
+
+  /// \brief Past the last item.
+  uint32_t end;
+
+  /// \brief Depth of the node.
+  uint32_t depth;
+};
+
+/// \brief Box and number of items of a bin.
+struct BuildBin
+{
+  /// \brief Minimum corner of the box.
+  float min[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+
+  /// \brief Maximum corner of the box.
+  float max[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+  /// \brief Number of items.
+  uint32_t count = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Grow a box to contain another one.
+/// \param[in,out] _min Minimum corner of the box to grow.
+/// \param[in,out] _max Maximum corner of the box to grow.
+/// \param[in] _otherMin Minimum corner of the other box.
+/// \param[in] _otherMax Maximum corner of the other box.
+static void Grow(float *_min, float *_max, const float *_otherMin,
+    const float *_otherMax)
+{
+  for (int a = 0; a < 3; ++a)
+  {
+    _min[a] = std::min(_min[a], _otherMin[a]);
+    _max[a] = std::max(_max[a], _otherMax[a]);
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Get half the surface area of a box.
+/// \param[in] _min Minimum corner of the box.
+/// \param[in] _max Maximum corner of the box.
+/// \return Half the area, zero for an empty box.
+static float HalfArea(const float *_min, const float *_max)
+{
+  const float x = _max[0] - _min[0];
+  const float y = _max[1] - _min[1];
+  const float z = _max[2] - _min[2];
+  if (x < 0 || y < 0 || z < 0)
+    return 0;
+  return x * y + y * z + z * x;
+}
+
+/////////////////////////////////////////////////
+/// \brief Lower the distance of the rays of a packet which hit a triangle.
+/// \param[in] _tri The triangle.
+/// \param[in,out] _packet The rays.
+static void IntersectTriangle(const BVHTriangle &_tri, RayPacket &_packet)
+{
+  // Moller-Trumbore, without branches so that the loop is vectorized
+  for (unsigned int i = 0; i < RayPacket::kSize; ++i)
+  {
+    const float dx = _packet.dir[0][i];
+    const float dy = _packet.dir[1][i];
+    const float dz = _packet.dir[2][i];
+
+    const float px = dy * _tri.e2[2] - dz * _tri.e2[1];
+    const float py = dz * _tri.e2[0] - dx * _tri.e2[2];
+    const float pz = dx * _tri.e2[1] - dy * _tri.e2[0];
+    const float det = _tri.e1[0] * px + _tri.e1[1] * py + _tri.e1[2] * pz;
+    const float inv = 1.0f / det;
+
+    const float tx = _packet.origin[0][i] - _tri.v0[0];
+    const float ty = _packet.origin[1][i] - _tri.v0[1];
+    const float tz = _packet.origin[2][i] - _tri.v0[2];
+    const float u = (tx * px + ty * py + tz * pz) * inv;
+
+    const float qx = ty * _tri.e1[2] - tz * _tri.e1[1];
+    const float qy = tz * _tri.e1[0] - tx * _tri.e1[2];
+    const float qz = tx * _tri.e1[1] - ty * _tri.e1[0];
+    const float v = (dx * qx + dy * qy + dz * qz) * inv;
+    const float t = (_tri.e2[0] * qx + _tri.e2[1] * qy + _tri.e2[2] * qz) *
+        inv;
+
+    // A positive determinant means the front side is hit
+    const bool hit = (det > 0.0f) & (u >= 0.0f) & (v >= 0.0f) &
+        (u + v <= 1.0f) & (t > 0.0f) & (t < _packet.dist[i]);
+    _packet.dist[i] = hit ? t : _packet.dist[i];
+  }
+}
+
+/////////////////////////////////////////////////
+void RayPacket::Prepare()
+{
+  for (unsigned int i = 0; i < kSize; ++i)
+  {
+    // A negative distance is never reached
+    if (i >= this->count)
+    {
+      for (int a = 0; a < 3; ++a)
+      {
+        this->origin[a][i] = 0;
+        this->dir[a][i] = 1;
+      }
+      this->dist[i] = -1;
+    }
+
+    for (int a = 0; a < 3; ++a)
+      this->invDir[a][i] = 1.0f / this->dir[a][i];
+  }
+}
+
+/////////////////////////////////////////////////
+bool RayPacket::HitsBox(const float *_min, const float *_max) const
+{
+  bool hit = false;
+  for (unsigned int i = 0; i < kSize; ++i)
+  {
+    float tNear = 0;
+    float tFar = this->dist[i];
+    for (int a = 0; a < 3; ++a)
+    {
+      const float t0 = (_min[a] - this->origin[a][i]) * this->invDir[a][i];
+      const float t1 = (_max[a] - this->origin[a][i]) * this->invDir[a][i];
+      tNear = std::max(tNear, std::min(t0, t1));
+      tFar = std::min(tFar, std::max(t0, t1));
+    }
+    hit |= tNear <= tFar;
+  }
+  return hit;
+}
+
+/////////////////////////////////////////////////
+TriangleBVH::TriangleBVH()
+  : dataPtr(new TriangleBVHPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+TriangleBVH::~TriangleBVH()
+{
+}
+
+/////////////////////////////////////////////////
+void TriangleBVH::AddTriangle(const ignition::math::Vector3d &_a,
+    const ignition::math::Vector3d &_b, const ignition::math::Vector3d &_c)
+{
+  BVHTriangle tri;
+  tri.v0[0] = static_cast<float>(_a.X());
+  tri.v0[1] = static_cast<float>(_a.Y());
+  tri.v0[2] = static_cast<float>(_a.Z());
+  tri.e1[0] = static_cast<float>(_b.X() - _a.X());
+  tri.e1[1] = static_cast<float>(_b.Y() - _a.Y());
+  tri.e1[2] = static_cast<float>(_b.Z() - _a.Z());
+  tri.e2[0] = static_cast<float>(_c.X() - _a.X());
+  tri.e2[1] = static_cast<float>(_c.Y() - _a.Y());
+  tri.e2[2] = static_cast<float>(_c.Z() - _a.Z());
+  this->dataPtr->triangles.push_back(tri);
+}
+
+/////////////////////////////////////////////////
+void TriangleBVH::AddMesh(const Mesh &_mesh,
+    const ignition::math::Vector3d &_scale)
+{
+  for (unsigned int i = 0; i < _mesh.GetSubMeshCount(); ++i)
+  {
+    const SubMesh *subMesh = _mesh.GetSubMesh(i);
+    if (subMesh)
+      this->AddSubMesh(*subMesh, _scale);
+  }
+}
+
+/////////////////////////////////////////////////
+void TriangleBVH::AddSubMesh(const SubMesh &_subMesh,
+    const ignition::math::Vector3d &_scale)
+{
+  if (_subMesh.GetPrimitiveType() != SubMesh::TRIANGLES)
+    return;
+
+  auto vertex = [&_subMesh, &_scale](const unsigned int _i)
+  {
+    const ignition::math::Vector3d v = _subMesh.Vertex(_i);
+    return ignition::math::Vector3d(v.X() * _scale.X(), v.Y() * _scale.Y(),
+        v.Z() * _scale.Z());
+  };
+
+  // Submeshes without indices list the vertices of each triangle
+  const unsigned int indexCount = _subMesh.GetIndexCount();
+  if (indexCount > 0)
+  {
+    for (unsigned int i = 0; i + 2 < indexCount; i += 3)
+    {
+      this->AddTriangle(vertex(_subMesh.GetIndex(i)),
+          vertex(_subMesh.GetIndex(i + 1)), vertex(_subMesh.GetIndex(i + 2)));
+    }
+  }
+  else
+  {
+    const unsigned int vertexCount = _subMesh.GetVertexCount();
+    for (unsigned int i = 0; i + 2 < vertexCount; i += 3)
+      this->AddTriangle(vertex(i), vertex(i + 1), vertex(i + 2));
+  }
+}
+
+/////////////////////////////////////////////////
+void TriangleBVH::Build()
+{
+  auto &d = *this->dataPtr;
+  d.nodes.clear();
+  const uint32_t count = static_cast<uint32_t>(d.triangles.size());
+  if (count == 0)
+    return;
+
+  std::vector<BuildItem> items(count);
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const BVHTriangle &tri = d.triangles[i];
+    BuildItem &item = items[i];
+    for (int a = 0; a < 3; ++a)
+    {
+      const float p1 = tri.v0[a] + tri.e1[a];
+      const float p2 = tri.v0[a] + tri.e2[a];
+      item.min[a] = std::min(tri.v0[a], std::min(p1, p2));
+      item.max[a] = std::max(tri.v0[a], std::max(p1, p2));
+      item.center[a] = 0.5f * (item.min[a] + item.max[a]);
+    }
+    item.index = i;
+  }
+
+  d.nodes.reserve(2 * count);
+  d.nodes.emplace_back();
+  std::vector<BuildTask> tasks;
+  tasks.push_back({0, 0, count, 0});
+
+  while (!tasks.empty())
+  {
+    const BuildTask task = tasks.back();
+    tasks.pop_back();
+
+    // Box of the node, and box of the centers of its triangles
+    float min[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+    float max[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    float centerMin[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+    float centerMax[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (uint32_t i = task.begin; i < task.end; ++i)
+    {
+      Grow(min, max, items[i].min, items[i].max);
+      Grow(centerMin, centerMax, items[i].center, items[i].center);
+    }
+
+    BVHNode &node = d.nodes[task.node];
+    std::copy(min, min + 3, node.min);
+    std::copy(max, max + 3, node.max);
+    node.first = task.begin;
+    node.count = task.end - task.begin;
+
+    uint32_t axis = 0;
+    for (uint32_t a = 1; a < 3; ++a)
+    {
+      if (centerMax[a] - centerMin[a] > centerMax[axis] - centerMin[axis])
+        axis = a;
+    }
+    const float extent = centerMax[axis] - centerMin[axis];
+    if (node.count <= kMaxLeafSize || task.depth >= kMaxDepth ||
+        extent <= 0)
+    {
+      continue;
+    }
+
+    // Split where the surface area heuristic, the sum over both sides of
+    // the number of triangles times the area of their box, is the lowest
+    auto binOf = [&](const BuildItem &_item)
+    {
+      const int bin = static_cast<int>(
+          (_item.center[axis] - centerMin[axis]) * kBinCount / extent);
+      return std::min(bin, kBinCount - 1);
+    };
+
+    BuildBin bins[kBinCount];
+    for (uint32_t i = task.begin; i < task.end; ++i)
+    {
+      BuildBin &bin = bins[binOf(items[i])];
+      Grow(bin.min, bin.max, items[i].min, items[i].max);
+      ++bin.count;
+    }
+
+    float rightCost[kBinCount];
+    BuildBin right;
+    for (int b = kBinCount - 1; b > 0; --b)
+    {
+      Grow(right.min, right.max, bins[b].min, bins[b].max);
+      right.count += bins[b].count;
+      rightCost[b] = right.count * HalfArea(right.min, right.max);
+    }
+
+    int split = 1;
+    float bestCost = FLT_MAX;
+    BuildBin left;
+    for (int b = 1; b < kBinCount; ++b)
+    {
+      Grow(left.min, left.max, bins[b - 1].min, bins[b - 1].max);
+      left.count += bins[b - 1].count;
+      const float cost = left.count * HalfArea(left.min, left.max) +
+          rightCost[b];
+      if (left.count > 0 && left.count < node.count && cost < bestCost)
+      {
+        bestCost = cost;
+        split = b;
+      }
+    }
+
+    auto middle = std::partition(items.begin() + task.begin,
+        items.begin() + task.end, [&](const BuildItem &_item)
+        {
+          return binOf(_item) < split;
+        });
+    uint32_t mid = static_cast<uint32_t>(middle - items.begin());
+
+    // Split in the middle if all the triangles fell on one side
+    if (mid == task.begin || mid == task.end)
+    {
+      mid = task.begin + node.count / 2;
+      std::nth_element(items.begin() + task.begin, items.begin() + mid,
+          items.begin() + task.end,
+          [axis](const BuildItem &_a, const BuildItem &_b)
+          {
+            return _a.center[axis] < _b.center[axis];
+          });
+    }
+
+    node.first = static_cast<uint32_t>(d.nodes.size());
+    node.count = 0;
+    node.axis = axis;
+    const uint32_t child = node.first;
+    d.nodes.emplace_back();
+    d.nodes.emplace_back();
+    tasks.push_back({child + 1, mid, task.end, task.depth + 1});
+    tasks.push_back({child, task.begin, mid, task.depth + 1});
+  }
+
+  // Store the triangles in the order of the leaves
+  std::vector<BVHTriangle> sorted(count);
+  for (uint32_t i = 0; i < count; ++i)
+    sorted[i] = d.triangles[items[i].index];
+  d.triangles.swap(sorted);
+}
+
+/////////////////////////////////////////////////
+size_t TriangleBVH::TriangleCount() const
+{
+  return this->dataPtr->triangles.size();
+}
+
+/////////////////////////////////////////////////
+bool TriangleBVH::Bounds(ignition::math::Vector3d &_min,
+    ignition::math::Vector3d &_max) const
+{
+  if (this->dataPtr->nodes.empty())
+    return false;
+
+  const BVHNode &root = this->dataPtr->nodes[0];
+  _min.Set(root.min[0], root.min[1], root.min[2]);
+  _max.Set(root.max[0], root.max[1], root.max[2]);
+  return true;
+}
+
+/////////////////////////////////////////////////
+void TriangleBVH::Intersect(RayPacket &_packet) const
+{
+  const auto &d = *this->dataPtr;
+  if (d.nodes.empty())
+    return;
+
+  uint32_t stack[kMaxDepth + 2];
+  unsigned int top = 0;
+  stack[top++] = 0;
+  while (top > 0)
+  {
+    const BVHNode &node = d.nodes[stack[--top]];
+    if (!_packet.HitsBox(node.min, node.max))
+      continue;
+
+    if (node.count > 0)
+    {
+      for (uint32_t i = node.first; i < node.first + node.count; ++i)
+        IntersectTriangle(d.triangles[i], _packet);
+      continue;
+    }
+
+    // Visit first the child on the side the rays come from
+    if (_packet.dir[node.axis][0] > 0)
+    {
+      stack[top++] = node.first + 1;
+      stack[top++] = node.first;
+    }
+    else
+    {
+      stack[top++] = node.first;
+      stack[top++] = node.first + 1;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+bool TriangleBVH::Intersect(const ignition::math::Vector3d &_origin,
+    const ignition::math::Vector3d &_dir, double &_dist) const
+{
+  RayPacket packet;
+  packet.count = 1;
+  packet.origin[0][0] = static_cast<float>(_origin.X());
+  packet.origin[1][0] = static_cast<float>(_origin.Y());
+  packet.origin[2][0] = static_cast<float>(_origin.Z());
+  packet.dir[0][0] = static_cast<float>(_dir.X());
+  packet.dir[1][0] = static_cast<float>(_dir.Y());
+  packet.dir[2][0] = static_cast<float>(_dir.Z());
+  packet.dist[0] = static_cast<float>(std::min(_dist,
+        static_cast<double>(FLT_MAX)));
+  packet.Prepare();
+
+  const float maxDist = packet.dist[0];
+  this->Intersect(packet);
+  if (packet.dist[0] >= maxDist)
+    return false;
+
+  _dist = packet.dist[0];
+  return true;
+}
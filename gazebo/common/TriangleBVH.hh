@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_TRIANGLEBVH_HH_
+#define GAZEBO_COMMON_TRIANGLEBVH_HH_
+
+#include <cstddef>
+#include <memory>
+
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    // Forward declarations.
+    class Mesh;
+    class SubMesh;
+    class TriangleBVHPrivate;
+
+    /// \addtogroup gazebo_common
+    /// \{
+
+    /// \brief Rays intersected together, see TriangleBVH::Intersect.
+    ///
+    /// Each component is stored in an array indexed by ray, so that the
+    /// loops over the rays of a packet are vectorized by the compiler.
+    class GZ_COMMON_VISIBLE RayPacket
+    {
+      /// \brief Maximum number of rays in a packet.
+      public: static constexpr unsigned int kSize = 8;
+
+      /// \brief Compute the inverse directions and disable the unused
+      /// rays. Call it after setting the rays and before intersecting
+      /// them.
+      public: void Prepare();
+
+      /// \brief Check whether a ray hits a box closer than its distance.
+      /// \param[in] _min Minimum corner of the box.
+      /// \param[in] _max Maximum corner of the box.
+      /// \return True if at least one ray hits the box.
+      public: bool HitsBox(const float *_min, const float *_max) const;
+
+      /// \brief Number of rays in use, at most kSize.
+      public: unsigned int count = 0;
+
+      /// \brief Origin of each ray, indexed by axis then by ray.
+      public: float origin[3][kSize];
+
+      /// \brief Direction of each ray, indexed by axis then by ray. It
+      /// does not need to be normalized, distances are measured in
+      /// multiples of its length.
+      public: float dir[3][kSize];
+
+      /// \brief Inverse of dir, set by Prepare.
+      public: float invDir[3][kSize];
+
+      /// \brief Distance of each ray. Set it to the maximum distance
+      /// before intersecting; it is lowered to the closest hit.
+      public: float dist[kSize];
+    };
+
+    /// \class TriangleBVH TriangleBVH.hh common/common.hh
+    /// \brief Bounding volume hierarchy of triangles, to find the closest
+    /// triangle hit by rays.
+    ///
+    /// Triangles are added, then Build sorts them into a tree of boxes,
+    /// after which Intersect can be called from several threads. Only
+    /// the side from which the vertices of a triangle are seen counter
+    /// clockwise is hit, as with the back face culling of rendering.
+    class GZ_COMMON_VISIBLE TriangleBVH
+    {
+      /// \brief Constructor.
+      public: TriangleBVH();
+
+      /// \brief Destructor.
+      public: ~TriangleBVH();
+
+      /// \brief Add a triangle.
+      /// \param[in] _a First vertex.
+      /// \param[in] _b Second vertex.
+      /// \param[in] _c Third vertex.
+      public: void AddTriangle(const ignition::math::Vector3d &_a,
+                  const ignition::math::Vector3d &_b,
+                  const ignition::math::Vector3d &_c);
+
+      /// \brief Add the triangles of all the submeshes of a mesh.
+      /// \param[in] _mesh The mesh.
+      /// \param[in] _scale Scale applied to the vertices.
+      public: void AddMesh(const Mesh &_mesh,
+                  const ignition::math::Vector3d &_scale);
+
+      /// \brief Add the triangles of a submesh. Submeshes made of other
+      /// primitives are ignored.
+      /// \param[in] _subMesh The submesh.
+      /// \param[in] _scale Scale applied to the vertices.
+      public: void AddSubMesh(const SubMesh &_subMesh,
+                  const ignition::math::Vector3d &_scale);
+
+      /// \brief Build the tree from the triangles added so far.
+      public: void Build();
+
+      /// \brief Get the number of triangles.
+      /// \return Number of triangles.
+      public: size_t TriangleCount() const;
+
+      /// \brief Get the box containing the triangles, once built.
+      /// \param[out] _min Minimum corner of the box.
+      /// \param[out] _max Maximum corner of the box.
+      /// \return False if the tree is empty or not built.
+      public: bool Bounds(ignition::math::Vector3d &_min,
+                  ignition::math::Vector3d &_max) const;
+
+      /// \brief Intersect a packet of rays with the triangles. The
+      /// distance of each ray is lowered to its closest hit.
+      /// \param[in,out] _packet Rays, prepared with RayPacket::Prepare.
+      public: void Intersect(RayPacket &_packet) const;
+
+      /// \brief Intersect one ray with the triangles.
+      /// \param[in] _origin Origin of the ray.
+      /// \param[in] _dir Direction of the ray.
+      /// \param[in,out] _dist Maximum distance, set to the distance of the
+      /// closest hit.
+      /// \return True if a triangle is hit.
+      public: bool Intersect(const ignition::math::Vector3d &_origin,
+                  const ignition::math::Vector3d &_dir, double &_dist) const;
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<TriangleBVHPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshManager.hh"
+#include "gazebo/common/TriangleBVH.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+using ignition::math::Vector3d;
+
+class TriangleBVHTest : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+TEST_F(TriangleBVHTest, Triangle)
+{
+  common::TriangleBVH bvh;
+  Vector3d min, max;
+  double dist = 10;
+  bvh.Build();
+  EXPECT_FALSE(bvh.Bounds(min, max));
+  EXPECT_FALSE(bvh.Intersect(Vector3d::Zero, Vector3d::UnitZ, dist));
+
+  bvh.AddTriangle(Vector3d(0, 0, 0), Vector3d(2, 0, 0), Vector3d(0, 2, 0));
+  bvh.Build();
+  EXPECT_EQ(1u, bvh.TriangleCount());
+  EXPECT_TRUE(bvh.Bounds(min, max));
+  EXPECT_EQ(Vector3d(0, 0, 0), min);
+  EXPECT_EQ(Vector3d(2, 2, 0), max);
+
+  // The triangle faces +z, so it is only hit from above
+  EXPECT_TRUE(bvh.Intersect(Vector3d(0.5, 0.5, 3), -Vector3d::UnitZ, dist));
+  EXPECT_NEAR(3.0, dist, 1e-6);
+  dist = 10;
+  EXPECT_FALSE(bvh.Intersect(Vector3d(0.5, 0.5, -3), Vector3d::UnitZ, dist));
+  EXPECT_DOUBLE_EQ(10.0, dist);
+
+  // Misses beside the triangle and beyond the maximum distance
+  EXPECT_FALSE(bvh.Intersect(Vector3d(1.5, 1.5, 3), -Vector3d::UnitZ, dist));
+  dist = 2;
+  EXPECT_FALSE(bvh.Intersect(Vector3d(0.5, 0.5, 3), -Vector3d::UnitZ, dist));
+
+  // Distances are measured in multiples of the direction
+  dist = 10;
+  EXPECT_TRUE(bvh.Intersect(Vector3d(0.5, 0.5, 3),
+      Vector3d(0, 0, -2), dist));
+  EXPECT_NEAR(1.5, dist, 1e-6);
+}
+
+/////////////////////////////////////////////////
+TEST_F(TriangleBVHTest, Mesh)
+{
+  const common::Mesh *mesh =
+      common::MeshManager::Instance()->GetMesh("unit_box");
+  ASSERT_NE(nullptr, mesh);
+
+  common::TriangleBVH bvh;
+  bvh.AddMesh(*mesh, Vector3d(2, 4, 6));
+  bvh.Build();
+  EXPECT_EQ(12u, bvh.TriangleCount());
+  Vector3d min, max;
+  EXPECT_TRUE(bvh.Bounds(min, max));
+  EXPECT_EQ(Vector3d(-1, -2, -3), min);
+  EXPECT_EQ(Vector3d(1, 2, 3), max);
+
+  // Each face is hit from outside, none from inside
+  const Vector3d dirs[] = {Vector3d::UnitX, Vector3d::UnitY,
+      Vector3d::UnitZ};
+  for (const Vector3d &dir : dirs)
+  {
+    const double half = (dir * max).Sum();
+    for (const double sign : {1.0, -1.0})
+    {
+      double dist = 100;
+      EXPECT_TRUE(bvh.Intersect(dir * sign * 10, -dir * sign, dist));
+      EXPECT_NEAR(10 - half, dist, 1e-5);
+
+      dist = 100;
+      EXPECT_FALSE(bvh.Intersect(Vector3d::Zero, dir * sign, dist));
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(TriangleBVHTest, Packet)
+{
+  // A grid of triangles facing +z at z = 1, with a hole in the middle
+  common::TriangleBVH bvh;
+  for (int i = -10; i < 10; ++i)
+  {
+    for (int j = -10; j < 10; ++j)
+    {
+      if (i == 0 && j == 0)
+        continue;
+      bvh.AddTriangle(Vector3d(i, j, 1), Vector3d(i + 1, j, 1),
+          Vector3d(i + 1, j + 1, 1));
+      bvh.AddTriangle(Vector3d(i, j, 1), Vector3d(i + 1, j + 1, 1),
+          Vector3d(i, j + 1, 1));
+    }
+  }
+  bvh.Build();
+  EXPECT_EQ(798u, bvh.TriangleCount());
+
+  // Five rays pointing down from z = 4, the first through the hole
+  common::RayPacket packet;
+  packet.count = 5;
+  for (unsigned int i = 0; i < packet.count; ++i)
+  {
+    packet.origin[0][i] = 0.5f + 2 * i;
+    packet.origin[1][i] = 0.5f;
+    packet.origin[2][i] = 4;
+    packet.dir[0][i] = 0;
+    packet.dir[1][i] = 0;
+    packet.dir[2][i] = -1;
+    packet.dist[i] = 100;
+  }
+  packet.Prepare();
+  bvh.Intersect(packet);
+
+  EXPECT_FLOAT_EQ(100, packet.dist[0]);
+  for (unsigned int i = 1; i < packet.count; ++i)
+    EXPECT_NEAR(3, packet.dist[i], 1e-5);
+
+  // Unused rays are never hit
+  for (unsigned int i = packet.count; i < common::RayPacket::kSize; ++i)
+    EXPECT_LT(packet.dist[i], 0);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
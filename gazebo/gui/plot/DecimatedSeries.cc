@@ -0,0 +1,402 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#include <ignition/math/Helpers.hh>
+
+#include "gazebo/common/Assert.hh"
+#include "gazebo/gui/plot/DecimatedSeries.hh"
+
+using namespace gazebo;
+using namespace gui;
+
+namespace gazebo
+{
+  namespace gui
+  {
+    /// \brief Summary of a bucket of consecutive samples.
+    struct MinMaxBucket
+    {
+      /// \brief Sample with the minimum y value.
+      public: ignition::math::Vector2d min;
+
+      /// \brief Sample with the maximum y value.
+      public: ignition::math::Vector2d max;
+
+      /// \brief Minimum x value in the bucket.
+      public: double minX;
+
+      /// \brief Maximum x value in the bucket.
+      public: double maxX;
+    };
+
+    /// \brief One level of the min/max pyramid.
+    struct MinMaxLevel
+    {
+      /// \brief Number of samples summarized by each bucket.
+      public: uint64_t span;
+
+      /// \brief Ring buffer of buckets, indexed by bucket number modulo
+      /// size.
+      public: std::vector<MinMaxBucket> buckets;
+    };
+
+    /// \internal
+    /// \brief DecimatedSeries private data
+    class DecimatedSeriesPrivate
+    {
+      /// \brief Reset all storage for the given capacity.
+      /// \param[in] _capacity New capacity.
+      public: void Reset(const size_t _capacity);
+
+      /// \brief Get the sample with the given sequence number.
+      /// \param[in] _seq Sequence number, must be in [first, next).
+      /// \return Stored sample.
+      public: const ignition::math::Vector2d &At(const uint64_t _seq) const
+              {
+                return this->samples[_seq % this->capacity];
+              }
+
+      /// \brief Find the first sequence number in [first, next) whose
+      /// sample has an x value not less than _x.
+      /// \param[in] _x X value to search for.
+      /// \return Sequence number, or next if there is none.
+      public: uint64_t LowerBound(const double _x) const;
+
+      /// \brief Visit the samples in [_start, _end) using the coarsest
+      /// summaries available at or below a given level. Buckets of that
+      /// level that are fully inside the range are passed to _bucketCb,
+      /// and the partial ranges at either end are split recursively across
+      /// the finer levels, down to raw samples passed to _sampleCb.
+      /// \param[in] _start First sequence number.
+      /// \param[in] _end One past the last sequence number.
+      /// \param[in] _level Number of levels that may be used, i.e. index of
+      /// the coarsest usable level plus one.
+      /// \param[in] _bucketCb Called for every visited bucket.
+      /// \param[in] _sampleCb Called for every visited raw sample.
+      public: template<typename BucketCb, typename SampleCb>
+              void Visit(const uint64_t _start, const uint64_t _end,
+                  const size_t _level, BucketCb &_bucketCb,
+                  SampleCb &_sampleCb) const
+              {
+                if (_start >= _end)
+                  return;
+
+                if (_level == 0u)
+                {
+                  for (uint64_t s = _start; s < _end; ++s)
+                    _sampleCb(this->At(s));
+                  return;
+                }
+
+                const MinMaxLevel &level = this->levels[_level - 1u];
+                uint64_t firstFull = (_start + level.span - 1u) / level.span;
+                uint64_t lastFull = _end / level.span;
+                if (firstFull >= lastFull)
+                {
+                  this->Visit(_start, _end, _level - 1u, _bucketCb,
+                      _sampleCb);
+                  return;
+                }
+
+                this->Visit(_start, firstFull * level.span, _level - 1u,
+                    _bucketCb, _sampleCb);
+                for (uint64_t b = firstFull; b < lastFull; ++b)
+                  _bucketCb(level.buckets[b % level.buckets.size()]);
+                this->Visit(lastFull * level.span, _end, _level - 1u,
+                    _bucketCb, _sampleCb);
+              }
+
+      /// \brief Bucket size ratio between consecutive levels.
+      public: static const uint64_t LevelFactor = 8u;
+
+      /// \brief Minimum number of buckets kept by the coarsest level.
+      public: static const uint64_t MinTopBuckets = 16u;
+
+      /// \brief Protects all members below.
+      public: mutable std::mutex mutex;
+
+      /// \brief Maximum number of stored samples.
+      public: size_t capacity = 0u;
+
+      /// \brief Ring buffer of samples, indexed by sequence number modulo
+      /// capacity. Grows on demand up to the capacity.
+      public: std::vector<ignition::math::Vector2d> samples;
+
+      /// \brief Sequence number of the oldest stored sample.
+      public: uint64_t first = 0u;
+
+      /// \brief Sequence number of the next sample to be added.
+      public: uint64_t next = 0u;
+
+      /// \brief Min/max pyramid, finest level first.
+      public: std::vector<MinMaxLevel> levels;
+    };
+  }
+}
+
+/////////////////////////////////////////////////
+void DecimatedSeriesPrivate::Reset(const size_t _capacity)
+{
+  this->capacity = _capacity;
+  this->samples.clear();
+  this->samples.shrink_to_fit();
+  this->first = 0u;
+  this->next = 0u;
+
+  this->levels.clear();
+  for (uint64_t span = LevelFactor; span * MinTopBuckets <= _capacity;
+      span *= LevelFactor)
+  {
+    MinMaxLevel level;
+    level.span = span;
+    // +2 so that a partially evicted bucket at the front and a partially
+    // filled bucket at the back can coexist with all full buckets.
+    level.buckets.resize(_capacity / span + 2u);
+    this->levels.push_back(level);
+  }
+}
+
+/////////////////////////////////////////////////
+uint64_t DecimatedSeriesPrivate::LowerBound(const double _x) const
+{
+  uint64_t lo = this->first;
+  uint64_t hi = this->next;
+  while (lo < hi)
+  {
+    uint64_t mid = lo + (hi - lo) / 2u;
+    if (this->At(mid).X() < _x)
+      lo = mid + 1u;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+/////////////////////////////////////////////////
+DecimatedSeries::DecimatedSeries(const size_t _capacity)
+  : dataPtr(new DecimatedSeriesPrivate)
+{
+  GZ_ASSERT(_capacity > 0u, "Capacity must be greater than zero");
+  this->dataPtr->Reset(_capacity);
+}
+
+/////////////////////////////////////////////////
+DecimatedSeries::~DecimatedSeries()
+{
+}
+
+/////////////////////////////////////////////////
+void DecimatedSeries::SetCapacity(const size_t _capacity)
+{
+  GZ_ASSERT(_capacity > 0u, "Capacity must be greater than zero");
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->Reset(_capacity);
+}
+
+/////////////////////////////////////////////////
+size_t DecimatedSeries::Capacity() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->capacity;
+}
+
+/////////////////////////////////////////////////
+void DecimatedSeries::Add(const ignition::math::Vector2d &_pt)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+  auto &d = *this->dataPtr;
+  uint64_t seq = d.next++;
+
+  if (d.samples.size() < d.capacity)
+    d.samples.push_back(_pt);
+  else
+    d.samples[seq % d.capacity] = _pt;
+
+  if (d.next - d.first > d.capacity)
+    ++d.first;
+
+  for (auto &level : d.levels)
+  {
+    uint64_t b = seq / level.span;
+    MinMaxBucket &bucket = level.buckets[b % level.buckets.size()];
+    if (seq % level.span == 0u)
+    {
+      bucket.min = _pt;
+      bucket.max = _pt;
+      bucket.minX = _pt.X();
+      bucket.maxX = _pt.X();
+      continue;
+    }
+
+    if (_pt.Y() < bucket.min.Y())
+      bucket.min = _pt;
+    if (_pt.Y() > bucket.max.Y())
+      bucket.max = _pt;
+    bucket.minX = std::min(bucket.minX, _pt.X());
+    bucket.maxX = std::max(bucket.maxX, _pt.X());
+  }
+}
+
+/////////////////////////////////////////////////
+void DecimatedSeries::Add(const std::vector<ignition::math::Vector2d> &_pts)
+{
+  for (const auto &pt : _pts)
+    this->Add(pt);
+}
+
+/////////////////////////////////////////////////
+void DecimatedSeries::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->Reset(this->dataPtr->capacity);
+}
+
+/////////////////////////////////////////////////
+size_t DecimatedSeries::Size() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return static_cast<size_t>(this->dataPtr->next - this->dataPtr->first);
+}
+
+/////////////////////////////////////////////////
+size_t DecimatedSeries::Evicted() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return static_cast<size_t>(this->dataPtr->first);
+}
+
+/////////////////////////////////////////////////
+ignition::math::Vector2d DecimatedSeries::Point(const size_t _index) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (_index >= this->dataPtr->next - this->dataPtr->first)
+  {
+    return ignition::math::Vector2d(ignition::math::NAN_D,
+        ignition::math::NAN_D);
+  }
+  return this->dataPtr->At(this->dataPtr->first + _index);
+}
+
+/////////////////////////////////////////////////
+std::vector<ignition::math::Vector2d> DecimatedSeries::Points() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  std::vector<ignition::math::Vector2d> pts;
+  pts.reserve(this->dataPtr->next - this->dataPtr->first);
+  for (uint64_t s = this->dataPtr->first; s < this->dataPtr->next; ++s)
+    pts.push_back(this->dataPtr->At(s));
+  return pts;
+}
+
+/////////////////////////////////////////////////
+bool DecimatedSeries::Bounds(ignition::math::Vector2d &_min,
+    ignition::math::Vector2d &_max) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto &d = *this->dataPtr;
+  if (d.next == d.first)
+    return false;
+
+  const double inf = std::numeric_limits<double>::infinity();
+  _min.Set(inf, inf);
+  _max.Set(-inf, -inf);
+
+  auto bucketCb = [&](const MinMaxBucket &_bucket)
+  {
+    _min.X(std::min(_min.X(), _bucket.minX));
+    _max.X(std::max(_max.X(), _bucket.maxX));
+    _min.Y(std::min(_min.Y(), _bucket.min.Y()));
+    _max.Y(std::max(_max.Y(), _bucket.max.Y()));
+  };
+  auto sampleCb = [&](const ignition::math::Vector2d &_pt)
+  {
+    _min.Min(_pt);
+    _max.Max(_pt);
+  };
+  d.Visit(d.first, d.next, d.levels.size(), bucketCb, sampleCb);
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+std::vector<ignition::math::Vector2d> DecimatedSeries::Decimate(
+    const double _minX, const double _maxX, const size_t _maxPoints) const
+{
+  std::vector<ignition::math::Vector2d> result;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto &d = *this->dataPtr;
+  if (d.next == d.first || _maxX < _minX)
+    return result;
+
+  // Visible range plus one sample on each side.
+  uint64_t start = d.LowerBound(_minX);
+  if (start > d.first)
+    --start;
+  uint64_t end = d.LowerBound(_maxX);
+  if (end < d.next)
+    ++end;
+  if (start >= end)
+    return result;
+
+  uint64_t count = end - start;
+
+  // Use the finest level whose buckets fit in the budget. Each bucket
+  // contributes up to two samples.
+  size_t levelCount = 0u;
+  if (count > _maxPoints)
+  {
+    for (const auto &level : d.levels)
+    {
+      ++levelCount;
+      if ((count / level.span + 2u) * 2u <= _maxPoints)
+        break;
+    }
+  }
+
+  auto bucketCb = [&](const MinMaxBucket &_bucket)
+  {
+    if (_bucket.min == _bucket.max)
+    {
+      result.push_back(_bucket.min);
+    }
+    else if (_bucket.min.X() <= _bucket.max.X())
+    {
+      result.push_back(_bucket.min);
+      result.push_back(_bucket.max);
+    }
+    else
+    {
+      result.push_back(_bucket.max);
+      result.push_back(_bucket.min);
+    }
+  };
+  auto sampleCb = [&](const ignition::math::Vector2d &_pt)
+  {
+    result.push_back(_pt);
+  };
+
+  result.reserve(std::min(count, static_cast<uint64_t>(_maxPoints) * 2u));
+  d.Visit(start, end, levelCount, bucketCb, sampleCb);
+
+  return result;
+}
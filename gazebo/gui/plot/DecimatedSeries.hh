@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_GUI_PLOT_DECIMATEDSERIES_HH_
+#define GAZEBO_GUI_PLOT_DECIMATEDSERIES_HH_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <ignition/math/Vector2.hh>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace gui
+  {
+    // Forward declare private data class
+    class DecimatedSeriesPrivate;
+
+    /// \brief A bounded history of 2d samples with a multi-resolution
+    /// min/max pyramid on top of it.
+    ///
+    /// Samples are stored in a ring buffer so that the oldest samples are
+    /// evicted one at a time once the capacity is reached. Every sample is
+    /// also folded into a set of coarser levels, each of which stores the
+    /// minimum and maximum y value of a fixed size bucket of consecutive
+    /// samples. A query for a given x range and pixel budget is then
+    /// answered from the level whose bucket count fits the budget, so the
+    /// cost of rendering depends on the plot width rather than on the
+    /// number of samples.
+    ///
+    /// Samples are assumed to be added in increasing x order, which is
+    /// the case for sim time based curves. All functions are thread safe,
+    /// so samples can be added from a transport thread while the GUI thread
+    /// queries the series.
+    class GZ_GUI_VISIBLE DecimatedSeries
+    {
+      /// \brief Constructor.
+      /// \param[in] _capacity Maximum number of samples kept in history.
+      public: explicit DecimatedSeries(
+          const size_t _capacity = DecimatedSeries::DefaultCapacity);
+
+      /// \brief Destructor.
+      public: ~DecimatedSeries();
+
+      /// \brief Set the maximum number of samples kept in history. This
+      /// clears all existing samples.
+      /// \param[in] _capacity New capacity, must be greater than zero.
+      public: void SetCapacity(const size_t _capacity);
+
+      /// \brief Get the maximum number of samples kept in history.
+      /// \return Capacity of the series.
+      public: size_t Capacity() const;
+
+      /// \brief Add a sample, evicting the oldest one if the series is full.
+      /// \param[in] _pt Sample to add.
+      public: void Add(const ignition::math::Vector2d &_pt);
+
+      /// \brief Add a list of samples.
+      /// \param[in] _pts Samples to add, in increasing x order.
+      public: void Add(const std::vector<ignition::math::Vector2d> &_pts);
+
+      /// \brief Remove all samples.
+      public: void Clear();
+
+      /// \brief Get the number of samples currently stored.
+      /// \return Number of samples.
+      public: size_t Size() const;
+
+      /// \brief Get the number of samples that have been evicted because
+      /// the capacity was reached.
+      /// \return Number of evicted samples since the last Clear.
+      public: size_t Evicted() const;
+
+      /// \brief Get a sample. Index 0 is the oldest stored sample.
+      /// \param[in] _index Index of the sample.
+      /// \return The sample, or a Vector2d of nans if the index is out of
+      /// bounds.
+      public: ignition::math::Vector2d Point(const size_t _index) const;
+
+      /// \brief Get a copy of all the stored samples, oldest first.
+      /// \return All samples.
+      public: std::vector<ignition::math::Vector2d> Points() const;
+
+      /// \brief Get the bounding box of the stored samples.
+      /// \param[out] _min Minimum x and y values.
+      /// \param[out] _max Maximum x and y values.
+      /// \return False if the series is empty.
+      public: bool Bounds(ignition::math::Vector2d &_min,
+          ignition::math::Vector2d &_max) const;
+
+      /// \brief Get a min/max decimated view of the samples in an x range.
+      /// Samples are returned unmodified if they fit in the budget, otherwise
+      /// each bucket of the selected level contributes its minimum and its
+      /// maximum sample, in x order. One sample on each side of the range
+      /// is included so that lines reach the edges of the plot.
+      /// \param[in] _minX Lower bound of the x range.
+      /// \param[in] _maxX Upper bound of the x range.
+      /// \param[in] _maxPoints Budget of samples to return.
+      /// \return Decimated samples in increasing x order.
+      public: std::vector<ignition::math::Vector2d> Decimate(
+          const double _minX, const double _maxX,
+          const size_t _maxPoints) const;
+
+      /// \brief Default capacity, a bit over an hour of history for a
+      /// variable updated at 1 kHz.
+      public: static const size_t DefaultCapacity = 1u << 22;
+
+      /// \internal
+      /// \brief Private data pointer
+      private: std::unique_ptr<DecimatedSeriesPrivate> dataPtr;
+    };
+  }
+}
+#endif
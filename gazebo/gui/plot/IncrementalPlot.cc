@@ -148,9 +148,6 @@ namespace gazebo
       /// \brief The curve to draw.
       public: CurveMap curves;
 
-      /// \brief Drawing utility
-      public: QwtPlotDirectPainter *directPainter;
-
       /// \brief Pointer to the plot magnifier.
       public: PlotMagnifier *magnifier;
 
@@ -183,7 +180,6 @@ IncrementalPlot::IncrementalPlot(QWidget *_parent)
   this->setObjectName("incrementalPlot");
 
   this->dataPtr->period = 10;
-  this->dataPtr->directPainter = new QwtPlotDirectPainter(this);
 
   // panning with the left mouse button
   this->dataPtr->panner = new QwtPlotPanner(this->canvas());
@@ -353,18 +349,6 @@ void IncrementalPlot::Update()
       continue;
 
     lastPoint = curve.second->Point(pointCount-1);
-
-    if (ignition::math::isnan(lastPoint.X()) ||
-        ignition::math::isnan(lastPoint.Y()))
-    {
-      continue;
-    }
-
-    ignition::math::Vector2d minPt = curve.second->Min();
-    ignition::math::Vector2d maxPt = curve.second->Max();
-
-    this->dataPtr->directPainter->drawSeries(curve.second->Curve(),
-      pointCount - 1, pointCount - 1);
   }
 
   // get x axis lower and upper bounds
@@ -399,6 +383,13 @@ void IncrementalPlot::Update()
   this->dataPtr->prevPoint = lastPoint;
   this->setAxisScale(QwtPlot::xBottom, minX, maxX);
 
+  // only hand the visible, decimated part of each curve to qwt
+  unsigned int width = static_cast<unsigned int>(this->canvas()->width());
+  for (auto &curve : this->dataPtr->curves)
+  {
+    curve.second->UpdateView(ignition::math::Vector2d(minX, maxX), width);
+  }
+
   this->dataPtr->tracker->Update();
   this->replot();
 }
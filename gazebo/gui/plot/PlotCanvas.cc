@@ -975,11 +975,8 @@ void PlotCanvas::ExportCSV(const std::string &_filePrefix) const
       std::ofstream out(filename);
       // \todo: fix hardcoded sim_time
       out << "sim_time, " << c->Label() << std::endl;
-      for (unsigned int j = 0; j < c->Size(); ++j)
-      {
-        ignition::math::Vector2d pt = c->Point(j);
+      for (const auto &pt : c->Points())
         out << pt.X() << ", " << pt.Y() << std::endl;
-      }
       out.close();
 
       gzmsg << "Plot exported to file [" << filename << "]" << std::endl;
@@ -14,12 +14,15 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
 #include <map>
 #include <ignition/math/Color.hh>
 
 #include "gazebo/common/Assert.hh"
+#include "gazebo/common/Console.hh"
 
 #include "gazebo/gui/Conversions.hh"
+#include "gazebo/gui/plot/DecimatedSeries.hh"
 #include "gazebo/gui/plot/qwt_gazebo.h"
 #include "gazebo/gui/plot/IncrementalPlot.hh"
 #include "gazebo/gui/plot/PlotCurve.hh"
@@ -45,18 +48,43 @@ namespace gazebo
           Colors[ColorGroupCount][ColorCount];
     };
 
-    /// \brief A class that manages curve data
-    class CurveData: public QwtArraySeriesData<QPointF>
+    /// \brief A class that manages curve data. The full sample history
+    /// is kept in a DecimatedSeries, and Qwt is only handed a min/max
+    /// decimated view of the visible x range, sized to the plot width.
+    class CurveData: public QwtSeriesData<QPointF>
     {
       public: CurveData()
               {}
 
-      /// \brief Add a point to the sample.
-      /// \return Bounding box of the sample.
+      /// \brief Get the number of samples in the current view.
+      /// \return Number of samples to render.
+      public: virtual size_t size() const
+              {
+                return this->view.size();
+              }
+
+      /// \brief Get a sample of the current view.
+      /// \param[in] _i Index of the sample.
+      /// \return Sample to render.
+      public: virtual QPointF sample(size_t _i) const
+              {
+                return this->view[static_cast<int>(_i)];
+              }
+
+      /// \brief Get the bounding box of all the samples in history.
+      /// \return Bounding box of the samples.
       public: virtual QRectF boundingRect() const
               {
-                if (this->d_boundingRect.width() < 0.0)
-                  this->d_boundingRect = qwtBoundingRect(*this);
+                ignition::math::Vector2d min;
+                ignition::math::Vector2d max;
+                if (!this->series.Bounds(min, max))
+                {
+                  this->d_boundingRect = QRectF(0.0, 0.0, -1.0, -1.0);
+                  return this->d_boundingRect;
+                }
+
+                this->d_boundingRect.setCoords(
+                    min.X(), min.Y(), max.X(), max.Y());
 
                 // set a minimum bounding box height
                 // this prevents plot's auto scale to zoom in on near-zero
@@ -75,58 +103,52 @@ namespace gazebo
                 return this->d_boundingRect;
               }
 
-      /// \brief Add a point to the sample.
-      /// \param[in] _point Point to add.
-      public: inline void Add(const QPointF &_point)
+      /// \brief Called by Qwt when the visible area of the plot changes.
+      /// \param[in] _rect Visible area in plot coordinates.
+      public: virtual void setRectOfInterest(const QRectF &_rect)
               {
-                this->d_samples += _point;
+                this->UpdateView(_rect.left(), _rect.right(), this->width);
+              }
 
-                if (this->d_samples.size() > maxSampleSize)
-                {
-                  // remove sample window
-                  // update bounding rect?
-                  this->d_samples.remove(0, windowSize);
-                }
+      /// \brief Rebuild the decimated view.
+      /// \param[in] _minX Lower bound of the visible x range.
+      /// \param[in] _maxX Upper bound of the visible x range.
+      /// \param[in] _width Width of the plot canvas in pixels.
+      public: void UpdateView(const double _minX, const double _maxX,
+                  const unsigned int _width)
+              {
+                this->width = std::max(1u, _width);
 
-                if (this->d_samples.size() == 1)
-                {
-                  // init bounding rect
-                  this->d_boundingRect.setTopLeft(_point);
-                  this->d_boundingRect.setBottomRight(_point);
-                  return;
-                }
+                // A min and a max sample per pixel column, with some
+                // slack for the coarse steps between pyramid levels.
+                auto pts = this->series.Decimate(_minX, _maxX,
+                    static_cast<size_t>(this->width) * 4u);
 
-                // expand bounding rect
-                if (_point.x() < this->d_boundingRect.left())
-                  this->d_boundingRect.setLeft(_point.x());
-                else if (_point.x() > this->d_boundingRect.right())
-                  this->d_boundingRect.setRight(_point.x());
-                if (_point.y() < this->d_boundingRect.top())
-                  this->d_boundingRect.setTop(_point.y());
-                else if (_point.y() > this->d_boundingRect.bottom())
-                  this->d_boundingRect.setBottom(_point.y());
+                this->view.resize(static_cast<int>(pts.size()));
+                for (size_t i = 0; i < pts.size(); ++i)
+                  this->view[static_cast<int>(i)] =
+                      QPointF(pts[i].X(), pts[i].Y());
               }
 
       /// \brief Clear the sample data.
       public: void Clear()
               {
-                this->d_samples.clear();
-                this->d_samples.squeeze();
+                this->series.Clear();
+                this->view.clear();
+                this->view.squeeze();
                 this->d_boundingRect = QRectF(0.0, 0.0, -1.0, -1.0);
               }
 
-      /// \brief Get the sample data.
-      /// \return A vector of same points.
-      public: QVector<QPointF> Samples() const
-              {
-                return this->d_samples;
-              }
+      /// \brief Sample history. Thread safe, so it can be filled from
+      /// transport threads.
+      public: DecimatedSeries series;
 
-      /// \brief maxium sample size of this curve.
-      private: int maxSampleSize = 11000;
+      /// \brief Decimated samples currently handed to Qwt. Only accessed
+      /// from the GUI thread.
+      private: QVector<QPointF> view;
 
-      /// \brief Size of samples to remove when maxSampleSize is reached.
-      private: int windowSize = 1000;
+      /// \brief Width of the plot canvas in pixels, used to size the view.
+      private: unsigned int width = 1000u;
     };
 
 
@@ -256,7 +278,7 @@ void PlotCurve::AddPoint(const ignition::math::Vector2d &_pt)
     return;
 
   // Add a point
-  this->dataPtr->curveData->Add(QPointF(_pt.X(), _pt.Y()));
+  this->dataPtr->curveData->series.Add(_pt);
 }
 
 /////////////////////////////////////////////////
@@ -266,10 +288,7 @@ void PlotCurve::AddPoints(const std::vector<ignition::math::Vector2d> &_pts)
     return;
 
   // Add all the points
-  for (const auto &pt : _pts)
-  {
-    this->dataPtr->curveData->Add(QPointF(pt.X(), pt.Y()));
-  }
+  this->dataPtr->curveData->series.Add(_pts);
 }
 
 /////////////////////////////////////////////////
@@ -342,7 +361,26 @@ void PlotCurve::SetAge(const unsigned int _age)
 /////////////////////////////////////////////////
 unsigned int PlotCurve::Size() const
 {
-  return static_cast<unsigned int>(this->dataPtr->curveData->samples().size());
+  return static_cast<unsigned int>(this->dataPtr->curveData->series.Size());
+}
+
+/////////////////////////////////////////////////
+void PlotCurve::SetMaxSize(const unsigned int _size)
+{
+  if (_size == 0u)
+  {
+    gzerr << "Curve size must be greater than zero" << std::endl;
+    return;
+  }
+
+  this->dataPtr->curveData->series.SetCapacity(_size);
+}
+
+/////////////////////////////////////////////////
+unsigned int PlotCurve::MaxSize() const
+{
+  return static_cast<unsigned int>(
+      this->dataPtr->curveData->series.Capacity());
 }
 
 /////////////////////////////////////////////////
@@ -362,15 +400,26 @@ ignition::math::Vector2d PlotCurve::Max()
 /////////////////////////////////////////////////
 ignition::math::Vector2d PlotCurve::Point(const unsigned int _index) const
 {
-  if (_index >= static_cast<unsigned int>(
-      this->dataPtr->curveData->samples().size()))
-  {
-    return ignition::math::Vector2d(ignition::math::NAN_D,
-        ignition::math::NAN_D);
-  }
+  return this->dataPtr->curveData->series.Point(_index);
+}
+
+/////////////////////////////////////////////////
+std::vector<ignition::math::Vector2d> PlotCurve::Points() const
+{
+  return this->dataPtr->curveData->series.Points();
+}
 
-  const QPointF &pt = this->dataPtr->curveData->samples()[_index];
-  return ignition::math::Vector2d(pt.x(), pt.y());
+/////////////////////////////////////////////////
+void PlotCurve::UpdateView(const ignition::math::Vector2d &_range,
+    const unsigned int _width)
+{
+  this->dataPtr->curveData->UpdateView(_range.X(), _range.Y(), _width);
+}
+
+/////////////////////////////////////////////////
+unsigned int PlotCurve::ViewSize() const
+{
+  return static_cast<unsigned int>(this->dataPtr->curveData->size());
 }
 
 /////////////////////////////////////////////////
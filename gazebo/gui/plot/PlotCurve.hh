@@ -38,6 +38,11 @@ namespace gazebo
     class IncrementalPlot;
 
     /// \brief Plot Curve data.
+    ///
+    /// The curve keeps a bounded history of samples and renders a min/max
+    /// decimated view of it, so drawing cost depends on the plot width
+    /// rather than on the number of samples. Points can be added from any
+    /// thread.
     class GZ_GUI_VISIBLE PlotCurve
     {
       /// \brief Constructor.
@@ -103,6 +108,28 @@ namespace gazebo
       /// \return Number of data points.
       public: unsigned int Size() const;
 
+      /// \brief Set the maximum number of data points kept in the curve
+      /// history. Once full, the oldest points are discarded as new ones
+      /// are added. This clears all existing data.
+      /// \param[in] _size Maximum number of data points.
+      public: void SetMaxSize(const unsigned int _size);
+
+      /// \brief Get the maximum number of data points kept in the curve
+      /// history.
+      /// \return Maximum number of data points.
+      public: unsigned int MaxSize() const;
+
+      /// \brief Update the set of points that is rendered.
+      /// \param[in] _range Visible x range, min in X and max in Y.
+      /// \param[in] _width Width of the plot canvas in pixels.
+      public: void UpdateView(const ignition::math::Vector2d &_range,
+          const unsigned int _width);
+
+      /// \brief Get the number of points that are rendered, as computed by
+      /// the last call to UpdateView.
+      /// \return Number of rendered points.
+      public: unsigned int ViewSize() const;
+
       /// \brief Get the min x and y values of this curve
       /// \return Point with min values
       public: ignition::math::Vector2d Min();
@@ -15,6 +15,10 @@
  *
 */
 
+#include <algorithm>
+#include <cmath>
+
+#include "gazebo/gui/plot/qwt_gazebo.h"
 #include "gazebo/gui/plot/PlottingTypes.hh"
 #include "gazebo/gui/plot/PlotCurve.hh"
 #include "gazebo/gui/plot/PlotCurve_TEST.hh"
@@ -133,5 +137,60 @@ void PlotCurve_TEST::AddPoint()
   delete plotCurve;
 }
 
+/////////////////////////////////////////////////
+void PlotCurve_TEST::LongHistory()
+{
+  this->resMaxPercentChange = 5.0;
+  this->shareMaxPercentChange = 2.0;
+
+  this->Load("worlds/empty.world");
+
+  // Create a new plot curve with a small history
+  gazebo::gui::PlotCurve *plotCurve = new gazebo::gui::PlotCurve("curve01");
+  QVERIFY(plotCurve != nullptr);
+  plotCurve->SetMaxSize(1000u);
+  QCOMPARE(plotCurve->MaxSize(), 1000u);
+
+  // add more points than the curve can hold, with a single spike
+  unsigned int ptSize = 5000;
+  for (unsigned int i = 0; i < ptSize; ++i)
+  {
+    double y = (i == 4500u) ? 100.0 : std::sin(i * 0.1);
+    plotCurve->AddPoint(ignition::math::Vector2d(i * 0.01, y));
+  }
+
+  // verify only the most recent points are kept
+  QCOMPARE(plotCurve->Size(), 1000u);
+  QCOMPARE(plotCurve->Point(0), ignition::math::Vector2d(40.0,
+      std::sin(4000 * 0.1)));
+  QCOMPARE(plotCurve->Point(999), ignition::math::Vector2d(49.99,
+      std::sin(4999 * 0.1)));
+  QCOMPARE(plotCurve->Points().size(), size_t(1000u));
+  QVERIFY(ignition::math::equal(plotCurve->Max().Y(), 100.0));
+
+  // a narrow view is rendered from raw points
+  plotCurve->UpdateView(ignition::math::Vector2d(45.0, 45.1), 100u);
+  QVERIFY(plotCurve->ViewSize() > 0u);
+  QVERIFY(plotCurve->ViewSize() <= 13u);
+
+  // a wide view is decimated to the width of the plot, but keeps the spike
+  plotCurve->UpdateView(ignition::math::Vector2d(0.0, 50.0), 100u);
+  QVERIFY(plotCurve->ViewSize() > 0u);
+  QVERIFY(plotCurve->ViewSize() <= 400u);
+  double maxY = 0;
+  for (unsigned int i = 0; i < plotCurve->ViewSize(); ++i)
+  {
+    maxY = std::max(maxY,
+        plotCurve->Curve()->data()->sample(i).y());
+  }
+  QVERIFY(ignition::math::equal(maxY, 100.0));
+
+  // setting a new size clears the curve
+  plotCurve->SetMaxSize(10u);
+  QCOMPARE(plotCurve->Size(), 0u);
+
+  delete plotCurve;
+}
+
 // Generate a main function for the test
 QTEST_MAIN(PlotCurve_TEST)
@@ -32,5 +32,8 @@ class PlotCurve_TEST : public QTestFixture
 
   /// \brief Test adding points to the curve
   private slots: void AddPoint();
+
+  /// \brief Test bounded history and decimated rendering of large curves
+  private slots: void LongHistory();
 };
 #endif
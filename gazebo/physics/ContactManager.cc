@@ -26,10 +26,54 @@
 #include "gazebo/physics/Collision.hh"
 #include "gazebo/physics/Contact.hh"
 #include "gazebo/physics/ContactManager.hh"
+#include "gazebo/physics/Link.hh"
+#include "gazebo/physics/Model.hh"
 
 using namespace gazebo;
 using namespace physics;
 
+namespace
+{
+  /// \brief Contacts of an entity that has none.
+  const std::vector<Contact *> noContacts;
+
+  /// \brief Prepare an index for a rebuild. Entries that had no contacts
+  /// are removed, the others are emptied but keep their memory.
+  /// \param[in,out] _index The index.
+  template<typename T>
+  void ResetIndex(
+      std::unordered_map<const T *, std::vector<Contact *> > &_index)
+  {
+    for (auto iter = _index.begin(); iter != _index.end();)
+    {
+      if (iter->second.empty())
+      {
+        iter = _index.erase(iter);
+      }
+      else
+      {
+        iter->second.clear();
+        ++iter;
+      }
+    }
+  }
+
+  /// \brief Look up the contacts of an entity in an index.
+  /// \param[in] _index The index.
+  /// \param[in] _entity The entity.
+  /// \return Contacts of the entity.
+  template<typename T>
+  const std::vector<Contact *> &FindContacts(
+      const std::unordered_map<const T *, std::vector<Contact *> > &_index,
+      const T *_entity)
+  {
+    auto iter = _index.find(_entity);
+    if (iter == _index.end())
+      return noContacts;
+    return iter->second;
+  }
+}
+
 /////////////////////////////////////////////////
 ContactManager::ContactManager()
 {
@@ -262,6 +306,82 @@ const std::vector<Contact*> &ContactManager::GetContacts() const
 void ContactManager::ResetCount()
 {
   this->contactIndex = 0;
+
+  std::lock_guard<std::mutex> lock(this->indexMutex);
+  this->indexDirty = true;
+}
+
+/////////////////////////////////////////////////
+void ContactManager::UpdateIndex() const
+{
+  // New contacts are only appended until the count is reset
+  if (!this->indexDirty && this->indexedCount == this->contactIndex)
+    return;
+
+  ResetIndex(this->collisionIndex);
+  ResetIndex(this->linkIndex);
+  ResetIndex(this->modelIndex);
+
+  for (unsigned int i = 0; i < this->contactIndex; ++i)
+  {
+    Contact *contact = this->contacts[i];
+    for (const Collision *collision : {contact->collision1,
+                                       contact->collision2})
+    {
+      if (!collision)
+        continue;
+
+      this->collisionIndex[collision].push_back(contact);
+
+      const Link *link = collision->GetLink().get();
+      if (!link)
+        continue;
+
+      // A contact between two collisions of the same link or model is only
+      // listed once for it
+      std::vector<Contact *> &linkContacts = this->linkIndex[link];
+      if (linkContacts.empty() || linkContacts.back() != contact)
+        linkContacts.push_back(contact);
+
+      const Model *model = link->GetModel().get();
+      if (!model)
+        continue;
+
+      std::vector<Contact *> &modelContacts = this->modelIndex[model];
+      if (modelContacts.empty() || modelContacts.back() != contact)
+        modelContacts.push_back(contact);
+    }
+  }
+
+  this->indexDirty = false;
+  this->indexedCount = this->contactIndex;
+}
+
+/////////////////////////////////////////////////
+const std::vector<Contact *> &ContactManager::CollisionContacts(
+    const Collision *_collision) const
+{
+  std::lock_guard<std::mutex> lock(this->indexMutex);
+  this->UpdateIndex();
+  return FindContacts(this->collisionIndex, _collision);
+}
+
+/////////////////////////////////////////////////
+const std::vector<Contact *> &ContactManager::LinkContacts(
+    const Link *_link) const
+{
+  std::lock_guard<std::mutex> lock(this->indexMutex);
+  this->UpdateIndex();
+  return FindContacts(this->linkIndex, _link);
+}
+
+/////////////////////////////////////////////////
+const std::vector<Contact *> &ContactManager::ModelContacts(
+    const Model *_model) const
+{
+  std::lock_guard<std::mutex> lock(this->indexMutex);
+  this->UpdateIndex();
+  return FindContacts(this->modelIndex, _model);
 }
 
 /////////////////////////////////////////////////
@@ -273,6 +393,14 @@ void ContactManager::Clear()
 
   this->contacts.clear();
 
+  {
+    std::lock_guard<std::mutex> lock(this->indexMutex);
+    this->collisionIndex.clear();
+    this->linkIndex.clear();
+    this->modelIndex.clear();
+    this->indexDirty = true;
+  }
+
   boost::unordered_map<std::string, ContactPublisher *>::iterator iter;
   for (iter = this->customContactPublishers.begin();
       iter != this->customContactPublishers.end(); ++iter)
@@ -319,19 +447,35 @@ void ContactManager::PublishContacts()
       iter != this->customContactPublishers.end(); ++iter)
   {
     ContactPublisher *contactPublisher = iter->second;
-    msgs::Contacts msg2;
+
+    contactPublisher->view.clear();
     for (unsigned int j = 0;
         j < contactPublisher->contacts.size(); ++j)
     {
       if (contactPublisher->contacts[j]->count == 0)
         continue;
 
-      msgs::Contact *contactMsg = msg2.add_contact();
-      contactPublisher->contacts[j]->FillMsg(*contactMsg);
+      contactPublisher->view.push_back(contactPublisher->contacts[j]);
+    }
+
+    // In-process subscribers get the contacts directly
+    contactPublisher->contactsSignal(contactPublisher->view);
+
+    // Only build a message if someone subscribed to the topic
+    if (contactPublisher->publisher->HasConnections())
+    {
+      msgs::Contacts msg2;
+      for (auto const &contact : contactPublisher->view)
+      {
+        msgs::Contact *contactMsg = msg2.add_contact();
+        contact->FillMsg(*contactMsg);
+      }
+      msgs::Set(msg2.mutable_time(), this->world->SimTime());
+      contactPublisher->publisher->Publish(msg2);
     }
-    msgs::Set(msg2.mutable_time(), this->world->SimTime());
-    contactPublisher->publisher->Publish(msg2);
+
     contactPublisher->contacts.clear();
+    contactPublisher->view.clear();
   }
 }
 
@@ -445,6 +589,24 @@ void ContactManager::RemoveFilter(const std::string &_name)
   }
 }
 
+/////////////////////////////////////////////////
+event::ConnectionPtr ContactManager::ConnectContacts(const std::string &_name,
+    std::function<void (const std::vector<const Contact *> &)> _subscriber)
+{
+  std::string name = _name;
+  boost::replace_all(name, "::", "/");
+
+  boost::recursive_mutex::scoped_lock lock(*this->customMutex);
+  auto iter = this->customContactPublishers.find(name);
+  if (iter == this->customContactPublishers.end())
+  {
+    gzerr << "Contact filter [" << _name << "] does not exist" << std::endl;
+    return event::ConnectionPtr();
+  }
+
+  return iter->second->contactsSignal.Connect(_subscriber);
+}
+
 /////////////////////////////////////////////////
 unsigned int ContactManager::GetFilterCount()
 {
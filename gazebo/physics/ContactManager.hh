@@ -18,15 +18,19 @@
 #ifndef GAZEBO_PHYSICS_CONTACTMANAGER_HH_
 #define GAZEBO_PHYSICS_CONTACTMANAGER_HH_
 
+#include <functional>
 #include <vector>
 #include <string>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 #include <ignition/transport/Node.hh>
 
 #include <boost/unordered/unordered_set.hpp>
 #include <boost/unordered/unordered_map.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 
+#include "gazebo/common/Event.hh"
 #include "gazebo/transport/TransportTypes.hh"
 
 #include "gazebo/physics/PhysicsTypes.hh"
@@ -56,6 +60,15 @@ namespace gazebo
       /// \brief A list of contacts associated to the collisions.
       public: std::vector<Contact *> contacts;
 
+      /// \brief Signal with the contacts of a step, for in-process
+      /// subscribers, see ContactManager::ConnectContacts.
+      public: event::EventT<void (const std::vector<const Contact *> &)>
+              contactsSignal;
+
+      /// \internal
+      /// \brief Contacts passed to contactsSignal, reused every step.
+      public: std::vector<const Contact *> view;
+
       // Place ignition::transport objects at the end of this file to
       // guarantee they are destructed first.
 
@@ -156,6 +169,36 @@ namespace gazebo
       /// \return Vector of contact pointers.
       public: const std::vector<Contact *> &GetContacts() const;
 
+      /// \brief Get the contacts of the current step that involve a
+      /// collision. The contacts are indexed by collision, link and model on
+      /// the first query after the contacts changed, so the cost of a query
+      /// depends on the contacts of the entity and not on all the contacts
+      /// of the world.
+      /// \param[in] _collision The collision.
+      /// \return Contacts, empty if none. Valid until the contacts of the
+      /// next step are generated.
+      public: const std::vector<Contact *> &CollisionContacts(
+                  const Collision *_collision) const;
+
+      /// \brief Get the contacts of the current step that involve one of
+      /// the collisions of a link.
+      /// \param[in] _link The link.
+      /// \return Contacts, empty if none. Valid until the contacts of the
+      /// next step are generated.
+      /// \sa CollisionContacts
+      public: const std::vector<Contact *> &LinkContacts(
+                  const Link *_link) const;
+
+      /// \brief Get the contacts of the current step that involve one of
+      /// the links of a model. Only the links directly in the model are
+      /// considered, not the links of nested models.
+      /// \param[in] _model The model.
+      /// \return Contacts, empty if none. Valid until the contacts of the
+      /// next step are generated.
+      /// \sa CollisionContacts
+      public: const std::vector<Contact *> &ModelContacts(
+                  const Model *_model) const;
+
       /// \brief Clear all stored contacts.
       public: void Clear();
 
@@ -195,6 +238,26 @@ namespace gazebo
       /// param[in] _name Filter name.
       public: void RemoveFilter(const std::string &_name);
 
+      /// \brief Receive the contacts of a filter in the same process,
+      /// without going through a topic.
+      ///
+      /// The subscriber is called from PublishContacts every step, before
+      /// the world update end event, with the contacts of the step that
+      /// involve the collisions of the filter. The contacts are owned by the
+      /// contact manager and are only valid during the call. The filter
+      /// message is only serialized when its topic has subscribers, so
+      /// consumers that use this instead of the topic avoid the protobuf
+      /// round trip.
+      ///
+      /// The connection must be reset before the filter is removed.
+      /// \param[in] _name Filter name, as passed to CreateFilter.
+      /// \param[in] _subscriber Callback that receives the contacts.
+      /// \return Pointer to the connection, which must be kept in scope.
+      /// Null if the filter does not exist.
+      public: event::ConnectionPtr ConnectContacts(const std::string &_name,
+                  std::function<void (const std::vector<const Contact *> &)>
+                  _subscriber);
+
       /// \brief Get the number of filters in the contact manager.
       /// return Number of filters
       public: unsigned int GetFilterCount();
@@ -215,10 +278,36 @@ namespace gazebo
                        Collision *_collision2, const bool _getOnlyConnected,
                        std::vector<ContactPublisher*> &_publishers);
 
+      /// \brief Rebuild the contact index if the contacts changed.
+      private: void UpdateIndex() const;
+
       private: std::vector<Contact*> contacts;
 
       private: unsigned int contactIndex;
 
+      /// \brief Contacts by collision. Entries without contacts in the last
+      /// step are removed on the next rebuild, the others keep their memory.
+      private: mutable std::unordered_map<const Collision *,
+                   std::vector<Contact *> > collisionIndex;
+
+      /// \brief Contacts by link.
+      private: mutable std::unordered_map<const Link *,
+                   std::vector<Contact *> > linkIndex;
+
+      /// \brief Contacts by model.
+      private: mutable std::unordered_map<const Model *,
+                   std::vector<Contact *> > modelIndex;
+
+      /// \brief True if the contact count was reset since the index was
+      /// built.
+      private: mutable bool indexDirty = true;
+
+      /// \brief Number of contacts when the index was built.
+      private: mutable unsigned int indexedCount = 0;
+
+      /// \brief Mutex to protect the contact index.
+      private: mutable std::mutex indexMutex;
+
       /// \brief Node for communication.
       private: transport::NodePtr node;
 
@@ -194,6 +194,116 @@ TEST_F(ContactManagerTest, NeverDropContacts)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_F(ContactManagerTest, ConnectContacts)
+{
+  // world needs to be paused in order to use World::Step()
+  // function correctly (second parameter true)
+  Load("test/worlds/box.world", true);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::ContactManager *manager = world->Physics()->GetContactManager();
+  ASSERT_TRUE(manager != nullptr);
+
+  // No connection to a filter that doesn't exist
+  auto noConnection = manager->ConnectContacts("no_filter",
+      [](const std::vector<const physics::Contact *> &) {});
+  EXPECT_TRUE(noConnection == nullptr);
+
+  std::string filterName = "box_filter";
+  std::string collisionName = "box::link::collision";
+  manager->CreateFilter(filterName, collisionName);
+  ASSERT_TRUE(manager->HasFilter(filterName));
+
+  // Count the steps and the contacts reported in process
+  unsigned int steps = 0;
+  unsigned int contactCount = 0;
+  bool boxInContacts = true;
+  auto connection = manager->ConnectContacts(filterName,
+      [&](const std::vector<const physics::Contact *> &_contacts)
+      {
+        ++steps;
+        for (auto const &contact : _contacts)
+        {
+          ++contactCount;
+          boxInContacts = boxInContacts && contact->count > 0 &&
+              (contact->collision1->GetScopedName() == collisionName ||
+               contact->collision2->GetScopedName() == collisionName);
+        }
+      });
+  ASSERT_TRUE(connection != nullptr);
+
+  // The box rests on the ground, so every step reports contacts of the box
+  // in the same step
+  world->Step(1);
+  EXPECT_EQ(steps, 1u);
+  EXPECT_GT(contactCount, 0u);
+  EXPECT_TRUE(boxInContacts);
+
+  world->Step(10);
+  EXPECT_EQ(steps, 11u);
+  EXPECT_TRUE(boxInContacts);
+
+  // No more callbacks after disconnecting
+  connection.reset();
+  world->Step(1);
+  EXPECT_EQ(steps, 11u);
+
+  manager->RemoveFilter(filterName);
+  EXPECT_FALSE(manager->HasFilter(filterName));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ContactManagerTest, ContactIndex)
+{
+  Load("test/worlds/box.world", true);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::ContactManager *manager = world->Physics()->GetContactManager();
+  ASSERT_TRUE(manager != nullptr);
+  manager->SetNeverDropContacts(true);
+
+  physics::ModelPtr box = world->ModelByName("box");
+  ASSERT_TRUE(box != nullptr);
+  physics::LinkPtr link = box->GetLink("link");
+  ASSERT_TRUE(link != nullptr);
+  physics::CollisionPtr collision = link->GetCollision("collision");
+  ASSERT_TRUE(collision != nullptr);
+  physics::ModelPtr ground = world->ModelByName("ground_plane");
+  ASSERT_TRUE(ground != nullptr);
+
+  // Nothing is indexed before the first step
+  EXPECT_TRUE(manager->CollisionContacts(collision.get()).empty());
+  EXPECT_TRUE(manager->ModelContacts(nullptr).empty());
+
+  // The box starts in the ground
+  world->Step(1);
+  ASSERT_GT(manager->GetContactCount(), 0u);
+
+  const auto &collisionContacts =
+      manager->CollisionContacts(collision.get());
+  EXPECT_GT(collisionContacts.size(), 0u);
+  for (auto const &contact : collisionContacts)
+  {
+    EXPECT_TRUE(contact->collision1 == collision.get() ||
+                contact->collision2 == collision.get());
+  }
+
+  // The box has a single collision, and only touches the ground
+  EXPECT_EQ(manager->LinkContacts(link.get()), collisionContacts);
+  EXPECT_EQ(manager->ModelContacts(box.get()), collisionContacts);
+  EXPECT_EQ(manager->ModelContacts(ground.get()), collisionContacts);
+
+  // The index follows the contacts of the next step
+  world->Step(1);
+  EXPECT_EQ(manager->ModelContacts(box.get()).size(),
+      manager->GetContactCount());
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -674,6 +674,12 @@ const ignition::math::Pose3d &Entity::DirtyPose() const
   return this->dirtyPose;
 }
 
+//////////////////////////////////////////////////
+void Entity::_SetPhysicsWorldPose(const ignition::math::Pose3d &_pose)
+{
+  (*this.*setWorldPoseFunc)(_pose, false, false);
+}
+
 //////////////////////////////////////////////////
 ignition::math::AxisAlignedBox Entity::CollisionBoundingBox() const
 {
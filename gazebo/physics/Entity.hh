@@ -227,6 +227,13 @@ namespace gazebo
       /// \return The dirty pose of the entity.
       public: const ignition::math::Pose3d &DirtyPose() const;
 
+      /// \internal
+      /// \brief Set the world pose computed by the physics engine. Unlike
+      /// SetWorldPose, World::WorldPoseMutex is not locked and the physics
+      /// engine is not notified. Only LinkStateBuffer should call this.
+      /// \param[in] _pose New world pose.
+      public: void _SetPhysicsWorldPose(const ignition::math::Pose3d &_pose);
+
       /// \brief This function is called when the entity's
       /// (or one of its parents) pose of the parent has changed.
       protected: virtual void OnPoseChange() = 0;
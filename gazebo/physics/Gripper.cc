@@ -17,6 +17,8 @@
 #include <functional>
 #include <map>
 #include <mutex>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <ignition/math/Helpers.hh>
@@ -26,9 +28,6 @@
 
 #include "gazebo/common/Events.hh"
 
-#include "gazebo/transport/Node.hh"
-#include "gazebo/transport/Subscriber.hh"
-
 #include "gazebo/physics/ContactManager.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/physics/Joint.hh"
@@ -47,8 +46,8 @@ using namespace physics;
 class gazebo::physics::GripperPrivate
 {
   /// \brief Callback used when the gripper contacts an object.
-  /// \param[in] _msg Message that contains contact information.
-  public: void OnContacts(ConstContactsPtr &_msg);
+  /// \param[in] _contacts Contacts of the gripper collisions in this step.
+  public: void OnContacts(const std::vector<const Contact *> &_contacts);
 
   /// \brief Update the gripper.
   public: void OnUpdate();
@@ -80,8 +79,8 @@ class gazebo::physics::GripperPrivate
   /// \brief The collisions for the links in the gripper.
   public: std::map<std::string, physics::CollisionPtr> collisions;
 
-  /// \brief The current contacts.
-  public: std::vector<msgs::Contact> contacts;
+  /// \brief Scoped names of the collision pairs currently in contact.
+  public: std::vector<std::pair<std::string, std::string> > contacts;
 
   /// \brief Mutex used to protect reading/writing the contact message.
   public: std::mutex mutexContacts;
@@ -125,11 +124,8 @@ class gazebo::physics::GripperPrivate
   /// \brief Name of the gripper.
   public: std::string name;
 
-  /// \brief Node for communication.
-  public: transport::NodePtr node;
-
-  /// \brief Subscription to contact messages from the physics engine.
-  public: transport::SubscriberPtr contactSub;
+  /// \brief Connection to the contacts of the gripper collisions.
+  public: event::ConnectionPtr contactsConnection;
 };
 
 /////////////////////////////////////////////////
@@ -145,13 +141,13 @@ Gripper::Gripper(ModelPtr _model) : dataPtr(new GripperPrivate)
   this->dataPtr->attached = false;
 
   this->dataPtr->updateRate = common::Time(0, common::Time::SecToNano(0.75));
-
-  this->dataPtr->node = transport::NodePtr(new transport::Node());
 }
 
 /////////////////////////////////////////////////
 Gripper::~Gripper()
 {
+  this->dataPtr->contactsConnection.reset();
+
   if (this->dataPtr->world && this->dataPtr->world->Running())
   {
     physics::ContactManager *mgr =
@@ -167,8 +163,6 @@ Gripper::~Gripper()
 /////////////////////////////////////////////////
 void Gripper::Load(sdf::ElementPtr _sdf)
 {
-  this->dataPtr->node->Init(this->dataPtr->world->Name());
-
   this->dataPtr->name = _sdf->Get<std::string>("name");
   this->dataPtr->fixedJoint =
       this->dataPtr->world->Physics()->CreateJoint("fixed",
@@ -214,16 +208,16 @@ void Gripper::Load(sdf::ElementPtr _sdf)
 
   if (!this->dataPtr->collisions.empty())
   {
-    // request the contact manager to publish messages to a custom topic for
-    // this sensor
+    // request the contact manager to report the contacts of the gripper
+    // directly, in the same step
     physics::ContactManager *mgr =
         this->dataPtr->world->Physics()->GetContactManager();
-    std::string topic = mgr->CreateFilter(this->Name(),
-        this->dataPtr->collisions);
-    if (!this->dataPtr->contactSub)
+    mgr->CreateFilter(this->Name(), this->dataPtr->collisions);
+    if (!this->dataPtr->contactsConnection)
     {
-      this->dataPtr->contactSub = this->dataPtr->node->Subscribe(topic,
-          &GripperPrivate::OnContacts, this->dataPtr.get());
+      this->dataPtr->contactsConnection = mgr->ConnectContacts(this->Name(),
+          std::bind(&GripperPrivate::OnContacts, this->dataPtr.get(),
+          std::placeholders::_1));
     }
   }
   this->dataPtr->connections.push_back(event::Events::ConnectWorldUpdateEnd(
@@ -307,8 +301,8 @@ void GripperPrivate::HandleAttach()
   // needed.
   for (unsigned int i = 0; i < this->contacts.size(); ++i)
   {
-    std::string name1 = this->contacts[i].collision1();
-    std::string name2 = this->contacts[i].collision2();
+    const std::string &name1 = this->contacts[i].first;
+    const std::string &name2 = this->contacts[i].second;
 
     if (this->collisions.find(name1) == this->collisions.end())
     {
@@ -371,20 +365,17 @@ void GripperPrivate::HandleDetach()
 }
 
 /////////////////////////////////////////////////
-void GripperPrivate::OnContacts(ConstContactsPtr &_msg)
+void GripperPrivate::OnContacts(const std::vector<const Contact *> &_contacts)
 {
-  for (int i = 0; i < _msg->contact_size(); ++i)
+  std::lock_guard<std::mutex> lock(this->mutexContacts);
+  for (auto const &contact : _contacts)
   {
-    CollisionPtr collision1 = boost::dynamic_pointer_cast<Collision>(
-        this->world->EntityByName(_msg->contact(i).collision1()));
-    CollisionPtr collision2 = boost::dynamic_pointer_cast<Collision>(
-        this->world->EntityByName(_msg->contact(i).collision2()));
-
-    if ((collision1 && !collision1->IsStatic()) &&
-        (collision2 && !collision2->IsStatic()))
+    if ((contact->collision1 && !contact->collision1->IsStatic()) &&
+        (contact->collision2 && !contact->collision2->IsStatic()))
     {
-      std::lock_guard<std::mutex> lock(this->mutexContacts);
-      this->contacts.push_back(_msg->contact(i));
+      this->contacts.push_back(std::make_pair(
+          contact->collision1->GetScopedName(),
+          contact->collision2->GetScopedName()));
     }
   }
 }
@@ -16,6 +16,7 @@
 */
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <string>
 #include <ignition/math/Helpers.hh>
 #include <gazebo/gazebo_config.h>
@@ -24,18 +25,30 @@
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Image.hh"
 #include "gazebo/common/CommonIface.hh"
+#include "gazebo/common/Events.hh"
 #include "gazebo/common/SphericalCoordinates.hh"
+#include "gazebo/physics/Collision.hh"
 #include "gazebo/physics/HeightmapShape.hh"
+#include "gazebo/physics/HeightmapShapePrivate.hh"
+#include "gazebo/physics/Model.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/transport/transport.hh"
 
 using namespace gazebo;
 using namespace physics;
 
+namespace
+{
+  /// \brief Number of DEM sample intervals per tile side when paging.
+  const unsigned int kDemTileSize = 256;
+
+  /// \brief Default tile budget, in megabytes.
+  const size_t kDefaultTileBudget = 64;
+}
 
 //////////////////////////////////////////////////
 HeightmapShape::HeightmapShape(CollisionPtr _parent)
-    : Shape(_parent)
+    : Shape(_parent), dataPtr(new HeightmapShapePrivate)
 {
   static_assert(
       std::is_same<HeightType, float>::value ||
@@ -43,11 +56,18 @@ HeightmapShape::HeightmapShape(CollisionPtr _parent)
       "Height field needs to be double or float");
   this->vertSize = 0;
   this->AddType(Base::HEIGHTMAP_SHAPE);
+
+  size_t budget = kDefaultTileBudget;
+  const char *env = std::getenv("GAZEBO_HEIGHTMAP_TILE_BUDGET");
+  if (env)
+    budget = std::strtoul(env, nullptr, 10);
+  this->dataPtr->budget = budget * 1024 * 1024;
 }
 
 //////////////////////////////////////////////////
 HeightmapShape::~HeightmapShape()
 {
+  this->dataPtr->updateConnection.reset();
   this->requestSub.reset();
   this->responsePub.reset();
   if (this->node)
@@ -81,7 +101,8 @@ void HeightmapShape::OnRequest(ConstRequestPtr &_msg)
 //////////////////////////////////////////////////
 int HeightmapShape::LoadTerrainFile(const std::string &_filename)
 {
-  this->heightmapData = common::HeightmapDataLoader::LoadTerrainFile(_filename);
+  this->heightmapData = common::HeightmapDataLoader::LoadTerrainFile(
+      _filename, this->dataPtr->tiled ? kDemTileSize : 0);
   if (!this->heightmapData)
   {
     gzerr << "Unable to load heightmap data" << std::endl;
@@ -94,6 +115,7 @@ int HeightmapShape::LoadTerrainFile(const std::string &_filename)
   if (demData)
   {
     this->dem = *demData;
+    this->dataPtr->tiled = this->dem.Tiles() != nullptr;
     if (this->sdf->HasElement("size"))
     {
       this->heightmapSize = this->sdf->Get<ignition::math::Vector3d>("size");
@@ -137,6 +159,7 @@ int HeightmapShape::LoadTerrainFile(const std::string &_filename)
         dynamic_cast<common::ImageHeightmap *>(this->heightmapData);
     if (imageData)
     {
+      this->dataPtr->tiled = false;
       this->img = *imageData;
       this->heightmapSize = this->sdf->Get<ignition::math::Vector3d>("size");
       return 0;
@@ -159,6 +182,10 @@ void HeightmapShape::Load(sdf::ElementPtr _sdf)
     return;
   }
 
+  // Large DEMs are paged, images are always loaded in memory
+  this->dataPtr->tiled = this->sdf->HasElement("use_terrain_paging") &&
+      this->sdf->Get<bool>("use_terrain_paging");
+
   if (this->LoadTerrainFile(filename) != 0)
   {
     gzerr << "Heightmap data size must be square, with a size of 2^n+1\n";
@@ -181,9 +208,11 @@ void HeightmapShape::Load(sdf::ElementPtr _sdf)
     }
   }
 
-  // Check if the geometry of the terrain data matches Ogre constrains
-  if (this->heightmapData->GetWidth() != this->heightmapData->GetHeight() ||
-      !ignition::math::isPowerOfTwo(this->heightmapData->GetWidth() - 1))
+  // Check if the geometry of the terrain data matches Ogre constrains. Tiled
+  // terrains are not resampled.
+  if (!this->dataPtr->tiled &&
+      (this->heightmapData->GetWidth() != this->heightmapData->GetHeight() ||
+      !ignition::math::isPowerOfTwo(this->heightmapData->GetWidth() - 1)))
   {
     gzerr << "Heightmap data size must be square, with a size of 2^n+1\n";
     return;
@@ -245,8 +274,221 @@ void HeightmapShape::Init()
   else
     this->scale.Z() = fabs(terrainSize.Z()) / heightmapSizeZ;
 
-  // Construct the heightmap lookup table
-  this->FillHeightfield(this->heights);
+  if (this->dataPtr->tiled && !this->supportsTiles)
+  {
+    gzwarn << "The physics engine does not support paging heightmap "
+           << "tiles, the whole heightmap[" << this->GetURI()
+           << "] is loaded in memory" << std::endl;
+    this->dataPtr->tiled = false;
+  }
+
+  if (!this->dataPtr->tiled)
+  {
+    // Construct the heightmap lookup table
+    this->FillHeightfield(this->heights);
+    return;
+  }
+
+#ifdef HAVE_GDAL
+  this->dataPtr->tileVerts = kDemTileSize * this->subSampling;
+  this->dataPtr->tileCount = std::max(1u,
+      (this->vertSize - 1 + this->dataPtr->tileVerts - 1) /
+      this->dataPtr->tileVerts);
+
+  // Height range of the vertices, see Dem::FillHeightMap
+  HeightType minElevation = this->dem.GetMinElevation();
+  HeightType maxElevation = minElevation +
+      (this->dem.GetMaxElevation() - minElevation) * this->scale.Z();
+  if (terrainSize.Z() < 0)
+  {
+    this->dataPtr->minHeight = -maxElevation;
+    this->dataPtr->maxHeight = -minElevation;
+  }
+  else
+  {
+    this->dataPtr->minHeight = minElevation;
+    this->dataPtr->maxHeight = maxElevation;
+  }
+
+  this->dataPtr->updateConnection = event::Events::ConnectWorldUpdateBegin(
+      std::bind(&HeightmapShape::UpdateTiles, this));
+#endif
+}
+
+//////////////////////////////////////////////////
+void HeightmapShape::UpdateTiles()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  ++this->dataPtr->step;
+
+  if (!this->world || !this->collisionParent)
+    return;
+
+  const ignition::math::Pose3d pose = this->collisionParent->WorldPose();
+  const ignition::math::Vector3d size = this->Size();
+  const double vertices = this->vertSize - 1;
+  const double tileVerts = this->dataPtr->tileVerts;
+
+  for (const auto &model : this->world->Models())
+  {
+    if (model->IsStatic())
+      continue;
+
+    // Tiles under the model's bounding box, with a margin of half a tile
+    // to page the next tile in before the model reaches it
+    const ignition::math::AxisAlignedBox box = model->BoundingBox();
+    const ignition::math::Vector3d center = pose.Rot().RotateVectorReverse(
+        box.Center() - pose.Pos());
+    const double radius = box.Size().Length() * 0.5;
+    if (!std::isfinite(radius))
+      continue;
+
+    // Columns follow x, rows follow -y, see ODEHeightmapShape
+    const double x = (center.X() + size.X() * 0.5) * vertices / size.X();
+    const double y = (size.Y() * 0.5 - center.Y()) * vertices / size.Y();
+    const double marginX = radius * vertices / size.X() + tileVerts * 0.5;
+    const double marginY = radius * vertices / size.Y() + tileVerts * 0.5;
+
+    const double last = this->dataPtr->tileCount - 1;
+    const int x1 = static_cast<int>(
+        ignition::math::clamp((x - marginX) / tileVerts, 0.0, last));
+    const int x2 = static_cast<int>(
+        ignition::math::clamp((x + marginX) / tileVerts, 0.0, last));
+    const int y1 = static_cast<int>(
+        ignition::math::clamp((y - marginY) / tileVerts, 0.0, last));
+    const int y2 = static_cast<int>(
+        ignition::math::clamp((y + marginY) / tileVerts, 0.0, last));
+
+    for (int ty = y1; ty <= y2; ++ty)
+    {
+      for (int tx = x1; tx <= x2; ++tx)
+        this->Tile(tx, ty);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+HeightmapTile &HeightmapShape::Tile(const unsigned int _x,
+    const unsigned int _y) const
+{
+  HeightmapShapePrivate &data = *this->dataPtr;
+
+  const uint64_t key = (static_cast<uint64_t>(_y) << 32) | _x;
+  if (key != data.lastKey)
+  {
+    auto iter = data.tiles.find(key);
+    if (iter == data.tiles.end())
+    {
+      // Page out the least recently used tiles, except the ones used during
+      // this step
+      const unsigned int maxWidth = data.tileVerts + 1;
+      const size_t tileMemory =
+          maxWidth * maxWidth * sizeof(HeightmapShape::HeightType);
+      while (data.memory + tileMemory > data.budget && !data.lru.empty())
+      {
+        auto oldest = data.tiles.find(data.lru.back());
+        if (oldest->second.lastUsed == data.step)
+          break;
+
+        if (oldest->first == data.lastKey)
+        {
+          data.lastKey = UINT64_MAX;
+          data.lastTile = nullptr;
+        }
+        data.memory -= oldest->second.heights.size() *
+            sizeof(HeightmapShape::HeightType);
+        data.lru.pop_back();
+        data.tiles.erase(oldest);
+      }
+
+      HeightmapTile tile;
+      this->LoadTile(_x, _y, tile);
+      data.memory += tile.heights.size() * sizeof(HeightmapShape::HeightType);
+      data.lru.push_front(key);
+      tile.lruIter = data.lru.begin();
+      iter = data.tiles.emplace(key, std::move(tile)).first;
+    }
+
+    data.lastKey = key;
+    data.lastTile = &iter->second;
+  }
+
+  data.lru.splice(data.lru.begin(), data.lru, data.lastTile->lruIter);
+  data.lastTile->lastUsed = data.step;
+  return *data.lastTile;
+}
+
+//////////////////////////////////////////////////
+void HeightmapShape::LoadTile(const unsigned int _x, const unsigned int _y,
+    HeightmapTile &_tile) const
+{
+#ifdef HAVE_GDAL
+  const unsigned int maxWidth = this->dataPtr->tileVerts + 1;
+  const unsigned int x = _x * this->dataPtr->tileVerts;
+  const unsigned int y = _y * this->dataPtr->tileVerts;
+  _tile.width = std::min(maxWidth, this->vertSize - x);
+  const unsigned int height = std::min(maxWidth, this->vertSize - y);
+
+  std::vector<float> heights;
+  this->dem.FillHeightMapRegion(this->subSampling, x, y, _tile.width,
+      height, this->Size(), this->scale, heights);
+  _tile.heights.assign(heights.begin(), heights.end());
+#else
+  (void)_x;
+  (void)_y;
+  (void)_tile;
+#endif
+}
+
+//////////////////////////////////////////////////
+void HeightmapShape::ReadTiles(const std::function<void(const unsigned int,
+    const unsigned int, const HeightmapTile &)> &_func) const
+{
+  const unsigned int tileVerts = this->dataPtr->tileVerts;
+  HeightmapTile unpaged;
+  for (unsigned int ty = 0; ty < this->dataPtr->tileCount; ++ty)
+  {
+    for (unsigned int tx = 0; tx < this->dataPtr->tileCount; ++tx)
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+      const uint64_t key = (static_cast<uint64_t>(ty) << 32) | tx;
+      auto iter = this->dataPtr->tiles.find(key);
+      const HeightmapTile *tile = &unpaged;
+      if (iter != this->dataPtr->tiles.end())
+        tile = &iter->second;
+      else
+        this->LoadTile(tx, ty, unpaged);
+
+      if (tile->width > 0)
+        _func(tx * tileVerts, ty * tileVerts, *tile);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+bool HeightmapShape::Tiled() const
+{
+  return this->dataPtr->tiled;
+}
+
+//////////////////////////////////////////////////
+void HeightmapShape::SetTileBudget(const size_t _bytes)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->budget = _bytes;
+}
+
+//////////////////////////////////////////////////
+size_t HeightmapShape::TileBudget() const
+{
+  return this->dataPtr->budget;
+}
+
+//////////////////////////////////////////////////
+size_t HeightmapShape::TileCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->tiles.size();
 }
 
 //////////////////////////////////////////////////
@@ -294,6 +536,30 @@ void HeightmapShape::FillMsg(msgs::Geometry &_msg)
 //////////////////////////////////////////////////
 void HeightmapShape::FillHeights(msgs::Geometry &_msg) const
 {
+  if (this->dataPtr->tiled)
+  {
+    // Rows of the message go from the last row of GetHeight to the first
+    auto msgHeights = _msg.mutable_heightmap()->mutable_heights();
+    const int offset = msgHeights->size();
+    msgHeights->Resize(offset + this->vertSize * this->vertSize, 0.0f);
+    this->ReadTiles([&](const unsigned int _x, const unsigned int _y,
+        const HeightmapTile &_tile)
+    {
+      const unsigned int rows = _tile.heights.size() / _tile.width;
+      for (unsigned int r = 0; r < rows; ++r)
+      {
+        const unsigned int y = this->flipY ? _y + r :
+            this->vertSize - 1 - (_y + r);
+        for (unsigned int c = 0; c < _tile.width; ++c)
+        {
+          msgHeights->Set(offset + y * this->vertSize + _x + c,
+              _tile.heights[r * _tile.width + c]);
+        }
+      }
+    });
+    return;
+  }
+
   for (unsigned int y = 0; y < this->vertSize; ++y)
   {
     for (unsigned int x = 0; x < this->vertSize; ++x)
@@ -319,6 +585,27 @@ ignition::math::Vector2i HeightmapShape::VertexCount() const
 /////////////////////////////////////////////////
 HeightmapShape::HeightType HeightmapShape::GetHeight(int _x, int _y) const
 {
+  if (this->dataPtr->tiled)
+  {
+    const int size = static_cast<int>(this->vertSize);
+    if (_x < 0 || _y < 0 || _x >= size || _y >= size)
+      return 0.0;
+
+    const unsigned int x = _x;
+    const unsigned int y = this->flipY ? size - 1 - _y : _y;
+
+    // The last vertex of a tile is also the first one of the next tile
+    const unsigned int tileVerts = this->dataPtr->tileVerts;
+    const unsigned int last = this->dataPtr->tileCount - 1;
+    const unsigned int tx = std::min(x / tileVerts, last);
+    const unsigned int ty = std::min(y / tileVerts, last);
+
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    const HeightmapTile &tile = this->Tile(tx, ty);
+    return tile.heights[(y - ty * tileVerts) * tile.width +
+        (x - tx * tileVerts)];
+  }
+
   int index =  _y * this->vertSize + _x;
   if (_x < 0 || _y < 0 || index >= static_cast<int>(this->heights.size()))
     return 0.0;
@@ -329,6 +616,9 @@ HeightmapShape::HeightType HeightmapShape::GetHeight(int _x, int _y) const
 /////////////////////////////////////////////////
 HeightmapShape::HeightType HeightmapShape::GetMaxHeight() const
 {
+  if (this->dataPtr->tiled)
+    return this->dataPtr->maxHeight;
+
   HeightType max = -std::numeric_limits<HeightType>::max();
   for (unsigned int i = 0; i < this->heights.size(); ++i)
   {
@@ -342,6 +632,9 @@ HeightmapShape::HeightType HeightmapShape::GetMaxHeight() const
 /////////////////////////////////////////////////
 HeightmapShape::HeightType HeightmapShape::GetMinHeight() const
 {
+  if (this->dataPtr->tiled)
+    return this->dataPtr->minHeight;
+
   HeightType min = std::numeric_limits<HeightType>::max();
   for (unsigned int i = 0; i < this->heights.size(); ++i)
   {
@@ -367,27 +660,68 @@ common::Image HeightmapShape::GetImage() const
   // Create the image data buffer
   imageData = new unsigned char[size * size];
 
-  // Get height data from all vertices
-  for (uint16_t y = 0; y < size; ++y)
+  auto setPixel = [&](const int _x, const int _y, const double _height)
   {
-    for (uint16_t x = 0; x < size; ++x)
-    {
-      int sx = static_cast<int>(x * this->subSampling);
-      int sy;
+    // Normalize height value
+    height = (_height - minHeight) / maxHeight;
 
-      if (!this->flipY)
-        sy = static_cast<int>(y * this->subSampling);
-      else
-        sy = static_cast<int>(size - 1 -y) * this->subSampling;
-
-      // Normalize height value
-      height = (this->GetHeight(sx, sy) - minHeight) / maxHeight;
+    GZ_ASSERT(height <= 1.0, "Normalized terrain height > 1.0");
+    GZ_ASSERT(height >= 0.0, "Normalized terrain height < 0.0");
 
-      GZ_ASSERT(height <= 1.0, "Normalized terrain height > 1.0");
-      GZ_ASSERT(height >= 0.0, "Normalized terrain height < 0.0");
+    // Scale height to a value between 0 and 255
+    imageData[_y * size + _x] = static_cast<unsigned char>(height * 255.0);
+  };
 
-      // Scale height to a value between 0 and 255
-      imageData[y * size + x] = static_cast<unsigned char>(height * 255.0);
+  if (this->dataPtr->tiled)
+  {
+    // Pixels past the last vertex read as zero, like GetHeight
+    std::fill(imageData, imageData + size * size,
+        static_cast<unsigned char>(ignition::math::clamp(
+        -minHeight / maxHeight, 0.0, 1.0) * 255.0));
+
+    // Only the vertices on the subsampling grid are pixels
+    const int subSampling = this->subSampling;
+    this->ReadTiles([&](const unsigned int _x, const unsigned int _y,
+        const HeightmapTile &_tile)
+    {
+      const unsigned int rows = _tile.heights.size() / _tile.width;
+      for (unsigned int r = 0; r < rows; ++r)
+      {
+        const int sy = this->flipY ? this->vertSize - 1 - (_y + r) : _y + r;
+        if (sy % subSampling != 0)
+          continue;
+        const int y = this->flipY ? size - 1 - sy / subSampling :
+            sy / subSampling;
+        if (y < 0 || y >= size)
+          continue;
+
+        for (unsigned int c = 0; c < _tile.width; ++c)
+        {
+          const int sx = _x + c;
+          if (sx % subSampling != 0 || sx / subSampling >= size)
+            continue;
+          setPixel(sx / subSampling, y, _tile.heights[r * _tile.width + c]);
+        }
+      }
+    });
+  }
+  else
+  {
+    // Get height data from all vertices
+    for (uint16_t y = 0; y < size; ++y)
+    {
+      for (uint16_t x = 0; x < size; ++x)
+      {
+        int sx = static_cast<int>(x * this->subSampling);
+        int sy;
+
+        if (!this->flipY)
+          sy = static_cast<int>(y * this->subSampling);
+        else
+          sy = static_cast<int>(size - 1 -y) * this->subSampling;
+
+        setPixel(x, y, this->GetHeight(sx, sy));
+      }
     }
   }
 
@@ -17,6 +17,8 @@
 #ifndef GAZEBO_PHYSICS_HEIGHTMAPSHAPE_HH_
 #define GAZEBO_PHYSICS_HEIGHTMAPSHAPE_HH_
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 #include <ignition/transport/Node.hh>
@@ -35,6 +37,10 @@ namespace gazebo
 {
   namespace physics
   {
+    // Forward declare private data class
+    class HeightmapShapePrivate;
+    class HeightmapTile;
+
     /// \addtogroup gazebo_physics
     /// \{
 
@@ -42,6 +48,13 @@ namespace gazebo
     /// \brief HeightmapShape collision shape builds a heightmap from
     /// an image.  The supplied image must be square with
     /// N*N+1 pixels per side, where N is an integer.
+    ///
+    /// A DEM with use_terrain_paging set is not loaded in memory. It is
+    /// paged from a common::HeightmapTiles pyramid instead, and physics
+    /// engines that support it only keep the heightfield tiles around the
+    /// moving models, within a memory budget. The budget defaults to the
+    /// GAZEBO_HEIGHTMAP_TILE_BUDGET environment variable, in megabytes, or
+    /// to 64 megabytes.
     class GZ_PHYSICS_VISIBLE HeightmapShape : public Shape
     {
       /// \brief height field type, float or double
@@ -89,6 +102,24 @@ namespace gazebo
       /// \return The height at a the specified location.
       public: HeightType GetHeight(int _x, int _y) const;
 
+      /// \brief Get whether the heightfield is paged in tiles instead of
+      /// being held in memory.
+      /// \return True if paged.
+      public: bool Tiled() const;
+
+      /// \brief Set the maximum memory held by the paged tiles. Tiles used
+      /// during the current step are kept even if the budget is exceeded.
+      /// \param[in] _bytes Budget in bytes.
+      public: void SetTileBudget(const size_t _bytes);
+
+      /// \brief Get the maximum memory held by the paged tiles.
+      /// \return Budget in bytes.
+      public: size_t TileBudget() const;
+
+      /// \brief Get the number of paged in tiles.
+      /// \return Number of tiles, 0 if not tiled.
+      public: size_t TileCount() const;
+
       /// \brief Fill a geometry message with this shape's data. Raw height
       /// data are not packed in this message to minimize packet size.
       /// \param[in] _msg Message to fill.
@@ -135,6 +166,34 @@ namespace gazebo
       /// \param[in] _msg The request message.
       private: void OnRequest(ConstRequestPtr &_msg);
 
+      /// \brief Page in the tiles under the moving models, called on every
+      /// world update when tiled.
+      private: void UpdateTiles();
+
+      /// \brief Get a paged in tile, paging it in if needed. Must be called
+      /// with the tile mutex locked.
+      /// \param[in] _x Column of the tile.
+      /// \param[in] _y Row of the tile.
+      /// \return The tile.
+      private: HeightmapTile &Tile(const unsigned int _x,
+                   const unsigned int _y) const;
+
+      /// \brief Read the heights of a tile from the DEM.
+      /// \param[in] _x Column of the tile.
+      /// \param[in] _y Row of the tile.
+      /// \param[out] _tile Tile to fill.
+      private: void LoadTile(const unsigned int _x, const unsigned int _y,
+                   HeightmapTile &_tile) const;
+
+      /// \brief Call a function with every tile of the heightfield, one
+      /// tile at a time. Tiles that are not paged in are read from the DEM
+      /// without being paged in, so that reading the whole heightfield
+      /// neither pins it in memory nor pages out the tiles in use.
+      /// \param[in] _func Function called with the column and row of the
+      /// tile's first vertex, before flipping, and the tile.
+      private: void ReadTiles(const std::function<void(const unsigned int,
+                   const unsigned int, const HeightmapTile &)> &_func) const;
+
       /// \brief Fills the heightmap data (float) into the vector
       /// by calling HeightmapData::FillHeightMap with \e heights
       /// \param[in] heights height field to fill with data.
@@ -161,6 +220,10 @@ namespace gazebo
       /// \brief The amount of subsampling. Default is 2.
       protected: int subSampling;
 
+      /// \brief True if the physics engine builds its heightfield from
+      /// GetHeight, which allows paging the heightfield in tiles.
+      protected: bool supportsTiles = false;
+
       /// \brief Transportation node.
       private: transport::NodePtr node;
 
@@ -181,6 +244,10 @@ namespace gazebo
       private: common::Dem dem;
       #endif
 
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<HeightmapShapePrivate> dataPtr;
+
       // Place ignition::transport objects at the end of this file to
       // guarantee they are destructed first.
 
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_HEIGHTMAPSHAPE_PRIVATE_HH_
+#define GAZEBO_PHYSICS_HEIGHTMAPSHAPE_PRIVATE_HH_
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "gazebo/common/Event.hh"
+#include "gazebo/physics/HeightmapShape.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief A paged in part of a tiled heightfield.
+    class HeightmapTile
+    {
+      /// \brief Heights of the tile's vertices, row major.
+      public: std::vector<HeightmapShape::HeightType> heights;
+
+      /// \brief Number of vertices per row.
+      public: unsigned int width = 0;
+
+      /// \brief Value of HeightmapShapePrivate::step when last used.
+      public: uint64_t lastUsed = 0;
+
+      /// \brief Position of the tile in HeightmapShapePrivate::lru.
+      public: std::list<uint64_t>::iterator lruIter;
+    };
+
+    /// \internal
+    /// \brief Private data for the HeightmapShape class, only used when the
+    /// heightfield is paged in tiles.
+    class HeightmapShapePrivate
+    {
+      /// \brief True if the heightfield is paged in tiles.
+      public: bool tiled = false;
+
+      /// \brief Number of vertex intervals per tile side.
+      public: unsigned int tileVerts = 0;
+
+      /// \brief Number of tiles along a side of the heightfield.
+      public: unsigned int tileCount = 0;
+
+      /// \brief Maximum memory held by the tiles, in bytes.
+      public: size_t budget = 0;
+
+      /// \brief Memory currently held by the tiles, in bytes.
+      public: size_t memory = 0;
+
+      /// \brief Paged in tiles, keyed by row and column.
+      public: std::unordered_map<uint64_t, HeightmapTile> tiles;
+
+      /// \brief Keys of the paged in tiles, most recently used first.
+      public: std::list<uint64_t> lru;
+
+      /// \brief Key of the last tile used, to skip the lookup for
+      /// consecutive vertices of the same tile.
+      public: uint64_t lastKey = UINT64_MAX;
+
+      /// \brief The last tile used.
+      public: HeightmapTile *lastTile = nullptr;
+
+      /// \brief Incremented on every world update. Tiles used during the
+      /// current step are never paged out.
+      public: uint64_t step = 1;
+
+      /// \brief Minimum height, computed from the DEM elevation range.
+      public: HeightmapShape::HeightType minHeight = 0;
+
+      /// \brief Maximum height, computed from the DEM elevation range.
+      public: HeightmapShape::HeightType maxHeight = 0;
+
+      /// \brief Protects the tiles, which are used by the physics thread and
+      /// by heightmap data requests.
+      public: std::mutex mutex;
+
+      /// \brief Connection to the world update event, used to page tiles in
+      /// around the models.
+      public: event::ConnectionPtr updateConnection;
+    };
+  }
+}
+#endif
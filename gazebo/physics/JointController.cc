@@ -31,6 +31,18 @@
 using namespace gazebo;
 using namespace physics;
 
+/////////////////////////////////////////////////
+/// \brief Wake a model on the world thread. Commands are applied by
+/// JointController::Update, which is skipped while the model is asleep, and
+/// they may arrive on any thread.
+/// \param[in] _model Model to wake.
+static void RequestWake(ModelPtr _model)
+{
+  WorldPtr world = _model->GetWorld();
+  if (world)
+    world->_RequestWake(_model);
+}
+
 /////////////////////////////////////////////////
 JointController::JointController(ModelPtr _model)
   : dataPtr(new JointControllerPrivate)
@@ -241,6 +253,8 @@ void JointController::OnJointCommand(const ignition::msgs::JointCmd &_msg)
   iter = this->dataPtr->joints.find(_msg.name());
   if (iter != this->dataPtr->joints.end())
   {
+    RequestWake(this->dataPtr->model);
+
     if (_msg.reset())
     {
       if (this->dataPtr->forces.find(_msg.name()) !=
@@ -417,6 +431,7 @@ void JointController::SetJointPositions(
 void JointController::SetJointPosition(
   JointPtr _joint, double _position, int _index)
 {
+  RequestWake(this->dataPtr->model);
   _joint->SetPosition(_index, _position);
 }
 
@@ -485,6 +500,7 @@ bool JointController::SetPositionTarget(const std::string &_jointName,
       this->dataPtr->posPids.end())
   {
     this->dataPtr->positions[_jointName] = _target;
+    RequestWake(this->dataPtr->model);
     result = true;
   }
 
@@ -514,6 +530,7 @@ bool JointController::SetVelocityTarget(const std::string &_jointName,
       this->dataPtr->velPids.end())
   {
     this->dataPtr->velocities[_jointName] = _target;
+    RequestWake(this->dataPtr->model);
     result = true;
   }
 
@@ -530,6 +547,7 @@ bool JointController::SetForce(const std::string &_jointName,
       this->dataPtr->joints.end())
   {
     this->dataPtr->forces[_jointName] = _force;
+    RequestWake(this->dataPtr->model);
     result = true;
   }
 
@@ -97,8 +97,8 @@ class gazebo::physics::LinkPrivate
   /// \brief Wind velocity.
   public: ignition::math::Vector3d windLinearVel;
 
-  /// \brief Update connection to calculate wind velocity.
-  public: event::ConnectionPtr updateConnection;
+  /// \brief True if the world updates the wind of the link on every step.
+  public: bool windUpdate = false;
 
   /// \brief All the attached batteries.
   public: std::vector<common::BatteryPtr> batteries;
@@ -295,10 +295,15 @@ void Link::Load(sdf::ElementPtr _sdf)
   this->sdf->GetElement("enable_wind")->GetValue()->SetUpdateFunc(
       std::bind(&Link::WindMode, this));
 
-  this->connections.push_back(event::Events::ConnectWorldUpdateBegin(
-      std::bind(
-      static_cast<void(Link::*)(const common::UpdateInfo &)>(&Link::Update),
-      this, std::placeholders::_1)));
+  // Only links with batteries or audio need Link::Update on every step.
+  // Wrench messages queue a single update.
+  bool update = !this->dataPtr->batteries.empty();
+#ifdef HAVE_OPENAL
+  update = update || this->dataPtr->audioSink ||
+      !this->dataPtr->audioSources.empty();
+#endif
+  if (update)
+    this->world->_SetLinkUpdate(this, false, true);
 
   this->SetStatic(this->IsStatic());
 }
@@ -344,7 +349,14 @@ void Link::Init()
 //////////////////////////////////////////////////
 void Link::Fini()
 {
-  this->dataPtr->updateConnection.reset();
+  // No wrench message can queue an update after this
+  this->dataPtr->wrenchSub.reset();
+  if (this->world)
+  {
+    this->world->_SetLinkUpdate(this, true, false);
+    this->world->_SetLinkUpdate(this, false, false);
+  }
+  this->dataPtr->windUpdate = false;
 
   this->dataPtr->attachedModels.clear();
   this->dataPtr->parentJoints.clear();
@@ -638,6 +650,12 @@ void Link::UpdateWind(const common::UpdateInfo & /*_info*/)
   this->dataPtr->windLinearVel = this->world->Wind().WorldLinearVel(this);
 }
 
+//////////////////////////////////////////////////
+void Link::_SetWorldWindLinearVel(const ignition::math::Vector3d &_vel)
+{
+  this->dataPtr->windLinearVel = _vel;
+}
+
 /////////////////////////////////////////////////
 Joint_V Link::GetParentJoints() const
 {
@@ -842,26 +860,21 @@ void Link::SetWindMode(const bool _mode)
 {
   this->sdf->GetElement("enable_wind")->Set(_mode);
 
-  if (!this->WindMode() && this->dataPtr->updateConnection)
+  if (!this->WindMode() && this->dataPtr->windUpdate)
     this->SetWindEnabled(false);
-  else if (this->WindMode() && !this->dataPtr->updateConnection)
+  else if (this->WindMode() && !this->dataPtr->windUpdate)
     this->SetWindEnabled(true);
 }
 
 /////////////////////////////////////////////////
 void Link::SetWindEnabled(const bool _enable)
 {
-  if (_enable)
-  {
-    this->dataPtr->updateConnection = event::Events::ConnectWorldUpdateBegin(
-        std::bind(&Link::UpdateWind, this, std::placeholders::_1));
-  }
-  else
-  {
-    this->dataPtr->updateConnection.reset();
-    // Make sure wind velocity is null
+  this->world->_SetLinkUpdate(this, true, _enable);
+  this->dataPtr->windUpdate = _enable;
+
+  // Make sure wind velocity is null
+  if (!_enable)
     this->dataPtr->windLinearVel.Set(0, 0, 0);
-  }
 }
 
 //////////////////////////////////////////////////
@@ -1799,8 +1812,11 @@ void Link::OnWrenchMsg(ConstWrenchPtr &_msg)
     return;
   }
 
-  std::lock_guard<std::mutex> lock(this->dataPtr->wrenchMsgMutex);
-  this->dataPtr->wrenchMsgs.push_back(*_msg);
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->wrenchMsgMutex);
+    this->dataPtr->wrenchMsgs.push_back(*_msg);
+  }
+  this->world->_QueueLinkUpdate(this);
 }
 
 //////////////////////////////////////////////////
@@ -79,7 +79,9 @@ namespace gazebo
       /// \param[in] _sdf SDF values to load from.
       public: virtual void UpdateParameters(sdf::ElementPtr _sdf) override;
 
-      /// \brief Update the collision.
+      /// \brief Update the audio and batteries, and apply the received
+      /// wrench messages. The world calls this at the start of the steps
+      /// where the link has such work to do.
       /// \param[in] _info Update information.
       public: void Update(const common::UpdateInfo &_info);
       using Base::Update;
@@ -570,10 +572,18 @@ namespace gazebo
       /// \return this link's wind velocity.
       public: const ignition::math::Vector3d RelativeWindLinearVel() const;
 
-      /// \brief Update the wind.
+      /// \brief Update the wind. The world samples the wind of all the
+      /// links at once on every step, so this is only needed to refresh
+      /// the velocity of a single link outside of a step.
       /// \param[in] _info Update information.
       public: void UpdateWind(const common::UpdateInfo &_info);
 
+      /// \internal
+      /// \brief Set the wind velocity returned by WorldWindLinearVel. This
+      /// is called by the world with the result of the batched wind update.
+      /// \param[in] _vel Wind velocity in the world frame.
+      public: void _SetWorldWindLinearVel(const ignition::math::Vector3d &_vel);
+
       /// \brief Get a battery by name.
       /// \param[in] _name Name of the battery to get.
       /// \return Pointer to the battery, NULL if the name is invalid.
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "gazebo/physics/Entity.hh"
+#include "gazebo/physics/LinkStateBuffer.hh"
+
+using namespace gazebo;
+using namespace physics;
+
+/// \brief Number of entities written per parallel task.
+static const size_t kWriteGrainSize = 256;
+
+/// \brief Components stored per entity.
+enum Component
+{
+  PX, PY, PZ, QW, QX, QY, QZ, VX, VY, VZ, WX, WY, WZ, COMPONENT_COUNT
+};
+
+/// \brief Flag set if the velocities of an entity are known.
+static const uint8_t kHasVel = 1;
+
+/// \brief Flag set if the pose of an entity must be written serially,
+/// because it may move a model shared with other entities.
+static const uint8_t kSerial = 2;
+
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief Private data for LinkStateBuffer.
+    class LinkStateBufferPrivate
+    {
+      /// \brief Add an entity, or find its index if it was already added.
+      /// \param[in] _entity The entity.
+      /// \return Index of the entity.
+      public: size_t Slot(Entity *_entity)
+      {
+        auto inserted = this->index.emplace(_entity, this->entities.size());
+        if (!inserted.second)
+          return inserted.first->second;
+
+        // A link of a top level model moves at most that model, so links
+        // of different top level models can be written in parallel.
+        uint8_t flag = 0;
+        BasePtr parent = _entity->GetParent();
+        if (!_entity->HasType(Base::LINK) || (parent && parent->GetParent() &&
+              parent->GetParent()->HasType(Base::MODEL)))
+        {
+          flag = kSerial;
+        }
+
+        this->entities.push_back(_entity);
+        this->flags.push_back(flag);
+        for (auto &values : this->c)
+          values.push_back(0);
+        return this->entities.size() - 1;
+      }
+
+      /// \brief Set the pose at an index.
+      /// \param[in] _i Index.
+      /// \param[in] _pose World pose.
+      public: void SetPose(const size_t _i,
+                  const ignition::math::Pose3d &_pose)
+      {
+        this->c[PX][_i] = _pose.Pos().X();
+        this->c[PY][_i] = _pose.Pos().Y();
+        this->c[PZ][_i] = _pose.Pos().Z();
+        this->c[QW][_i] = _pose.Rot().W();
+        this->c[QX][_i] = _pose.Rot().X();
+        this->c[QY][_i] = _pose.Rot().Y();
+        this->c[QZ][_i] = _pose.Rot().Z();
+      }
+
+      /// \brief Entities, in the order they were added.
+      public: std::vector<Entity *> entities;
+
+      /// \brief kHasVel and kSerial flags of each entity.
+      public: std::vector<uint8_t> flags;
+
+      /// \brief One array per component of the poses and velocities.
+      public: std::array<std::vector<double>, COMPONENT_COUNT> c;
+
+      /// \brief Index of each entity in the arrays.
+      public: std::unordered_map<const Entity *, size_t> index;
+    };
+  }
+}
+
+/////////////////////////////////////////////////
+LinkStateBuffer::LinkStateBuffer()
+  : dataPtr(new LinkStateBufferPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+LinkStateBuffer::~LinkStateBuffer()
+{
+}
+
+/////////////////////////////////////////////////
+void LinkStateBuffer::Reserve(const size_t _count)
+{
+  this->dataPtr->entities.reserve(_count);
+  this->dataPtr->flags.reserve(_count);
+  for (auto &values : this->dataPtr->c)
+    values.reserve(_count);
+  this->dataPtr->index.reserve(_count);
+}
+
+/////////////////////////////////////////////////
+void LinkStateBuffer::Clear()
+{
+  this->dataPtr->entities.clear();
+  this->dataPtr->flags.clear();
+  for (auto &values : this->dataPtr->c)
+    values.clear();
+  this->dataPtr->index.clear();
+}
+
+/////////////////////////////////////////////////
+void LinkStateBuffer::Add(Entity *_entity,
+    const ignition::math::Pose3d &_pose)
+{
+  if (!_entity)
+    return;
+
+  const size_t i = this->dataPtr->Slot(_entity);
+  this->dataPtr->SetPose(i, _pose);
+  this->dataPtr->flags[i] &= static_cast<uint8_t>(~kHasVel);
+}
+
+/////////////////////////////////////////////////
+void LinkStateBuffer::Add(Entity *_entity,
+    const ignition::math::Pose3d &_pose,
+    const ignition::math::Vector3d &_linearVel,
+    const ignition::math::Vector3d &_angularVel)
+{
+  if (!_entity)
+    return;
+
+  const size_t i = this->dataPtr->Slot(_entity);
+  this->dataPtr->SetPose(i, _pose);
+  auto &c = this->dataPtr->c;
+  c[VX][i] = _linearVel.X();
+  c[VY][i] = _linearVel.Y();
+  c[VZ][i] = _linearVel.Z();
+  c[WX][i] = _angularVel.X();
+  c[WY][i] = _angularVel.Y();
+  c[WZ][i] = _angularVel.Z();
+  this->dataPtr->flags[i] |= kHasVel;
+}
+
+/////////////////////////////////////////////////
+void LinkStateBuffer::RemoveIf(
+    const std::function<bool(const Entity *)> &_pred)
+{
+  auto &d = *this->dataPtr;
+
+  // Compact the arrays in place, keeping the order of the other entities
+  size_t kept = 0;
+  for (size_t i = 0; i < d.entities.size(); ++i)
+  {
+    if (_pred(d.entities[i]))
+      continue;
+
+    if (kept != i)
+    {
+      d.entities[kept] = d.entities[i];
+      d.flags[kept] = d.flags[i];
+      for (auto &values : d.c)
+        values[kept] = values[i];
+    }
+    ++kept;
+  }
+
+  if (kept == d.entities.size())
+    return;
+
+  d.entities.resize(kept);
+  d.flags.resize(kept);
+  for (auto &values : d.c)
+    values.resize(kept);
+
+  d.index.clear();
+  for (size_t i = 0; i < d.entities.size(); ++i)
+    d.index[d.entities[i]] = i;
+}
+
+/////////////////////////////////////////////////
+size_t LinkStateBuffer::Count() const
+{
+  return this->dataPtr->entities.size();
+}
+
+/////////////////////////////////////////////////
+int LinkStateBuffer::Index(const Entity *_entity) const
+{
+  auto iter = this->dataPtr->index.find(_entity);
+  if (iter == this->dataPtr->index.end())
+    return -1;
+  return static_cast<int>(iter->second);
+}
+
+/////////////////////////////////////////////////
+Entity *LinkStateBuffer::EntityByIndex(const size_t _index) const
+{
+  if (_index >= this->dataPtr->entities.size())
+    return nullptr;
+  return this->dataPtr->entities[_index];
+}
+
+/////////////////////////////////////////////////
+ignition::math::Pose3d LinkStateBuffer::Pose(const size_t _index) const
+{
+  const auto &d = *this->dataPtr;
+  if (_index >= d.entities.size())
+    return ignition::math::Pose3d::Zero;
+
+  return ignition::math::Pose3d(
+      d.c[PX][_index], d.c[PY][_index], d.c[PZ][_index],
+      d.c[QW][_index], d.c[QX][_index], d.c[QY][_index], d.c[QZ][_index]);
+}
+
+/////////////////////////////////////////////////
+bool LinkStateBuffer::HasVel(const size_t _index) const
+{
+  if (_index >= this->dataPtr->entities.size())
+    return false;
+  return (this->dataPtr->flags[_index] & kHasVel) != 0;
+}
+
+/////////////////////////////////////////////////
+ignition::math::Vector3d LinkStateBuffer::LinearVel(const size_t _index) const
+{
+  const auto &d = *this->dataPtr;
+  if (!this->HasVel(_index))
+    return ignition::math::Vector3d::Zero;
+
+  return ignition::math::Vector3d(
+      d.c[VX][_index], d.c[VY][_index], d.c[VZ][_index]);
+}
+
+/////////////////////////////////////////////////
+ignition::math::Vector3d LinkStateBuffer::AngularVel(const size_t _index)
+    const
+{
+  const auto &d = *this->dataPtr;
+  if (!this->HasVel(_index))
+    return ignition::math::Vector3d::Zero;
+
+  return ignition::math::Vector3d(
+      d.c[WX][_index], d.c[WY][_index], d.c[WZ][_index]);
+}
+
+/////////////////////////////////////////////////
+void LinkStateBuffer::WriteWorldPoses() const
+{
+  const auto &d = *this->dataPtr;
+  const size_t count = d.entities.size();
+
+  auto write = [this, &d](const size_t _begin, const size_t _end,
+      const bool _serial)
+  {
+    for (size_t i = _begin; i < _end; ++i)
+    {
+      if (((d.flags[i] & kSerial) != 0) == _serial)
+        d.entities[i]->_SetPhysicsWorldPose(this->Pose(i));
+    }
+  };
+
+  if (count > 2 * kWriteGrainSize)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, kWriteGrainSize),
+        [&write](const tbb::blocked_range<size_t> &_r)
+        {
+          write(_r.begin(), _r.end(), false);
+        });
+  }
+  else
+  {
+    write(0, count, false);
+  }
+
+  write(0, count, true);
+}
+
+/////////////////////////////////////////////////
+void LinkStateBuffer::Swap(LinkStateBuffer &_other)
+{
+  this->dataPtr.swap(_other.dataPtr);
+}
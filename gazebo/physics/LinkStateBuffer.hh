@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_LINKSTATEBUFFER_HH_
+#define GAZEBO_PHYSICS_LINKSTATEBUFFER_HH_
+
+#include <functional>
+#include <memory>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/physics/PhysicsTypes.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    // Forward declare private data class.
+    class LinkStateBufferPrivate;
+
+    /// \addtogroup gazebo_physics
+    /// \{
+
+    /// \class LinkStateBuffer LinkStateBuffer.hh physics/physics.hh
+    /// \brief World poses and velocities of the links moved by a physics
+    /// step, stored as one array per component.
+    ///
+    /// Physics engines add the state of every link they moved, then the
+    /// world writes all the poses back into the links at once, see
+    /// World::_DirtyLinkStates. The states of the last step can be read
+    /// with World::LinkStates without going through each link.
+    ///
+    /// An entity is stored at most once, adding it again replaces its
+    /// state. The buffer is not thread safe.
+    class GZ_PHYSICS_VISIBLE LinkStateBuffer
+    {
+      /// \brief Constructor. The buffer is empty.
+      public: LinkStateBuffer();
+
+      /// \brief Destructor.
+      public: ~LinkStateBuffer();
+
+      /// \brief Reserve memory for a number of entities.
+      /// \param[in] _count Number of entities.
+      public: void Reserve(const size_t _count);
+
+      /// \brief Remove all the states. Memory is kept for the next step.
+      public: void Clear();
+
+      /// \brief Add the world pose of an entity, without velocities.
+      /// \param[in] _entity The entity.
+      /// \param[in] _pose World pose of the entity.
+      public: void Add(Entity *_entity, const ignition::math::Pose3d &_pose);
+
+      /// \brief Add the world pose and velocities of an entity.
+      /// \param[in] _entity The entity.
+      /// \param[in] _pose World pose of the entity.
+      /// \param[in] _linearVel Linear velocity of the entity's origin in
+      /// the world frame.
+      /// \param[in] _angularVel Angular velocity in the world frame.
+      public: void Add(Entity *_entity, const ignition::math::Pose3d &_pose,
+                  const ignition::math::Vector3d &_linearVel,
+                  const ignition::math::Vector3d &_angularVel);
+
+      /// \brief Remove the states of the entities matching a predicate.
+      /// \param[in] _pred Returns true for the entities to remove.
+      public: void RemoveIf(
+                  const std::function<bool(const Entity *)> &_pred);
+
+      /// \brief Get the number of entities.
+      /// \return Number of entities.
+      public: size_t Count() const;
+
+      /// \brief Get the index of an entity.
+      /// \param[in] _entity The entity.
+      /// \return Index of the entity, -1 if it is not in the buffer.
+      public: int Index(const Entity *_entity) const;
+
+      /// \brief Get an entity.
+      /// \param[in] _index Index of the entity.
+      /// \return The entity, null if the index is out of range.
+      public: Entity *EntityByIndex(const size_t _index) const;
+
+      /// \brief Get the world pose of an entity.
+      /// \param[in] _index Index of the entity.
+      /// \return World pose, zero if the index is out of range.
+      public: ignition::math::Pose3d Pose(const size_t _index) const;
+
+      /// \brief Get whether the velocities of an entity were added.
+      /// \param[in] _index Index of the entity.
+      /// \return True if the velocities are known.
+      public: bool HasVel(const size_t _index) const;
+
+      /// \brief Get the linear velocity of an entity's origin.
+      /// \param[in] _index Index of the entity.
+      /// \return Linear velocity in the world frame, zero if it is unknown.
+      public: ignition::math::Vector3d LinearVel(const size_t _index) const;
+
+      /// \brief Get the angular velocity of an entity.
+      /// \param[in] _index Index of the entity.
+      /// \return Angular velocity in the world frame, zero if it is unknown.
+      public: ignition::math::Vector3d AngularVel(const size_t _index) const;
+
+      /// \brief Set the world pose of every entity, without notifying the
+      /// physics engine. Links of top level models are written in
+      /// parallel, other entities afterwards in order. The caller must
+      /// hold World::WorldPoseMutex.
+      public: void WriteWorldPoses() const;
+
+      /// \brief Exchange the content of two buffers.
+      /// \param[in,out] _other The other buffer.
+      public: void Swap(LinkStateBuffer &_other);
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<LinkStateBufferPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
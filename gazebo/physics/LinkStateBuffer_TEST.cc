@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "gazebo/physics/Entity.hh"
+#include "gazebo/physics/LinkStateBuffer.hh"
+#include "gazebo/physics/Model.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+using ignition::math::Pose3d;
+using ignition::math::Vector3d;
+
+class LinkStateBufferTest : public gazebo::testing::AutoLogFixture { };
+
+/// \brief Entity standing in for a link.
+class TestLink : public physics::Entity
+{
+  /// \brief Constructor.
+  /// \param[in] _parent Parent of the link.
+  public: explicit TestLink(physics::BasePtr _parent)
+          : physics::Entity(_parent)
+  {
+    this->AddType(physics::Base::LINK);
+  }
+
+  // Documentation inherited
+  protected: virtual void OnPoseChange() {}
+};
+
+/////////////////////////////////////////////////
+TEST_F(LinkStateBufferTest, Add)
+{
+  physics::EntityPtr link1(new TestLink(physics::BasePtr()));
+  physics::EntityPtr link2(new TestLink(physics::BasePtr()));
+
+  physics::LinkStateBuffer states;
+  EXPECT_EQ(0u, states.Count());
+  EXPECT_EQ(-1, states.Index(link1.get()));
+  EXPECT_TRUE(states.EntityByIndex(0) == nullptr);
+  EXPECT_EQ(Pose3d::Zero, states.Pose(0));
+  EXPECT_FALSE(states.HasVel(0));
+
+  const Pose3d pose1(1, 2, 3, 0.1, 0.2, 0.3);
+  const Pose3d pose2(-1, 0, 5, 0, 0, 1.5);
+  states.Add(link1.get(), pose1);
+  states.Add(link2.get(), pose2, Vector3d(1, 0, 0), Vector3d(0, 0, 2));
+  states.Add(nullptr, pose2);
+
+  ASSERT_EQ(2u, states.Count());
+  EXPECT_EQ(0, states.Index(link1.get()));
+  EXPECT_EQ(1, states.Index(link2.get()));
+  EXPECT_EQ(link2.get(), states.EntityByIndex(1));
+  EXPECT_EQ(pose1, states.Pose(0));
+  EXPECT_EQ(pose2, states.Pose(1));
+  EXPECT_FALSE(states.HasVel(0));
+  EXPECT_EQ(Vector3d::Zero, states.LinearVel(0));
+  EXPECT_TRUE(states.HasVel(1));
+  EXPECT_EQ(Vector3d(1, 0, 0), states.LinearVel(1));
+  EXPECT_EQ(Vector3d(0, 0, 2), states.AngularVel(1));
+
+  // Adding an entity again replaces its state
+  states.Add(link1.get(), pose2, Vector3d(0, 3, 0), Vector3d::Zero);
+  states.Add(link2.get(), pose1);
+  ASSERT_EQ(2u, states.Count());
+  EXPECT_EQ(pose2, states.Pose(0));
+  EXPECT_TRUE(states.HasVel(0));
+  EXPECT_EQ(Vector3d(0, 3, 0), states.LinearVel(0));
+  EXPECT_EQ(pose1, states.Pose(1));
+  EXPECT_FALSE(states.HasVel(1));
+
+  states.Clear();
+  EXPECT_EQ(0u, states.Count());
+  EXPECT_EQ(-1, states.Index(link1.get()));
+}
+
+/////////////////////////////////////////////////
+TEST_F(LinkStateBufferTest, RemoveIfSwap)
+{
+  std::vector<physics::EntityPtr> links;
+  physics::LinkStateBuffer states;
+  for (int i = 0; i < 5; ++i)
+  {
+    links.push_back(physics::EntityPtr(new TestLink(physics::BasePtr())));
+    states.Add(links.back().get(), Pose3d(i, 0, 0, 0, 0, 0));
+  }
+
+  physics::Entity *removed = links[1].get();
+  states.RemoveIf([removed](const physics::Entity *_entity)
+      {
+        return _entity == removed;
+      });
+
+  ASSERT_EQ(4u, states.Count());
+  EXPECT_EQ(-1, states.Index(removed));
+  EXPECT_EQ(1, states.Index(links[2].get()));
+  EXPECT_EQ(links[4].get(), states.EntityByIndex(3));
+  EXPECT_EQ(Pose3d(4, 0, 0, 0, 0, 0), states.Pose(3));
+
+  physics::LinkStateBuffer other;
+  other.Swap(states);
+  EXPECT_EQ(0u, states.Count());
+  EXPECT_EQ(4u, other.Count());
+  EXPECT_EQ(0, other.Index(links[0].get()));
+}
+
+/////////////////////////////////////////////////
+TEST_F(LinkStateBufferTest, WriteWorldPoses)
+{
+  // Enough links to be written in parallel
+  physics::ModelPtr model(new physics::Model(physics::BasePtr()));
+  std::vector<physics::EntityPtr> links;
+  physics::LinkStateBuffer states;
+  for (int i = 0; i < 2000; ++i)
+  {
+    links.push_back(physics::EntityPtr(new TestLink(
+        i % 2 ? physics::BasePtr() : physics::BasePtr(model))));
+    states.Add(links.back().get(), Pose3d(i, -i, 0.5 * i, 0, 0, 0.001 * i));
+  }
+
+  states.WriteWorldPoses();
+
+  for (int i = 0; i < 2000; ++i)
+  {
+    EXPECT_EQ(Pose3d(i, -i, 0.5 * i, 0, 0, 0.001 * i),
+        links[i]->WorldPose());
+  }
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
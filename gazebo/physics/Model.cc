@@ -25,6 +25,8 @@
 #include <ignition/math/Pose3.hh>
 #include <ignition/math/SemanticVersion.hh>
 #include <ignition/msgs/plugin_v.pb.h>
+#include <algorithm>
+#include <list>
 #include <sstream>
 
 #include "gazebo/common/KeyFrame.hh"
@@ -126,6 +128,28 @@ void Model::Load(sdf::ElementPtr _sdf)
   if (this->sdf->HasElement("allow_auto_disable"))
     this->SetAutoDisable(this->sdf->Get<bool>("allow_auto_disable"));
 
+  // <substeps> is not part of the SDF specification, it is read as a
+  // string from the copied element.
+  if (this->sdf->HasElement("substeps"))
+  {
+    int count = 0;
+    std::istringstream stream(this->sdf->Get<std::string>("substeps"));
+    if (!(stream >> count) || count < 1)
+    {
+      gzerr << "Invalid substeps[" << this->sdf->Get<std::string>("substeps")
+            << "] for model[" << this->GetScopedName()
+            << "], must be a positive integer\n";
+    }
+    else if (this->parent && this->parent->HasType(MODEL))
+    {
+      gzwarn << "Ignoring substeps of nested model["
+             << this->GetScopedName()
+             << "], nested models are substepped with their top level model\n";
+    }
+    else
+      this->SetSubsteps(count);
+  }
+
   this->LoadLinks();
 
   this->LoadModels();
@@ -445,6 +469,12 @@ boost::shared_ptr<Model> Model::shared_from_this()
 //////////////////////////////////////////////////
 void Model::Fini()
 {
+  if (this->sleeping.exchange(false) && this->world)
+    this->world->_SetModelSleeping(false);
+  if (this->substeps > 1 && this->world)
+    this->world->_SetModelSubstepped(false);
+  this->substeps = 1;
+
   // Destroy all attached models
   for (auto &model : this->attachedModels)
   {
@@ -1266,6 +1296,9 @@ void Model::SetJointAnimation(
     const std::map<std::string, common::NumericAnimationPtr> &_anims,
     boost::function<void()> _onComplete)
 {
+  // Animations are played by Update, which is skipped while asleep
+  this->Wake();
+
   boost::recursive_mutex::scoped_lock lock(this->updateMutex);
   std::map<std::string, common::NumericAnimationPtr>::const_iterator iter;
   for (iter = _anims.begin(); iter != _anims.end(); ++iter)
@@ -1820,3 +1853,105 @@ std::optional<sdf::SemanticPose> Model::SDFSemanticPose() const
   }
   return std::nullopt;
 }
+
+/////////////////////////////////////////////////
+void Model::Sleep()
+{
+  // Nested models sleep with their top level model
+  if (this->parent && this->parent->HasType(MODEL))
+  {
+    this->GetParentModel()->Sleep();
+    return;
+  }
+
+  if (this->IsStatic() || this->sleeping.exchange(true))
+    return;
+
+  this->sleepIteration = this->world->Iterations();
+  this->world->_SetModelSleeping(true);
+
+  std::list<ModelPtr> modelList = {
+      boost::static_pointer_cast<Model>(shared_from_this())};
+  while (!modelList.empty())
+  {
+    ModelPtr model = modelList.front();
+    modelList.pop_front();
+    model->SetEnabled(false);
+    for (const auto &nested : model->NestedModels())
+      modelList.push_back(nested);
+  }
+}
+
+/////////////////////////////////////////////////
+void Model::Wake()
+{
+  // Nested models sleep with their top level model
+  if (this->parent && this->parent->HasType(MODEL))
+  {
+    this->GetParentModel()->Wake();
+    return;
+  }
+
+  if (!this->sleeping.exchange(false))
+    return;
+
+  this->world->_SetModelSleeping(false);
+
+  std::list<ModelPtr> modelList = {
+      boost::static_pointer_cast<Model>(shared_from_this())};
+  while (!modelList.empty())
+  {
+    ModelPtr model = modelList.front();
+    modelList.pop_front();
+    model->SetEnabled(true);
+    for (const auto &nested : model->NestedModels())
+      modelList.push_back(nested);
+  }
+}
+
+/////////////////////////////////////////////////
+bool Model::IsSleeping() const
+{
+  const Base *top = this;
+  while (top->GetParent() && top->GetParent()->HasType(MODEL))
+    top = top->GetParent().get();
+  return static_cast<const Model *>(top)->sleeping;
+}
+
+/////////////////////////////////////////////////
+uint64_t Model::SleepIteration() const
+{
+  return this->sleepIteration;
+}
+
+/////////////////////////////////////////////////
+void Model::SetSubsteps(const unsigned int _substeps)
+{
+  // Nested models are substepped with their top level model
+  if (this->parent && this->parent->HasType(MODEL))
+  {
+    this->GetParentModel()->SetSubsteps(_substeps);
+    return;
+  }
+
+  if (_substeps > 1 &&
+      this->world->Physics()->GetType() != "ode")
+  {
+    gzwarn << "Substeps of model[" << this->GetScopedName() << "] are "
+           << "ignored, only the ode physics engine supports substepping\n";
+  }
+
+  const unsigned int count = std::max(1u, _substeps);
+  if ((count > 1) != (this->substeps > 1))
+    this->world->_SetModelSubstepped(count > 1);
+  this->substeps = count;
+}
+
+/////////////////////////////////////////////////
+unsigned int Model::Substeps() const
+{
+  const Base *top = this;
+  while (top->GetParent() && top->GetParent()->HasType(MODEL))
+    top = top->GetParent().get();
+  return static_cast<const Model *>(top)->substeps;
+}
@@ -17,6 +17,7 @@
 #ifndef GAZEBO_PHYSICS_MODEL_HH_
 #define GAZEBO_PHYSICS_MODEL_HH_
 
+#include <atomic>
 #include <string>
 #include <map>
 #include <mutex>
@@ -344,6 +345,49 @@ namespace gazebo
       /// \return True if auto disable is allowed for this model.
       public: bool GetAutoDisable() const;
 
+      /// \brief Put the model to sleep. The links are disabled in the
+      /// physics engine, and the world stops updating the model and
+      /// recording its state until it wakes. A model that is allowed to auto
+      /// disable falls asleep on its own once the physics engine has
+      /// disabled all its links. Nested models sleep with their top level
+      /// model.
+      /// \sa Wake()
+      public: void Sleep();
+
+      /// \brief Wake the model up. This happens automatically when a link
+      /// of the model is moved by the physics engine, for example on
+      /// contact, when the pose of the model is set, or when the model or
+      /// its joints are commanded.
+      /// \sa Sleep()
+      public: void Wake();
+
+      /// \brief Get whether the model, or its top level model, is asleep.
+      /// \return True if the model is asleep.
+      public: bool IsSleeping() const;
+
+      /// \brief Get the world iteration at which the model last fell asleep.
+      /// State recorded after this iteration is still current while the
+      /// model is asleep.
+      /// \return Iteration count.
+      public: uint64_t SleepIteration() const;
+
+      /// \brief Set the number of physics substeps the model takes during
+      /// each world step. With more than one substep, the links of the
+      /// model and of its nested models are integrated at a finer rate
+      /// while the rest of the world uses the physics step size. Models
+      /// attached by joints to other models should be substepped together.
+      /// Nested models are substepped with their top level model, and only
+      /// the ODE physics engine supports substepping. Set from the
+      /// <substeps> element of the model SDF.
+      /// \param[in] _substeps Number of substeps, 1 to disable substepping.
+      public: void SetSubsteps(const unsigned int _substeps);
+
+      /// \brief Get the number of physics substeps the model, or its top
+      /// level model, takes during each world step.
+      /// \return Number of substeps, 1 if the model is not substepped.
+      /// \sa SetSubsteps()
+      public: unsigned int Substeps() const;
+
       /// \brief Load all plugins
       ///
       /// Load all plugins specified in the SDF for the model.
@@ -559,6 +603,17 @@ namespace gazebo
 
       /// \brief SDF Model DOM object
       private: const sdf::Model *modelSDFDom = nullptr;
+
+      /// \brief True while the model is asleep. Only used for top level
+      /// models.
+      private: std::atomic<bool> sleeping{false};
+
+      /// \brief World iteration at which the model last fell asleep.
+      private: uint64_t sleepIteration = 0;
+
+      /// \brief Number of physics substeps per world step. Only used for
+      /// top level models.
+      private: unsigned int substeps = 1;
     };
     /// \}
   }
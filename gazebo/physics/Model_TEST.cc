@@ -15,6 +15,8 @@
  *
 */
 
+#include <thread>
+
 #include <ignition/msgs/plugin_v.pb.h>
 
 #include "gazebo/test/ServerFixture.hh"
@@ -242,6 +244,59 @@ TEST_F(ModelTest, BoundingBox)
       model->BoundingBox());
 }
 
+//////////////////////////////////////////////////
+TEST_F(ModelTest, Sleep)
+{
+  this->Load("worlds/shapes.world", true, "ode");
+  auto world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  auto box = world->ModelByName("box");
+  ASSERT_TRUE(box != nullptr);
+  auto link = box->GetLink("link");
+  ASSERT_TRUE(link != nullptr);
+
+  // Put the model to sleep
+  EXPECT_FALSE(box->IsSleeping());
+  box->Sleep();
+  EXPECT_TRUE(box->IsSleeping());
+  EXPECT_FALSE(link->GetEnabled());
+  EXPECT_EQ(1u, world->SleepingModelCount());
+
+  // Sleeping twice is counted once
+  box->Sleep();
+  EXPECT_EQ(1u, world->SleepingModelCount());
+
+  // The model stays still while asleep
+  const ignition::math::Pose3d pose = box->WorldPose();
+  world->Step(10);
+  EXPECT_TRUE(box->IsSleeping());
+  EXPECT_EQ(pose, box->WorldPose());
+
+  // Setting the pose wakes the model
+  box->SetWorldPose(pose + ignition::math::Pose3d(0, 0, 1, 0, 0, 0));
+  EXPECT_FALSE(box->IsSleeping());
+  EXPECT_TRUE(link->GetEnabled());
+  EXPECT_EQ(0u, world->SleepingModelCount());
+
+  // Commanding a link wakes the model
+  box->Sleep();
+  EXPECT_TRUE(box->IsSleeping());
+  link->AddForce(ignition::math::Vector3d(0, 0, 1));
+  EXPECT_FALSE(box->IsSleeping());
+  EXPECT_EQ(0u, world->SleepingModelCount());
+
+  // Wake requests from other threads are applied by the next update
+  box->Sleep();
+  std::thread requester([&world, &box]() {world->_RequestWake(box);});
+  requester.join();
+  EXPECT_TRUE(box->IsSleeping());
+  world->Step(1);
+  EXPECT_FALSE(box->IsSleeping());
+  EXPECT_TRUE(link->GetEnabled());
+  EXPECT_EQ(0u, world->SleepingModelCount());
+}
+
 //////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -41,6 +41,7 @@ namespace gazebo
     class Actor;
     class Light;
     class Link;
+    class LinkStateBuffer;
     class Collision;
     class FrictionPyramid;
     class Gripper;
@@ -50,8 +51,10 @@ namespace gazebo
     class PresetManager;
     class UserCmd;
     class UserCmdManager;
+    class StepService;
     class PhysicsEngine;
     class Wind;
+    class WindField;
     class Atmosphere;
     class Mass;
     class Road;
@@ -137,6 +140,10 @@ namespace gazebo
     /// \brief Shared pointer to a UserCmdManager object
     typedef std::shared_ptr<UserCmdManager> UserCmdManagerPtr;
 
+    /// \def  StepServicePtr
+    /// \brief Shared pointer to a StepService object
+    typedef std::shared_ptr<StepService> StepServicePtr;
+
     /// \def ShapePtr
     /// \brief Boost shared pointer to a Shape object
     typedef boost::shared_ptr<Shape> ShapePtr;
@@ -15,6 +15,7 @@
  *
 */
 
+#include <cstdlib>
 #include <string>
 #include <vector>
 #include <boost/lexical_cast.hpp>
@@ -40,6 +41,9 @@ Population::Population(sdf::ElementPtr _sdf, boost::shared_ptr<World> _world)
   this->dataPtr->world = _world;
   if (_sdf->HasElement("population"))
     this->dataPtr->populationElem = _sdf->GetElement("population");
+
+  const char *instancing = std::getenv("GAZEBO_POPULATION_INSTANCING");
+  this->dataPtr->instancing = instancing && std::string(instancing) == "1";
 }
 
 //////////////////////////////////////////////////
@@ -47,6 +51,18 @@ Population::~Population()
 {
 }
 
+//////////////////////////////////////////////////
+void Population::SetInstancing(const bool _enable)
+{
+  this->dataPtr->instancing = _enable;
+}
+
+//////////////////////////////////////////////////
+bool Population::Instancing() const
+{
+  return this->dataPtr->instancing;
+}
+
 //////////////////////////////////////////////////
 bool Population::PopulateAll()
 {
@@ -106,6 +122,26 @@ bool Population::PopulateOne(const sdf::ElementPtr _population)
   sdf.SetFromString("<sdf version ='" + std::string(SDF_PROTOCOL_VERSION) +
     "'>" + params.modelSdf + "</sdf>");
 
+  if (this->dataPtr->instancing)
+  {
+    // Copy the parsed model for each clone, and only set its name and pose
+    sdf::ElementPtr modelElem = sdf.Root()->GetElement("model");
+    std::vector<sdf::ElementPtr> clones;
+    clones.reserve(objects.size());
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+      sdf::ElementPtr clone = modelElem->Clone();
+      clone->GetAttribute("name")->Set(params.modelName +
+          std::string("_clone_") + boost::lexical_cast<std::string>(i));
+      clone->GetElement("pose")->Set(ignition::math::Pose3d(objects[i],
+          ignition::math::Quaterniond::Identity));
+      clones.push_back(clone);
+    }
+
+    this->dataPtr->world->InsertModelElements(clones);
+    return true;
+  }
+
   for (size_t i = 0; i < objects.size(); ++i)
   {
     ignition::math::Vector3d p(objects[i].X(), objects[i].Y(), objects[i].Z());
@@ -97,6 +97,18 @@ namespace gazebo
       /// otherwise.
       public: bool PopulateAll();
 
+      /// \brief Enable or disable instancing. With instancing, the model of
+      /// a population is parsed once and each clone is a copy of the parsed
+      /// model, inserted without being parsed again. Disabled by default,
+      /// unless the GAZEBO_POPULATION_INSTANCING environment variable is set
+      /// to 1.
+      /// \param[in] _enable True to enable instancing.
+      public: void SetInstancing(const bool _enable);
+
+      /// \brief Get whether instancing is enabled.
+      /// \return True if instancing is enabled.
+      public: bool Instancing() const;
+
       /// \brief Generate and spawn one model population into the world.
       /// \param[in] _population SDF parameter containing the population details
       /// \return True when the population was successfully spawned or false
@@ -34,6 +34,9 @@ namespace gazebo
 
       /// \brief Pointer to the world.
       public: boost::shared_ptr<World> world;
+
+      /// \brief True to insert copies of the parsed model.
+      public: bool instancing = false;
     };
   }
 }
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <string>
+
+#include <boost/thread/recursive_mutex.hpp>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/Events.hh"
+#include "gazebo/transport/transport.hh"
+
+#include "gazebo/physics/Joint.hh"
+#include "gazebo/physics/Link.hh"
+#include "gazebo/physics/PhysicsEngine.hh"
+#include "gazebo/physics/World.hh"
+#include "gazebo/physics/StepServicePrivate.hh"
+#include "gazebo/physics/StepService.hh"
+
+using namespace gazebo;
+using namespace physics;
+
+/////////////////////////////////////////////////
+StepTopicFeed::StepTopicFeed(const WorldPtr &_world)
+  : world(_world)
+{
+}
+
+/////////////////////////////////////////////////
+void StepTopicFeed::OnMsg(const std::string &_data)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->data = _data;
+  this->time = this->world->SimTime();
+}
+
+/////////////////////////////////////////////////
+StepService::StepService(const WorldPtr &_world)
+  : dataPtr(new StepServicePrivate)
+{
+  this->dataPtr->world = _world;
+
+  this->dataPtr->node = transport::NodePtr(new transport::Node());
+  this->dataPtr->node->Init(_world->Name());
+
+  this->dataPtr->updateConnection = event::Events::ConnectWorldUpdateBegin(
+      std::bind(&StepService::OnWorldUpdateBegin, this));
+
+  this->dataPtr->service = "/" + _world->Name() + "/step";
+  if (!this->dataPtr->ignNode.Advertise(this->dataPtr->service,
+      &StepService::Step, this))
+  {
+    gzerr << "Error advertising service [" << this->dataPtr->service << "]"
+          << std::endl;
+  }
+}
+
+/////////////////////////////////////////////////
+StepService::~StepService()
+{
+  this->dataPtr->ignNode.UnadvertiseSrv(this->dataPtr->service);
+  this->dataPtr->updateConnection.reset();
+  this->dataPtr->feeds.clear();
+  if (this->dataPtr->node)
+    this->dataPtr->node->Fini();
+}
+
+/////////////////////////////////////////////////
+std::string StepService::ServiceName() const
+{
+  return this->dataPtr->service;
+}
+
+/////////////////////////////////////////////////
+bool StepService::Step(const msgs::StepRequest &_req,
+    msgs::StepResponse &_rep)
+{
+  std::lock_guard<std::mutex> stepLock(this->dataPtr->stepMutex);
+  WorldPtr world = this->dataPtr->world;
+
+  _rep.Clear();
+
+  // Resolve all the names first, so that nothing is applied if one is
+  // unknown.
+  auto findJoint = [&](const std::string &_name)
+  {
+    JointPtr joint =
+        boost::dynamic_pointer_cast<Joint>(world->BaseByName(_name));
+    if (!joint)
+      _rep.add_error(_name);
+    return joint;
+  };
+  auto findLink = [&](const std::string &_name)
+  {
+    LinkPtr link = boost::dynamic_pointer_cast<Link>(world->BaseByName(_name));
+    if (!link)
+      _rep.add_error(_name);
+    return link;
+  };
+
+  std::vector<JointPtr> cmdJoints;
+  for (const auto &cmd : _req.joint())
+  {
+    cmdJoints.push_back(findJoint(cmd.name()));
+    if (cmdJoints.back() && cmd.axis() >= cmdJoints.back()->DOF())
+      _rep.add_error(cmd.name() + " axis " + std::to_string(cmd.axis()));
+  }
+  std::vector<LinkPtr> cmdLinks;
+  for (const auto &cmd : _req.link())
+    cmdLinks.push_back(findLink(cmd.name()));
+  std::vector<JointPtr> observedJoints;
+  for (const auto &name : _req.observe_joint())
+    observedJoints.push_back(findJoint(name));
+  std::vector<LinkPtr> observedLinks;
+  for (const auto &name : _req.observe_link())
+    observedLinks.push_back(findLink(name));
+
+  // The service still succeeds, since ign-transport does not send the
+  // response of a failed request and the errors would be lost.
+  if (_rep.error_size() > 0)
+  {
+    msgs::Set(_rep.mutable_sim_time(), world->SimTime());
+    _rep.set_iterations(world->Iterations());
+    return true;
+  }
+
+  // Subscribe to new sensor topics
+  for (const auto &topic : _req.observe_topic())
+  {
+    auto &feed = this->dataPtr->feeds[topic];
+    if (!feed)
+    {
+      feed.reset(new StepTopicFeed(world));
+      feed->topic = this->dataPtr->node->DecodeTopicName(topic);
+      feed->sub = this->dataPtr->node->Subscribe(topic,
+          &StepTopicFeed::OnMsg, feed.get());
+    }
+  }
+
+  if (!world->IsPaused())
+    world->SetPaused(true);
+
+  // Apply the commands
+  {
+    boost::recursive_mutex::scoped_lock lock(
+        *world->Physics()->GetPhysicsUpdateMutex());
+    std::lock_guard<std::mutex> forceLock(this->dataPtr->forceMutex);
+
+    for (int i = 0; i < _req.joint_size(); ++i)
+    {
+      const auto &cmd = _req.joint(i);
+      const JointPtr &joint = cmdJoints[i];
+      if (cmd.has_position())
+        joint->SetPosition(cmd.axis(), cmd.position());
+      if (cmd.has_velocity())
+        joint->SetVelocity(cmd.axis(), cmd.velocity());
+      if (cmd.has_force())
+        this->dataPtr->jointForces.push_back({joint, cmd.axis(), cmd.force()});
+    }
+
+    for (int i = 0; i < _req.link_size(); ++i)
+    {
+      const auto &cmd = _req.link(i);
+      const LinkPtr &link = cmdLinks[i];
+      if (cmd.has_pose())
+        link->SetWorldPose(msgs::ConvertIgn(cmd.pose()));
+      if (cmd.has_linear_velocity())
+        link->SetLinearVel(msgs::ConvertIgn(cmd.linear_velocity()));
+      if (cmd.has_angular_velocity())
+        link->SetAngularVel(msgs::ConvertIgn(cmd.angular_velocity()));
+      if (cmd.has_force() || cmd.has_torque())
+      {
+        StepLinkWrench wrench;
+        wrench.link = link;
+        if (cmd.has_force())
+          wrench.force = msgs::ConvertIgn(cmd.force());
+        if (cmd.has_torque())
+          wrench.torque = msgs::ConvertIgn(cmd.torque());
+        this->dataPtr->linkWrenches.push_back(wrench);
+      }
+    }
+  }
+
+  if (_req.iterations() > 0)
+    world->Step(_req.iterations());
+
+  // Forces are only held while stepping this request
+  {
+    std::lock_guard<std::mutex> forceLock(this->dataPtr->forceMutex);
+    this->dataPtr->jointForces.clear();
+    this->dataPtr->linkWrenches.clear();
+  }
+
+  // Observe
+  {
+    boost::recursive_mutex::scoped_lock lock(
+        *world->Physics()->GetPhysicsUpdateMutex());
+
+    msgs::Set(_rep.mutable_sim_time(), world->SimTime());
+    _rep.set_iterations(world->Iterations());
+
+    for (const auto &link : observedLinks)
+    {
+      msgs::Pose *pose = _rep.add_link();
+      msgs::Set(pose, link->WorldPose());
+      pose->set_name(link->GetScopedName());
+      pose->set_id(link->GetId());
+    }
+
+    for (const auto &joint : observedJoints)
+    {
+      auto *state = _rep.add_joint();
+      state->set_name(joint->GetScopedName());
+      for (unsigned int axis = 0; axis < joint->DOF(); ++axis)
+      {
+        state->add_position(joint->Position(axis));
+        state->add_velocity(joint->GetVelocity(axis));
+        state->add_force(joint->GetForce(axis));
+      }
+    }
+  }
+
+  for (const auto &topic : _req.observe_topic())
+  {
+    StepTopicFeed &feed = *this->dataPtr->feeds[topic];
+    auto *data = _rep.add_topic();
+    data->set_topic(topic);
+
+    std::lock_guard<std::mutex> lock(feed.mutex);
+    if (feed.data.empty())
+      continue;
+
+    if (feed.type.empty())
+      feed.type = transport::getTopicMsgType(feed.topic);
+    data->set_type(feed.type);
+    data->set_data(feed.data);
+    msgs::Set(data->mutable_time(), feed.time);
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+void StepService::OnWorldUpdateBegin()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->forceMutex);
+  for (const auto &force : this->dataPtr->jointForces)
+    force.joint->SetForce(force.axis, force.force);
+  for (const auto &wrench : this->dataPtr->linkWrenches)
+  {
+    wrench.link->AddForce(wrench.force);
+    wrench.link->AddTorque(wrench.torque);
+  }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_STEPSERVICE_HH_
+#define GAZEBO_PHYSICS_STEPSERVICE_HH_
+
+#include <memory>
+#include <string>
+
+#include "gazebo/msgs/msgs.hh"
+#include "gazebo/physics/PhysicsTypes.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    // Forward declare private data class
+    class StepServicePrivate;
+
+    /// \addtogroup gazebo_physics
+    /// \{
+
+    /// \class StepService StepService.hh physics/physics.hh
+    /// \brief Synchronous step service for external controllers and
+    /// learners, advertised as /<world name>/step.
+    ///
+    /// A single msgs::StepRequest applies joint and link commands, steps the
+    /// world and returns the requested observations in a msgs::StepResponse,
+    /// replacing world control messages, waits on world statistics and
+    /// separate subscriptions. The world is paused by the first request.
+    ///
+    /// Forces and torques of a request are applied during every iteration
+    /// it steps. Sensor data is the latest message received on each
+    /// requested topic; the first request for a topic subscribes to it, so
+    /// its data is empty until the sensor publishes. Running the server with
+    /// --lockstep keeps sensor updates in step with the world.
+    class GZ_PHYSICS_VISIBLE StepService
+    {
+      /// \brief Constructor. Advertises the service.
+      /// \param[in] _world The world to step.
+      public: explicit StepService(const WorldPtr &_world);
+
+      /// \brief Destructor.
+      public: ~StepService();
+
+      /// \brief Get the name of the service.
+      /// \return Service name.
+      public: std::string ServiceName() const;
+
+      /// \brief Apply the commands of a request, step the world and fill
+      /// the observations. This is the service callback, and can also be
+      /// called directly. Requests are handled one at a time.
+      /// \param[in] _req The request.
+      /// \param[out] _rep The observations.
+      /// \return Always true, so that remote requesters receive the
+      /// response. If a name in the request is unknown or a joint command
+      /// targets an axis the joint does not have, nothing is applied or
+      /// stepped and the errors are listed in the response.
+      public: bool Step(const msgs::StepRequest &_req,
+                  msgs::StepResponse &_rep);
+
+      /// \brief Apply the held forces, called on world update begin.
+      private: void OnWorldUpdateBegin();
+
+      /// \internal
+      /// \brief Private data pointer
+      private: std::unique_ptr<StepServicePrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_STEPSERVICE_PRIVATE_HH_
+#define GAZEBO_PHYSICS_STEPSERVICE_PRIVATE_HH_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+#include <ignition/transport/Node.hh>
+
+#include "gazebo/common/Event.hh"
+#include "gazebo/common/Time.hh"
+#include "gazebo/transport/TransportTypes.hh"
+#include "gazebo/physics/PhysicsTypes.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief Latest message received on a sensor topic.
+    class StepTopicFeed
+    {
+      /// \brief Constructor.
+      /// \param[in] _world World used to time stamp the messages.
+      public: explicit StepTopicFeed(const WorldPtr &_world);
+
+      /// \brief Store a serialized message.
+      /// \param[in] _data The message.
+      public: void OnMsg(const std::string &_data);
+
+      /// \brief World used to time stamp the messages.
+      public: WorldPtr world;
+
+      /// \brief Subscription to the topic.
+      public: transport::SubscriberPtr sub;
+
+      /// \brief Fully qualified topic name.
+      public: std::string topic;
+
+      /// \brief Message type, looked up once data is received.
+      public: std::string type;
+
+      /// \brief Protects the data and time.
+      public: std::mutex mutex;
+
+      /// \brief Latest serialized message.
+      public: std::string data;
+
+      /// \brief Simulation time at which the latest message was received.
+      public: common::Time time;
+    };
+
+    /// \internal
+    /// \brief A force applied to a joint during every iteration.
+    class StepJointForce
+    {
+      /// \brief The joint.
+      public: JointPtr joint;
+
+      /// \brief Joint axis.
+      public: unsigned int axis = 0;
+
+      /// \brief Force or torque.
+      public: double force = 0;
+    };
+
+    /// \internal
+    /// \brief A wrench applied to a link during every iteration.
+    class StepLinkWrench
+    {
+      /// \brief The link.
+      public: LinkPtr link;
+
+      /// \brief Force in the world frame.
+      public: ignition::math::Vector3d force;
+
+      /// \brief Torque in the world frame.
+      public: ignition::math::Vector3d torque;
+    };
+
+    /// \internal
+    /// \brief Private data for the StepService class
+    class StepServicePrivate
+    {
+      /// \brief The world to step.
+      public: WorldPtr world;
+
+      /// \brief Name of the service.
+      public: std::string service;
+
+      /// \brief Ignition node advertising the service.
+      public: ignition::transport::Node ignNode;
+
+      /// \brief Node used to subscribe to sensor topics.
+      public: transport::NodePtr node;
+
+      /// \brief Sensor topics subscribed to, by topic name.
+      public: std::map<std::string, std::unique_ptr<StepTopicFeed>> feeds;
+
+      /// \brief Handles one request at a time.
+      public: std::mutex stepMutex;
+
+      /// \brief Protects the held forces, which are read by the world
+      /// thread.
+      public: std::mutex forceMutex;
+
+      /// \brief Joint forces of the request being stepped.
+      public: std::vector<StepJointForce> jointForces;
+
+      /// \brief Link wrenches of the request being stepped.
+      public: std::vector<StepLinkWrench> linkWrenches;
+
+      /// \brief Connection to the world update begin event.
+      public: event::ConnectionPtr updateConnection;
+    };
+  }
+}
+#endif
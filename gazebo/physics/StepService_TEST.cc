@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <ignition/transport/Node.hh>
+
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+/// \brief Path of this test executable, run again as a step client.
+static std::string g_testPath;
+
+/////////////////////////////////////////////////
+/// \brief Request a step that observes a joint from this process, and
+/// print the result of the call followed by the errors, one per line.
+/// \param[in] _joint Name of the joint to observe.
+/// \return Zero if a response was received.
+static int StepClient(const std::string &_joint)
+{
+  ignition::transport::Node node;
+  msgs::StepRequest req;
+  msgs::StepResponse rep;
+  bool result = false;
+
+  req.set_iterations(1);
+  req.add_observe_joint(_joint);
+  if (!node.Request("/default/step", req, 5000, rep, result))
+    return 1;
+
+  std::cout << result << std::endl;
+  for (const auto &error : rep.error())
+    std::cout << error << std::endl;
+  return 0;
+}
+
+/////////////////////////////////////////////////
+class StepServiceTest : public ServerFixture
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(StepServiceTest, StepAndObserve)
+{
+  Load("worlds/shapes.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  const uint64_t iterations = world->Iterations();
+  const auto boxPose = world->ModelByName("box")->WorldPose();
+
+  ignition::transport::Node node;
+  msgs::StepRequest req;
+  msgs::StepResponse rep;
+  bool result = false;
+
+  // Push the box up and step
+  req.set_iterations(10);
+  req.add_observe_link("box::link");
+  auto *cmd = req.add_link();
+  cmd->set_name("box::link");
+  msgs::Set(cmd->mutable_linear_velocity(),
+      ignition::math::Vector3d(0, 0, 1));
+
+  ASSERT_TRUE(node.Request("/default/step", req, 5000, rep, result));
+  EXPECT_TRUE(result);
+  EXPECT_EQ(iterations + 10, rep.iterations());
+  EXPECT_EQ(0, rep.error_size());
+  EXPECT_EQ(world->SimTime(), msgs::Convert(rep.sim_time()));
+
+  ASSERT_EQ(1, rep.link_size());
+  EXPECT_EQ("box::link", rep.link(0).name());
+  EXPECT_GT(rep.link(0).position().z(), boxPose.Pos().Z());
+
+  // The world is left paused
+  EXPECT_TRUE(world->IsPaused());
+
+  // Unknown names are reported and nothing is stepped
+  req.Clear();
+  req.add_observe_joint("box::no_joint");
+  ASSERT_TRUE(node.Request("/default/step", req, 5000, rep, result));
+  EXPECT_TRUE(result);
+  ASSERT_EQ(1, rep.error_size());
+  EXPECT_EQ("box::no_joint", rep.error(0));
+  EXPECT_EQ(iterations + 10, world->Iterations());
+}
+
+/////////////////////////////////////////////////
+TEST_F(StepServiceTest, RemoteErrors)
+{
+  Load("worlds/shapes.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+  const uint64_t iterations = world->Iterations();
+
+  // A requester in another process receives the errors of its request
+  std::istringstream output(
+      custom_exec(g_testPath + " --step-client box::no_joint"));
+  std::string line;
+  ASSERT_TRUE(static_cast<bool>(std::getline(output, line)));
+  EXPECT_EQ("1", line);
+  ASSERT_TRUE(static_cast<bool>(std::getline(output, line)));
+  EXPECT_EQ("box::no_joint", line);
+  EXPECT_FALSE(static_cast<bool>(std::getline(output, line)));
+  EXPECT_EQ(iterations, world->Iterations());
+}
+
+/////////////////////////////////////////////////
+TEST_F(StepServiceTest, JointAxis)
+{
+  Load("test/worlds/damp_test.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  const std::string jointName = "model_1_mass_1_damping_10000::joint_0";
+  physics::JointPtr joint = boost::dynamic_pointer_cast<physics::Joint>(
+      world->BaseByName(jointName));
+  ASSERT_TRUE(joint != NULL);
+  ASSERT_EQ(1u, joint->DOF());
+
+  const uint64_t iterations = world->Iterations();
+  const double position = joint->Position(0);
+
+  ignition::transport::Node node;
+  msgs::StepRequest req;
+  msgs::StepResponse rep;
+  bool result = true;
+
+  // A command on an axis the joint does not have cancels the whole
+  // request
+  req.set_iterations(10);
+  auto *cmd = req.add_joint();
+  cmd->set_name(jointName);
+  cmd->set_position(position + 0.5);
+  cmd = req.add_joint();
+  cmd->set_name(jointName);
+  cmd->set_axis(1);
+  cmd->set_velocity(1);
+
+  ASSERT_TRUE(node.Request("/default/step", req, 5000, rep, result));
+  EXPECT_TRUE(result);
+  ASSERT_EQ(1, rep.error_size());
+  EXPECT_EQ(jointName + " axis 1", rep.error(0));
+  EXPECT_EQ(iterations, world->Iterations());
+  EXPECT_NEAR(position, joint->Position(0), 1e-9);
+
+  // The valid command alone is applied
+  req.mutable_joint()->RemoveLast();
+  ASSERT_TRUE(node.Request("/default/step", req, 5000, rep, result));
+  EXPECT_TRUE(result);
+  EXPECT_EQ(0, rep.error_size());
+  EXPECT_EQ(iterations + 10, world->Iterations());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  if (argc == 3 && std::string(argv[1]) == "--step-client")
+    return StepClient(argv[2]);
+
+  g_testPath = argv[0];
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -14,11 +14,16 @@
  * limitations under the License.
  *
  */
+#include <cstring>
+#include <set>
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 
 #include "gazebo/transport/transport.hh"
 
+#include "gazebo/physics/Light.hh"
+#include "gazebo/physics/Link.hh"
+#include "gazebo/physics/Model.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/physics/WorldState.hh"
 
@@ -28,29 +33,392 @@
 using namespace gazebo;
 using namespace physics;
 
+namespace
+{
+  /// \brief Append a value to a recorded state.
+  /// \param[in] _value Value to append.
+  /// \param[out] _out Recorded state.
+  template<typename T>
+  void Write(const T &_value, std::string &_out)
+  {
+    _out.append(reinterpret_cast<const char *>(&_value), sizeof(T));
+  }
+
+  /// \brief Append a string to a recorded state.
+  /// \param[in] _value String to append.
+  /// \param[out] _out Recorded state.
+  void Write(const std::string &_value, std::string &_out)
+  {
+    Write(static_cast<uint32_t>(_value.size()), _out);
+    _out.append(_value);
+  }
+
+  /// \brief Append a vector to a recorded state.
+  /// \param[in] _value Vector to append.
+  /// \param[out] _out Recorded state.
+  void Write(const ignition::math::Vector3d &_value, std::string &_out)
+  {
+    Write(_value.X(), _out);
+    Write(_value.Y(), _out);
+    Write(_value.Z(), _out);
+  }
+
+  /// \brief Append a pose to a recorded state.
+  /// \param[in] _value Pose to append.
+  /// \param[out] _out Recorded state.
+  void Write(const ignition::math::Pose3d &_value, std::string &_out)
+  {
+    Write(_value.Pos(), _out);
+    Write(_value.Rot().W(), _out);
+    Write(_value.Rot().X(), _out);
+    Write(_value.Rot().Y(), _out);
+    Write(_value.Rot().Z(), _out);
+  }
+
+  /// \brief Reads the values appended by Write.
+  class StateReader
+  {
+    /// \brief Constructor.
+    /// \param[in] _data Recorded state, must outlive the reader.
+    public: explicit StateReader(const std::string &_data)
+            : data(_data)
+            {
+            }
+
+    /// \brief Read a value.
+    /// \param[out] _value Value read.
+    /// \return False if the state is truncated.
+    public: template<typename T>
+            bool Read(T &_value)
+            {
+              if (this->offset + sizeof(T) > this->data.size())
+                return false;
+              std::memcpy(&_value, this->data.data() + this->offset,
+                  sizeof(T));
+              this->offset += sizeof(T);
+              return true;
+            }
+
+    /// \brief Read a string.
+    /// \param[out] _value String read.
+    /// \return False if the state is truncated.
+    public: bool Read(std::string &_value)
+            {
+              uint32_t size = 0;
+              if (!this->Read(size) || this->offset + size > this->data.size())
+                return false;
+              _value.assign(this->data, this->offset, size);
+              this->offset += size;
+              return true;
+            }
+
+    /// \brief Read a vector.
+    /// \param[out] _value Vector read.
+    /// \return False if the state is truncated.
+    public: bool Read(ignition::math::Vector3d &_value)
+            {
+              double x, y, z;
+              if (!this->Read(x) || !this->Read(y) || !this->Read(z))
+                return false;
+              _value.Set(x, y, z);
+              return true;
+            }
+
+    /// \brief Read a pose.
+    /// \param[out] _value Pose read.
+    /// \return False if the state is truncated.
+    public: bool Read(ignition::math::Pose3d &_value)
+            {
+              ignition::math::Vector3d pos;
+              double w, x, y, z;
+              if (!this->Read(pos) || !this->Read(w) || !this->Read(x) ||
+                  !this->Read(y) || !this->Read(z))
+              {
+                return false;
+              }
+              _value.Set(pos, ignition::math::Quaterniond(w, x, y, z));
+              return true;
+            }
+
+    /// \brief Recorded state.
+    private: const std::string &data;
+
+    /// \brief Offset of the next value.
+    private: size_t offset = 0;
+  };
+
+  /// \brief Record the state of a model, the same state as ModelState
+  /// holds.
+  /// \param[in] _model Model to record.
+  /// \param[out] _out Recorded state.
+  void WriteModel(const ModelPtr &_model, std::string &_out)
+  {
+    Write(_model->GetName(), _out);
+    Write(_model->WorldPose(), _out);
+    Write(_model->Scale(), _out);
+
+    const Link_V &links = _model->GetLinks();
+    Write(static_cast<uint32_t>(links.size()), _out);
+    for (const auto &link : links)
+    {
+      Write(link->GetName(), _out);
+      Write(link->WorldPose(), _out);
+      Write(link->WorldLinearVel(), _out);
+      Write(link->WorldAngularVel(), _out);
+      Write(link->WorldForce(), _out);
+      Write(link->WorldTorque(), _out);
+    }
+
+    const Model_V &nested = _model->NestedModels();
+    Write(static_cast<uint32_t>(nested.size()), _out);
+    for (const auto &model : nested)
+      WriteModel(model, _out);
+  }
+
+  /// \brief Set the state of a model recorded by WriteModel, the same way
+  /// Model::SetState does.
+  /// \param[in] _model Model to set, or null to skip the state.
+  /// \param[in] _reader Recorded state, after the model's name.
+  /// \return False if the state is truncated.
+  bool ReadModel(const ModelPtr &_model, StateReader &_reader)
+  {
+    ignition::math::Pose3d pose;
+    ignition::math::Vector3d scale;
+    uint32_t count = 0;
+    if (!_reader.Read(pose) || !_reader.Read(scale) || !_reader.Read(count))
+      return false;
+
+    if (_model)
+    {
+      _model->SetWorldPose(pose, true);
+      _model->SetScale(scale, true);
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      std::string name;
+      ignition::math::Vector3d linearVel, angularVel, force, torque;
+      if (!_reader.Read(name) || !_reader.Read(pose) ||
+          !_reader.Read(linearVel) || !_reader.Read(angularVel) ||
+          !_reader.Read(force) || !_reader.Read(torque))
+      {
+        return false;
+      }
+
+      if (!_model)
+        continue;
+
+      LinkPtr link = _model->GetLink(name);
+      if (!link)
+      {
+        gzerr << "Unable to find link[" << name << "]\n";
+        continue;
+      }
+      link->SetWorldPose(pose);
+      link->SetLinearVel(linearVel);
+      link->SetAngularVel(angularVel);
+      link->SetForce(force);
+      link->SetTorque(torque);
+    }
+
+    if (!_reader.Read(count))
+      return false;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      std::string name;
+      if (!_reader.Read(name))
+        return false;
+
+      ModelPtr model;
+      if (_model)
+      {
+        model = _model->NestedModel(name);
+        if (!model)
+          gzerr << "Unable to find model[" << name << "]\n";
+      }
+      if (!ReadModel(model, _reader))
+        return false;
+    }
+
+    return true;
+  }
+
+  /// \brief Record the state of some entities of a world.
+  /// \param[in] _world The world.
+  /// \param[in] _entities Names of top level models and lights, empty for
+  /// the whole world. The time is always recorded.
+  /// \return The recorded state.
+  std::string RecordState(const WorldPtr &_world,
+      const std::vector<std::string> &_entities)
+  {
+    Model_V models;
+    Light_V lights;
+    if (_entities.empty())
+    {
+      models = _world->Models();
+      lights = _world->Lights();
+    }
+    else
+    {
+      for (const auto &name : _entities)
+      {
+        if (auto model = _world->ModelByName(name))
+          models.push_back(model);
+        else if (auto light = _world->LightByName(name))
+          lights.push_back(light);
+      }
+    }
+
+    std::string state;
+    Write(static_cast<uint8_t>(_entities.empty()), state);
+    Write(_world->SimTime().sec, state);
+    Write(_world->SimTime().nsec, state);
+    Write(_world->RealTime().sec, state);
+    Write(_world->RealTime().nsec, state);
+    Write(static_cast<uint64_t>(_world->Iterations()), state);
+
+    Write(static_cast<uint32_t>(models.size()), state);
+    for (const auto &model : models)
+      WriteModel(model, state);
+
+    Write(static_cast<uint32_t>(lights.size()), state);
+    for (const auto &light : lights)
+    {
+      Write(light->GetName(), state);
+      Write(light->WorldPose(), state);
+    }
+
+    return state;
+  }
+
+  /// \brief Set the state recorded by RecordState, including the time.
+  /// Physics states are only reset for the recorded models.
+  /// \param[in] _world The world.
+  /// \param[in] _state The recorded state.
+  void ApplyState(const WorldPtr &_world, const std::string &_state)
+  {
+    StateReader reader(_state);
+
+    uint8_t wholeWorld = 0;
+    if (!reader.Read(wholeWorld))
+      return;
+
+    common::Time simTime, realTime;
+    uint64_t iterations = 0;
+    if (!reader.Read(simTime.sec) || !reader.Read(simTime.nsec) ||
+        !reader.Read(realTime.sec) || !reader.Read(realTime.nsec) ||
+        !reader.Read(iterations))
+    {
+      gzerr << "Invalid user command state" << std::endl;
+      return;
+    }
+
+    if (wholeWorld)
+      _world->ResetPhysicsStates();
+
+    // Undo and redo go back in time like when the whole world state was
+    // recorded. A state without models only sets the time.
+    WorldState timeState;
+    timeState.SetSimTime(simTime);
+    timeState.SetRealTime(realTime);
+    timeState.SetIterations(iterations);
+    _world->SetState(timeState);
+
+    uint32_t count = 0;
+    if (!reader.Read(count))
+    {
+      gzerr << "Invalid user command state" << std::endl;
+      return;
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      std::string name;
+      if (!reader.Read(name))
+      {
+        gzerr << "Invalid user command state" << std::endl;
+        return;
+      }
+
+      ModelPtr model = _world->ModelByName(name);
+      if (!model)
+        gzerr << "Unable to find model[" << name << "]\n";
+      else if (!wholeWorld)
+        model->ResetPhysicsStates();
+
+      if (!ReadModel(model, reader))
+      {
+        gzerr << "Invalid user command state" << std::endl;
+        return;
+      }
+    }
+
+    if (!reader.Read(count))
+    {
+      gzerr << "Invalid user command state" << std::endl;
+      return;
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      std::string name;
+      ignition::math::Pose3d pose;
+      if (!reader.Read(name) || !reader.Read(pose))
+      {
+        gzerr << "Invalid user command state" << std::endl;
+        return;
+      }
+
+      LightPtr light = _world->LightByName(name);
+      if (light)
+        light->SetWorldPose(pose);
+      else
+        gzerr << "Unable to find light[" << name << "]" << std::endl;
+    }
+  }
+
+  /// \brief Get the top level entity of a scoped name.
+  /// \param[in] _name Scoped name, such as "model::link".
+  /// \return Top level name, such as "model".
+  std::string TopLevelName(const std::string &_name)
+  {
+    return _name.substr(0, _name.find("::"));
+  }
+}
 
 /////////////////////////////////////////////////
 UserCmd::UserCmd(const unsigned int _id,
                  physics::WorldPtr _world,
                  const std::string &_description,
                  const msgs::UserCmd::Type &_type)
+  : UserCmd(_id, _world, _description, _type, std::vector<std::string>())
+{
+}
+
+/////////////////////////////////////////////////
+UserCmd::UserCmd(const unsigned int _id,
+                 physics::WorldPtr _world,
+                 const std::string &_description,
+                 const msgs::UserCmd::Type &_type,
+                 const std::vector<std::string> &_entities)
   : dataPtr(new UserCmdPrivate())
 {
   this->dataPtr->id = _id;
   this->dataPtr->world = _world;
   this->dataPtr->description = _description;
   this->dataPtr->type = _type;
+  this->dataPtr->entities = _entities;
 
-  // Record current world state
-  this->dataPtr->startState = WorldState(this->dataPtr->world);
+  // Record current state
+  this->dataPtr->startState =
+      RecordState(this->dataPtr->world, this->dataPtr->entities);
 }
 
 /////////////////////////////////////////////////
 UserCmd::~UserCmd()
 {
   this->dataPtr->world.reset();
-  this->dataPtr->startState.SetWorld(WorldPtr());
-  this->dataPtr->endState.SetWorld(WorldPtr());
 
   delete this->dataPtr;
   this->dataPtr = NULL;
@@ -60,23 +428,18 @@ UserCmd::~UserCmd()
 void UserCmd::Undo()
 {
   // Record / override the state for redo
-  this->dataPtr->endState = WorldState(this->dataPtr->world);
-
-  // Reset physics states for the whole world
-  this->dataPtr->world->ResetPhysicsStates();
+  this->dataPtr->endState =
+      RecordState(this->dataPtr->world, this->dataPtr->entities);
 
   // Set state to the moment the command was executed
-  this->dataPtr->world->SetState(this->dataPtr->startState);
+  ApplyState(this->dataPtr->world, this->dataPtr->startState);
 }
 
 /////////////////////////////////////////////////
 void UserCmd::Redo()
 {
-  // Reset physics states for the whole world
-  this->dataPtr->world->ResetPhysicsStates();
-
   // Set state to the moment undo was triggered
-  this->dataPtr->world->SetState(this->dataPtr->endState);
+  ApplyState(this->dataPtr->world, this->dataPtr->endState);
 }
 
 /////////////////////////////////////////////////
@@ -97,6 +460,13 @@ msgs::UserCmd::Type UserCmd::Type() const
   return this->dataPtr->type;
 }
 
+/////////////////////////////////////////////////
+size_t UserCmd::StateSize() const
+{
+  return this->dataPtr->startState.capacity() +
+      this->dataPtr->endState.capacity();
+}
+
 /////////////////////////////////////////////////
 UserCmdManager::UserCmdManager(const WorldPtr _world)
   : dataPtr(new UserCmdManagerPrivate())
@@ -160,9 +530,33 @@ void UserCmdManager::OnUserCmdMsg(ConstUserCmdPtr &_msg)
   // Generate unique id
   unsigned int id = this->dataPtr->idCounter++;
 
+  // Entities changed by the command, the whole world is recorded for other
+  // commands
+  std::set<std::string> entities;
+  switch (_msg->type())
+  {
+    case msgs::UserCmd::MOVING:
+    case msgs::UserCmd::SCALING:
+    {
+      for (int i = 0; i < _msg->model_size(); ++i)
+        entities.insert(TopLevelName(_msg->model(i).name()));
+      for (int i = 0; i < _msg->light_size(); ++i)
+        entities.insert(TopLevelName(_msg->light(i).name()));
+      break;
+    }
+    case msgs::UserCmd::WRENCH:
+    {
+      entities.insert(TopLevelName(_msg->entity_name()));
+      break;
+    }
+    default:
+      break;
+  }
+
   // Create command
   UserCmdPtr cmd(new UserCmd(id, this->dataPtr->world, _msg->description(),
-      _msg->type()));
+      _msg->type(), std::vector<std::string>(entities.begin(),
+      entities.end())));
 
   // Forward message after we've saved the current state
   switch (_msg->type())
@@ -226,6 +620,8 @@ void UserCmdManager::OnUserCmdMsg(ConstUserCmdPtr &_msg)
   // Clear redo list
   this->dataPtr->redoCmds.clear();
 
+  this->TrimHistory();
+
   // Publish stats
   this->PublishCurrentStats();
 }
@@ -279,6 +675,9 @@ void UserCmdManager::OnUndoRedoMsg(ConstUndoRedoPtr &_msg)
       if (cmdIt == cmd)
         break;
     }
+
+    // Undo recorded the states to redo
+    this->TrimHistory();
   }
   // Redo
   else
@@ -331,6 +730,66 @@ void UserCmdManager::OnUndoRedoMsg(ConstUndoRedoPtr &_msg)
   this->PublishCurrentStats();
 }
 
+/////////////////////////////////////////////////
+void UserCmdManager::SetHistoryLimit(const size_t _bytes)
+{
+  this->dataPtr->historyLimit = _bytes;
+  this->TrimHistory();
+}
+
+/////////////////////////////////////////////////
+size_t UserCmdManager::HistoryLimit() const
+{
+  return this->dataPtr->historyLimit;
+}
+
+/////////////////////////////////////////////////
+size_t UserCmdManager::HistorySize() const
+{
+  size_t size = 0;
+  for (const auto &cmd : this->dataPtr->undoCmds)
+    size += cmd->StateSize();
+  for (const auto &cmd : this->dataPtr->redoCmds)
+    size += cmd->StateSize();
+  return size;
+}
+
+/////////////////////////////////////////////////
+void UserCmdManager::TrimHistory()
+{
+  size_t size = this->HistorySize();
+  if (size <= this->dataPtr->historyLimit)
+    return;
+
+  // Drop the commands furthest from the current state first: the oldest
+  // undo commands, then the furthest redo commands. The most recent undo
+  // command is always kept.
+  auto &undoCmds = this->dataPtr->undoCmds;
+  auto &redoCmds = this->dataPtr->redoCmds;
+  size_t dropUndo = 0;
+  while (size > this->dataPtr->historyLimit &&
+         dropUndo + 1 < undoCmds.size())
+  {
+    size -= undoCmds[dropUndo++]->StateSize();
+  }
+  undoCmds.erase(undoCmds.begin(), undoCmds.begin() + dropUndo);
+
+  size_t dropRedo = 0;
+  while (size > this->dataPtr->historyLimit && dropRedo < redoCmds.size() &&
+         (dropRedo + 1 < redoCmds.size() || !undoCmds.empty()))
+  {
+    size -= redoCmds[dropRedo++]->StateSize();
+  }
+  redoCmds.erase(redoCmds.begin(), redoCmds.begin() + dropRedo);
+
+  if (dropUndo > 0 || dropRedo > 0)
+  {
+    gzmsg << "Dropped " << dropUndo + dropRedo << " user commands to keep "
+          << "the undo history under " << this->dataPtr->historyLimit
+          << " bytes" << std::endl;
+  }
+}
+
 /////////////////////////////////////////////////
 void UserCmdManager::PublishCurrentStats()
 {
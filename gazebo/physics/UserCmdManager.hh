@@ -18,6 +18,7 @@
 #define GAZEBO_PHYSICS_USERCMDMANAGER_HH_
 
 #include <string>
+#include <vector>
 
 #include "gazebo/transport/TransportTypes.hh"
 
@@ -32,9 +33,13 @@ namespace gazebo
 
     /// \brief Class which represents a user command, which can be "undone"
     /// and "redone".
+    ///
+    /// Only the state of the models and lights changed by the command is
+    /// recorded, as a compact binary snapshot, and undo and redo only set
+    /// the state of those entities.
     class GZ_PHYSICS_VISIBLE UserCmd
     {
-      /// \brief Constructor
+      /// \brief Constructor. The state of the whole world is recorded.
       /// \param[in] _id Unique ID for this command
       /// \param[in] _world Pointer to the world
       /// \param[in] _description Description for the command, such as
@@ -45,6 +50,21 @@ namespace gazebo
                       const std::string &_description,
                       const msgs::UserCmd::Type &_type);
 
+      /// \brief Constructor.
+      /// \param[in] _id Unique ID for this command
+      /// \param[in] _world Pointer to the world
+      /// \param[in] _description Description for the command, such as
+      /// "Rotate box", "Delete sphere", etc.
+      /// \param[in] _type Type of command, such as MOVING, DELETING, etc.
+      /// \param[in] _entities Names of the top level models and lights
+      /// changed by the command. If empty, the state of the whole world is
+      /// recorded. The simulation time is always recorded.
+      public: UserCmd(const unsigned int _id,
+                      physics::WorldPtr _world,
+                      const std::string &_description,
+                      const msgs::UserCmd::Type &_type,
+                      const std::vector<std::string> &_entities);
+
       /// \brief Destructor
       public: virtual ~UserCmd();
 
@@ -66,6 +86,11 @@ namespace gazebo
       /// \return Command type
       public: msgs::UserCmd::Type Type() const;
 
+      /// \brief Get the memory used by the states recorded for undo and
+      /// redo.
+      /// \return Size in bytes.
+      public: size_t StateSize() const;
+
       /// \internal
       /// \brief Pointer to private data.
       protected: UserCmdPrivate *dataPtr;
@@ -83,6 +108,22 @@ namespace gazebo
       /// \brief Destructor.
       public: virtual ~UserCmdManager();
 
+      /// \brief Set the maximum memory used by the states recorded for undo
+      /// and redo. The oldest commands are dropped when it is exceeded, the
+      /// most recent command is always kept.
+      /// \param[in] _bytes Limit in bytes.
+      public: void SetHistoryLimit(const size_t _bytes);
+
+      /// \brief Get the maximum memory used by the states recorded for undo
+      /// and redo.
+      /// \return Limit in bytes.
+      public: size_t HistoryLimit() const;
+
+      /// \brief Get the memory used by the states recorded for undo and
+      /// redo.
+      /// \return Size in bytes.
+      public: size_t HistorySize() const;
+
       /// \brief Callback when a UserCmd message is received, notifying that
       /// a new command has been executed by a user.
       /// \param[in] _msg Incoming message
@@ -96,6 +137,10 @@ namespace gazebo
       /// \brief Publish a message about current user command statistics.
       private: void PublishCurrentStats();
 
+      /// \brief Drop the oldest commands until the history fits in its
+      /// limit.
+      private: void TrimHistory();
+
       /// \internal
       /// \brief Pointer to private data.
       private: UserCmdManagerPrivate *dataPtr;
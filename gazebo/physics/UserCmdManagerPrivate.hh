@@ -29,8 +29,6 @@ namespace gazebo
 {
   namespace physics
   {
-    class WorldState;
-
     /// \internal
     /// \brief Private data for the UserCmdManager class
     class UserCmdPrivate
@@ -38,12 +36,17 @@ namespace gazebo
       /// \brief Pointer to the world.
       public: WorldPtr world;
 
-      /// \brief Whole world state the moment the user command was executed.
-      public: WorldState startState;
+      /// \brief Names of the top level models and lights changed by the
+      /// command, empty for the whole world.
+      public: std::vector<std::string> entities;
+
+      /// \brief State of the entities the moment the user command was
+      /// executed.
+      public: std::string startState;
 
-      /// \brief Whole world state for the most recent time the user has
+      /// \brief State of the entities for the most recent time the user has
       /// triggered undo for this command.
-      public: WorldState endState;
+      public: std::string endState;
 
       /// \brief Unique ID identifying this command in the server.
       public: unsigned int id;
@@ -93,6 +96,9 @@ namespace gazebo
 
       /// \brief List of commands which can be redone.
       public: std::vector<UserCmdPtr> redoCmds;
+
+      /// \brief Maximum memory used by the states of the commands.
+      public: size_t historyLimit = 64 * 1024 * 1024;
     };
   }
 }
@@ -15,6 +15,10 @@
  *
 */
 
+#include <atomic>
+#include <string>
+#include <vector>
+
 #include <sdf/sdf.hh>
 
 #include "gazebo/test/ServerFixture.hh"
@@ -61,6 +65,143 @@ TEST_F(UserCmdManagerTest, CreateCmd)
   manager = NULL;
 }
 
+/////////////////////////////////////////////////
+TEST_F(UserCmdManagerTest, EntityCmd)
+{
+  Load("worlds/shapes.world", true);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  physics::ModelPtr box = world->ModelByName("box");
+  physics::ModelPtr sphere = world->ModelByName("sphere");
+  ASSERT_TRUE(box != NULL);
+  ASSERT_TRUE(sphere != NULL);
+
+  const ignition::math::Pose3d boxPose = box->WorldPose();
+
+  // A command touching the box only records the box
+  physics::UserCmd cmd(0, world, "Move box", msgs::UserCmd::MOVING,
+      {"box"});
+  physics::UserCmd worldCmd(1, world, "World", msgs::UserCmd::WORLD_CONTROL);
+  EXPECT_LT(cmd.StateSize(), worldCmd.StateSize());
+
+  const ignition::math::Pose3d movedBox(1, 2, 3, 0, 0, 0);
+  const ignition::math::Pose3d movedSphere(-1, -2, 3, 0, 0, 0);
+  box->SetWorldPose(movedBox);
+  sphere->SetWorldPose(movedSphere);
+
+  // Undo only restores the box
+  cmd.Undo();
+  EXPECT_EQ(boxPose, box->WorldPose());
+  EXPECT_EQ(movedSphere, sphere->WorldPose());
+
+  // Redo restores the pose at the time of the undo
+  cmd.Redo();
+  EXPECT_EQ(movedBox, box->WorldPose());
+  EXPECT_EQ(movedSphere, sphere->WorldPose());
+
+  // History limit
+  physics::UserCmdManager manager(world);
+  EXPECT_EQ(0u, manager.HistorySize());
+  manager.SetHistoryLimit(1024);
+  EXPECT_EQ(1024u, manager.HistoryLimit());
+}
+
+/// \brief Undo command count of the last stats received.
+static std::atomic<int> g_undoCmdCount(-1);
+
+/// \brief Number of stats received.
+static std::atomic<int> g_statsCount(0);
+
+/////////////////////////////////////////////////
+void OnUserCmdStats(ConstUserCmdStatsPtr &_msg)
+{
+  g_undoCmdCount = _msg->undo_cmd_count();
+  ++g_statsCount;
+}
+
+/////////////////////////////////////////////////
+TEST_F(UserCmdManagerTest, HistoryLimit)
+{
+  Load("worlds/shapes.world", true);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+  physics::ModelPtr box = world->ModelByName("box");
+  ASSERT_TRUE(box != NULL);
+  physics::UserCmdManagerPtr manager = world->UserCmdMgr();
+  ASSERT_TRUE(manager != NULL);
+
+  // Room for three commands moving the box
+  const size_t cmdSize =
+      physics::UserCmd(0, world, "", msgs::UserCmd::MOVING, {"box"})
+      .StateSize();
+  manager->SetHistoryLimit(3 * cmdSize + cmdSize / 2);
+
+  transport::NodePtr node(new transport::Node());
+  node->Init();
+  transport::PublisherPtr userCmdPub =
+      node->Advertise<msgs::UserCmd>("~/user_cmd");
+  transport::PublisherPtr undoRedoPub =
+      node->Advertise<msgs::UndoRedo>("~/undo_redo");
+  transport::SubscriberPtr statsSub =
+      node->Subscribe("~/user_cmd_stats", &OnUserCmdStats);
+
+  // Waits for the stats published after a command, an undo or a redo
+  auto waitForStats = [](const int _count)
+  {
+    for (int i = 0; i < 500 && g_statsCount < _count; ++i)
+      common::Time::MSleep(10);
+    return g_statsCount >= _count;
+  };
+
+  // Move the box six times, recording its pose before each move
+  std::vector<ignition::math::Pose3d> poses;
+  for (int i = 0; i < 6; ++i)
+  {
+    poses.push_back(box->WorldPose());
+    const ignition::math::Pose3d target(i + 1, 0, 0.5, 0, 0, 0);
+
+    msgs::UserCmd msg;
+    msg.set_description("Move box " + std::to_string(i));
+    msg.set_type(msgs::UserCmd::MOVING);
+    msgs::Model *modelMsg = msg.add_model();
+    modelMsg->set_name("box");
+    msgs::Set(modelMsg->mutable_pose(), target);
+    userCmdPub->Publish(msg);
+
+    ASSERT_TRUE(waitForStats(i + 1));
+    for (int j = 0; j < 500 && box->WorldPose() != target; ++j)
+      common::Time::MSleep(10);
+    ASSERT_EQ(target, box->WorldPose());
+  }
+
+  // The three oldest commands were dropped
+  EXPECT_EQ(3, g_undoCmdCount);
+  EXPECT_LE(manager->HistorySize(), manager->HistoryLimit());
+
+  // Undo records the states to redo, make room for them
+  manager->SetHistoryLimit(100 * cmdSize);
+
+  // The remaining commands undo to the poses recorded before them
+  msgs::UndoRedo undoMsg;
+  undoMsg.set_undo(true);
+  for (int i = 0; i < 3; ++i)
+  {
+    undoRedoPub->Publish(undoMsg);
+    ASSERT_TRUE(waitForStats(7 + i));
+    EXPECT_EQ(2 - i, g_undoCmdCount);
+    EXPECT_EQ(poses[5 - i], box->WorldPose());
+  }
+
+  // Nothing is left to undo
+  undoRedoPub->Publish(undoMsg);
+  EXPECT_FALSE(waitForStats(10));
+  EXPECT_EQ(poses[3], box->WorldPose());
+}
+
+/////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
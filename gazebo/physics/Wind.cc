@@ -16,17 +16,23 @@
 */
 
 #include <functional>
+#include <memory>
+#include <sstream>
 #include <boost/lexical_cast.hpp>
 #include <sdf/sdf.hh>
 
 #include <ignition/math/Vector3.hh>
 
+#include "gazebo/common/CommonIface.hh"
+#include "gazebo/common/Console.hh"
+
 #include "gazebo/transport/Node.hh"
 #include "gazebo/transport/TransportTypes.hh"
 
 #include "gazebo/physics/Entity.hh"
 #include "gazebo/physics/PhysicsTypes.hh"
 #include "gazebo/physics/Wind.hh"
+#include "gazebo/physics/WindField.hh"
 #include "gazebo/physics/World.hh"
 
 namespace gazebo
@@ -57,6 +63,12 @@ namespace gazebo
       public: std::function< ignition::math::Vector3d (
                   const Wind *, const Entity *)> linearVelFunc;
 
+      /// \brief True if linearVelFunc was set by SetLinearVelFunc.
+      public: bool customLinearVelFunc = false;
+
+      /// \brief Wind field added to the global velocity, may be null.
+      public: std::shared_ptr<const WindField> field;
+
       // Transport is declared last.
       /// \brief Node for communication.
       public: transport::NodePtr node;
@@ -95,6 +107,7 @@ Wind::Wind(World &_world, sdf::ElementPtr _sdf)
 
   this->SetLinearVelFunc(std::bind(&Wind::LinearVelDefault, this,
         std::placeholders::_1, std::placeholders::_2));
+  this->dataPtr->customLinearVelFunc = false;
 }
 
 //////////////////////////////////////////////////
@@ -109,9 +122,14 @@ Wind::~Wind()
 
 //////////////////////////////////////////////////
 ignition::math::Vector3d Wind::LinearVelDefault(
-    const Wind *_wind, const Entity */*_entity*/)
+    const Wind *_wind, const Entity *_entity)
 {
-  return _wind->LinearVel();
+  auto field = _wind->Field();
+  if (!field || !_entity)
+    return _wind->LinearVel();
+
+  return _wind->LinearVel() + field->Sample(_entity->WorldPose().Pos(),
+      this->dataPtr->world.SimTime().Double());
 }
 
 //////////////////////////////////////////////////
@@ -120,6 +138,29 @@ ignition::math::Vector3d Wind::WorldLinearVel(const Entity *_entity) const
   return this->dataPtr->linearVelFunc(this, _entity);
 }
 
+//////////////////////////////////////////////////
+void Wind::WorldLinearVels(const std::vector<const Entity *> &_entities,
+    std::vector<ignition::math::Vector3d> &_vels) const
+{
+  _vels.resize(_entities.size());
+
+  auto field = this->Field();
+  if (this->dataPtr->customLinearVelFunc || !field)
+  {
+    for (size_t i = 0; i < _entities.size(); ++i)
+      _vels[i] = this->WorldLinearVel(_entities[i]);
+    return;
+  }
+
+  std::vector<ignition::math::Vector3d> positions(_entities.size());
+  for (size_t i = 0; i < _entities.size(); ++i)
+    positions[i] = _entities[i]->WorldPose().Pos();
+
+  field->Sample(positions, this->dataPtr->world.SimTime().Double(), _vels);
+  for (auto &vel : _vels)
+    vel += this->dataPtr->linearVel;
+}
+
 //////////////////////////////////////////////////
 ignition::math::Vector3d Wind::RelativeLinearVel(const Entity *_entity) const
 {
@@ -200,6 +241,69 @@ void Wind::Load(sdf::ElementPtr _sdf)
 {
   if (_sdf && _sdf->HasElement("linear_velocity"))
     this->SetLinearVel(_sdf->Get<ignition::math::Vector3d>("linear_velocity"));
+
+  // <field> is not part of the SDF specification, its children are read as
+  // strings from the copied element.
+  if (_sdf && _sdf->HasElement("field"))
+    this->LoadField(_sdf->GetElement("field"));
+}
+
+//////////////////////////////////////////////////
+void Wind::LoadField(sdf::ElementPtr _sdf)
+{
+  auto getString = [&_sdf](const std::string &_key,
+      const std::string &_default)
+  {
+    if (!_sdf->HasElement(_key))
+      return _default;
+    std::string value = _sdf->Get<std::string>(_key);
+    value.erase(0, value.find_first_not_of(" \t\n"));
+    value.erase(value.find_last_not_of(" \t\n") + 1);
+    return value;
+  };
+
+  std::shared_ptr<WindField> field(new WindField());
+
+  const std::string uri = getString("uri", "");
+  if (!uri.empty())
+  {
+    const std::string filename = common::find_file(uri);
+    if (filename.empty())
+    {
+      gzerr << "Unable to find wind field[" << uri << "]\n";
+      return;
+    }
+    if (!field->Load(filename))
+      return;
+  }
+  else
+  {
+    unsigned int nx = 0, ny = 0, nz = 0, nt = 0;
+    ignition::math::Vector3d origin, spacing;
+    double timeStep = 0, intensity = 0, lengthScale = 0;
+    unsigned int seed = 0;
+    std::istringstream sizeStream(getString("size", "16 16 8 1"));
+    std::istringstream(getString("origin", "0 0 0")) >> origin;
+    std::istringstream(getString("spacing", "1 1 1")) >> spacing;
+    std::istringstream(getString("time_step", "1")) >> timeStep;
+    std::istringstream(getString("intensity", "1")) >> intensity;
+    std::istringstream(getString("length_scale", "10")) >> lengthScale;
+    std::istringstream(getString("seed", "0")) >> seed;
+    if (!(sizeStream >> nx >> ny >> nz >> nt))
+    {
+      gzerr << "Invalid wind field size[" << getString("size", "")
+            << "], expected '<nx> <ny> <nz> <nt>'\n";
+      return;
+    }
+
+    if (!field->GenerateTurbulence(nx, ny, nz, nt, origin, spacing,
+          timeStep, intensity, lengthScale, seed))
+    {
+      return;
+    }
+  }
+
+  this->SetField(field);
 }
 
 /////////////////////////////////////////////////
@@ -239,4 +343,17 @@ void Wind::SetLinearVelFunc(std::function< ignition::math::Vector3d (
     const Wind *, const Entity *_entity) > _linearVelFunc)
 {
   this->dataPtr->linearVelFunc = _linearVelFunc;
+  this->dataPtr->customLinearVelFunc = true;
+}
+
+/////////////////////////////////////////////////
+void Wind::SetField(std::shared_ptr<const WindField> _field)
+{
+  std::atomic_store(&this->dataPtr->field, _field);
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<const WindField> Wind::Field() const
+{
+  return std::atomic_load(&this->dataPtr->field);
 }
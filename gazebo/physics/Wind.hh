@@ -20,6 +20,7 @@
 #include <string>
 #include <functional>
 #include <memory>
+#include <vector>
 #include <boost/any.hpp>
 
 #include "gazebo/msgs/msgs.hh"
@@ -38,6 +39,24 @@ namespace gazebo
 
     /// \class Wind Wind.hh physics/physics.hh
     /// \brief Base class for wind.
+    ///
+    /// By default the wind velocity is the global linear velocity plus the
+    /// velocity of the wind field, if any, at the entity's position. A
+    /// field is set with SetField, or loaded from the optional <field>
+    /// element of <wind>:
+    ///
+    /// <field>
+    ///   <!-- Either a file written by WindField::Save -->
+    ///   <uri>model://my_wind/field.txt</uri>
+    ///   <!-- or generated turbulence -->
+    ///   <size>32 32 8 16</size>         <!-- nodes along X, Y, Z, time -->
+    ///   <origin>-50 -50 0</origin>
+    ///   <spacing>3 3 3</spacing>
+    ///   <time_step>0.5</time_step>
+    ///   <intensity>1.5</intensity>      <!-- m/s -->
+    ///   <length_scale>30</length_scale> <!-- m -->
+    ///   <seed>0</seed>
+    /// </field>
     class GZ_PHYSICS_VISIBLE Wind
     {
       /// \brief Default constructor.
@@ -91,6 +110,17 @@ namespace gazebo
       public: ignition::math::Vector3d WorldLinearVel(const Entity *_entity)
           const;
 
+      /// \brief Get the wind velocity at the locations of many entities in
+      /// the world coordinate frame. Without a custom function set by
+      /// SetLinearVelFunc, the wind field is sampled for all the entities
+      /// at once.
+      /// \param[in] _entities Entities at which location the wind is
+      /// applied.
+      /// \param[out] _vels Linear velocities of the wind, resized to the
+      /// number of entities.
+      public: void WorldLinearVels(const std::vector<const Entity *> &_entities,
+                  std::vector<ignition::math::Vector3d> &_vels) const;
+
       /// \brief Get the wind velocity at an entity location.
       /// \param[in] _entity Entity at which location the wind is applied.
       /// \return Linear velocity of the wind.
@@ -114,7 +144,17 @@ namespace gazebo
       public: void SetLinearVelFunc(std::function< ignition::math::Vector3d (
           const Wind *_wind, const Entity *_entity) > _linearVelFunc);
 
-      /// \brief Get the global wind velocity, ignoring the entity.
+      /// \brief Set the wind field added to the global velocity by the
+      /// default wind function.
+      /// \param[in] _field The field, null to remove it.
+      public: void SetField(std::shared_ptr<const WindField> _field);
+
+      /// \brief Get the wind field.
+      /// \return The field, null if there is none.
+      public: std::shared_ptr<const WindField> Field() const;
+
+      /// \brief Get the global wind velocity plus the velocity of the wind
+      /// field at the entity's location.
       /// \param[in] _wind Reference to the wind.
       /// \param[in] _entity Pointer to an entity at which location the wind
       /// velocity is to be calculated.
@@ -122,6 +162,10 @@ namespace gazebo
       private: ignition::math::Vector3d LinearVelDefault(const Wind *_wind,
           const Entity *_entity);
 
+      /// \brief Load the wind field from the <field> element.
+      /// \param[in] _sdf The <field> element.
+      private: void LoadField(sdf::ElementPtr _sdf);
+
       /// \internal
       /// \brief Private data pointer.
       private: std::unique_ptr<WindPrivate> dataPtr;
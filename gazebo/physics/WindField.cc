@@ -0,0 +1,459 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+
+#include <ignition/math/Helpers.hh>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/physics/WindField.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief Private data for the WindField class.
+    class WindFieldPrivate
+    {
+      /// \brief Number of nodes along X, Y and Z, and number of time
+      /// slices. All zero if the field is empty.
+      public: unsigned int size[4] = {0, 0, 0, 0};
+
+      /// \brief Position of the first node.
+      public: ignition::math::Vector3d origin;
+
+      /// \brief Distance between nodes.
+      public: ignition::math::Vector3d spacing;
+
+      /// \brief Time between slices in seconds.
+      public: double timeStep = 1;
+
+      /// \brief Velocities along X, stored apart from the other axes so
+      /// that blocks of samples are computed with contiguous loads.
+      public: std::vector<float> vx;
+
+      /// \brief Velocities along Y.
+      public: std::vector<float> vy;
+
+      /// \brief Velocities along Z.
+      public: std::vector<float> vz;
+    };
+  }
+}
+
+using namespace gazebo;
+using namespace physics;
+
+/// \brief Number of positions sampled together.
+static const size_t kBlock = 64;
+
+/////////////////////////////////////////////////
+/// \brief Compute the lower node and the interpolation weight of a block of
+/// coordinates along one axis.
+/// \param[in] _coords Coordinates, _count of them.
+/// \param[in] _count Number of coordinates.
+/// \param[in] _origin Coordinate of the first node.
+/// \param[in] _spacing Distance between nodes.
+/// \param[in] _n Number of nodes.
+/// \param[in] _stride Distance between consecutive nodes in the arrays.
+/// \param[out] _offsets Array offset of the lower node.
+/// \param[out] _weights Weight of the upper node.
+static void AxisWeights(const double *_coords, const size_t _count,
+    const double _origin, const double _spacing, const unsigned int _n,
+    const size_t _stride, size_t *_offsets, float *_weights)
+{
+  if (_n < 2)
+  {
+    std::fill(_offsets, _offsets + _count, 0);
+    std::fill(_weights, _weights + _count, 0.0f);
+    return;
+  }
+
+  const double inv = 1.0 / _spacing;
+  const double last = _n - 1;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    const double f = std::min(std::max((_coords[i] - _origin) * inv, 0.0),
+        last);
+    const unsigned int lower = std::min(static_cast<unsigned int>(f), _n - 2);
+    _offsets[i] = lower * _stride;
+    _weights[i] = static_cast<float>(f - lower);
+  }
+}
+
+/////////////////////////////////////////////////
+WindField::WindField()
+  : dataPtr(new WindFieldPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+WindField::~WindField()
+{
+}
+
+/////////////////////////////////////////////////
+bool WindField::Set(const unsigned int _nx, const unsigned int _ny,
+    const unsigned int _nz, const unsigned int _nt,
+    const ignition::math::Vector3d &_origin,
+    const ignition::math::Vector3d &_spacing, const double _timeStep,
+    const std::vector<ignition::math::Vector3d> &_vels)
+{
+  if (_nx == 0 || _ny == 0 || _nz == 0 || _nt == 0)
+  {
+    gzerr << "Wind field sizes must be positive\n";
+    return false;
+  }
+
+  if (_spacing.X() <= 0 || _spacing.Y() <= 0 || _spacing.Z() <= 0)
+  {
+    gzerr << "Wind field spacing[" << _spacing << "] must be positive\n";
+    return false;
+  }
+
+  if (_nt > 1 && _timeStep <= 0)
+  {
+    gzerr << "Wind field time step[" << _timeStep << "] must be positive\n";
+    return false;
+  }
+
+  const size_t count = static_cast<size_t>(_nx) * _ny * _nz * _nt;
+  if (_vels.size() != count)
+  {
+    gzerr << "Wind field of " << _nx << "x" << _ny << "x" << _nz << "x"
+          << _nt << " nodes needs " << count << " velocities, got "
+          << _vels.size() << "\n";
+    return false;
+  }
+
+  this->dataPtr->size[0] = _nx;
+  this->dataPtr->size[1] = _ny;
+  this->dataPtr->size[2] = _nz;
+  this->dataPtr->size[3] = _nt;
+  this->dataPtr->origin = _origin;
+  this->dataPtr->spacing = _spacing;
+  this->dataPtr->timeStep = _nt > 1 ? _timeStep : 1.0;
+
+  this->dataPtr->vx.resize(count);
+  this->dataPtr->vy.resize(count);
+  this->dataPtr->vz.resize(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    this->dataPtr->vx[i] = static_cast<float>(_vels[i].X());
+    this->dataPtr->vy[i] = static_cast<float>(_vels[i].Y());
+    this->dataPtr->vz[i] = static_cast<float>(_vels[i].Z());
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool WindField::GenerateTurbulence(const unsigned int _nx,
+    const unsigned int _ny, const unsigned int _nz, const unsigned int _nt,
+    const ignition::math::Vector3d &_origin,
+    const ignition::math::Vector3d &_spacing, const double _timeStep,
+    const double _intensity, const double _lengthScale,
+    const unsigned int _seed)
+{
+  if (_lengthScale <= 0 || _intensity < 0)
+  {
+    gzerr << "Wind turbulence needs a positive length scale and a "
+          << "non-negative intensity\n";
+    return false;
+  }
+
+  const size_t count = static_cast<size_t>(_nx) * _ny * _nz * _nt;
+  std::vector<ignition::math::Vector3d> vels(count);
+
+  // Check the grid before spending time on the modes
+  if (!this->Set(_nx, _ny, _nz, _nt, _origin, _spacing, _timeStep, vels))
+    return false;
+
+  // Wave numbers are spread logarithmically from eddies much larger than
+  // the length scale down to the grid resolution.
+  const unsigned int modeCount = 64;
+  const double kMin = 0.1 / _lengthScale;
+  const double kMax = std::max(IGN_PI / std::min(std::min(_spacing.X(),
+      _spacing.Y()), _spacing.Z()), kMin * 2);
+  const double ratio = std::pow(kMax / kMin, 1.0 / (modeCount - 1));
+
+  // Frequencies are multiples of the loop frequency, so the last slice
+  // blends into the first one.
+  const double loopFreq = _nt > 1 ? 2 * IGN_PI / (_nt * _timeStep) : 0;
+
+  std::mt19937 generator(_seed);
+  std::uniform_real_distribution<double> uniform(0, 1);
+  std::normal_distribution<double> normal(0, 1);
+
+  struct Mode
+  {
+    ignition::math::Vector3d wave;
+    ignition::math::Vector3d amplitude;
+    double freq;
+    double phase;
+  };
+  std::vector<Mode> modes(modeCount);
+  for (unsigned int m = 0; m < modeCount; ++m)
+  {
+    const double k = kMin * std::pow(ratio, m);
+    const double dk = k * (ratio - 1);
+
+    // von Karman energy spectrum
+    const double kl = k * _lengthScale;
+    const double energy = std::pow(kl, 4) / std::pow(1 + kl * kl, 17.0 / 6);
+
+    ignition::math::Vector3d dir;
+    while (dir.SquaredLength() < 1e-6)
+      dir.Set(normal(generator), normal(generator), normal(generator));
+    dir.Normalize();
+
+    // The velocity is perpendicular to the wave, so the field has no
+    // divergence.
+    ignition::math::Vector3d perp;
+    while (perp.SquaredLength() < 1e-6)
+    {
+      perp = dir.Cross(ignition::math::Vector3d(normal(generator),
+          normal(generator), normal(generator)));
+    }
+    perp.Normalize();
+
+    modes[m].wave = dir * k;
+    modes[m].amplitude = perp * std::sqrt(energy * dk);
+    modes[m].freq = loopFreq > 0 ?
+        std::max(1.0, std::round(k * _intensity / loopFreq)) * loopFreq : 0;
+    modes[m].phase = uniform(generator) * 2 * IGN_PI;
+  }
+
+  ignition::math::Vector3d sum;
+  size_t i = 0;
+  for (unsigned int t = 0; t < _nt; ++t)
+  {
+    const double time = t * _timeStep;
+    for (unsigned int z = 0; z < _nz; ++z)
+    {
+      for (unsigned int y = 0; y < _ny; ++y)
+      {
+        for (unsigned int x = 0; x < _nx; ++x, ++i)
+        {
+          const ignition::math::Vector3d pos = _origin +
+              ignition::math::Vector3d(x * _spacing.X(), y * _spacing.Y(),
+              z * _spacing.Z());
+          ignition::math::Vector3d vel;
+          for (const auto &mode : modes)
+          {
+            vel += mode.amplitude * std::cos(mode.wave.Dot(pos) +
+                mode.freq * time + mode.phase);
+          }
+          vels[i] = vel;
+          sum += vel;
+        }
+      }
+    }
+  }
+
+  // Remove the mean and scale to the requested intensity
+  const ignition::math::Vector3d mean = sum / static_cast<double>(count);
+  double squares = 0;
+  for (auto &vel : vels)
+  {
+    vel -= mean;
+    squares += vel.SquaredLength();
+  }
+  const double rms = std::sqrt(squares / (3.0 * count));
+  const double scale = rms > 0 ? _intensity / rms : 0;
+  for (auto &vel : vels)
+    vel *= scale;
+
+  return this->Set(_nx, _ny, _nz, _nt, _origin, _spacing, _timeStep, vels);
+}
+
+/////////////////////////////////////////////////
+bool WindField::Load(const std::string &_filename)
+{
+  std::ifstream in(_filename.c_str());
+  if (!in)
+  {
+    gzerr << "Unable to open wind field[" << _filename << "]\n";
+    return false;
+  }
+
+  std::string magic;
+  int version = 0;
+  unsigned int nx = 0, ny = 0, nz = 0, nt = 0;
+  ignition::math::Vector3d origin, spacing;
+  double timeStep = 0;
+  if (!(in >> magic >> version) || magic != "gzwind" || version != 1 ||
+      !(in >> nx >> ny >> nz >> nt >> origin >> spacing >> timeStep))
+  {
+    gzerr << "Invalid wind field header in [" << _filename << "]\n";
+    return false;
+  }
+
+  const size_t count = static_cast<size_t>(nx) * ny * nz * nt;
+  std::vector<ignition::math::Vector3d> vels(count);
+  for (auto &vel : vels)
+  {
+    if (!(in >> vel))
+    {
+      gzerr << "Wind field[" << _filename << "] is missing velocities\n";
+      return false;
+    }
+  }
+
+  return this->Set(nx, ny, nz, nt, origin, spacing, timeStep, vels);
+}
+
+/////////////////////////////////////////////////
+bool WindField::Save(const std::string &_filename) const
+{
+  if (!this->Valid())
+    return false;
+
+  std::ofstream out(_filename.c_str());
+  if (!out)
+  {
+    gzerr << "Unable to write wind field[" << _filename << "]\n";
+    return false;
+  }
+
+  const unsigned int *size = this->dataPtr->size;
+  out.precision(9);
+  out << "gzwind 1\n"
+      << size[0] << " " << size[1] << " " << size[2] << " " << size[3] << "\n"
+      << this->dataPtr->origin << "\n"
+      << this->dataPtr->spacing << "\n"
+      << this->dataPtr->timeStep << "\n";
+  for (size_t i = 0; i < this->dataPtr->vx.size(); ++i)
+  {
+    out << this->dataPtr->vx[i] << " " << this->dataPtr->vy[i] << " "
+        << this->dataPtr->vz[i] << "\n";
+  }
+
+  return static_cast<bool>(out);
+}
+
+/////////////////////////////////////////////////
+bool WindField::Valid() const
+{
+  return !this->dataPtr->vx.empty();
+}
+
+/////////////////////////////////////////////////
+ignition::math::Vector3d WindField::Sample(
+    const ignition::math::Vector3d &_pos, const double _time) const
+{
+  std::vector<ignition::math::Vector3d> vels;
+  this->Sample({_pos}, _time, vels);
+  return vels[0];
+}
+
+/////////////////////////////////////////////////
+void WindField::Sample(const std::vector<ignition::math::Vector3d> &_pos,
+    const double _time, std::vector<ignition::math::Vector3d> &_vels) const
+{
+  _vels.resize(_pos.size());
+  if (!this->Valid())
+  {
+    std::fill(_vels.begin(), _vels.end(), ignition::math::Vector3d::Zero);
+    return;
+  }
+
+  const unsigned int *size = this->dataPtr->size;
+  const size_t strideY = size[0];
+  const size_t strideZ = strideY * size[1];
+  const size_t strideT = strideZ * size[2];
+  const size_t nextX = size[0] > 1 ? 1 : 0;
+  const size_t nextY = size[1] > 1 ? strideY : 0;
+  const size_t nextZ = size[2] > 1 ? strideZ : 0;
+
+  // Time slices repeat
+  size_t slice0 = 0;
+  size_t slice1 = 0;
+  float wt = 0;
+  if (size[3] > 1)
+  {
+    double ft = std::fmod(_time / this->dataPtr->timeStep, size[3]);
+    if (ft < 0)
+      ft += size[3];
+    const unsigned int lower = std::min(static_cast<unsigned int>(ft),
+        size[3] - 1);
+    slice0 = lower * strideT;
+    slice1 = ((lower + 1) % size[3]) * strideT;
+    wt = static_cast<float>(ft - lower);
+  }
+
+  double coords[3][kBlock];
+  size_t offsets[3][kBlock];
+  float weights[3][kBlock];
+  float result[3][kBlock];
+  const std::vector<float> *data[3] = {&this->dataPtr->vx,
+      &this->dataPtr->vy, &this->dataPtr->vz};
+
+  for (size_t start = 0; start < _pos.size(); start += kBlock)
+  {
+    const size_t count = std::min(kBlock, _pos.size() - start);
+    for (size_t i = 0; i < count; ++i)
+    {
+      coords[0][i] = _pos[start + i].X();
+      coords[1][i] = _pos[start + i].Y();
+      coords[2][i] = _pos[start + i].Z();
+    }
+
+    AxisWeights(coords[0], count, this->dataPtr->origin.X(),
+        this->dataPtr->spacing.X(), size[0], 1, offsets[0], weights[0]);
+    AxisWeights(coords[1], count, this->dataPtr->origin.Y(),
+        this->dataPtr->spacing.Y(), size[1], strideY, offsets[1],
+        weights[1]);
+    AxisWeights(coords[2], count, this->dataPtr->origin.Z(),
+        this->dataPtr->spacing.Z(), size[2], strideZ, offsets[2],
+        weights[2]);
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const float *v = data[axis]->data();
+      for (size_t i = 0; i < count; ++i)
+      {
+        const size_t base = offsets[0][i] + offsets[1][i] + offsets[2][i];
+        const float wx = weights[0][i];
+        const float wy = weights[1][i];
+        const float wz = weights[2][i];
+
+        auto trilinear = [&](const float *_s)
+        {
+          const float *p = _s + base;
+          const float c00 = p[0] + wx * (p[nextX] - p[0]);
+          const float c10 = p[nextY] + wx * (p[nextY + nextX] - p[nextY]);
+          const float c01 = p[nextZ] + wx * (p[nextZ + nextX] - p[nextZ]);
+          const float c11 = p[nextZ + nextY] +
+              wx * (p[nextZ + nextY + nextX] - p[nextZ + nextY]);
+          const float c0 = c00 + wy * (c10 - c00);
+          const float c1 = c01 + wy * (c11 - c01);
+          return c0 + wz * (c1 - c0);
+        };
+
+        const float v0 = trilinear(v + slice0);
+        result[axis][i] = wt > 0 ? v0 + wt * (trilinear(v + slice1) - v0) : v0;
+      }
+    }
+
+    for (size_t i = 0; i < count; ++i)
+      _vels[start + i].Set(result[0][i], result[1][i], result[2][i]);
+  }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_WINDFIELD_HH_
+#define GAZEBO_PHYSICS_WINDFIELD_HH_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    // Forward declare private data class.
+    class WindFieldPrivate;
+
+    /// \addtogroup gazebo_physics
+    /// \{
+
+    /// \class WindField WindField.hh physics/physics.hh
+    /// \brief A wind velocity field sampled on a regular grid, optionally
+    /// varying over time.
+    ///
+    /// The grid holds nx * ny * nz nodes per time slice, spaced evenly from
+    /// an origin. Velocities between nodes are interpolated trilinearly,
+    /// and linearly between time slices. Positions outside of the grid use
+    /// the velocity of the closest node, and time slices repeat once the
+    /// last one is reached.
+    ///
+    /// A field is loaded from a file, see Load, or generated as synthetic
+    /// turbulence, see GenerateTurbulence.
+    class GZ_PHYSICS_VISIBLE WindField
+    {
+      /// \brief Constructor. The field is empty.
+      public: WindField();
+
+      /// \brief Destructor.
+      public: ~WindField();
+
+      /// \brief Set the grid and its velocities.
+      /// \param[in] _nx Number of nodes along X.
+      /// \param[in] _ny Number of nodes along Y.
+      /// \param[in] _nz Number of nodes along Z.
+      /// \param[in] _nt Number of time slices.
+      /// \param[in] _origin Position of the first node.
+      /// \param[in] _spacing Distance between nodes along each axis.
+      /// \param[in] _timeStep Time between slices in seconds, ignored if
+      /// there is a single slice.
+      /// \param[in] _vels Velocities, with X varying fastest, then Y, Z and
+      /// time.
+      /// \return False if a size is zero, a spacing or the time step is not
+      /// positive, or the number of velocities does not match.
+      public: bool Set(const unsigned int _nx, const unsigned int _ny,
+                  const unsigned int _nz, const unsigned int _nt,
+                  const ignition::math::Vector3d &_origin,
+                  const ignition::math::Vector3d &_spacing,
+                  const double _timeStep,
+                  const std::vector<ignition::math::Vector3d> &_vels);
+
+      /// \brief Fill the grid with synthetic turbulence with zero mean,
+      /// built from a sum of random divergence free Fourier modes following
+      /// a von Karman spectrum.
+      /// \param[in] _nx Number of nodes along X.
+      /// \param[in] _ny Number of nodes along Y.
+      /// \param[in] _nz Number of nodes along Z.
+      /// \param[in] _nt Number of time slices.
+      /// \param[in] _origin Position of the first node.
+      /// \param[in] _spacing Distance between nodes along each axis.
+      /// \param[in] _timeStep Time between slices in seconds.
+      /// \param[in] _intensity Root mean square of each velocity
+      /// component in m/s.
+      /// \param[in] _lengthScale Size of the largest eddies in meters.
+      /// \param[in] _seed Seed of the random modes, the same seed gives the
+      /// same field.
+      /// \return False if the grid is invalid, see Set.
+      public: bool GenerateTurbulence(const unsigned int _nx,
+                  const unsigned int _ny, const unsigned int _nz,
+                  const unsigned int _nt,
+                  const ignition::math::Vector3d &_origin,
+                  const ignition::math::Vector3d &_spacing,
+                  const double _timeStep, const double _intensity,
+                  const double _lengthScale, const unsigned int _seed);
+
+      /// \brief Load a field from a text file.
+      ///
+      /// The file starts with the line "gzwind 1", followed by the
+      /// numbers of nodes "nx ny nz nt", the origin "x y z", the spacing
+      /// "dx dy dz" and the time step. One "vx vy vz" velocity per node
+      /// follows, in the order given to Set.
+      /// \param[in] _filename Path of the file.
+      /// \return False if the file could not be read.
+      public: bool Load(const std::string &_filename);
+
+      /// \brief Save the field in the format read by Load.
+      /// \param[in] _filename Path of the file.
+      /// \return False if the field is empty or could not be written.
+      public: bool Save(const std::string &_filename) const;
+
+      /// \brief Get whether the field holds a grid.
+      /// \return True after a successful Set, GenerateTurbulence or Load.
+      public: bool Valid() const;
+
+      /// \brief Get the velocity at a position.
+      /// \param[in] _pos Position in the world frame.
+      /// \param[in] _time Simulation time in seconds.
+      /// \return Velocity, zero if the field is empty.
+      public: ignition::math::Vector3d Sample(
+                  const ignition::math::Vector3d &_pos,
+                  const double _time) const;
+
+      /// \brief Get the velocities at many positions at once. This is
+      /// faster than calling Sample for each position.
+      /// \param[in] _pos Positions in the world frame.
+      /// \param[in] _time Simulation time in seconds.
+      /// \param[out] _vels Velocities, resized to the number of positions.
+      public: void Sample(const std::vector<ignition::math::Vector3d> &_pos,
+                  const double _time,
+                  std::vector<ignition::math::Vector3d> &_vels) const;
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<WindFieldPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "gazebo/physics/WindField.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+using ignition::math::Vector3d;
+
+class WindFieldTest : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+/// \brief Fill a 4x3x2 field with 2 time slices, where the velocity of a
+/// node is its grid index, plus 10 in Y for the second slice.
+/// \param[out] _field The field to fill.
+void LinearField(physics::WindField &_field)
+{
+  std::vector<Vector3d> vels;
+  for (int t = 0; t < 2; ++t)
+    for (int z = 0; z < 2; ++z)
+      for (int y = 0; y < 3; ++y)
+        for (int x = 0; x < 4; ++x)
+          vels.push_back(Vector3d(x, y + 10 * t, z));
+
+  EXPECT_TRUE(_field.Set(4, 3, 2, 2, Vector3d(-1, 0, 0), Vector3d(1, 2, 4),
+        0.5, vels));
+}
+
+/////////////////////////////////////////////////
+TEST_F(WindFieldTest, Set)
+{
+  physics::WindField field;
+  EXPECT_FALSE(field.Valid());
+  EXPECT_EQ(Vector3d::Zero, field.Sample(Vector3d(1, 2, 3), 0));
+
+  std::vector<Vector3d> vels(8, Vector3d(1, 0, 0));
+  EXPECT_FALSE(field.Set(0, 2, 2, 2, Vector3d::Zero, Vector3d::One, 1,
+        vels));
+  EXPECT_FALSE(field.Set(2, 2, 2, 1, Vector3d::Zero, Vector3d(1, 0, 1), 1,
+        vels));
+  EXPECT_FALSE(field.Set(2, 2, 2, 2, Vector3d::Zero, Vector3d::One, 0,
+        vels));
+  EXPECT_FALSE(field.Set(2, 2, 2, 2, Vector3d::Zero, Vector3d::One, 1,
+        vels));
+  EXPECT_FALSE(field.Valid());
+
+  EXPECT_TRUE(field.Set(2, 2, 2, 1, Vector3d::Zero, Vector3d::One, 1,
+        vels));
+  EXPECT_TRUE(field.Valid());
+  EXPECT_EQ(Vector3d(1, 0, 0), field.Sample(Vector3d(0.3, 0.7, 0.1), 5));
+}
+
+/////////////////////////////////////////////////
+TEST_F(WindFieldTest, Interpolation)
+{
+  physics::WindField field;
+  LinearField(field);
+
+  // Trilinear between nodes, halfway between the two time slices
+  Vector3d vel = field.Sample(Vector3d(0.5, 1, 2), 0.25);
+  EXPECT_NEAR(1.5, vel.X(), 1e-5);
+  EXPECT_NEAR(5.5, vel.Y(), 1e-5);
+  EXPECT_NEAR(0.5, vel.Z(), 1e-5);
+
+  // Positions outside of the grid use the closest node
+  vel = field.Sample(Vector3d(100, -5, 9), 0);
+  EXPECT_NEAR(3.0, vel.X(), 1e-5);
+  EXPECT_NEAR(0.0, vel.Y(), 1e-5);
+  EXPECT_NEAR(1.0, vel.Z(), 1e-5);
+
+  // Time slices repeat, so the last slice blends back into the first
+  vel = field.Sample(Vector3d(-1, 0, 0), 0.75);
+  EXPECT_NEAR(5.0, vel.Y(), 1e-5);
+  vel = field.Sample(Vector3d(-1, 0, 0), 1.0);
+  EXPECT_NEAR(0.0, vel.Y(), 1e-5);
+}
+
+/////////////////////////////////////////////////
+TEST_F(WindFieldTest, Batch)
+{
+  physics::WindField field;
+  LinearField(field);
+
+  // More positions than a single block of the batch sampler
+  std::vector<Vector3d> positions;
+  for (int i = 0; i < 200; ++i)
+    positions.push_back(Vector3d(i * 0.03 - 1, i * 0.05, i * 0.02));
+
+  std::vector<Vector3d> vels;
+  field.Sample(positions, 0.3, vels);
+  ASSERT_EQ(positions.size(), vels.size());
+  for (size_t i = 0; i < positions.size(); ++i)
+  {
+    Vector3d vel = field.Sample(positions[i], 0.3);
+    EXPECT_NEAR(vel.X(), vels[i].X(), 1e-5);
+    EXPECT_NEAR(vel.Y(), vels[i].Y(), 1e-5);
+    EXPECT_NEAR(vel.Z(), vels[i].Z(), 1e-5);
+  }
+
+  positions.clear();
+  field.Sample(positions, 0.3, vels);
+  EXPECT_TRUE(vels.empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(WindFieldTest, Turbulence)
+{
+  const double intensity = 1.5;
+  physics::WindField field;
+  EXPECT_FALSE(field.GenerateTurbulence(16, 16, 8, 4, Vector3d::Zero,
+        Vector3d(2, 2, 2), 0.5, intensity, 0, 3));
+  // A single slice, so that the statistics of the grid nodes are those of
+  // the whole field
+  ASSERT_TRUE(field.GenerateTurbulence(16, 16, 8, 1, Vector3d::Zero,
+        Vector3d(2, 2, 2), 0.5, intensity, 20, 3));
+
+  std::vector<Vector3d> positions;
+  for (int z = 0; z < 8; ++z)
+    for (int y = 0; y < 16; ++y)
+      for (int x = 0; x < 16; ++x)
+        positions.push_back(Vector3d(2 * x, 2 * y, 2 * z));
+
+  std::vector<Vector3d> vels;
+  field.Sample(positions, 0, vels);
+  Vector3d mean;
+  double squared = 0;
+  for (const auto &vel : vels)
+  {
+    mean += vel;
+    squared += vel.SquaredLength();
+  }
+  mean /= vels.size();
+  EXPECT_NEAR(0.0, mean.Length(), 1e-3);
+  EXPECT_NEAR(intensity, std::sqrt(squared / (3 * vels.size())), 1e-3);
+
+  // The same seed gives the same field
+  ASSERT_TRUE(field.GenerateTurbulence(16, 16, 8, 4, Vector3d::Zero,
+        Vector3d(2, 2, 2), 0.5, intensity, 20, 3));
+  physics::WindField other;
+  ASSERT_TRUE(other.GenerateTurbulence(16, 16, 8, 4, Vector3d::Zero,
+        Vector3d(2, 2, 2), 0.5, intensity, 20, 3));
+  EXPECT_EQ(field.Sample(Vector3d(3, 3, 3), 0.1),
+      other.Sample(Vector3d(3, 3, 3), 0.1));
+
+  ASSERT_TRUE(other.GenerateTurbulence(16, 16, 8, 4, Vector3d::Zero,
+        Vector3d(2, 2, 2), 0.5, intensity, 20, 4));
+  EXPECT_NE(field.Sample(Vector3d(3, 3, 3), 0.1),
+      other.Sample(Vector3d(3, 3, 3), 0.1));
+}
+
+/////////////////////////////////////////////////
+TEST_F(WindFieldTest, SaveLoad)
+{
+  const std::string filename = (boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gz_wind_%%%%%%%%")).string();
+
+  physics::WindField empty;
+  EXPECT_FALSE(empty.Save(filename));
+  EXPECT_FALSE(empty.Load(filename));
+
+  physics::WindField field;
+  ASSERT_TRUE(field.GenerateTurbulence(8, 8, 4, 2, Vector3d(-4, -4, 0),
+        Vector3d(1, 1, 1), 0.5, 2, 10, 7));
+  ASSERT_TRUE(field.Save(filename));
+
+  physics::WindField loaded;
+  ASSERT_TRUE(loaded.Load(filename));
+  EXPECT_TRUE(loaded.Valid());
+  for (double t = 0; t < 1.0; t += 0.1)
+  {
+    Vector3d pos(t * 3 - 4, 2 - t, t * 3);
+    Vector3d vel = field.Sample(pos, t);
+    Vector3d loadedVel = loaded.Sample(pos, t);
+    EXPECT_NEAR(vel.X(), loadedVel.X(), 1e-5);
+    EXPECT_NEAR(vel.Y(), loadedVel.Y(), 1e-5);
+    EXPECT_NEAR(vel.Z(), loadedVel.Z(), 1e-5);
+  }
+
+  boost::filesystem::remove(filename);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
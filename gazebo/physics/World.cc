@@ -22,6 +22,8 @@
 
 #include <sdf/sdf.hh>
 
+#include <algorithm>
+#include <chrono>
 #include <deque>
 #include <list>
 #include <set>
@@ -54,6 +56,7 @@
 #include "gazebo/common/Plugin.hh"
 #include "gazebo/common/SdfFrameSemantics.hh"
 #include "gazebo/common/Time.hh"
+#include "gazebo/common/Trace.hh"
 #include "gazebo/common/URI.hh"
 
 #include "gazebo/msgs/msgs.hh"
@@ -72,6 +75,7 @@
 #include "gazebo/physics/Atmosphere.hh"
 #include "gazebo/physics/AtmosphereFactory.hh"
 #include "gazebo/physics/PresetManager.hh"
+#include "gazebo/physics/StepService.hh"
 #include "gazebo/physics/UserCmdManager.hh"
 #include "gazebo/physics/Model.hh"
 #include "gazebo/physics/Light.hh"
@@ -286,6 +290,30 @@ void World::Load(sdf::ElementPtr _sdf)
 
   this->dataPtr->physicsEngine->Load(physicsElem);
 
+  // Optional real time pacing, not part of the physics schema
+  if (physicsElem->HasElement("real_time_pacing"))
+  {
+    sdf::ElementPtr pacingElem = physicsElem->GetElement("real_time_pacing");
+    common::StepPacer::PacingMode mode = common::StepPacer::SLEEP;
+    if (pacingElem->HasElement("mode") &&
+        !common::StepPacer::ConvertMode(
+          pacingElem->Get<std::string>("mode"), mode))
+    {
+      gzerr << "Invalid real time pacing mode ["
+            << pacingElem->Get<std::string>("mode")
+            << "], must be one of sleep, hybrid or spin. Using sleep.\n";
+    }
+
+    common::Time spinThreshold(0, 200000);
+    if (pacingElem->HasElement("spin_threshold"))
+    {
+      spinThreshold = common::Time(
+          pacingElem->Get<double>("spin_threshold"));
+    }
+
+    this->SetRealTimePacing(mode, spinThreshold);
+  }
+
   // This should come before loading of entities
   sdf::ElementPtr windElem = this->dataPtr->sdf->GetElement("wind");
 
@@ -356,6 +384,9 @@ void World::Load(sdf::ElementPtr _sdf)
   this->dataPtr->userCmdManager = UserCmdManagerPtr(
       new UserCmdManager(shared_from_this()));
 
+  this->dataPtr->stepService = StepServicePtr(
+      new StepService(shared_from_this()));
+
   // Initialize the world URI.
   this->dataPtr->uri.Clear();
   this->dataPtr->uri.SetScheme("data");
@@ -510,6 +541,7 @@ bool World::Running() const
 void World::Stop()
 {
   this->dataPtr->stop = true;
+  this->dataPtr->stepCondition.notify_all();
 
   // Make sure that the thread does not try to join with itself
   if (this->dataPtr->thread &&
@@ -526,6 +558,8 @@ void World::Stop()
 //////////////////////////////////////////////////
 void World::RunLoop()
 {
+  common::Trace::SetThreadName("physics");
+
   this->dataPtr->physicsEngine->InitForThread();
 
   this->dataPtr->startTime = common::Time::GetWallTime();
@@ -596,6 +630,7 @@ void World::LogStep()
         // There are no more chunks, time to exit.
         this->SetPaused(true);
         this->dataPtr->stepInc = 0;
+        this->dataPtr->stepCondition.notify_all();
       }
       else
       {
@@ -645,6 +680,9 @@ void World::LogStep()
 
       if (this->dataPtr->stepInc > 0)
         this->dataPtr->stepInc--;
+
+      if (this->dataPtr->stepInc == 0)
+        this->dataPtr->stepCondition.notify_all();
     }
   }
 
@@ -674,6 +712,7 @@ void World::SetSensorWaitFunc(std::function<void(double, double)> _func)
 //////////////////////////////////////////////////
 void World::Step()
 {
+  GZ_TRACE_SCOPE("World::Step");
   DIAG_TIMER_START("World::Step");
 
   /// need this because ODE does not call dxReallocateWorldProcessContext()
@@ -698,30 +737,44 @@ void World::Step()
         this->dataPtr->physicsEngine->GetMaxStepSize());
 
   double updatePeriod = this->dataPtr->physicsEngine->GetUpdatePeriod();
-  // sleep here to get the correct update rate
-  common::Time tmpTime = common::Time::GetWallTime();
-  common::Time sleepTime = this->dataPtr->prevStepWallTime +
-    common::Time(updatePeriod) - tmpTime - this->dataPtr->sleepOffset;
+  bool update = true;
 
-  common::Time actualSleep;
-  if (sleepTime > 0)
+  if (this->dataPtr->pacer.Mode() == common::StepPacer::SLEEP)
   {
-    common::Time::Sleep(sleepTime);
-    actualSleep = common::Time::GetWallTime() - tmpTime;
+    // sleep here to get the correct update rate
+    common::Time tmpTime = common::Time::GetWallTime();
+    common::Time sleepTime = this->dataPtr->prevStepWallTime +
+      common::Time(updatePeriod) - tmpTime - this->dataPtr->sleepOffset;
+
+    common::Time actualSleep;
+    if (sleepTime > 0)
+    {
+      common::Time::Sleep(sleepTime);
+      actualSleep = common::Time::GetWallTime() - tmpTime;
+    }
+    else
+      sleepTime = 0;
+
+    // exponentially avg out
+    this->dataPtr->sleepOffset = (actualSleep - sleepTime) * 0.01 +
+                        this->dataPtr->sleepOffset * 0.99;
+
+    DIAG_TIMER_LAP("World::Step", "sleepOffset");
+
+    // throttling update rate, with sleepOffset as tolerance
+    // the tolerance is needed as the sleep time is not exact
+    update = common::Time::GetWallTime() - this->dataPtr->prevStepWallTime +
+        this->dataPtr->sleepOffset >= common::Time(updatePeriod);
   }
   else
-    sleepTime = 0;
-
-  // exponentially avg out
-  this->dataPtr->sleepOffset = (actualSleep - sleepTime) * 0.01 +
-                      this->dataPtr->sleepOffset * 0.99;
+  {
+    // deadlines are absolute, so every wake up is an update
+    this->dataPtr->pacer.Wait(updatePeriod);
 
-  DIAG_TIMER_LAP("World::Step", "sleepOffset");
+    DIAG_TIMER_LAP("World::Step", "pacer");
+  }
 
-  // throttling update rate, with sleepOffset as tolerance
-  // the tolerance is needed as the sleep time is not exact
-  if (common::Time::GetWallTime() - this->dataPtr->prevStepWallTime +
-      this->dataPtr->sleepOffset >= common::Time(updatePeriod))
+  if (update)
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
 
@@ -742,7 +795,11 @@ void World::Step()
       DIAG_TIMER_LAP("World::Step", "update");
 
       if (this->IsPaused() && this->dataPtr->stepInc > 0)
+      {
         this->dataPtr->stepInc--;
+        if (this->dataPtr->stepInc == 0)
+          this->dataPtr->stepCondition.notify_all();
+      }
     }
     else
     {
@@ -772,25 +829,42 @@ void World::Step(const unsigned int _steps)
     this->SetPaused(true);
   }
 
-  {
-    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
-    this->dataPtr->stepInc = _steps;
-  }
+  std::unique_lock<std::recursive_mutex> lock(
+      this->dataPtr->worldUpdateMutex);
+  this->dataPtr->stepInc = _steps;
 
-  // block on completion
-  bool wait = true;
-  while (wait)
+  // block on completion. The world thread signals stepCondition when
+  // stepInc reaches zero, the timeout only covers code paths that reset
+  // stepInc without signaling.
+  while (this->dataPtr->stepInc != 0 && !this->dataPtr->stop)
   {
-    common::Time::NSleep(1);
-    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
-    if (this->dataPtr->stepInc == 0 || this->dataPtr->stop)
-      wait = false;
+    this->dataPtr->stepCondition.wait_for(lock,
+        std::chrono::milliseconds(100));
   }
 }
 
+//////////////////////////////////////////////////
+void World::SetRealTimePacing(const common::StepPacer::PacingMode _mode,
+    const common::Time &_spinThreshold)
+{
+  this->dataPtr->pacer.SetSpinThreshold(_spinThreshold);
+  this->dataPtr->pacer.SetMode(_mode);
+
+  // Start a new schedule so that the time spent in another mode isn't
+  // seen as lateness.
+  this->dataPtr->pacer.Reset();
+}
+
+//////////////////////////////////////////////////
+common::StepPacer::PacingMode World::RealTimePacing() const
+{
+  return this->dataPtr->pacer.Mode();
+}
+
 //////////////////////////////////////////////////
 void World::Update()
 {
+  GZ_TRACE_SCOPE("World::Update");
   DIAG_TIMER_START("World::Update");
 
   if (this->dataPtr->needsReset)
@@ -806,8 +880,23 @@ void World::Update()
   }
   DIAG_TIMER_LAP("World::Update", "needsReset");
 
+  // Wake the models commanded from other threads, before they are updated
+  std::vector<ModelPtr> wakeRequests;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->wakeMutex);
+    wakeRequests.swap(this->dataPtr->wakeRequests);
+  }
+  for (auto const &model : wakeRequests)
+    model->Wake();
+
   this->dataPtr->updateInfo.simTime = this->SimTime();
   this->dataPtr->updateInfo.realTime = this->RealTime();
+
+  // Links are updated before the plugins, which may read the wind
+  this->UpdateLinks();
+
+  DIAG_TIMER_LAP("World::Update", "UpdateLinks");
+
   event::Events::worldUpdateBegin(this->dataPtr->updateInfo);
 
   DIAG_TIMER_LAP("World::Update", "Events::worldUpdateBegin");
@@ -853,22 +942,52 @@ void World::Update()
     DIAG_TIMER_LAP("World::Update", "PhysicsEngine::UpdatePhysics");
 
     // do this after physics update as
-    //   ode --> MoveCallback sets the dirtyPoses
+    //   the physics engines fill linkStates
     //           and we need to propagate it into Entity::worldPose
     {
       // block any other pose updates (e.g. Joint::SetPosition)
       boost::recursive_mutex::scoped_lock plock(
           *this->Physics()->GetPhysicsUpdateMutex());
 
-      for (auto &dirtyEntity : this->dataPtr->dirtyPoses)
+      std::lock_guard<std::mutex> lock(this->dataPtr->linkStatesMutex);
+      LinkStateBuffer &states = this->dataPtr->linkStates;
+      {
+        std::lock_guard<std::mutex> poseLock(this->WorldPoseMutex());
+        states.WriteWorldPoses();
+      }
+
+      // The poses were written without publishing them, publish each
+      // moved model once
+      std::set<ModelPtr> movedModels;
+      for (size_t i = 0; i < states.Count(); ++i)
+      {
+        ModelPtr model = states.EntityByIndex(i)->GetParentModel();
+        if (model)
+          movedModels.insert(model);
+      }
+
+      {
+        std::lock_guard<std::recursive_mutex> receiveLock(
+            this->dataPtr->receiveMutex);
+        this->dataPtr->publishModelPoses.insert(
+            movedModels.begin(), movedModels.end());
+      }
+
+      // The physics engine moved a sleeping model, e.g. on contact
+      if (this->dataPtr->sleepingModels > 0)
       {
-        dirtyEntity->SetWorldPose(dirtyEntity->DirtyPose(), false);
+        for (auto const &model : movedModels)
+          model->Wake();
       }
 
-      this->dataPtr->dirtyPoses.clear();
+      // Keep the states for LinkStates until the next step
+      this->dataPtr->lastLinkStates.Swap(states);
+      states.Clear();
+
+      this->UpdateSleeping();
     }
 
-    DIAG_TIMER_LAP("World::Update", "SetWorldPose(dirtyPoses)");
+    DIAG_TIMER_LAP("World::Update", "SetWorldPose(linkStates)");
   }
 
   // Only update state information if logging data.
@@ -892,6 +1011,7 @@ void World::Update()
 void World::Fini()
 {
   this->dataPtr->stop = true;
+  this->dataPtr->stepCondition.notify_all();
   this->dataPtr->enablePhysicsEngine = false;
 
 #ifdef HAVE_OPENAL
@@ -943,6 +1063,12 @@ void World::Fini()
   this->dataPtr->publishModelScales.clear();
   this->dataPtr->publishLightPoses.clear();
 
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->linkStatesMutex);
+    this->dataPtr->linkStates.Clear();
+    this->dataPtr->lastLinkStates.Clear();
+  }
+
   // Clean entities
   for (auto &model : this->dataPtr->models)
   {
@@ -972,13 +1098,15 @@ void World::Fini()
   }
   this->dataPtr->prevStates[0].SetWorld(WorldPtr());
   this->dataPtr->prevStates[1].SetWorld(WorldPtr());
-  this->dataPtr->prevUnfilteredState.SetWorld(WorldPtr());
+  this->dataPtr->unfilteredStates[0].SetWorld(WorldPtr());
+  this->dataPtr->unfilteredStates[1].SetWorld(WorldPtr());
   this->dataPtr->logPlayState.SetWorld(WorldPtr());
   this->dataPtr->states[0].clear();
   this->dataPtr->states[1].clear();
 
   this->dataPtr->presetManager.reset();
   this->dataPtr->userCmdManager.reset();
+  this->dataPtr->stepService.reset();
 
   this->dataPtr->atmosphere.reset();
   this->dataPtr->wind.reset();
@@ -1063,6 +1191,12 @@ PresetManagerPtr World::PresetMgr() const
   return this->dataPtr->presetManager;
 }
 
+//////////////////////////////////////////////////
+UserCmdManagerPtr World::UserCmdMgr() const
+{
+  return this->dataPtr->userCmdManager;
+}
+
 //////////////////////////////////////////////////
 common::SphericalCoordinatesPtr World::SphericalCoords() const
 {
@@ -1654,9 +1788,52 @@ void World::BuildSceneMsg(msgs::Scene &_scene, BasePtr _entity)
 //////////////////////////////////////////////////
 void World::ModelUpdateSingleLoop()
 {
+  const bool anySleeping = this->dataPtr->sleepingModels > 0;
+
   // Update all the models
   for (unsigned int i = 0; i < this->dataPtr->rootElement->GetChildCount(); ++i)
-    this->dataPtr->rootElement->GetChild(i)->Update();
+  {
+    BasePtr child = this->dataPtr->rootElement->GetChild(i);
+    if (anySleeping && child->HasType(Base::MODEL) &&
+        boost::static_pointer_cast<Model>(child)->IsSleeping())
+    {
+      continue;
+    }
+    child->Update();
+  }
+}
+
+//////////////////////////////////////////////////
+void World::UpdateSleeping()
+{
+  for (const auto &model : this->dataPtr->models)
+  {
+    if (model->IsStatic() || model->IsSleeping() || !model->GetAutoDisable())
+      continue;
+
+    // Links report being enabled with physics engines that never disable
+    // them, so this stops at the first link of most models.
+    bool disabled = true;
+    std::list<ModelPtr> modelList = {model};
+    while (disabled && !modelList.empty())
+    {
+      ModelPtr m = modelList.front();
+      modelList.pop_front();
+      for (const auto &link : m->GetLinks())
+      {
+        if (link->GetEnabled())
+        {
+          disabled = false;
+          break;
+        }
+      }
+      for (const auto &nested : m->NestedModels())
+        modelList.push_back(nested);
+    }
+
+    if (disabled && !model->GetLinks().empty())
+      model->Sleep();
+  }
 }
 
 
@@ -2051,6 +2228,7 @@ void World::ProcessFactoryMsgs()
   std::list<sdf::ElementPtr> modelsToLoad, lightsToLoad;
 
   std::list<msgs::Factory> factoryMsgsCopy;
+  std::list<sdf::ElementPtr> factoryModelElemsCopy;
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->receiveMutex);
 
@@ -2058,6 +2236,7 @@ void World::ProcessFactoryMsgs()
       this->dataPtr->factoryMsgs.end(),
       std::back_inserter(factoryMsgsCopy));
     this->dataPtr->factoryMsgs.clear();
+    factoryModelElemsCopy.swap(this->dataPtr->factoryModelElems);
   }
 
   for (auto const &factoryMsg : factoryMsgsCopy)
@@ -2226,6 +2405,45 @@ void World::ProcessFactoryMsgs()
     }
   }
 
+  // Inserted elements only need a unique name. The names in use are
+  // gathered once, instead of searching the entities for each model.
+  if (!factoryModelElemsCopy.empty())
+  {
+    std::set<std::string> names;
+    for (auto const &model : this->dataPtr->models)
+      names.insert(model->GetName());
+    for (auto const &elem : modelsToLoad)
+      names.insert(elem->Get<std::string>("name"));
+
+    for (auto const &elem : factoryModelElemsCopy)
+    {
+      if (!elem || elem->GetName() != "model")
+      {
+        gzerr << "Unable to insert an element which is not a <model>\n";
+        continue;
+      }
+
+      const auto entityName = elem->Get<std::string>("name");
+      if (entityName.empty())
+      {
+        gzerr << "Can't load model with empty name" << std::endl;
+        continue;
+      }
+
+      std::string uniqueName = entityName;
+      int i = 0;
+      while (names.count(uniqueName))
+        uniqueName = entityName + "_" + std::to_string(i++);
+      if (uniqueName != entityName)
+        elem->GetAttribute("name")->Set(uniqueName);
+      names.insert(uniqueName);
+
+      elem->SetParent(this->dataPtr->sdf);
+      elem->GetParent()->InsertElement(elem);
+      modelsToLoad.push_back(elem);
+    }
+  }
+
   // Load models
   for (auto const &elem : modelsToLoad)
   {
@@ -2450,6 +2668,14 @@ void World::InsertModelString(const std::string &_sdfString)
   this->dataPtr->factoryMsgs.push_back(msg);
 }
 
+//////////////////////////////////////////////////
+void World::InsertModelElements(const std::vector<sdf::ElementPtr> &_models)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->receiveMutex);
+  this->dataPtr->factoryModelElems.insert(
+      this->dataPtr->factoryModelElems.end(), _models.begin(), _models.end());
+}
+
 //////////////////////////////////////////////////
 std::string World::StripWorldName(const std::string &_name) const
 {
@@ -2840,6 +3066,19 @@ void World::PublishWorldStats()
   this->dataPtr->worldStatsMsg.set_iterations(this->dataPtr->iterations);
   this->dataPtr->worldStatsMsg.set_paused(this->IsPaused());
 
+  if (this->dataPtr->substeppedModels > 0)
+  {
+    this->dataPtr->worldStatsMsg.set_substepped_models(
+        this->dataPtr->substeppedModels);
+
+    boost::any substeps;
+    if (this->dataPtr->physicsEngine->GetParam("substeps", substeps))
+    {
+      this->dataPtr->worldStatsMsg.set_substeps(
+          boost::any_cast<uint64_t>(substeps));
+    }
+  }
+
   if (util::LogPlay::Instance()->IsOpen())
   {
     msgs::LogPlaybackStatistics logStats;
@@ -2900,13 +3139,15 @@ void World::LogWorker()
 
   GZ_ASSERT(self, "Self pointer to World is invalid");
 
-  // Init the prevUnfilteredState
-  this->dataPtr->prevUnfilteredState.Load(self);
+  // Init the previous unfiltered state
+  this->dataPtr->unfilteredStates[this->dataPtr->unfilteredToggle].Load(self);
 
   while (!this->dataPtr->stop)
   {
-    // get unfiltered world state
-    WorldState unfilteredState;
+    // get unfiltered world state, reusing the older state
+    const int prevUnfiltered = this->dataPtr->unfilteredToggle;
+    WorldState &unfilteredState =
+        this->dataPtr->unfilteredStates[(prevUnfiltered + 1) % 2];
     {
       std::lock_guard<std::mutex> dLock(this->dataPtr->entityDeleteMutex);
       unfilteredState.Load(self);
@@ -2919,7 +3160,7 @@ void World::LogWorker()
 
     {
       WorldState unfilteredDiffState = unfilteredState -
-          this->dataPtr->prevUnfilteredState;
+          this->dataPtr->unfilteredStates[prevUnfiltered];
       if (!unfilteredDiffState.IsZero())
       {
         insertions = unfilteredDiffState.Insertions();
@@ -2927,7 +3168,7 @@ void World::LogWorker()
         insertDelete = !insertions.empty() || !deletions.empty();
       }
     }
-    this->dataPtr->prevUnfilteredState = unfilteredState;
+    this->dataPtr->unfilteredToggle = (prevUnfiltered + 1) % 2;
 
     // Throttle state capture based on log recording frequency.
     auto simTime = this->SimTime();
@@ -2995,19 +3236,24 @@ void World::RemoveModel(const std::string &_name)
 
   std::lock_guard<std::mutex> flock(this->dataPtr->factoryDeleteMutex);
 
-  // Remove all the dirty poses from the delete entity.
+  // Remove all the link states of the deleted entity.
   {
-    for (auto entity = this->dataPtr->dirtyPoses.begin();
-             entity != this->dataPtr->dirtyPoses.end(); ++entity)
+    auto removed = [&_name](const Entity *_entity)
     {
-      if ((*entity)->GetName() == _name ||
-         ((*entity)->GetParent() && (*entity)->GetParent()->GetName() == _name))
+      if (_entity->GetName() == _name)
+        return true;
+      for (BasePtr parent = _entity->GetParent(); parent;
+           parent = parent->GetParent())
       {
-        this->dataPtr->dirtyPoses.erase(entity++);
+        if (parent->GetName() == _name)
+          return true;
       }
-      else
-        ++entity;
-    }
+      return false;
+    };
+
+    std::lock_guard<std::mutex> lock(this->dataPtr->linkStatesMutex);
+    this->dataPtr->linkStates.RemoveIf(removed);
+    this->dataPtr->lastLinkStates.RemoveIf(removed);
   }
 
   // Remove from SDF
@@ -3191,7 +3437,185 @@ void World::SetAtmosphereEnabled(const bool _enable)
 void World::_AddDirty(Entity *_entity)
 {
   GZ_ASSERT(_entity != nullptr, "_entity is nullptr");
-  this->dataPtr->dirtyPoses.push_back(_entity);
+  std::lock_guard<std::mutex> lock(this->dataPtr->linkStatesMutex);
+  this->dataPtr->linkStates.Add(_entity, _entity->DirtyPose());
+}
+
+/////////////////////////////////////////////////
+void World::_AddDirty(Entity *_entity, const ignition::math::Pose3d &_pose,
+    const ignition::math::Vector3d &_linearVel,
+    const ignition::math::Vector3d &_angularVel)
+{
+  GZ_ASSERT(_entity != nullptr, "_entity is nullptr");
+  std::lock_guard<std::mutex> lock(this->dataPtr->linkStatesMutex);
+  this->dataPtr->linkStates.Add(_entity, _pose, _linearVel, _angularVel);
+}
+
+/////////////////////////////////////////////////
+LinkStateBuffer &World::_DirtyLinkStates()
+{
+  return this->dataPtr->linkStates;
+}
+
+/////////////////////////////////////////////////
+const LinkStateBuffer &World::LinkStates() const
+{
+  return this->dataPtr->lastLinkStates;
+}
+
+/////////////////////////////////////////////////
+void World::_SetModelSleeping(const bool _sleeping)
+{
+  if (_sleeping)
+    ++this->dataPtr->sleepingModels;
+  else
+    --this->dataPtr->sleepingModels;
+}
+
+/////////////////////////////////////////////////
+void World::_RequestWake(ModelPtr _model)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->wakeMutex);
+  this->dataPtr->wakeRequests.push_back(_model);
+}
+
+/////////////////////////////////////////////////
+unsigned int World::SleepingModelCount() const
+{
+  return this->dataPtr->sleepingModels;
+}
+
+/////////////////////////////////////////////////
+void World::_SetModelSubstepped(const bool _substepped)
+{
+  if (_substepped)
+    ++this->dataPtr->substeppedModels;
+  else
+    --this->dataPtr->substeppedModels;
+}
+
+/////////////////////////////////////////////////
+unsigned int World::SubsteppedModelCount() const
+{
+  return this->dataPtr->substeppedModels;
+}
+
+/////////////////////////////////////////////////
+void World::_SetLinkUpdate(Link *_link, const bool _wind, const bool _update)
+{
+  GZ_ASSERT(_link != nullptr, "_link is nullptr");
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->linkUpdateMutex);
+  LinkUpdateList &list =
+      _wind ? this->dataPtr->windLinks : this->dataPtr->updateLinks;
+  if (_update)
+  {
+    list.Add(_link);
+  }
+  else
+  {
+    list.Remove(_link);
+
+    // A removed link must not be left in the queue
+    if (!_wind)
+    {
+      std::lock_guard<std::mutex> queueLock(this->dataPtr->queuedLinksMutex);
+      this->dataPtr->queuedLinks.erase(_link);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void World::_QueueLinkUpdate(Link *_link)
+{
+  GZ_ASSERT(_link != nullptr, "_link is nullptr");
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->queuedLinksMutex);
+  this->dataPtr->queuedLinks.insert(_link);
+}
+
+/////////////////////////////////////////////////
+unsigned int World::UpdatedLinkCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->linkUpdateMutex);
+  unsigned int count = this->dataPtr->windLinks.links.size();
+  for (auto link : this->dataPtr->updateLinks.links)
+  {
+    if (!this->dataPtr->windLinks.Contains(link))
+      ++count;
+  }
+  return count;
+}
+
+/////////////////////////////////////////////////
+void World::SetParallelLinkUpdate(const bool _parallel)
+{
+  this->dataPtr->parallelLinkUpdate = _parallel;
+}
+
+/////////////////////////////////////////////////
+bool World::ParallelLinkUpdate() const
+{
+  return this->dataPtr->parallelLinkUpdate;
+}
+
+/////////////////////////////////////////////////
+void World::UpdateLinks()
+{
+  std::vector<Link *> queued;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->queuedLinksMutex);
+    if (!this->dataPtr->queuedLinks.empty())
+    {
+      queued.assign(this->dataPtr->queuedLinks.begin(),
+          this->dataPtr->queuedLinks.end());
+      this->dataPtr->queuedLinks.clear();
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->linkUpdateMutex);
+
+  // Queued links that are updated on every step anyway are skipped
+  const LinkUpdateList &updateLinks = this->dataPtr->updateLinks;
+  queued.erase(std::remove_if(queued.begin(), queued.end(),
+      [&updateLinks](Link *_link) {return updateLinks.Contains(_link);}),
+      queued.end());
+
+  const common::UpdateInfo &info = this->dataPtr->updateInfo;
+  auto update = [&info](const std::vector<Link *> &_links,
+      const bool _parallel)
+  {
+    if (_parallel && _links.size() > 1)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, _links.size(), 16),
+          [&](const tbb::blocked_range<size_t> &_r)
+          {
+            for (size_t i = _r.begin(); i != _r.end(); ++i)
+              _links[i]->Update(info);
+          });
+    }
+    else
+    {
+      for (auto link : _links)
+        link->Update(info);
+    }
+  };
+
+  // The wind of all the links is sampled in one batch
+  const std::vector<Link *> &windLinks = this->dataPtr->windLinks.links;
+  if (!windLinks.empty() && this->dataPtr->wind)
+  {
+    std::vector<const Entity *> &entities = this->dataPtr->windEntities;
+    entities.assign(windLinks.begin(), windLinks.end());
+    this->dataPtr->wind->WorldLinearVels(entities,
+        this->dataPtr->windLinearVels);
+    for (size_t i = 0; i < windLinks.size(); ++i)
+      windLinks[i]->_SetWorldWindLinearVel(this->dataPtr->windLinearVels[i]);
+  }
+
+  const bool parallel = this->dataPtr->parallelLinkUpdate;
+  update(this->dataPtr->updateLinks.links, parallel);
+  update(queued, parallel);
 }
 
 /////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 #include "gazebo/common/CommonTypes.hh"
 #include "gazebo/common/UpdateInfo.hh"
 #include "gazebo/common/Event.hh"
+#include "gazebo/common/StepPacer.hh"
 #include "gazebo/common/URI.hh"
 
 #include "gazebo/physics/Base.hh"
@@ -151,6 +152,11 @@ namespace gazebo
       /// \return Pointer to the preset manager.
       public: PresetManagerPtr PresetMgr() const;
 
+      /// \brief Return the manager of the user commands that can be undone,
+      /// for example to set its history limit.
+      /// \return Pointer to the user command manager.
+      public: UserCmdManagerPtr UserCmdMgr() const;
+
       /// \brief Get a reference to the wind used by the world.
       /// \return Reference to the wind.
       public: physics::Wind &Wind() const;
@@ -312,6 +318,15 @@ namespace gazebo
       /// \param[in] _sdf A reference to an SDF object.
       public: void InsertModelSDF(const sdf::SDF &_sdf);
 
+      /// \brief Insert models from parsed SDF elements.
+      /// The elements are loaded as they are, without being written to a
+      /// string and parsed again, which makes inserting many copies of a
+      /// model faster. A model whose name is taken is renamed.
+      /// \param[in] _models The <model> elements, owned by the world
+      /// afterwards.
+      public: void InsertModelElements(
+                  const std::vector<sdf::ElementPtr> &_models);
+
       /// \brief Return a version of the name with "<world_name>::" removed
       /// \param[in] _name Usually the name of an entity.
       /// \return The stripped world name.
@@ -327,10 +342,30 @@ namespace gazebo
       /// engine should not update an entity.
       public: void DisableAllModels();
 
-      /// \brief Step the world forward in time.
+      /// \brief Step the world forward in time. Blocks until the steps
+      /// have been taken or the world is stopped.
       /// \param[in] _steps The number of steps the World should take.
       public: void Step(const unsigned int _steps);
 
+      /// \brief Set how the world thread waits between iterations to
+      /// match the real time update rate. SLEEP is the default and sleeps
+      /// with a correction for the average wake up latency. HYBRID sleeps
+      /// until _spinThreshold before each absolute deadline and then busy
+      /// waits, and SPIN always busy waits. The last two modes track high
+      /// update rates more tightly at the cost of CPU time.
+      /// Can also be set in SDF with
+      /// <physics><real_time_pacing><mode>hybrid</mode>
+      /// <spin_threshold>0.0002</spin_threshold></real_time_pacing>.
+      /// \param[in] _mode Pacing mode.
+      /// \param[in] _spinThreshold Busy wait duration used by HYBRID.
+      public: void SetRealTimePacing(const common::StepPacer::PacingMode _mode,
+          const common::Time &_spinThreshold = common::Time(0, 200000));
+
+      /// \brief Get the real time pacing mode.
+      /// \return Pacing mode.
+      /// \sa SetRealTimePacing
+      public: common::StepPacer::PacingMode RealTimePacing() const;
+
       /// \brief Load a plugin
       /// \param[in] _filename The filename of the plugin.
       /// \param[in] _name A unique name for the plugin.
@@ -431,13 +466,106 @@ namespace gazebo
       public: void ResetPhysicsStates();
 
       /// \internal
-      /// \brief Inform the World that an Entity has moved. The Entity
-      /// is added to a list that will be processed by the World.
+      /// \brief Inform the World that an Entity has moved. The Entity's
+      /// dirty pose is added to the states written back by the World after
+      /// the physics step, see _DirtyLinkStates.
       /// Only a physics engine implementation should call this function.
       /// If you are unsure whether you should use this function, do not.
+      /// This function is thread safe.
       /// \param[in] _entity Entity that has moved.
       public: void _AddDirty(Entity *_entity);
 
+      /// \internal
+      /// \brief Inform the World that an Entity has moved, with its new
+      /// velocities. This function is thread safe.
+      /// \param[in] _entity Entity that has moved.
+      /// \param[in] _pose New world pose.
+      /// \param[in] _linearVel Linear velocity of the entity's origin in
+      /// the world frame.
+      /// \param[in] _angularVel Angular velocity in the world frame.
+      public: void _AddDirty(Entity *_entity,
+                  const ignition::math::Pose3d &_pose,
+                  const ignition::math::Vector3d &_linearVel,
+                  const ignition::math::Vector3d &_angularVel);
+
+      /// \internal
+      /// \brief Get the states of the links moved by the current physics
+      /// step. A physics engine may add the states of all its links in
+      /// bulk from PhysicsEngine::UpdatePhysics, which is faster than
+      /// calling _AddDirty for each link. The buffer is not thread safe.
+      /// \return The buffer written back by the World after the step.
+      public: LinkStateBuffer &_DirtyLinkStates();
+
+      /// \brief Get the states of the links moved by the last physics
+      /// step, as written into the links. Entities removed since then are
+      /// not included. This should be read from the world update thread,
+      /// for example in a world update end callback.
+      /// \return The link states.
+      public: const LinkStateBuffer &LinkStates() const;
+
+      /// \internal
+      /// \brief Inform the World that a model fell asleep or woke up.
+      /// Only Model should call this function.
+      /// \param[in] _sleeping True if a model fell asleep, false if it
+      /// woke up.
+      public: void _SetModelSleeping(const bool _sleeping);
+
+      /// \internal
+      /// \brief Wake a model at the start of the next world update, on the
+      /// world thread. Model::Wake must only be called from the world
+      /// thread, this can be called from any thread.
+      /// \param[in] _model Model to wake.
+      /// \sa Model::Wake()
+      public: void _RequestWake(ModelPtr _model);
+
+      /// \brief Get the number of top level models that are asleep.
+      /// \return Number of sleeping models.
+      /// \sa Model::Sleep()
+      public: unsigned int SleepingModelCount() const;
+
+      /// \internal
+      /// \brief Inform the World that a model started or stopped being
+      /// substepped. Only Model should call this function.
+      /// \param[in] _substepped True if a model started being substepped.
+      public: void _SetModelSubstepped(const bool _substepped);
+
+      /// \brief Get the number of top level models that take more than one
+      /// physics substep per world step.
+      /// \return Number of substepped models.
+      /// \sa Model::SetSubsteps()
+      public: unsigned int SubsteppedModelCount() const;
+
+      /// \internal
+      /// \brief Add or remove a link from the links updated at the start
+      /// of every step. Only Link should call this function.
+      /// \param[in] _link The link.
+      /// \param[in] _wind True for Link::UpdateWind, false for
+      /// Link::Update.
+      /// \param[in] _update True to add the link, false to remove it.
+      public: void _SetLinkUpdate(Link *_link, const bool _wind,
+                  const bool _update);
+
+      /// \internal
+      /// \brief Update a link at the start of the next step only. Only Link
+      /// should call this function.
+      /// \param[in] _link The link.
+      public: void _QueueLinkUpdate(Link *_link);
+
+      /// \brief Get the number of links updated on every step, for their
+      /// batteries, audio or wind.
+      /// \return Number of links.
+      public: unsigned int UpdatedLinkCount() const;
+
+      /// \brief Set whether links are updated in parallel. Battery update
+      /// functions must then be thread safe. The wind of all the links is
+      /// sampled in one batch, see Wind::WorldLinearVels.
+      /// \param[in] _parallel True to update links in parallel.
+      public: void SetParallelLinkUpdate(const bool _parallel);
+
+      /// \brief Get whether links are updated in parallel.
+      /// \return True if links are updated in parallel.
+      public: bool ParallelLinkUpdate() const;
+
       /// \brief Get whether sensors have been initialized.
       /// \return True if sensors have been initialized.
       public: bool SensorsInitialized() const;
@@ -563,6 +691,14 @@ namespace gazebo
       /// \brief Single loop version of model updating.
       private: void ModelUpdateSingleLoop();
 
+      /// \brief Update the links with pending work: batteries, audio, wind
+      /// and wrench messages.
+      private: void UpdateLinks();
+
+      /// \brief Put the models whose links were all disabled by the physics
+      /// engine to sleep.
+      private: void UpdateSleeping();
+
       /// \brief Helper function to load a plugin from SDF.
       /// \param[in] _sdf SDF plugin description.
       private: void LoadPlugin(sdf::ElementPtr _sdf);
@@ -654,12 +790,6 @@ namespace gazebo
       /// \internal
       /// \brief Private data pointer.
       private: std::unique_ptr<WorldPrivate> dataPtr;
-
-      /// Friend DARTLink so that it has access to dataPtr->dirtyPoses
-      private: friend class DARTLink;
-
-      /// Friend SimbodyPhysics so that it has access to dataPtr->dirtyPoses
-      private: friend class SimbodyPhysics;
     };
     /// \}
   }
@@ -27,11 +27,15 @@
 #include <string>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <condition_variable>
 
+#include <ignition/math/Vector3.hh>
 #include <ignition/transport.hh>
 
 #include "gazebo/common/Event.hh"
+#include "gazebo/common/StepPacer.hh"
 #include "gazebo/common/Time.hh"
 #include "gazebo/common/URI.hh"
 
@@ -39,6 +43,7 @@
 
 #include "gazebo/transport/TransportTypes.hh"
 
+#include "gazebo/physics/LinkStateBuffer.hh"
 #include "gazebo/physics/PhysicsTypes.hh"
 #include "gazebo/physics/WorldState.hh"
 
@@ -46,6 +51,50 @@ namespace gazebo
 {
   namespace physics
   {
+    /// \internal
+    /// \brief A flat list of links with constant time insertion and removal.
+    /// The order of the links is not preserved.
+    class LinkUpdateList
+    {
+      /// \brief Add a link, if not in the list yet.
+      /// \param[in] _link The link.
+      public: void Add(Link *_link)
+              {
+                if (this->index.emplace(_link, this->links.size()).second)
+                  this->links.push_back(_link);
+              }
+
+      /// \brief Remove a link, if in the list.
+      /// \param[in] _link The link.
+      public: void Remove(Link *_link)
+              {
+                auto iter = this->index.find(_link);
+                if (iter == this->index.end())
+                  return;
+
+                // Move the last link into the hole
+                Link *last = this->links.back();
+                this->links[iter->second] = last;
+                this->index[last] = iter->second;
+                this->links.pop_back();
+                this->index.erase(_link);
+              }
+
+      /// \brief Get whether a link is in the list.
+      /// \param[in] _link The link.
+      /// \return True if the link is in the list.
+      public: bool Contains(Link *_link) const
+              {
+                return this->index.find(_link) != this->index.end();
+              }
+
+      /// \brief The links.
+      public: std::vector<Link *> links;
+
+      /// \brief Position of each link in the links vector.
+      public: std::unordered_map<Link *, size_t> index;
+    };
+
     /// \brief Private data class for World.
     class WorldPrivate
     {
@@ -205,6 +254,9 @@ namespace gazebo
       /// \brief Factory message buffer.
       public: std::list<msgs::Factory> factoryMsgs;
 
+      /// \brief Model elements given to InsertModelElements.
+      public: std::list<sdf::ElementPtr> factoryModelElems;
+
       /// \brief Model message buffer.
       public: std::list<msgs::Model> modelMsgs;
 
@@ -253,6 +305,14 @@ namespace gazebo
       /// \brief sleep timing error offset due to clock wake up latency
       public: common::Time sleepOffset;
 
+      /// \brief Deadline scheduler used to pace World::Step when the real
+      /// time pacing mode is not SLEEP.
+      public: common::StepPacer pacer;
+
+      /// \brief Signaled when stepInc reaches zero or the world stops, used
+      /// by World::Step(unsigned int) to block on completion.
+      public: std::condition_variable_any stepCondition;
+
       /// \brief Last time incoming messages were processed.
       public: common::Time prevProcessMsgsTime;
 
@@ -268,9 +328,14 @@ namespace gazebo
       /// \brief Buffer of prev states
       public: WorldState prevStates[2];
 
-      /// \brief Previous unfiltered state. Used for determining insertions
-      /// and deletions
-      public: WorldState prevUnfilteredState;
+      /// \brief Current and previous unfiltered states, indexed by
+      /// unfilteredToggle. Used for determining insertions and deletions.
+      /// Both are reused so that the states of sleeping models are not
+      /// recorded again.
+      public: WorldState unfilteredStates[2];
+
+      /// \brief Index of the previous unfiltered state.
+      public: int unfilteredToggle = 0;
 
       /// \brief Int used to toggle between prevStates
       public: int stateToggle;
@@ -338,10 +403,56 @@ namespace gazebo
       /// ::ProcessFactoryMsgs functions.
       public: std::mutex factoryDeleteMutex;
 
-      /// \brief when physics engine makes an update and changes a link pose,
-      /// this flag is set to trigger Entity::SetWorldPose on the
-      /// physics::Link in World::Update.
-      public: std::list<Entity*> dirtyPoses;
+      /// \brief States of the links moved by the current physics step,
+      /// written into the links in World::Update.
+      public: LinkStateBuffer linkStates;
+
+      /// \brief States of the links moved by the last physics step.
+      public: LinkStateBuffer lastLinkStates;
+
+      /// \brief Mutex to protect linkStates in _AddDirty, which physics
+      /// engines may call from several threads.
+      public: std::mutex linkStatesMutex;
+
+      /// \brief Number of top level models that are asleep.
+      public: std::atomic<unsigned int> sleepingModels{0};
+
+      /// \brief Models to wake at the start of the next update.
+      public: std::vector<ModelPtr> wakeRequests;
+
+      /// \brief Mutex to protect wakeRequests.
+      public: std::mutex wakeMutex;
+
+      /// \brief Number of top level models with more than one substep.
+      public: std::atomic<unsigned int> substeppedModels{0};
+
+      /// \brief Links that need Link::Update on every step, because they
+      /// have batteries or audio.
+      public: LinkUpdateList updateLinks;
+
+      /// \brief Links that need Link::UpdateWind on every step.
+      public: LinkUpdateList windLinks;
+
+      /// \brief Scratch list of the wind links passed to
+      /// Wind::WorldLinearVels, kept to avoid allocating on every step.
+      public: std::vector<const Entity *> windEntities;
+
+      /// \brief Scratch list of the wind velocities of windEntities.
+      public: std::vector<ignition::math::Vector3d> windLinearVels;
+
+      /// \brief Mutex to protect updateLinks and windLinks.
+      public: std::mutex linkUpdateMutex;
+
+      /// \brief Links that need Link::Update on the next step only, because
+      /// they received wrench messages.
+      public: std::unordered_set<Link *> queuedLinks;
+
+      /// \brief Mutex to protect queuedLinks. Links are queued from the
+      /// transport threads.
+      public: std::mutex queuedLinksMutex;
+
+      /// \brief True to update links in parallel.
+      public: bool parallelLinkUpdate = false;
 
       /// \brief Class to manage preset simulation parameter profiles.
       public: PresetManagerPtr presetManager;
@@ -349,6 +460,9 @@ namespace gazebo
       /// \brief Class to manage user commands.
       public: UserCmdManagerPtr userCmdManager;
 
+      /// \brief Synchronous step and observe service.
+      public: StepServicePtr stepService;
+
       /// \brief True if sensors have been initialized. This should be set
       /// by the SensorManager.
       public: std::atomic_bool sensorsInitialized;
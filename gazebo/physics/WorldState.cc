@@ -131,8 +131,24 @@ void WorldState::Load(const WorldPtr _world)
 
     if (add)
     {
-      this->modelStates[(*iter)->GetName()].Load(*iter, this->realTime,
-          this->simTime, this->iterations);
+      // The state of a sleeping model recorded after it fell asleep is
+      // still current, only its time stamps are updated. Iterations go back
+      // to zero when the world is reset.
+      auto stateIter = this->modelStates.find((*iter)->GetName());
+      if (stateIter != this->modelStates.end() && (*iter)->IsSleeping() &&
+          stateIter->second.GetIterations() > (*iter)->SleepIteration() &&
+          stateIter->second.GetIterations() <= this->iterations)
+      {
+        stateIter->second.SetWallTime(this->wallTime);
+        stateIter->second.SetRealTime(this->realTime);
+        stateIter->second.SetSimTime(this->simTime);
+        stateIter->second.SetIterations(this->iterations);
+      }
+      else
+      {
+        this->modelStates[(*iter)->GetName()].Load(*iter, this->realTime,
+            this->simTime, this->iterations);
+      }
     }
   }
 
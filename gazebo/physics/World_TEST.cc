@@ -15,6 +15,8 @@
  *
 */
 
+#include <sstream>
+
 #include "gazebo/physics/PhysicsTypes.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/test/ServerFixture.hh"
@@ -216,6 +218,107 @@ TEST_F(WorldTest, Stop)
   EXPECT_TRUE(world->Running());
 }
 
+//////////////////////////////////////////////////
+TEST_F(WorldTest, RealTimePacing)
+{
+  // Load an empty world, paused
+  this->Load("worlds/blank.world", true);
+
+  auto world = physics::get_world("default");
+  ASSERT_NE(nullptr, world);
+  EXPECT_EQ(common::StepPacer::SLEEP, world->RealTimePacing());
+
+  for (auto mode : {common::StepPacer::HYBRID, common::StepPacer::SPIN,
+      common::StepPacer::SLEEP})
+  {
+    world->SetRealTimePacing(mode);
+    EXPECT_EQ(mode, world->RealTimePacing());
+
+    // Step(n) blocks until all the steps have been taken
+    uint64_t iterations = world->Iterations();
+    world->Step(50);
+    EXPECT_EQ(iterations + 50u, world->Iterations());
+  }
+}
+
+//////////////////////////////////////////////////
+/// \brief Only links with batteries, audio, wind or wrench messages are
+/// updated by the world.
+TEST_F(WorldTest, LinkUpdate)
+{
+  this->Load("worlds/blank.world", true);
+
+  auto world = physics::get_world("default");
+  ASSERT_NE(nullptr, world);
+  EXPECT_EQ(0u, world->UpdatedLinkCount());
+  EXPECT_FALSE(world->ParallelLinkUpdate());
+
+  std::ostringstream sdf;
+  sdf << "<sdf version='" << SDF_VERSION << "'>"
+      << "<model name='model'>"
+      << "  <link name='plain'>"
+      << "    <enable_wind>false</enable_wind>"
+      << "  </link>"
+      << "  <link name='battery'>"
+      << "    <pose>0 2 0 0 0 0</pose>"
+      << "    <enable_wind>false</enable_wind>"
+      << "    <battery name='battery'><voltage>12</voltage></battery>"
+      << "  </link>"
+      << "  <link name='windy'>"
+      << "    <pose>0 4 0 0 0 0</pose>"
+      << "    <enable_wind>true</enable_wind>"
+      << "  </link>"
+      << "</model>"
+      << "</sdf>";
+  this->SpawnSDF(sdf.str());
+
+  auto model = world->ModelByName("model");
+  ASSERT_NE(nullptr, model);
+  EXPECT_EQ(2u, world->UpdatedLinkCount());
+
+  auto windy = model->GetLink("windy");
+  ASSERT_NE(nullptr, windy);
+  windy->SetWindMode(false);
+  EXPECT_EQ(1u, world->UpdatedLinkCount());
+
+  // A wrench message is applied on the step after it is received
+  auto plain = model->GetLink("plain");
+  ASSERT_NE(nullptr, plain);
+  transport::PublisherPtr wrenchPub =
+    this->node->Advertise<msgs::Wrench>("~/model/plain/wrench");
+  wrenchPub->WaitForConnection();
+
+  msgs::Wrench wrench;
+  msgs::Set(wrench.mutable_force(), ignition::math::Vector3d(100, 0, 0));
+  msgs::Set(wrench.mutable_torque(), ignition::math::Vector3d::Zero);
+  wrenchPub->Publish(wrench);
+
+  for (int i = 0; i < 100 && ignition::math::equal(
+      plain->WorldLinearVel().X(), 0.0); ++i)
+  {
+    world->Step(1);
+    common::Time::MSleep(10);
+  }
+  EXPECT_GT(plain->WorldLinearVel().X(), 0.0);
+  EXPECT_EQ(1u, world->UpdatedLinkCount());
+
+  // Parallel updates give the same result
+  world->SetParallelLinkUpdate(true);
+  EXPECT_TRUE(world->ParallelLinkUpdate());
+  windy->SetWindMode(true);
+  EXPECT_EQ(2u, world->UpdatedLinkCount());
+  world->Step(10);
+
+  plain.reset();
+  windy.reset();
+  model.reset();
+  this->RemoveModel("model");
+  for (int i = 0; i < 100 && world->ModelByName("model"); ++i)
+    common::Time::MSleep(10);
+  EXPECT_EQ(nullptr, world->ModelByName("model"));
+  EXPECT_EQ(0u, world->UpdatedLinkCount());
+}
+
 //////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
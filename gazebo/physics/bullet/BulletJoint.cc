@@ -232,13 +232,22 @@ void BulletJoint::CacheForceTorque()
   // convert wrench from child cg location to child link frame
   if (this->childLink)
   {
-    ignition::math::Pose3d childPose = this->childLink->WorldPose();
-
     // convert torque from about child CG to joint anchor location
     // cg position specified in child link frame
     ignition::math::Pose3d cgPose =
       this->childLink->GetInertial()->Pose();
 
+    // The world writes the link poses back after the step, so read the
+    // new pose of the child from bullet.
+    ignition::math::Pose3d childPose = this->childLink->WorldPose();
+    btRigidBody *childBody = boost::static_pointer_cast<BulletLink>(
+        this->childLink)->GetBulletLink();
+    if (childBody)
+    {
+      childPose = -cgPose + BulletTypes::ConvertPoseIgn(
+          childBody->getCenterOfMassTransform());
+    }
+
     // anchorPose location of joint in child frame
     // childMomentArm: from child CG to joint location in child link frame
     // moment arm rotated into world frame (given feedback is in world frame)
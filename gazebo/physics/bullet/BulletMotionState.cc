@@ -21,6 +21,7 @@
 
 #include "gazebo/common/Assert.hh"
 #include "gazebo/physics/Link.hh"
+#include "gazebo/physics/World.hh"
 #include "gazebo/physics/bullet/BulletPhysics.hh"
 #include "gazebo/physics/bullet/BulletLink.hh"
 #include "gazebo/physics/bullet/BulletMotionState.hh"
@@ -58,10 +59,17 @@ void BulletMotionState::setWorldTransform(const btTransform &/*_cogWorldTrans*/)
     boost::static_pointer_cast<BulletLink>(this->link);
   GZ_ASSERT(bulletLink, "parent link must be valid");
   ignition::math::Pose3d pose;
-  if (bulletLink->GetBulletLink())
+  ignition::math::Vector3d linearVel;
+  ignition::math::Vector3d angularVel;
+  btRigidBody *rigidLink = bulletLink->GetBulletLink();
+  if (rigidLink)
   {
     pose = BulletTypes::ConvertPoseIgn(
-      bulletLink->GetBulletLink()->getCenterOfMassTransform());
+      rigidLink->getCenterOfMassTransform());
+    linearVel = BulletTypes::ConvertVector3Ign(
+      rigidLink->getLinearVelocity());
+    angularVel = BulletTypes::ConvertVector3Ign(
+      rigidLink->getAngularVelocity());
   }
   else
   {
@@ -74,12 +82,17 @@ void BulletMotionState::setWorldTransform(const btTransform &/*_cogWorldTrans*/)
   // pose: transform from world origin to cg in inertial frame.
   // -cg + pose:  transform from world origin to link frame in inertial frame.
   ignition::math::Pose3d cg = this->link->GetInertial()->Pose();
+  const ignition::math::Pose3d cgPose = pose;
   pose = -cg + pose;
 
-  // The second argument is set to false to prevent Entity.cc from propagating
-  // the pose change all the way back to bullet.
-  // \TODO: consider using the dirtyPose mechanism employed by ODE.
-  this->link->SetWorldPose(pose, false);
+  // Bullet gives the velocity of the center of mass, the world stores that
+  // of the link origin.
+  linearVel -= angularVel.Cross(cgPose.Pos() - pose.Pos());
+
+  // The world writes the pose back after the step, without propagating the
+  // pose change all the way back to bullet.
+  this->link->GetWorld()->_AddDirty(this->link.get(), pose, linearVel,
+      angularVel);
 
   // below is inefficient as we end up double caching for some joints
   // should consider adding a "dirty" flag.
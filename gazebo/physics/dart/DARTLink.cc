@@ -22,7 +22,7 @@
 #include "gazebo/common/Exception.hh"
 
 #include "gazebo/physics/World.hh"
-#include "gazebo/physics/WorldPrivate.hh"
+#include "gazebo/physics/LinkStateBuffer.hh"
 
 #include "gazebo/physics/dart/dart_inc.h"
 #include "gazebo/physics/dart/DARTCollision.hh"
@@ -963,9 +963,11 @@ void DARTLink::updateDirtyPoseFromDARTTransformation()
   // Set the new pose to this link
   this->dirtyPose = newPose;
 
-  // Set the new pose to the world
-  // (Below method can be changed in gazebo code)
-  this->world->dataPtr->dirtyPoses.push_back(this);
+  // Set the new state to the world
+  this->world->_DirtyLinkStates().Add(this, newPose,
+      DARTTypes::ConvVec3Ign(this->dataPtr->dtBodyNode->getLinearVelocity()),
+      DARTTypes::ConvVec3Ign(
+        this->dataPtr->dtBodyNode->getAngularVelocity()));
 }
 
 //////////////////////////////////////////////////
@@ -156,9 +156,9 @@ namespace gazebo
       // Documentation inherited.
       public: virtual void UpdateMass();
 
-      /// \brief Store DART Transformation to Entity::dirtyPose and add this
-      ///        link to World::dirtyPoses so that World::Update() trigger
-      ///        Entity::SetWorldPose() for this link.
+      /// \brief Store DART Transformation to Entity::dirtyPose and add the
+      ///        state of this link to World::_DirtyLinkStates so that
+      ///        World::Update() writes the world pose of this link.
       public: void updateDirtyPoseFromDARTTransformation();
 
       /// \brief Get pointer to DART Physics engine associated with this link.
@@ -34,6 +34,7 @@
 #include "gazebo/physics/Collision.hh"
 #include "gazebo/physics/ContactManager.hh"
 #include "gazebo/physics/Entity.hh"
+#include "gazebo/physics/LinkStateBuffer.hh"
 #include "gazebo/physics/MapShape.hh"
 #include "gazebo/physics/Model.hh"
 #include "gazebo/physics/PhysicsTypes.hh"
@@ -441,24 +442,21 @@ void DARTPhysics::UpdatePhysics()
   this->dataPtr->dtWorld->step(
         this->dataPtr->resetAllForcesAfterSimulationStep);
 
-  // Update all the transformation of DART's links to gazebo's links
-  // TODO: How to visit all the links in the world?
-  unsigned int modelCount = this->world->ModelCount();
-  ModelPtr modelItr;
+  // Update all the transformation of DART's links to gazebo's links, in
+  // bulk through the world's link state buffer
+  const Model_V models = this->world->Models();
+  LinkStateBuffer &states = this->world->_DirtyLinkStates();
+  size_t linkCount = states.Count();
+  for (const auto &model : models)
+    linkCount += model->GetLinks().size();
+  states.Reserve(linkCount);
 
-  for (unsigned int i = 0; i < modelCount; ++i)
+  for (const auto &model : models)
   {
-    modelItr = this->world->ModelByIndex(i);
-    // TODO: need to improve speed
-    Link_V links = modelItr->GetLinks();
-    unsigned int linkCount = links.size();
-    DARTLinkPtr dartLinkItr;
-
-    for (unsigned int j = 0; j < linkCount; ++j)
+    for (const auto &link : model->GetLinks())
     {
-      dartLinkItr
-          = boost::dynamic_pointer_cast<DARTLink>(links.at(j));
-      dartLinkItr->updateDirtyPoseFromDARTTransformation();
+      static_cast<DARTLink *>(link.get())->
+          updateDirtyPoseFromDARTTransformation();
     }
   }
 
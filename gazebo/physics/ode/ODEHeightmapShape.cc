@@ -26,6 +26,7 @@ ODEHeightmapShape::ODEHeightmapShape(CollisionPtr _parent)
     : HeightmapShape(_parent)
 {
   this->flipY = false;
+  this->supportsTiles = true;
 }
 
 //////////////////////////////////////////////////
@@ -109,20 +110,40 @@ void ODEHeightmapShape::Init()
   this->odeData = dGeomHeightfieldDataCreate();
 
 
-  // Step 3: Setup a callback method for ODE
-  setOdeHeightfieldDetails(
-      this->odeData,
-      this->heights.data(),
-      // in meters
-      this->Size().X(),
-      // in meters
-      this->Size().Y(),
-      // number of vertices
-      this->vertSize,
-      // vertical (z-axis) offset
-      this->Pos().Z(),
-      // vertical thickness for closing the height map mesh
-      1.0);
+  // Step 3: Setup a callback method for ODE. Tiled heightmaps are not held
+  // in memory, ODE gets the heights of the vertices close to other geoms
+  // through the callback.
+  if (this->Tiled())
+  {
+    dGeomHeightfieldDataBuildCallback(
+        this->odeData,
+        this,
+        &ODEHeightmapShape::GetHeightCallback,
+        this->Size().X(),   // width (in meters)
+        this->Size().Y(),   // height (in meters)
+        this->vertSize,     // width (sampling size)
+        this->vertSize,     // height (sampling size)
+        1.0,                // vertical (z-axis) scaling
+        this->Pos().Z(),    // vertical (z-axis) offset
+        1.0,                // vertical thickness
+        0);                 // wrap mode
+  }
+  else
+  {
+    setOdeHeightfieldDetails(
+        this->odeData,
+        this->heights.data(),
+        // in meters
+        this->Size().X(),
+        // in meters
+        this->Size().Y(),
+        // number of vertices
+        this->vertSize,
+        // vertical (z-axis) offset
+        this->Pos().Z(),
+        // vertical thickness for closing the height map mesh
+        1.0);
+  }
 
   // Step 4: Restrict the bounds of the AABB to improve efficiency
   dGeomHeightfieldDataSetBounds(this->odeData, this->GetMinHeight(),
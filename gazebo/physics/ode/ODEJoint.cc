@@ -34,6 +34,20 @@
 using namespace gazebo;
 using namespace physics;
 
+//////////////////////////////////////////////////
+/// \brief Tell the ODE engine of a world that a joint was attached or
+/// detached, since the substep groups keep joints.
+/// \param[in] _world The world of the joint.
+static void InvalidateSubstepGroups(const WorldPtr &_world)
+{
+  if (!_world)
+    return;
+
+  ODEPhysicsPtr odePhysics =
+    boost::dynamic_pointer_cast<ODEPhysics>(_world->Physics());
+  if (odePhysics)
+    odePhysics->InvalidateSubstepGroups();
+}
 
 //////////////////////////////////////////////////
 ODEJoint::ODEJoint(BasePtr _parent)
@@ -214,11 +228,15 @@ void ODEJoint::Attach(LinkPtr _parent, LinkPtr _child)
     else
       dJointAttach(this->jointId, odechild->GetODEId(), odeparent->GetODEId());
   }
+
+  InvalidateSubstepGroups(this->GetWorld());
 }
 
 //////////////////////////////////////////////////
 void ODEJoint::Detach()
 {
+  InvalidateSubstepGroups(this->GetWorld());
+
   auto odeChild = boost::dynamic_pointer_cast<ODELink>(this->childLink);
   auto odeParent = boost::dynamic_pointer_cast<ODELink>(this->parentLink);
 
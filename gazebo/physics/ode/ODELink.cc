@@ -65,6 +65,7 @@ void ODELink::Init()
   {
     this->linkId = dBodyCreate(this->odePhysics->GetWorldId());
     dBodySetData(this->linkId, this);
+    this->odePhysics->InvalidateSubstepGroups();
 
     // Only use auto disable if no joints and no sensors are present
     if (this->GetModel()->GetAutoDisable() &&
@@ -158,8 +159,15 @@ void ODELink::MoveCallback(dBodyID _id)
 
   self->dirtyPose.Pos() -= cog;
 
-  // Tell the world that our pose has changed.
-  self->world->_AddDirty(self);
+  // Tell the world that our pose has changed. ODE gives the velocity of
+  // the center of mass, the world stores that of the link origin.
+  const dReal *lin = dBodyGetLinearVel(_id);
+  const dReal *ang = dBodyGetAngularVel(_id);
+  const ignition::math::Vector3d angularVel(ang[0], ang[1], ang[2]);
+  const ignition::math::Vector3d linearVel =
+      ignition::math::Vector3d(lin[0], lin[1], lin[2]) -
+      angularVel.Cross(cog);
+  self->world->_AddDirty(self, self->dirtyPose, linearVel, angularVel);
 
   // self->poseMutex->unlock();
 
@@ -178,7 +186,11 @@ void ODELink::MoveCallback(dBodyID _id)
 void ODELink::Fini()
 {
   if (this->linkId)
+  {
     dBodyDestroy(this->linkId);
+    if (this->odePhysics)
+      this->odePhysics->InvalidateSubstepGroups();
+  }
   this->linkId = nullptr;
 
   this->odePhysics.reset();
@@ -285,7 +297,17 @@ void ODELink::SetEnabled(bool _enable) const
   }
 
   if (_enable)
+  {
     dBodyEnable(this->linkId);
+
+    // Commanding a link of a sleeping model wakes the model
+    if (this->world && this->world->SleepingModelCount() > 0)
+    {
+      ModelPtr model = this->GetModel();
+      if (model)
+        model->Wake();
+    }
+  }
   else
     dBodyDisable(this->linkId);
 }
@@ -740,6 +762,7 @@ void ODELink::SetKinematic(const bool &_state)
       dBodySetKinematic(this->linkId);
     else if (dBodyIsKinematic(this->linkId))
       dBodySetDynamic(this->linkId);
+    this->odePhysics->InvalidateSubstepGroups();
   }
   else if (!this->IsStatic() && this->initialized)
     gzlog << "ODE body for link [" << this->GetScopedName() << "]"
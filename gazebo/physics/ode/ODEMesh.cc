@@ -14,6 +14,11 @@
  * limitations under the License.
  *
 */
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
 #include "gazebo/common/Mesh.hh"
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
@@ -25,20 +30,85 @@
 using namespace gazebo;
 using namespace physics;
 
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief Scaled triangles of a mesh and the ODE data built from them.
+    class ODEMeshData
+    {
+      /// \brief Destructor.
+      public: ~ODEMeshData()
+      {
+        delete [] this->vertices;
+        delete [] this->indices;
+        if (this->odeData)
+          dGeomTriMeshDataDestroy(this->odeData);
+      }
+
+      /// \brief Array of vertex values.
+      public: float *vertices = nullptr;
+
+      /// \brief Array of index values.
+      public: int *indices = nullptr;
+
+      /// \brief ODE trimesh data.
+      public: dTriMeshDataID odeData = nullptr;
+    };
+  }
+}
+
+/// \brief Key of the shared triangle data: a mesh and its scale.
+typedef std::tuple<const common::Mesh *, double, double, double> MeshDataKey;
+
+/// \brief Mutex to protect g_meshData.
+static std::mutex g_meshDataMutex;
+
+/// \brief Triangle data of the meshes in use, shared by their collisions.
+static std::map<MeshDataKey, std::weak_ptr<ODEMeshData>> g_meshData;
+
+/////////////////////////////////////////////////
+/// \brief Build the ODE data of a mesh or a submesh.
+/// \param[in] _mesh The mesh or submesh.
+/// \param[in] _scale Scaling factor.
+/// \return The triangle data.
+template<typename T>
+static std::shared_ptr<ODEMeshData> BuildData(const T &_mesh,
+    const ignition::math::Vector3d &_scale)
+{
+  std::shared_ptr<ODEMeshData> data(new ODEMeshData);
+  const unsigned int numVertices = _mesh.GetVertexCount();
+  const unsigned int numIndices = _mesh.GetIndexCount();
+
+  // Get all the vertex and index data
+  _mesh.FillArrays(&data->vertices, &data->indices);
+
+  // Scale the vertex data
+  for (unsigned int j = 0;  j < numVertices; j++)
+  {
+    data->vertices[j*3+0] = data->vertices[j*3+0] * _scale.X();
+    data->vertices[j*3+1] = data->vertices[j*3+1] * _scale.Y();
+    data->vertices[j*3+2] = data->vertices[j*3+2] * _scale.Z();
+  }
+
+  // Build the ODE triangle mesh
+  data->odeData = dGeomTriMeshDataCreate();
+  dGeomTriMeshDataBuildSingle(data->odeData,
+      data->vertices, 3*sizeof(data->vertices[0]), numVertices,
+      data->indices, numIndices, 3*sizeof(data->indices[0]));
+
+  return data;
+}
+
 //////////////////////////////////////////////////
 ODEMesh::ODEMesh()
 {
-  this->odeData = nullptr;
-  this->vertices = nullptr;
-  this->indices = nullptr;
 }
 
 //////////////////////////////////////////////////
 ODEMesh::~ODEMesh()
 {
-  delete [] this->vertices;
-  delete [] this->indices;
-  dGeomTriMeshDataDestroy(this->odeData);
 }
 
 //////////////////////////////////////////////////
@@ -86,18 +156,12 @@ void ODEMesh::Init(const common::SubMesh *_subMesh, ODECollisionPtr _collision,
   if (!_subMesh)
     return;
 
-  unsigned int numVertices = _subMesh->GetVertexCount();
-  unsigned int numIndices = _subMesh->GetIndexCount();
-
-  this->vertices = nullptr;
-  this->indices = nullptr;
-
-  // Get all the vertex and index data
-  _subMesh->FillArrays(&this->vertices, &this->indices);
+  // Submeshes are copied by each shape, so their data is not shared
+  this->data = BuildData(*_subMesh, _scale);
 
   this->collisionId = _collision->GetCollisionId();
 
-  this->CreateMesh(numVertices, numIndices, _collision, _scale);
+  this->CreateMesh(_collision);
 }
 
 //////////////////////////////////////////////////
@@ -107,49 +171,37 @@ void ODEMesh::Init(const common::Mesh *_mesh, ODECollisionPtr _collision,
   if (!_mesh)
     return;
 
-  unsigned int numVertices = _mesh->GetVertexCount();
-  unsigned int numIndices = _mesh->GetIndexCount();
-
-  this->vertices = nullptr;
-  this->indices = nullptr;
-
-  // Get all the vertex and index data
-  _mesh->FillArrays(&this->vertices, &this->indices);
+  // Meshes are owned by the MeshManager and are not deleted while shapes
+  // use them, so the collisions of the same mesh and scale share their
+  // triangles and collision tree. This saves building them for each
+  // instance of a model.
+  const MeshDataKey key(_mesh, _scale.X(), _scale.Y(), _scale.Z());
+  {
+    std::lock_guard<std::mutex> lock(g_meshDataMutex);
+    this->data = g_meshData[key].lock();
+    if (!this->data)
+    {
+      this->data = BuildData(*_mesh, _scale);
+      g_meshData[key] = this->data;
+    }
+  }
 
   this->collisionId = _collision->GetCollisionId();
-  this->CreateMesh(numVertices, numIndices, _collision, _scale);
+  this->CreateMesh(_collision);
 }
 
 //////////////////////////////////////////////////
-void ODEMesh::CreateMesh(unsigned int _numVertices, unsigned int _numIndices,
-    ODECollisionPtr _collision, const ignition::math::Vector3d &_scale)
+void ODEMesh::CreateMesh(ODECollisionPtr _collision)
 {
-  /// This will hold the vertex data of the triangle mesh
-  if (this->odeData == nullptr)
-    this->odeData = dGeomTriMeshDataCreate();
-
-  // Scale the vertex data
-  for (unsigned int j = 0;  j < _numVertices; j++)
-  {
-    this->vertices[j*3+0] = this->vertices[j*3+0] * _scale.X();
-    this->vertices[j*3+1] = this->vertices[j*3+1] * _scale.Y();
-    this->vertices[j*3+2] = this->vertices[j*3+2] * _scale.Z();
-  }
-
-  // Build the ODE triangle mesh
-  dGeomTriMeshDataBuildSingle(this->odeData,
-      this->vertices, 3*sizeof(this->vertices[0]), _numVertices,
-      this->indices, _numIndices, 3*sizeof(this->indices[0]));
-
   if (_collision->GetCollisionId() == nullptr)
   {
     _collision->SetSpaceId(dSimpleSpaceCreate(_collision->GetSpaceId()));
     _collision->SetCollision(dCreateTriMesh(_collision->GetSpaceId(),
-          this->odeData, 0, 0, 0), true);
+          this->data->odeData, 0, 0, 0), true);
   }
   else
   {
-    dGeomTriMeshSetData(_collision->GetCollisionId(), this->odeData);
+    dGeomTriMeshSetData(_collision->GetCollisionId(), this->data->odeData);
   }
 
   memset(this->transform, 0, 32*sizeof(dReal));
@@ -18,6 +18,8 @@
 #ifndef GAZEBO_PHYSICS_ODE_ODEMESH_HH_
 #define GAZEBO_PHYSICS_ODE_ODEMESH_HH_
 
+#include <memory>
+
 #include <ignition/math/Vector3.hh>
 
 #include "gazebo/physics/ode/ODETypes.hh"
@@ -29,6 +31,9 @@ namespace gazebo
 {
   namespace physics
   {
+    // Forward declare the triangle data.
+    class ODEMeshData;
+
     /// \addtogroup gazebo_physics_ode
     /// \{
 
@@ -49,7 +54,8 @@ namespace gazebo
                       ODECollisionPtr _collision,
                       const ignition::math::Vector3d &_scale);
 
-      /// \brief Create a mesh collision shape using a mesh.
+      /// \brief Create a mesh collision shape using a mesh. The shapes
+      /// created from the same mesh and scale share their triangle data.
       /// \param[in] _mesh Pointer to the mesh.
       /// \param[in] _collision Pointer to the collision object.
       /// \param[in] _scale Scaling factor.
@@ -60,13 +66,10 @@ namespace gazebo
       /// \brief Update the collision mesh.
       public: virtual void Update();
 
-      /// \brief Helper function to create the collision shape.
-      /// \param[in] _numVertices Number of vertices.
-      /// \param[in] _numIndices Number of indices.
+      /// \brief Helper function to create the collision shape from the
+      /// triangle data.
       /// \param[in] _collision Pointer to the collision object.
-      private: void CreateMesh(unsigned int _numVertices,
-                   unsigned int _numIndices, ODECollisionPtr _collision,
-                   const ignition::math::Vector3d &_scale);
+      private: void CreateMesh(ODECollisionPtr _collision);
 
       /// \brief Transform matrix.
       private: dReal transform[16*2];
@@ -74,14 +77,8 @@ namespace gazebo
       /// \brief Transform matrix index.
       private: int transformIndex;
 
-      /// \brief Array of vertex values.
-      private: float *vertices;
-
-      /// \brief Array of index values.
-      private: int *indices;
-
-      /// \brief ODE trimesh data.
-      private: dTriMeshDataID odeData;
+      /// \brief Triangle data, possibly shared with other meshes.
+      private: std::shared_ptr<ODEMeshData> data;
 
       /// \brief The collision id that this mesh is attached to.
       private: dGeomID collisionId;
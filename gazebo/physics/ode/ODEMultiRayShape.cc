@@ -97,6 +97,14 @@ void ODEMultiRayShape::UpdateRays()
     dSpaceCollide2((dGeomID) (this->superSpaceId),
         (dGeomID) (ode->GetSpaceId()),
         this, &UpdateCallback);
+
+    // Static geometry may be kept in a space of its own
+    if (ode->StaticSpaceId())
+    {
+      dSpaceCollide2((dGeomID) (this->superSpaceId),
+          (dGeomID) (ode->StaticSpaceId()),
+          this, &UpdateCallback);
+    }
   }
 }
 
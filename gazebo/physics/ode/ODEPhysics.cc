@@ -21,11 +21,16 @@
 #include <sdf/sdf.hh>
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
 #include <map>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <ignition/math/Helpers.hh>
 #include <ignition/math/Rand.hh>
 #include <ignition/math/Vector3.hh>
 
@@ -35,6 +40,7 @@
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/Time.hh"
 #include "gazebo/common/Timer.hh"
+#include "gazebo/common/Trace.hh"
 
 #include "gazebo/transport/Publisher.hh"
 
@@ -129,6 +135,114 @@ extern "C" void dMessageQuiet(int, const char *, va_list)
 {
 }
 
+//////////////////////////////////////////////////
+/// \brief A body held in place while other bodies are substepped.
+struct ODEHeldBody
+{
+  /// \brief The body.
+  dBodyID id;
+
+  /// \brief True if the body was kinematic before being held.
+  bool kinematic;
+
+  /// \brief True if the body was enabled before being held.
+  bool enabled;
+
+  /// \brief Position of the body's center of mass.
+  dVector3 pos;
+
+  /// \brief Orientation of the body.
+  dQuaternion rot;
+};
+
+//////////////////////////////////////////////////
+/// \brief Make bodies kinematic, so that the solver treats them as moving
+/// obstacles, and stop reporting their moves to the world. They are also
+/// disabled, and only stepped when they touch or are joined to a body that
+/// is stepped, which enables them again.
+/// \param[in] _bodies Bodies to hold.
+/// \param[out] _held Saved state, to be given to ReleaseBodies.
+static void HoldBodies(const std::vector<dBodyID> &_bodies,
+    std::vector<ODEHeldBody> &_held)
+{
+  _held.resize(_bodies.size());
+  for (size_t i = 0; i < _bodies.size(); ++i)
+  {
+    ODEHeldBody &held = _held[i];
+    held.id = _bodies[i];
+    held.kinematic = dBodyIsKinematic(held.id);
+    held.enabled = dBodyIsEnabled(held.id);
+    dCopyVector3(held.pos, dBodyGetPosition(held.id));
+    const dReal *rot = dBodyGetQuaternion(held.id);
+    for (int j = 0; j < 4; ++j)
+      held.rot[j] = rot[j];
+
+    if (!held.kinematic)
+      dBodySetKinematic(held.id);
+    dBodySetMovedCallback(held.id, nullptr);
+    dBodyDisable(held.id);
+  }
+}
+
+//////////////////////////////////////////////////
+/// \brief Move bodies held by HoldBodies back to their saved pose and
+/// make them dynamic again. Velocities are left untouched, since the
+/// solver does not change the velocity of kinematic bodies, and so is the
+/// auto-disable countdown.
+/// \param[in] _held Saved state.
+static void ReleaseBodies(const std::vector<ODEHeldBody> &_held)
+{
+  for (const ODEHeldBody &held : _held)
+  {
+    dBodySetPosition(held.id, held.pos[0], held.pos[1], held.pos[2]);
+    dBodySetQuaternion(held.id, held.rot);
+    if (!held.kinematic)
+      dBodySetDynamic(held.id);
+    if (held.enabled)
+      dBodyReenable(held.id);
+    dBodySetMovedCallback(held.id, ODELink::MoveCallback);
+  }
+}
+
+//////////////////////////////////////////////////
+/// \brief Move all the top level geoms of one space into another.
+/// \param[in] _from Space to empty.
+/// \param[in] _to Space that receives the geoms.
+static void MoveSpaceGeoms(dSpaceID _from, dSpaceID _to)
+{
+  std::vector<dGeomID> geoms;
+  int count = dSpaceGetNumGeoms(_from);
+  for (int i = 0; i < count; ++i)
+    geoms.push_back(dSpaceGetGeom(_from, i));
+
+  for (auto geom : geoms)
+  {
+    dSpaceRemove(_from, geom);
+    dSpaceAdd(_to, geom);
+  }
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the axis aligned bounding box of a geom, if it is finite and
+/// not empty.
+/// \param[in] _geom The geom.
+/// \param[out] _aabb Bounds in ODE order: minx, maxx, miny, maxy, minz,
+/// maxz.
+/// \return True if the bounding box is finite and not empty.
+static bool FiniteAABB(dGeomID _geom, dReal _aabb[6])
+{
+  dGeomGetAABB(_geom, _aabb);
+  for (int i = 0; i < 3; ++i)
+  {
+    if (!std::isfinite(_aabb[2*i]) || !std::isfinite(_aabb[2*i+1]) ||
+        _aabb[2*i+1] < _aabb[2*i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 //////////////////////////////////////////////////
 ODEPhysics::ODEPhysics(WorldPtr _world)
     : PhysicsEngine(_world), dataPtr(new ODEPhysicsPrivate)
@@ -147,6 +261,7 @@ ODEPhysics::ODEPhysics(WorldPtr _world)
   dHashSpaceSetLevels(this->dataPtr->spaceId, -2, 8);
 
   this->dataPtr->contactGroup = dJointGroupCreate(0);
+  this->dataPtr->substepContactGroup = dJointGroupCreate(0);
 
   this->dataPtr->colliders.resize(100);
 
@@ -233,6 +348,188 @@ void ODEPhysics::Load(sdf::ElementPtr _sdf)
   this->SetStepType(this->dataPtr->stepType);
   if (this->dataPtr->physicsStepFunc == nullptr)
     gzthrow(std::string("Invalid step type[") + this->dataPtr->stepType);
+
+  this->LoadBroadphase(odeElem);
+}
+
+//////////////////////////////////////////////////
+void ODEPhysics::LoadBroadphase(sdf::ElementPtr _odeElem)
+{
+  // The <broadphase> element is optional. Without it the world keeps a
+  // single hash space with fixed levels for all geometry.
+  if (!_odeElem->HasElement("broadphase"))
+    return;
+
+  sdf::ElementPtr bpElem = _odeElem->GetElement("broadphase");
+
+  auto getString = [&bpElem](const std::string &_key,
+      const std::string &_default)
+  {
+    if (!bpElem->HasElement(_key))
+      return _default;
+    std::string value = bpElem->Get<std::string>(_key);
+    value.erase(0, value.find_first_not_of(" \t\n"));
+    value.erase(value.find_last_not_of(" \t\n") + 1);
+    return value;
+  };
+
+  std::string type = getString("type", "hash");
+  dSpaceID space = nullptr;
+  if (type == "hash")
+  {
+    std::string levels = getString("hash_levels", "-2 8");
+    if (levels == "auto")
+    {
+      this->dataPtr->autoHashLevels = true;
+    }
+    else
+    {
+      int minLevel = -2;
+      int maxLevel = 8;
+      std::istringstream stream(levels);
+      if (!(stream >> minLevel >> maxLevel) || minLevel > maxLevel)
+      {
+        gzerr << "Invalid ODE broadphase hash_levels[" << levels
+              << "], expected 'auto' or '<min> <max>'. Using [-2 8]\n";
+        minLevel = -2;
+        maxLevel = 8;
+      }
+      dHashSpaceSetLevels(this->dataPtr->spaceId, minLevel, maxLevel);
+    }
+  }
+  else if (type == "sap")
+  {
+    // Z is up, so sort along the horizontal axes first.
+    space = dSweepAndPruneSpaceCreate(0, dSAP_AXES_XYZ);
+  }
+  else if (type == "quadtree")
+  {
+    ignition::math::Vector3d center(0, 0, 0);
+    ignition::math::Vector3d extents(100, 100, 100);
+    int depth = 6;
+    std::istringstream(getString("quadtree_center", "0 0 0")) >> center;
+    std::istringstream(getString("quadtree_extents", "100 100 100"))
+        >> extents;
+    std::istringstream(getString("quadtree_depth", "6")) >> depth;
+
+    dVector3 c = {center.X(), center.Y(), center.Z(), 0};
+    dVector3 e = {extents.X(), extents.Y(), extents.Z(), 0};
+    space = dQuadTreeSpaceCreate(0, c, e, std::max(1, depth));
+  }
+  else
+  {
+    gzerr << "Unknown ODE broadphase type[" << type
+          << "], valid types are hash, sap and quadtree. Using hash.\n";
+    type = "hash";
+  }
+
+  if (space)
+  {
+    MoveSpaceGeoms(this->dataPtr->spaceId, space);
+    dSpaceSetCleanup(this->dataPtr->spaceId, 0);
+    dSpaceDestroy(this->dataPtr->spaceId);
+    this->dataPtr->spaceId = space;
+  }
+  this->dataPtr->broadphaseType = type;
+
+  std::string staticSpace = getString("static_space", "false");
+  if (staticSpace == "true" || staticSpace == "1")
+  {
+    std::istringstream(getString("static_space_depth", "6"))
+        >> this->dataPtr->staticSpaceDepth;
+    this->dataPtr->staticSpaceDepth =
+        std::max(1, this->dataPtr->staticSpaceDepth);
+
+    // Resized to fit the static geometry once it is loaded, see
+    // UpdateBroadphase.
+    dVector3 c = {0, 0, 0, 0};
+    dVector3 e = {1, 1, 1, 0};
+    this->dataPtr->staticSpaceId =
+        dQuadTreeSpaceCreate(0, c, e, this->dataPtr->staticSpaceDepth);
+  }
+}
+
+//////////////////////////////////////////////////
+void ODEPhysics::UpdateBroadphase()
+{
+  if (!this->dataPtr->broadphaseDirty)
+    return;
+  this->dataPtr->broadphaseDirty = false;
+
+  dReal aabb[6];
+
+  // Fit the hash levels to the smallest and largest top level geoms, which
+  // are mostly model spaces. Geoms larger than the top level end up in a
+  // list that is tested against every other geom, so the top level must
+  // cover the largest model.
+  if (this->dataPtr->autoHashLevels && this->dataPtr->broadphaseType == "hash")
+  {
+    double minSize = std::numeric_limits<double>::max();
+    double maxSize = 0;
+    int count = dSpaceGetNumGeoms(this->dataPtr->spaceId);
+    for (int i = 0; i < count; ++i)
+    {
+      if (!FiniteAABB(dSpaceGetGeom(this->dataPtr->spaceId, i), aabb))
+        continue;
+
+      double size = std::max(aabb[1] - aabb[0],
+          std::max(aabb[3] - aabb[2], aabb[5] - aabb[4]));
+      if (size <= 0)
+        continue;
+      minSize = std::min(minSize, size);
+      maxSize = std::max(maxSize, size);
+    }
+
+    if (maxSize > 0)
+    {
+      int minLevel = ignition::math::clamp(
+          static_cast<int>(std::floor(std::log2(minSize))), -10, 20);
+      int maxLevel = ignition::math::clamp(
+          static_cast<int>(std::ceil(std::log2(maxSize))), minLevel, 20);
+      dHashSpaceSetLevels(this->dataPtr->spaceId, minLevel, maxLevel);
+      gzlog << "ODE hash space levels set to [" << minLevel << " "
+            << maxLevel << "]" << std::endl;
+    }
+  }
+
+  // Resize the static quadtree to the bounds of the static geometry.
+  // Infinite geoms such as planes are left out of the bounds, the quadtree
+  // keeps them in its root block.
+  if (this->dataPtr->staticSpaceId && this->dataPtr->staticSpaceDirty)
+  {
+    this->dataPtr->staticSpaceDirty = false;
+
+    ignition::math::Vector3d min(ignition::math::MAX_D,
+        ignition::math::MAX_D, ignition::math::MAX_D);
+    ignition::math::Vector3d max(ignition::math::LOW_D,
+        ignition::math::LOW_D, ignition::math::LOW_D);
+    bool found = false;
+    int count = dSpaceGetNumGeoms(this->dataPtr->staticSpaceId);
+    for (int i = 0; i < count; ++i)
+    {
+      if (!FiniteAABB(dSpaceGetGeom(this->dataPtr->staticSpaceId, i), aabb))
+        continue;
+      min.Min(ignition::math::Vector3d(aabb[0], aabb[2], aabb[4]));
+      max.Max(ignition::math::Vector3d(aabb[1], aabb[3], aabb[5]));
+      found = true;
+    }
+
+    if (found)
+    {
+      ignition::math::Vector3d center = (min + max) * 0.5;
+      ignition::math::Vector3d extents = (max - min) * 0.5 +
+          ignition::math::Vector3d::One;
+      dVector3 c = {center.X(), center.Y(), center.Z(), 0};
+      dVector3 e = {extents.X(), extents.Y(), extents.Z(), 0};
+      dSpaceID space =
+          dQuadTreeSpaceCreate(0, c, e, this->dataPtr->staticSpaceDepth);
+
+      MoveSpaceGeoms(this->dataPtr->staticSpaceId, space);
+      dSpaceSetCleanup(this->dataPtr->staticSpaceId, 0);
+      dSpaceDestroy(this->dataPtr->staticSpaceId);
+      this->dataPtr->staticSpaceId = space;
+    }
+  }
 }
 
 /////////////////////////////////////////////////
@@ -358,47 +655,105 @@ void ODEPhysics::InitForThread()
 //////////////////////////////////////////////////
 void ODEPhysics::UpdateCollision()
 {
+  GZ_TRACE_SCOPE("ODEPhysics::UpdateCollision");
   DIAG_TIMER_START("ODEPhysics::UpdateCollision");
 
   boost::recursive_mutex::scoped_lock lock(*this->physicsUpdateMutex);
   dJointGroupEmpty(this->dataPtr->contactGroup);
 
-  unsigned int i = 0;
-  this->dataPtr->collidersCount = 0;
-  this->dataPtr->trimeshCollidersCount = 0;
   this->dataPtr->jointFeedbackIndex = 0;
 
   // Reset the contact count
   this->contactManager->ResetCount();
 
+  this->UpdateBroadphase();
+  this->dataPtr->broadphasePairs = 0;
+  this->dataPtr->staticBroadphasePairs = 0;
+
   // Do collision detection; this will add contacts to the contact group
+  this->CollideSpaces();
+  DIAG_TIMER_LAP("ODEPhysics::UpdateCollision", "collide");
+
+  DIAG_TIMER_STOP("ODEPhysics::UpdateCollision");
+}
+
+//////////////////////////////////////////////////
+void ODEPhysics::CollideSpaces()
+{
+  this->dataPtr->collidersCount = 0;
+  this->dataPtr->trimeshCollidersCount = 0;
+
   dSpaceCollide(this->dataPtr->spaceId, this, CollisionCallback);
-  DIAG_TIMER_LAP("ODEPhysics::UpdateCollision", "dSpaceCollide");
 
+  // Static geometry never moves, so it is only tested against the dynamic
+  // geometry. Each dynamic top level geom queries the static space, which
+  // is a quadtree, instead of every static geom being visited.
+  if (this->dataPtr->staticSpaceId)
+  {
+    this->dataPtr->collidingStatic = true;
+    int count = dSpaceGetNumGeoms(this->dataPtr->spaceId);
+    for (int j = 0; j < count; ++j)
+    {
+      dSpaceCollide2(dSpaceGetGeom(this->dataPtr->spaceId, j),
+          (dGeomID)this->dataPtr->staticSpaceId, this,
+          CollisionCallback);
+    }
+    this->dataPtr->collidingStatic = false;
+  }
+
+  this->CollideColliders();
+}
+
+//////////////////////////////////////////////////
+void ODEPhysics::CollideBodies(const std::vector<dBodyID> &_bodies)
+{
+  this->dataPtr->collidersCount = 0;
+  this->dataPtr->trimeshCollidersCount = 0;
+
+  for (dBodyID body : _bodies)
+  {
+    for (dGeomID geom = dBodyGetFirstGeom(body); geom;
+        geom = dBodyGetNextGeom(geom))
+    {
+      this->dataPtr->substepGeom = geom;
+      dSpaceCollide2(geom, (dGeomID)this->dataPtr->spaceId, this,
+          CollisionCallback);
+      if (this->dataPtr->staticSpaceId)
+      {
+        dSpaceCollide2(geom, (dGeomID)this->dataPtr->staticSpaceId, this,
+            CollisionCallback);
+      }
+    }
+  }
+  this->dataPtr->substepGeom = nullptr;
+
+  this->CollideColliders();
+}
+
+//////////////////////////////////////////////////
+void ODEPhysics::CollideColliders()
+{
   // Generate non-trimesh collisions.
-  for (i = 0; i < this->dataPtr->collidersCount; ++i)
+  for (unsigned int i = 0; i < this->dataPtr->collidersCount; ++i)
   {
     this->Collide(this->dataPtr->colliders[i].first,
         this->dataPtr->colliders[i].second, this->dataPtr->contactCollisions);
   }
-  DIAG_TIMER_LAP("ODEPhysics::UpdateCollision", "collideShapes");
 
   // Generate trimesh collision.
   // This must happen in this thread sequentially
-  for (i = 0; i < this->dataPtr->trimeshCollidersCount; ++i)
+  for (unsigned int i = 0; i < this->dataPtr->trimeshCollidersCount; ++i)
   {
     ODECollision *collision1 = this->dataPtr->trimeshColliders[i].first;
     ODECollision *collision2 = this->dataPtr->trimeshColliders[i].second;
     this->Collide(collision1, collision2, this->dataPtr->contactCollisions);
   }
-  DIAG_TIMER_LAP("ODEPhysics::UpdateCollision", "collideTrimeshes");
-
-  DIAG_TIMER_STOP("ODEPhysics::UpdateCollision");
 }
 
 //////////////////////////////////////////////////
 void ODEPhysics::UpdatePhysics()
 {
+  GZ_TRACE_SCOPE("ODEPhysics::UpdatePhysics");
   DIAG_TIMER_START("ODEPhysics::UpdatePhysics");
 
   // need to lock, otherwise might conflict with world resetting
@@ -406,8 +761,15 @@ void ODEPhysics::UpdatePhysics()
     boost::recursive_mutex::scoped_lock lock(*this->physicsUpdateMutex);
 
     // Update the dynamical model
-    (*(this->dataPtr->physicsStepFunc))
-      (this->dataPtr->worldId, this->maxStepSize);
+    if (this->world->SubsteppedModelCount() > 0)
+    {
+      this->UpdateSubsteps();
+    }
+    else
+    {
+      (*(this->dataPtr->physicsStepFunc))
+        (this->dataPtr->worldId, this->maxStepSize);
+    }
 
     ignition::math::Vector3d f1, f2, t1, t2;
 
@@ -445,6 +807,236 @@ void ODEPhysics::UpdatePhysics()
   DIAG_TIMER_STOP("ODEPhysics::UpdatePhysics");
 }
 
+//////////////////////////////////////////////////
+void ODEPhysics::UpdateSubstepGroups()
+{
+  // Model substeps can change without the physics engine being told, so
+  // compare them with the substeps the groups were built with.
+  bool dirty = this->dataPtr->substepGroupsDirty.exchange(false);
+  for (auto iter = this->dataPtr->substepModels.begin();
+      !dirty && iter != this->dataPtr->substepModels.end(); ++iter)
+  {
+    dirty = iter->first->Substeps() != iter->second;
+  }
+
+  if (!dirty)
+    return;
+
+  auto &groups = this->dataPtr->substepGroups;
+  groups.clear();
+  this->dataPtr->coarseBodies.clear();
+  this->dataPtr->substepModels.clear();
+
+  // Sort the bodies by the substeps of their top level model. Kinematic
+  // bodies are never substepped.
+  std::map<dBodyID, unsigned int> bodySubsteps;
+  for (const auto &model : this->world->Models())
+  {
+    const unsigned int substeps = model->Substeps();
+    this->dataPtr->substepModels.push_back(std::make_pair(model, substeps));
+
+    std::list<ModelPtr> models = {model};
+    while (!models.empty())
+    {
+      ModelPtr current = models.front();
+      models.pop_front();
+      for (const auto &link : current->GetLinks())
+      {
+        ODELinkPtr odeLink = boost::dynamic_pointer_cast<ODELink>(link);
+        dBodyID body = odeLink ? odeLink->GetODEId() : nullptr;
+        if (!body)
+          continue;
+        if (substeps > 1 && !dBodyIsKinematic(body))
+        {
+          groups[substeps].bodies.push_back(body);
+          bodySubsteps[body] = substeps;
+        }
+        else
+        {
+          this->dataPtr->coarseBodies.push_back(body);
+          bodySubsteps[body] = 1;
+        }
+      }
+      for (const auto &nested : current->NestedModels())
+        models.push_back(nested);
+    }
+  }
+
+  // Each group is stepped with the other bodies held in place, so a joint
+  // between two groups only pulls on the finer side during its substeps
+  // and on the coarser side during its steps.
+  for (const auto &body : bodySubsteps)
+  {
+    const int count = dBodyGetNumJoints(body.first);
+    for (int i = 0; i < count; ++i)
+    {
+      dJointID joint = dBodyGetJoint(body.first, i);
+      if (dJointGetType(joint) == dJointTypeContact)
+        continue;
+
+      dBodyID other = dJointGetBody(joint, 0);
+      if (other == body.first)
+        other = dJointGetBody(joint, 1);
+      auto iter = bodySubsteps.find(other);
+      if (iter == bodySubsteps.end() || iter->second >= body.second)
+        continue;
+
+      gzwarn << "Link["
+             << static_cast<ODELink *>(dBodyGetData(body.first))->
+                GetScopedName()
+             << "] takes " << body.second << " substeps and is joined to "
+             << "link["
+             << static_cast<ODELink *>(dBodyGetData(other))->GetScopedName()
+             << "] that takes " << iter->second << ". The joint is solved "
+             << "one way, give both models the same substeps.\n";
+    }
+  }
+
+  // The bodies held while each group is substepped, and the joints that
+  // only connect held bodies. Contact joints are not kept, the contacts of
+  // the world step are dropped before substepping.
+  for (auto &group : groups)
+  {
+    ODESubstepGroup &current = group.second;
+    current.heldBodies = this->dataPtr->coarseBodies;
+    for (const auto &other : groups)
+    {
+      if (other.first != group.first)
+      {
+        current.heldBodies.insert(current.heldBodies.end(),
+            other.second.bodies.begin(), other.second.bodies.end());
+      }
+    }
+
+    for (dBodyID body : current.heldBodies)
+    {
+      const int count = dBodyGetNumJoints(body);
+      for (int i = 0; i < count; ++i)
+      {
+        dJointID joint = dBodyGetJoint(body, i);
+        if (dJointGetType(joint) == dJointTypeContact)
+          continue;
+
+        // Joints to the group are solved. Joints between two held bodies
+        // are seen from both of them.
+        dBodyID other = dJointGetBody(joint, 0);
+        if (other == body)
+          other = dJointGetBody(joint, 1);
+        auto iter = bodySubsteps.find(other);
+        if (iter != bodySubsteps.end() &&
+            (iter->second == group.first || other < body))
+        {
+          continue;
+        }
+        current.heldJoints.push_back(joint);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void ODEPhysics::UpdateSubsteps()
+{
+  GZ_TRACE_SCOPE("ODEPhysics::UpdateSubsteps");
+
+  this->UpdateSubstepGroups();
+  const auto &groups = this->dataPtr->substepGroups;
+  this->dataPtr->substepBroadphasePairs = 0;
+
+  if (groups.empty())
+  {
+    (*(this->dataPtr->physicsStepFunc))
+      (this->dataPtr->worldId, this->maxStepSize);
+    return;
+  }
+
+  // The force accumulators are cleared by every step, keep the forces
+  // applied to the substepped bodies to apply them on each substep.
+  std::vector<std::pair<ignition::math::Vector3d,
+      ignition::math::Vector3d>> wrenches;
+  std::vector<dBodyID> allFine;
+  for (const auto &group : groups)
+  {
+    for (dBodyID body : group.second.bodies)
+    {
+      const dReal *f = dBodyGetForce(body);
+      const dReal *t = dBodyGetTorque(body);
+      wrenches.push_back(std::make_pair(
+          ignition::math::Vector3d(f[0], f[1], f[2]),
+          ignition::math::Vector3d(t[0], t[1], t[2])));
+      allFine.push_back(body);
+    }
+  }
+
+  // Coarse step, the substepped bodies move as kinematic obstacles
+  std::vector<ODEHeldBody> held;
+  HoldBodies(allFine, held);
+  (*(this->dataPtr->physicsStepFunc))
+    (this->dataPtr->worldId, this->maxStepSize);
+  ReleaseBodies(held);
+
+  // The contacts of the world step were found before the coarse step
+  // moved the bodies, and are solved. Drop them, so that the groups are
+  // only touched by contacts found before each substep, at the substep
+  // size, and held bodies are not linked to each other by contacts.
+  dJointGroupEmpty(this->dataPtr->contactGroup);
+
+  // Substep each group with every other body held in place
+  std::vector<dJointID> disabledJoints;
+  size_t wrenchIndex = 0;
+  for (const auto &group : groups)
+  {
+    const std::vector<dBodyID> &bodies = group.second.bodies;
+    HoldBodies(group.second.heldBodies, held);
+
+    // Joints between held bodies do not need to be solved, which keeps
+    // every held body that does not touch the group out of its islands.
+    disabledJoints.clear();
+    for (dJointID joint : group.second.heldJoints)
+    {
+      if (dJointIsEnabled(joint))
+      {
+        dJointDisable(joint);
+        disabledJoints.push_back(joint);
+      }
+    }
+
+    for (dBodyID body : bodies)
+      dBodySetMovedCallback(body, nullptr);
+
+    const dReal stepSize = this->maxStepSize / group.first;
+    for (unsigned int i = 0; i < group.first; ++i)
+    {
+      for (size_t j = 0; j < bodies.size(); ++j)
+      {
+        dBodyID body = bodies[j];
+        const auto &wrench = wrenches[wrenchIndex + j];
+        dBodySetForce(body, wrench.first.X(), wrench.first.Y(),
+            wrench.first.Z());
+        dBodySetTorque(body, wrench.second.X(), wrench.second.Y(),
+            wrench.second.Z());
+
+        // Only the last substep reports the moves to the world
+        if (i + 1 == group.first)
+          dBodySetMovedCallback(body, ODELink::MoveCallback);
+      }
+
+      this->dataPtr->substepSize = stepSize;
+      this->CollideBodies(bodies);
+      this->dataPtr->substepSize = 0;
+
+      (*(this->dataPtr->physicsStepFunc))(this->dataPtr->worldId, stepSize);
+      dJointGroupEmpty(this->dataPtr->substepContactGroup);
+    }
+    this->dataPtr->substeps += group.first;
+    wrenchIndex += bodies.size();
+
+    for (dJointID joint : disabledJoints)
+      dJointEnable(joint);
+    ReleaseBodies(held);
+  }
+}
+
 //////////////////////////////////////////////////
 void ODEPhysics::Fini()
 {
@@ -454,6 +1046,14 @@ void ODEPhysics::Fini()
     dJointGroupDestroy(this->dataPtr->contactGroup);
   this->dataPtr->contactGroup = nullptr;
 
+  if (this->dataPtr->substepContactGroup)
+    dJointGroupDestroy(this->dataPtr->substepContactGroup);
+  this->dataPtr->substepContactGroup = nullptr;
+
+  this->dataPtr->substepGroups.clear();
+  this->dataPtr->coarseBodies.clear();
+  this->dataPtr->substepModels.clear();
+
   // Delete all the joint feedbacks.
   for (auto iter = this->dataPtr->jointFeedbacks.begin();
       iter != this->dataPtr->jointFeedbacks.end(); ++iter)
@@ -468,6 +1068,13 @@ void ODEPhysics::Fini()
     dSpaceDestroy(this->dataPtr->spaceId);
   }
 
+  if (this->dataPtr->staticSpaceId)
+  {
+    dSpaceSetCleanup(this->dataPtr->staticSpaceId, 0);
+    dSpaceDestroy(this->dataPtr->staticSpaceId);
+  }
+  this->dataPtr->staticSpaceId = nullptr;
+
   if (this->dataPtr->worldId)
     dWorldDestroy(this->dataPtr->worldId);
   this->dataPtr->worldId = nullptr;
@@ -483,6 +1090,7 @@ void ODEPhysics::Reset()
   boost::recursive_mutex::scoped_lock lock(*this->physicsUpdateMutex);
   // Very important to clear out the contact group
   dJointGroupEmpty(this->dataPtr->contactGroup);
+  dJointGroupEmpty(this->dataPtr->substepContactGroup);
 }
 
 //////////////////////////////////////////////////
@@ -495,8 +1103,20 @@ LinkPtr ODEPhysics::CreateLink(ModelPtr _parent)
   iter = this->dataPtr->spaces.find(_parent->GetName());
 
   if (iter == this->dataPtr->spaces.end())
+  {
+    // Static models go in their own space if enabled. A model that
+    // becomes static after it is loaded stays in the dynamic space.
+    dSpaceID parentSpace = this->dataPtr->spaceId;
+    if (this->dataPtr->staticSpaceId && _parent->IsStatic())
+    {
+      parentSpace = this->dataPtr->staticSpaceId;
+      this->dataPtr->staticSpaceDirty = true;
+    }
+    this->dataPtr->broadphaseDirty = true;
+
     this->dataPtr->spaces[_parent->GetName()] =
-      dSimpleSpaceCreate(this->dataPtr->spaceId);
+      dSimpleSpaceCreate(parentSpace);
+  }
 
   ODELinkPtr link(new ODELink(_parent));
 
@@ -567,6 +1187,12 @@ dWorldID ODEPhysics::GetWorldId()
   return this->dataPtr->worldId;
 }
 
+//////////////////////////////////////////////////
+void ODEPhysics::InvalidateSubstepGroups()
+{
+  this->dataPtr->substepGroupsDirty = true;
+}
+
 //////////////////////////////////////////////////
 void ODEPhysics::ConvertMass(InertialPtr _inertial, void *_engineMass)
 {
@@ -901,6 +1527,12 @@ dSpaceID ODEPhysics::GetSpaceId() const
   return this->dataPtr->spaceId;
 }
 
+//////////////////////////////////////////////////
+dSpaceID ODEPhysics::StaticSpaceId() const
+{
+  return this->dataPtr->staticSpaceId;
+}
+
 //////////////////////////////////////////////////
 std::string ODEPhysics::GetStepType() const
 {
@@ -953,6 +1585,27 @@ void ODEPhysics::CollisionCallback(void *_data, dGeomID _o1, dGeomID _o2)
   }
   else
   {
+    // While substepping, each geom of the group queries the world, so a
+    // pair of two geoms of the group is found twice. Other bodies are held
+    // as kinematic, which tells the group apart.
+    if (self->dataPtr->substepSize > 0)
+    {
+      dGeomID other = _o1 == self->dataPtr->substepGeom ? _o2 : _o1;
+      dBodyID otherBody = dGeomGetBody(other);
+      if (otherBody && !dBodyIsKinematic(otherBody) &&
+          other < self->dataPtr->substepGeom)
+      {
+        return;
+      }
+      ++self->dataPtr->substepBroadphasePairs;
+    }
+    else
+    {
+      ++self->dataPtr->broadphasePairs;
+      if (self->dataPtr->collidingStatic)
+        ++self->dataPtr->staticBroadphasePairs;
+    }
+
     ODECollision *collision1 = nullptr;
     ODECollision *collision2 = nullptr;
 
@@ -1097,10 +1750,12 @@ void ODEPhysics::Collide(ODECollision *_collision1, ODECollision *_collision2,
   double kp = 1.0 / (1.0 / surf1->kp + 1.0 / surf2->kp);
   double kd = surf1->kd + surf2->kd;
 
-  contact.surface.soft_erp = (this->maxStepSize * kp) /
-                             (this->maxStepSize * kp + kd);
+  // Contacts found for a substep are solved at the substep size.
+  const double stepSize = this->dataPtr->substepSize > 0 ?
+      this->dataPtr->substepSize : this->maxStepSize;
+  contact.surface.soft_erp = (stepSize * kp) / (stepSize * kp + kd);
 
-  contact.surface.soft_cfm = 1.0 / (this->maxStepSize * kp + kd);
+  contact.surface.soft_cfm = 1.0 / (stepSize * kp + kd);
 
   // contact.surface.soft_erp = 0.5*(_collision1->surface->softERP +
   //                                _collision2->surface->softERP);
@@ -1251,9 +1906,14 @@ void ODEPhysics::Collide(ODECollision *_collision1, ODECollision *_collision2,
   dBodyID b2 = dGeomGetBody(_collision2->GetCollisionId());
 
   // Add a new contact to the manager. This will return nullptr if no one is
-  // listening for contact information.
-  Contact *contactFeedback = this->contactManager->NewContact(_collision1,
-      _collision2, this->world->SimTime());
+  // listening for contact information. Contacts found for a substep are
+  // not reported, they were found at the start of the step.
+  Contact *contactFeedback = nullptr;
+  if (this->dataPtr->substepSize <= 0)
+  {
+    contactFeedback = this->contactManager->NewContact(_collision1,
+        _collision2, this->world->SimTime());
+  }
 
   ODEJointFeedback *jointFeedback = nullptr;
 
@@ -1283,6 +1943,7 @@ void ODEPhysics::Collide(ODECollision *_collision1, ODECollision *_collision2,
     // Create the contact joint. This introduces the contact constraint to
     // ODE
     dJointID contactJoint = dJointCreateContact(this->dataPtr->worldId,
+      this->dataPtr->substepSize > 0 ? this->dataPtr->substepContactGroup :
       this->dataPtr->contactGroup, &contact);
 
     // Store contact information.
@@ -1654,6 +2315,18 @@ bool ODEPhysics::GetParam(const std::string &_key, boost::any &_value) const
     _value = dGetMessageHandler() != 0;
   else if (_key == "world_step_solver")
     _value = this->GetWorldStepSolverType();
+  else if (_key == "broadphase_type")
+    _value = this->dataPtr->broadphaseType;
+  else if (_key == "broadphase_static_space")
+    _value = this->dataPtr->staticSpaceId != nullptr;
+  else if (_key == "broadphase_pairs")
+    _value = this->dataPtr->broadphasePairs;
+  else if (_key == "broadphase_static_pairs")
+    _value = this->dataPtr->staticBroadphasePairs;
+  else if (_key == "substeps")
+    _value = this->dataPtr->substeps;
+  else if (_key == "substep_pairs")
+    _value = this->dataPtr->substepBroadphasePairs;
   else
   {
     return PhysicsEngine::GetParam(_key, _value);
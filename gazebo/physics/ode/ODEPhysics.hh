@@ -21,6 +21,7 @@
 #include <tbb/concurrent_vector.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <boost/thread/thread.hpp>
 
@@ -228,10 +229,22 @@ namespace gazebo
       /// \return The space id for the world.
       public: dSpaceID GetSpaceId() const;
 
+      /// \brief Return the space holding the static geometry when the
+      /// static_space parameter is set. It is not part of the world space,
+      /// so queries of the world geometry must also test it.
+      /// \return The static space id, null if static geometry is in the
+      /// world space.
+      public: dSpaceID StaticSpaceId() const;
+
       /// \brief Get the world id.
       /// \return The world id.
       public: dWorldID GetWorldId();
 
+      /// \brief Sort the bodies into substep groups again before the next
+      /// step. Links call this when their body is created, destroyed or
+      /// made kinematic, and joints when they are attached or detached.
+      public: void InvalidateSubstepGroups();
+
       /// \brief Convert an ODE mass to Inertial.
       /// \param[out] _intertial Pointer to an Inertial object.
       /// \param[in] _odeMass Pointer to an ODE mass that will be converted.
@@ -303,6 +316,45 @@ namespace gazebo
                                              dGeomID _o2);
 
 
+      /// \brief Create the broadphase collision spaces from the optional
+      /// <broadphase> element of the <ode> SDF block.
+      /// \param[in] _odeElem The <ode> SDF element.
+      private: void LoadBroadphase(sdf::ElementPtr _odeElem);
+
+      /// \brief Refit the broadphase to the current geometry, if geometry
+      /// has been added since the last update. This auto-tunes the hash
+      /// space levels and resizes the static geometry space.
+      private: void UpdateBroadphase();
+
+      /// \brief Step the world when models take physics substeps. The
+      /// world is stepped once with the substepped bodies held as kinematic
+      /// obstacles, then each group of models sharing a substep count is
+      /// stepped at its finer rate with all other bodies held in place.
+      /// Contacts of the group are found again before every substep, and
+      /// are only reported as found at the start of the world step.
+      /// Joints between bodies of different groups are solved one way:
+      /// each side sees the other as a moving obstacle.
+      /// \sa Model::SetSubsteps()
+      private: void UpdateSubsteps();
+
+      /// \brief Sort the bodies into fine and coarse substep groups, if
+      /// links or model substeps changed since the last sort.
+      private: void UpdateSubstepGroups();
+
+      /// \brief Run the broadphase and narrowphase, adding contact joints
+      /// for every colliding pair.
+      private: void CollideSpaces();
+
+      /// \brief Run the broadphase and narrowphase for the geoms of some
+      /// bodies only, adding contact joints for every colliding pair. Each
+      /// geom queries the world and static spaces, so the cost does not
+      /// grow with the geometry that is away from the bodies.
+      /// \param[in] _bodies Bodies to collide with the world.
+      private: void CollideBodies(const std::vector<dBodyID> &_bodies);
+
+      /// \brief Run the narrowphase on the pairs found by the broadphase.
+      private: void CollideColliders();
+
       /// \brief Create a triangle mesh object collider.
       /// \param[in] _collision1 The first collision object.
       /// \param[in] _collision2 The second collision object.
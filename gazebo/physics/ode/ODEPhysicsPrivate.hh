@@ -18,12 +18,15 @@
 #ifndef _ODEPHYSICS_PRIVATE_HH_
 #define _ODEPHYSICS_PRIVATE_HH_
 
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
 #include <utility>
 
 #include "gazebo/physics/Contact.hh"
+#include "gazebo/physics/PhysicsTypes.hh"
 #include "gazebo/physics/ode/ODETypes.hh"
 
 namespace gazebo
@@ -45,6 +48,21 @@ namespace gazebo
       public: dJointFeedback feedbacks[MAX_CONTACT_JOINTS];
     };
 
+    /// \brief Bodies of the models sharing a substep count, and the state
+    /// of the rest of the world while they are substepped.
+    class ODESubstepGroup
+    {
+      /// \brief Bodies of the group.
+      public: std::vector<dBodyID> bodies;
+
+      /// \brief All other bodies, held in place during the substeps.
+      public: std::vector<dBodyID> heldBodies;
+
+      /// \brief Joints between two held bodies, or a held body and the
+      /// world, disabled during the substeps.
+      public: std::vector<dJointID> heldJoints;
+    };
+
     class ODEPhysicsPrivate
     {
       /// \brief Top-level world for all bodies
@@ -53,6 +71,74 @@ namespace gazebo
       /// \brief Top-level space for all sub-spaces/collisions
       public: dSpaceID spaceId;
 
+      /// \brief Space for the collisions of static models, or null if
+      /// static geometry is kept in spaceId. This space is only collided
+      /// against spaceId, never against itself.
+      public: dSpaceID staticSpaceId = nullptr;
+
+      /// \brief Broadphase type of spaceId: hash, sap or quadtree.
+      public: std::string broadphaseType = "hash";
+
+      /// \brief True to tune the hash space levels to the size of the
+      /// geometry in spaceId.
+      public: bool autoHashLevels = false;
+
+      /// \brief Depth of the static geometry quadtree.
+      public: int staticSpaceDepth = 6;
+
+      /// \brief True when models were added since the last broadphase
+      /// update.
+      public: bool broadphaseDirty = false;
+
+      /// \brief True when static models were added since the last
+      /// broadphase update.
+      public: bool staticSpaceDirty = false;
+
+      /// \brief True while colliding dynamic geometry against staticSpaceId.
+      public: bool collidingStatic = false;
+
+      /// \brief Number of geom pairs reported by the broadphase in the last
+      /// collision update, including the static pass.
+      public: unsigned int broadphasePairs = 0;
+
+      /// \brief Number of geom pairs between dynamic and static geometry
+      /// reported by the broadphase in the last collision update.
+      public: unsigned int staticBroadphasePairs = 0;
+
+      /// \brief Total number of substeps taken by substepped models.
+      public: uint64_t substeps = 0;
+
+      /// \brief Number of geom pairs reported by the broadphase during the
+      /// substeps of the last world step.
+      public: unsigned int substepBroadphasePairs = 0;
+
+      /// \brief Substepped models, grouped by substep count.
+      public: std::map<unsigned int, ODESubstepGroup> substepGroups;
+
+      /// \brief Bodies that take one step per world step.
+      public: std::vector<dBodyID> coarseBodies;
+
+      /// \brief Top level models sorted into substepGroups and
+      /// coarseBodies, with their substep count at the time.
+      public: std::vector<std::pair<ModelPtr, unsigned int>> substepModels;
+
+      /// \brief True when links were added, removed or made kinematic, or
+      /// joints were attached or detached, since substepGroups and
+      /// coarseBodies were built.
+      public: std::atomic<bool> substepGroupsDirty{true};
+
+      /// \brief Contacts of the bodies being substepped, found again
+      /// before every substep.
+      public: dJointGroupID substepContactGroup = nullptr;
+
+      /// \brief Step size of the substep being collided, or zero when
+      /// colliding for a world step.
+      public: double substepSize = 0;
+
+      /// \brief Geom of the substepped group being collided against the
+      /// world, see ODEPhysics::CollideBodies().
+      public: dGeomID substepGeom = nullptr;
+
       /// \brief Collision attributes
       public: dJointGroupID contactGroup;
 
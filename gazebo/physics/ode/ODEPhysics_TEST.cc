@@ -15,6 +15,8 @@
  *
 */
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "gazebo/physics/physics.hh"
@@ -374,6 +376,187 @@ TEST_F(ODEPhysics_TEST, PhysicsParam)
   }
 }
 
+/////////////////////////////////////////////////
+/// Test the configurable broadphase with a separate static space
+TEST_F(ODEPhysics_TEST, Broadphase)
+{
+  Load("worlds/ode_broadphase.world", true, "ode");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  ODEPhysicsPtr odePhysics
+      = boost::dynamic_pointer_cast<ODEPhysics>(world->Physics());
+  ASSERT_TRUE(odePhysics != nullptr);
+
+  boost::any value;
+  value = odePhysics->GetParam("broadphase_type");
+  EXPECT_EQ(boost::any_cast<std::string>(value), "sap");
+  value = odePhysics->GetParam("broadphase_static_space");
+  EXPECT_TRUE(boost::any_cast<bool>(value));
+
+  // let the box fall and settle on the ground plane
+  world->Step(1000);
+
+  ModelPtr box = world->ModelByName("box");
+  ASSERT_TRUE(box != nullptr);
+  EXPECT_NEAR(box->WorldPose().Pos().Z(), 0.5, 1e-2);
+
+  // the box touches the static ground plane, and the two overlapping static
+  // boxes are never collided against each other
+  value = odePhysics->GetParam("broadphase_static_pairs");
+  unsigned int staticPairs = boost::any_cast<unsigned int>(value);
+  EXPECT_EQ(staticPairs, 1u);
+  value = odePhysics->GetParam("broadphase_pairs");
+  unsigned int pairs = boost::any_cast<unsigned int>(value);
+  EXPECT_EQ(pairs, staticPairs);
+}
+
+/////////////////////////////////////////////////
+/// Test models taking physics substeps
+TEST_F(ODEPhysics_TEST, Substeps)
+{
+  Load("worlds/ode_substeps.world", true, "ode");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  ModelPtr coarse = world->ModelByName("coarse_sphere");
+  ModelPtr fine = world->ModelByName("fine_sphere");
+  ModelPtr pendulum = world->ModelByName("pendulum");
+  ModelPtr box = world->ModelByName("box");
+  ASSERT_TRUE(coarse != nullptr);
+  ASSERT_TRUE(fine != nullptr);
+  ASSERT_TRUE(pendulum != nullptr);
+  ASSERT_TRUE(box != nullptr);
+
+  EXPECT_EQ(1u, coarse->Substeps());
+  EXPECT_EQ(4u, fine->Substeps());
+  EXPECT_EQ(10u, pendulum->Substeps());
+  EXPECT_EQ(10u, pendulum->GetLink("arm")->GetModel()->Substeps());
+  EXPECT_EQ(2u, world->SubsteppedModelCount());
+
+  // Both spheres are in free fall for the first 500 steps
+  world->Step(500);
+  EXPECT_NEAR(coarse->WorldPose().Pos().Z(), fine->WorldPose().Pos().Z(),
+      1e-2);
+  EXPECT_LT(fine->WorldPose().Pos().Z(), 4.0);
+  EXPECT_EQ(500u * 14u,
+      boost::any_cast<uint64_t>(world->Physics()->GetParam("substeps")));
+
+  // Both spheres land, and the pendulum rests on the coarse box
+  world->Step(2000);
+  EXPECT_NEAR(coarse->WorldPose().Pos().Z(), 0.5, 1e-2);
+  EXPECT_NEAR(fine->WorldPose().Pos().Z(), 0.5, 1e-2);
+  EXPECT_NEAR(box->WorldPose().Pos().Z(), 0.5, 1e-2);
+  const double angle = pendulum->GetJoint("joint")->Position(0);
+  EXPECT_GT(angle, 0.0);
+  EXPECT_LT(angle, 0.5);
+  EXPECT_NEAR(pendulum->GetJoint("joint")->GetVelocity(0), 0.0, 1e-2);
+
+  // Contacts are found again for each substep, so the resting sphere is
+  // not pushed out of the ground
+  EXPECT_NEAR(fine->WorldLinearVel().Z(), 0.0, 1e-3);
+
+  // A new substep count takes effect on the next step
+  fine->SetSubsteps(2);
+  world->Step(10);
+  EXPECT_EQ(2500u * 14u + 10u * 12u,
+      boost::any_cast<uint64_t>(world->Physics()->GetParam("substeps")));
+  EXPECT_NEAR(fine->WorldPose().Pos().Z(), 0.5, 1e-2);
+
+  // Substepping stops once no model asks for it
+  fine->SetSubsteps(1);
+  pendulum->SetSubsteps(0);
+  EXPECT_EQ(1u, pendulum->Substeps());
+  EXPECT_EQ(0u, world->SubsteppedModelCount());
+  world->Step(10);
+  EXPECT_EQ(2500u * 14u + 10u * 12u,
+      boost::any_cast<uint64_t>(world->Physics()->GetParam("substeps")));
+}
+
+/////////////////////////////////////////////////
+/// Test that the substeps only collide the substepped bodies
+TEST_F(ODEPhysics_TEST, SubstepsPassiveBodies)
+{
+  Load("worlds/empty.world", true, "ode");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+  PhysicsEnginePtr physics = world->Physics();
+  ASSERT_TRUE(physics != nullptr);
+
+  // A substepped sphere resting on the ground
+  SpawnSDF(
+      "<sdf version='1.6'>"
+      "<model name='fine_sphere'>"
+      "  <substeps>4</substeps>"
+      "  <pose>0 0 0.5 0 0 0</pose>"
+      "  <link name='link'>"
+      "    <collision name='collision'>"
+      "      <geometry><sphere><radius>0.5</radius></sphere></geometry>"
+      "    </collision>"
+      "  </link>"
+      "</model>"
+      "</sdf>");
+  ModelPtr fine = world->ModelByName("fine_sphere");
+  ASSERT_TRUE(fine != nullptr);
+  EXPECT_EQ(4u, fine->Substeps());
+
+  // The sphere touches the ground on each substep
+  world->Step(10);
+  EXPECT_EQ(4u,
+      boost::any_cast<unsigned int>(physics->GetParam("substep_pairs")));
+  EXPECT_EQ(1u,
+      boost::any_cast<unsigned int>(physics->GetParam("broadphase_pairs")));
+
+  // Passive boxes resting on the ground add to the world step, not to
+  // the substeps
+  const unsigned int boxCount = 20;
+  for (unsigned int i = 0; i < boxCount; ++i)
+  {
+    SpawnBox("box_" + std::to_string(i), ignition::math::Vector3d(1, 1, 1),
+        ignition::math::Vector3d(3.0 + 2.0 * i, 0, 0.5),
+        ignition::math::Vector3d::Zero);
+  }
+  world->Step(1);
+  EXPECT_EQ(1u + boxCount,
+      boost::any_cast<unsigned int>(physics->GetParam("broadphase_pairs")));
+  EXPECT_EQ(4u,
+      boost::any_cast<unsigned int>(physics->GetParam("substep_pairs")));
+  EXPECT_EQ(4u * 11u,
+      boost::any_cast<uint64_t>(physics->GetParam("substeps")));
+
+  // The sphere still rests on the ground
+  world->Step(100);
+  EXPECT_NEAR(fine->WorldPose().Pos().Z(), 0.5, 1e-2);
+  EXPECT_NEAR(fine->WorldLinearVel().Z(), 0.0, 1e-3);
+}
+
+/////////////////////////////////////////////////
+/// Test the default broadphase
+TEST_F(ODEPhysics_TEST, BroadphaseDefault)
+{
+  Load("worlds/box.world", true, "ode");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  ODEPhysicsPtr odePhysics
+      = boost::dynamic_pointer_cast<ODEPhysics>(world->Physics());
+  ASSERT_TRUE(odePhysics != nullptr);
+
+  boost::any value;
+  value = odePhysics->GetParam("broadphase_type");
+  EXPECT_EQ(boost::any_cast<std::string>(value), "hash");
+  value = odePhysics->GetParam("broadphase_static_space");
+  EXPECT_FALSE(boost::any_cast<bool>(value));
+
+  world->Step(100);
+
+  // box on ground plane, all in the same space
+  value = odePhysics->GetParam("broadphase_pairs");
+  EXPECT_EQ(boost::any_cast<unsigned int>(value), 1u);
+  value = odePhysics->GetParam("broadphase_static_pairs");
+  EXPECT_EQ(boost::any_cast<unsigned int>(value), 0u);
+}
+
 /////////////////////////////////////////////////
 void ODEPhysics_TEST::OnPhysicsMsgResponse(ConstResponsePtr &_msg)
 {
@@ -138,6 +138,14 @@ void ODERayShape::GetIntersection(double &_dist, std::string &_entity)
       dSpaceCollide2(this->geomId,
           (dGeomID)(this->physicsEngine->GetSpaceId()),
           &intersection, &UpdateCallback);
+
+      // Static geometry may be kept in a space of its own
+      if (this->physicsEngine->StaticSpaceId())
+      {
+        dSpaceCollide2(this->geomId,
+            (dGeomID)(this->physicsEngine->StaticSpaceId()),
+            &intersection, &UpdateCallback);
+      }
     }
 
     _dist = intersection.depth;
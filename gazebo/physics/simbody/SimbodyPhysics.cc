@@ -45,7 +45,7 @@
 #include "gazebo/physics/PhysicsTypes.hh"
 #include "gazebo/physics/PhysicsFactory.hh"
 #include "gazebo/physics/World.hh"
-#include "gazebo/physics/WorldPrivate.hh"
+#include "gazebo/physics/LinkStateBuffer.hh"
 #include "gazebo/physics/Entity.hh"
 #include "gazebo/physics/Model.hh"
 #include "gazebo/physics/SurfaceParams.hh"
@@ -674,32 +674,31 @@ void SimbodyPhysics::UpdatePhysics()
   //       << "]\n";
   // this->lastUpdateTime = currTime;
 
-  // pushing new entity pose into dirtyPoses for visualization
-  physics::Model_V models = this->world->Models();
-  for (physics::Model_V::iterator mi = models.begin();
-       mi != models.end(); ++mi)
+  // writing the new link states in bulk for the world to apply
+  LinkStateBuffer &states = this->world->_DirtyLinkStates();
+  const physics::Model_V models = this->world->Models();
+  size_t linkCount = states.Count();
+  for (const auto &model : models)
+    linkCount += model->GetLinks().size();
+  states.Reserve(linkCount);
+
+  for (const auto &model : models)
   {
-    physics::Link_V links = (*mi)->GetLinks();
-    for (physics::Link_V::iterator lx = links.begin();
-         lx != links.end(); ++lx)
+    for (const auto &link : model->GetLinks())
     {
-      physics::SimbodyLinkPtr simbodyLink =
-        boost::dynamic_pointer_cast<physics::SimbodyLink>(*lx);
-      auto pose = SimbodyPhysics::Transform2PoseIgn(
-        simbodyLink->masterMobod.getBodyTransform(s));
+      SimbodyLink *simbodyLink = static_cast<SimbodyLink *>(link.get());
+      const SimTK::MobilizedBody &mobod = simbodyLink->masterMobod;
+      auto pose = SimbodyPhysics::Transform2PoseIgn(mobod.getBodyTransform(s));
       simbodyLink->SetDirtyPose(pose);
-      this->world->dataPtr->dirtyPoses.push_back(
-        boost::static_pointer_cast<Entity>(*lx).get());
-    }
 
-    physics::Joint_V joints = (*mi)->GetJoints();
-    for (physics::Joint_V::iterator jx = joints.begin();
-         jx != joints.end(); ++jx)
-    {
-      SimbodyJointPtr simbodyJoint =
-        boost::dynamic_pointer_cast<physics::SimbodyJoint>(*jx);
-      simbodyJoint->CacheForceTorque();
+      // spatial velocity of the body origin, angular first
+      const SimTK::SpatialVec &vel = mobod.getBodyVelocity(s);
+      states.Add(simbodyLink, pose, SimbodyPhysics::Vec3ToVector3Ign(vel[1]),
+          SimbodyPhysics::Vec3ToVector3Ign(vel[0]));
     }
+
+    for (const auto &joint : model->GetJoints())
+      static_cast<SimbodyJoint *>(joint.get())->CacheForceTorque();
   }
 
   // FIXME:  this needs to happen before forces are applied for the next step
@@ -36,6 +36,7 @@
 #include "gazebo/common/Events.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Exception.hh"
+#include "gazebo/common/Trace.hh"
 #include "gazebo/common/VideoEncoder.hh"
 
 #include "gazebo/rendering/ogre_gazebo.h"
@@ -564,6 +565,8 @@ void Camera::Render(const bool _force)
 //////////////////////////////////////////////////
 void Camera::RenderImpl()
 {
+  GZ_TRACE_SCOPE("Camera::RenderImpl");
+
   if (this->renderTarget)
   {
     Events::cameraPreRender(this->Name());
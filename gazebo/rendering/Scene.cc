@@ -15,7 +15,14 @@
  *
 */
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <functional>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/make_shared.hpp>
@@ -30,6 +37,8 @@
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
+#include "gazebo/common/MeshManager.hh"
+#include "gazebo/common/Trace.hh"
 #include "gazebo/rendering/Road2d.hh"
 #include "gazebo/rendering/Projector.hh"
 #include "gazebo/rendering/Heightmap.hh"
@@ -96,6 +105,77 @@ struct VisualMessageLess {
     }
 } VisualMessageLessOp;
 
+/////////////////////////////////////////////////
+/// \brief Start loading the meshes of visual messages in the background.
+/// \param[in] _msgs The visual messages.
+static void PrepareMeshes(const VisualMsgs_L &_msgs)
+{
+  for (const auto &msg : _msgs)
+  {
+    if (msg->has_geometry() && msg->geometry().has_mesh() &&
+        !msg->geometry().mesh().filename().empty())
+    {
+      common::MeshManager::Instance()->Prepare(
+          msg->geometry().mesh().filename());
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Get whether the mesh of a visual message is still loaded in the
+/// background.
+/// \param[in] _msg The visual message.
+/// \return True if the mesh is not loaded yet.
+static bool MeshPending(const msgs::Visual &_msg)
+{
+  return _msg.has_geometry() && _msg.geometry().has_mesh() &&
+      common::MeshManager::Instance()->Preparing(
+          _msg.geometry().mesh().filename());
+}
+
+/////////////////////////////////////////////////
+/// \brief Get whether a visual message must wait for a mesh loaded in the
+/// background. The later messages of a visual wait with it, so that the
+/// messages of a visual are processed in the order they were received.
+/// \param[in] _msg The visual message.
+/// \param[in,out] _waiting Names of the visuals with waiting messages.
+/// \return True if the message must wait.
+static bool MustWait(const msgs::Visual &_msg,
+    std::set<std::string> &_waiting)
+{
+  if (_waiting.count(_msg.name()) == 0 && !MeshPending(_msg))
+    return false;
+
+  _waiting.insert(_msg.name());
+  return true;
+}
+
+/////////////////////////////////////////////////
+/// \brief Sort messages by the distance of their entity to the camera,
+/// closest first. The messages of an entity are sorted by the pose of its
+/// first message and keep their order, so that an update is never
+/// processed before the message it updates.
+/// \param[in] _eye Position of the camera.
+/// \param[in,out] _msgs Model or visual messages to sort.
+template<typename T>
+static void SortByDistance(const ignition::math::Vector3d &_eye,
+    std::list<boost::shared_ptr<T const>> &_msgs)
+{
+  std::map<std::string, double> distances;
+  for (const auto &msg : _msgs)
+  {
+    distances.emplace(msg->name(),
+        _eye.Distance(msgs::ConvertIgn(msg->pose().position())));
+  }
+
+  // std::list::sort is stable
+  _msgs.sort([&distances](const boost::shared_ptr<T const> &_a,
+        const boost::shared_ptr<T const> &_b)
+      {
+        return distances[_a->name()] < distances[_b->name()];
+      });
+}
+
 //////////////////////////////////////////////////
 Scene::Scene()
   : dataPtr(new ScenePrivate)
@@ -137,6 +217,16 @@ Scene::Scene(const std::string &_name, const bool _enableVisualizations,
 
   this->dataPtr->receiveMutex = new std::mutex();
 
+  // Interpolation of the poses received from the world between frames
+  const char *interpolation = std::getenv("GAZEBO_POSE_INTERPOLATION");
+  this->dataPtr->poseTable.SetInterpolation(
+      interpolation && std::string(interpolation) == "1");
+
+  // Time in milliseconds spent building visuals per frame
+  const char *budget = std::getenv("GAZEBO_SCENE_CONSTRUCTION_BUDGET");
+  if (budget)
+    this->SetConstructionBudget(std::atof(budget));
+
   this->dataPtr->connections.push_back(
       event::Events::ConnectPreRender(std::bind(&Scene::PreRender, this)));
 
@@ -249,7 +339,7 @@ void Scene::Clear()
 
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
-    this->dataPtr->poseMsgs.clear();
+    this->dataPtr->poseTable.Clear();
   }
 
   this->dataPtr->joints.clear();
@@ -1535,17 +1625,8 @@ bool Scene::ProcessSceneMsg(ConstScenePtr &_msg)
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
     for (int i = 0; i < _msg->model_size(); ++i)
     {
-      PoseMsgs_M::iterator iter =
-          this->dataPtr->poseMsgs.find(_msg->model(i).id());
-      if (iter != this->dataPtr->poseMsgs.end())
-        iter->second.CopyFrom(_msg->model(i).pose());
-      else
-        this->dataPtr->poseMsgs.insert(
-            std::make_pair(_msg->model(i).id(), _msg->model(i).pose()));
-
-      this->dataPtr->poseMsgs[_msg->model(i).id()].set_name(
-          _msg->model(i).name());
-      this->dataPtr->poseMsgs[_msg->model(i).id()].set_id(_msg->model(i).id());
+      this->dataPtr->poseTable.Set(_msg->model(i).id(),
+          msgs::ConvertIgn(_msg->model(i).pose()));
 
       this->ProcessModelMsg(_msg->model(i));
     }
@@ -1676,16 +1757,8 @@ bool Scene::ProcessModelMsg(const msgs::Model &_msg)
       std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
       if (_msg.link(j).has_pose())
       {
-        PoseMsgs_M::iterator iter =
-            this->dataPtr->poseMsgs.find(_msg.link(j).id());
-        if (iter != this->dataPtr->poseMsgs.end())
-          iter->second.CopyFrom(_msg.link(j).pose());
-        else
-          this->dataPtr->poseMsgs.insert(
-              std::make_pair(_msg.link(j).id(), _msg.link(j).pose()));
-
-        this->dataPtr->poseMsgs[_msg.link(j).id()].set_name(linkName);
-        this->dataPtr->poseMsgs[_msg.link(j).id()].set_id(_msg.link(j).id());
+        this->dataPtr->poseTable.Set(_msg.link(j).id(),
+            msgs::ConvertIgn(_msg.link(j).pose()));
       }
     }
 
@@ -1761,6 +1834,10 @@ void Scene::OnVisualMsg(ConstVisualPtr &_msg)
 //////////////////////////////////////////////////
 void Scene::PreRender()
 {
+  GZ_TRACE_SCOPE("Scene::PreRender");
+
+  const auto frameStart = std::chrono::steady_clock::now();
+
   /* Deferred shading debug code. Delete me soon (July 17, 2012)
   static bool first = true;
 
@@ -1811,7 +1888,6 @@ void Scene::PreRender()
   static ModelMsgs_L::iterator modelIter;
   static VisualMsgs_L::iterator visualIter;
   static LightMsgs_L::iterator lightIter;
-  static PoseMsgs_M::iterator pIter;
   static SkeletonPoseMsgs_L::iterator spIter;
   static JointMsgs_L::iterator jointIter;
   static SensorMsgs_L::iterator sensorIter;
@@ -1830,64 +1906,60 @@ void Scene::PreRender()
   LinkMsgs_L linkMsgsCopy;
   RoadMsgs_L roadMsgsCopy;
 
+  // Take the received messages by swapping the lists, so that the
+  // callbacks can keep receiving while they are processed
   {
     std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
 
-    std::copy(this->dataPtr->sceneMsgs.begin(), this->dataPtr->sceneMsgs.end(),
-              std::back_inserter(sceneMsgsCopy));
-    this->dataPtr->sceneMsgs.clear();
-
-    std::copy(this->dataPtr->modelMsgs.begin(), this->dataPtr->modelMsgs.end(),
-              std::back_inserter(modelMsgsCopy));
-    this->dataPtr->modelMsgs.clear();
-
-    std::copy(this->dataPtr->sensorMsgs.begin(),
-              this->dataPtr->sensorMsgs.end(),
-              std::back_inserter(sensorMsgsCopy));
-    this->dataPtr->sensorMsgs.clear();
-
-    std::copy(this->dataPtr->lightFactoryMsgs.begin(),
-              this->dataPtr->lightFactoryMsgs.end(),
-              std::back_inserter(lightFactoryMsgsCopy));
-    this->dataPtr->lightFactoryMsgs.clear();
-
-    std::copy(this->dataPtr->lightModifyMsgs.begin(),
-              this->dataPtr->lightModifyMsgs.end(),
-              std::back_inserter(lightModifyMsgsCopy));
-    this->dataPtr->lightModifyMsgs.clear();
-
-    std::copy(this->dataPtr->modelVisualMsgs.begin(),
-              this->dataPtr->modelVisualMsgs.end(),
-              std::back_inserter(modelVisualMsgsCopy));
-    this->dataPtr->modelVisualMsgs.clear();
-
-    std::copy(this->dataPtr->linkVisualMsgs.begin(),
-              this->dataPtr->linkVisualMsgs.end(),
-              std::back_inserter(linkVisualMsgsCopy));
-    this->dataPtr->linkVisualMsgs.clear();
-
-    this->dataPtr->visualMsgs.sort(VisualMessageLessOp);
-    std::copy(this->dataPtr->visualMsgs.begin(),
-              this->dataPtr->visualMsgs.end(),
-              std::back_inserter(visualMsgsCopy));
-    this->dataPtr->visualMsgs.clear();
-
-    std::copy(this->dataPtr->collisionVisualMsgs.begin(),
-              this->dataPtr->collisionVisualMsgs.end(),
-              std::back_inserter(collisionVisualMsgsCopy));
-    this->dataPtr->collisionVisualMsgs.clear();
-
-    std::copy(this->dataPtr->jointMsgs.begin(), this->dataPtr->jointMsgs.end(),
-              std::back_inserter(jointMsgsCopy));
-    this->dataPtr->jointMsgs.clear();
-
-    std::copy(this->dataPtr->linkMsgs.begin(), this->dataPtr->linkMsgs.end(),
-              std::back_inserter(linkMsgsCopy));
-    this->dataPtr->linkMsgs.clear();
-
-    std::copy(this->dataPtr->roadMsgs.begin(), this->dataPtr->roadMsgs.end(),
-              std::back_inserter(roadMsgsCopy));
-    this->dataPtr->roadMsgs.clear();
+    sceneMsgsCopy.swap(this->dataPtr->sceneMsgs);
+    modelMsgsCopy.swap(this->dataPtr->modelMsgs);
+    sensorMsgsCopy.swap(this->dataPtr->sensorMsgs);
+    lightFactoryMsgsCopy.swap(this->dataPtr->lightFactoryMsgs);
+    lightModifyMsgsCopy.swap(this->dataPtr->lightModifyMsgs);
+    modelVisualMsgsCopy.swap(this->dataPtr->modelVisualMsgs);
+    linkVisualMsgsCopy.swap(this->dataPtr->linkVisualMsgs);
+    visualMsgsCopy.swap(this->dataPtr->visualMsgs);
+    collisionVisualMsgsCopy.swap(this->dataPtr->collisionVisualMsgs);
+    jointMsgsCopy.swap(this->dataPtr->jointMsgs);
+    linkMsgsCopy.swap(this->dataPtr->linkMsgs);
+    roadMsgsCopy.swap(this->dataPtr->roadMsgs);
+  }
+  visualMsgsCopy.sort(VisualMessageLessOp);
+
+  // With a construction budget, models and visuals are built until the
+  // budget of the frame is spent, and the others wait for the next frames.
+  // At least one of them is built per frame, so construction progresses.
+  const double budget = this->dataPtr->constructionBudget;
+  bool constructed = false;
+  auto budgetSpent = [&]()
+  {
+    return budget > 0 && constructed &&
+        std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - frameStart).count() > budget;
+  };
+
+  if (budget > 0)
+  {
+    // Meshes are loaded in the background, and their visuals are built
+    // once they are ready
+    PrepareMeshes(modelVisualMsgsCopy);
+    PrepareMeshes(linkVisualMsgsCopy);
+    PrepareMeshes(visualMsgsCopy);
+    PrepareMeshes(collisionVisualMsgsCopy);
+
+    // Build the models closest to the camera first
+    CameraPtr camera;
+    if (!this->dataPtr->userCameras.empty())
+      camera = this->dataPtr->userCameras[0];
+    else if (!this->dataPtr->cameras.empty())
+      camera = this->dataPtr->cameras[0];
+
+    if (camera)
+    {
+      const ignition::math::Vector3d eye = camera->WorldPosition();
+      SortByDistance(eye, modelMsgsCopy);
+      SortByDistance(eye, modelVisualMsgsCopy);
+    }
   }
 
   // Process the scene messages. DO THIS FIRST
@@ -1905,10 +1977,14 @@ void Scene::PreRender()
   }
 
   // Process the model messages.
-  for (modelIter = modelMsgsCopy.begin(); modelIter != modelMsgsCopy.end();)
+  for (modelIter = modelMsgsCopy.begin();
+      modelIter != modelMsgsCopy.end() && !budgetSpent();)
   {
     if (this->ProcessModelMsg(**modelIter))
+    {
       modelMsgsCopy.erase(modelIter++);
+      constructed = true;
+    }
     else
       ++modelIter;
   }
@@ -1922,45 +1998,69 @@ void Scene::PreRender()
       ++sensorIter;
   }
 
+  // Visuals with messages waiting for their meshes
+  std::set<std::string> waiting;
+
   // Process the model visual messages.
   for (visualIter = modelVisualMsgsCopy.begin();
-      visualIter != modelVisualMsgsCopy.end();)
+      visualIter != modelVisualMsgsCopy.end() && !budgetSpent();)
   {
-    if (this->ProcessVisualMsg(*visualIter, Visual::VT_MODEL))
+    if (budget > 0 && MustWait(**visualIter, waiting))
+      ++visualIter;
+    else if (this->ProcessVisualMsg(*visualIter, Visual::VT_MODEL))
+    {
       modelVisualMsgsCopy.erase(visualIter++);
+      constructed = true;
+    }
     else
       ++visualIter;
   }
 
   // Process the link visual messages.
   for (visualIter = linkVisualMsgsCopy.begin();
-      visualIter != linkVisualMsgsCopy.end();)
+      visualIter != linkVisualMsgsCopy.end() && !budgetSpent();)
   {
-    if (this->ProcessVisualMsg(*visualIter, Visual::VT_LINK))
+    if (budget > 0 && MustWait(**visualIter, waiting))
+      ++visualIter;
+    else if (this->ProcessVisualMsg(*visualIter, Visual::VT_LINK))
+    {
       linkVisualMsgsCopy.erase(visualIter++);
+      constructed = true;
+    }
     else
       ++visualIter;
   }
 
   // Process the visual messages.
-  for (visualIter = visualMsgsCopy.begin(); visualIter != visualMsgsCopy.end();)
+  for (visualIter = visualMsgsCopy.begin();
+      visualIter != visualMsgsCopy.end() && !budgetSpent();)
   {
     Visual::VisualType visualType = Visual::VT_VISUAL;
     if ((*visualIter)->has_type())
       visualType = Visual::ConvertVisualType((*visualIter)->type());
 
-    if (this->ProcessVisualMsg(*visualIter, visualType))
+    if (budget > 0 && MustWait(**visualIter, waiting))
+      ++visualIter;
+    else if (this->ProcessVisualMsg(*visualIter, visualType))
+    {
       visualMsgsCopy.erase(visualIter++);
+      constructed = true;
+    }
     else
       ++visualIter;
   }
 
   // Process the collision visual messages.
   for (visualIter = collisionVisualMsgsCopy.begin();
-      visualIter != collisionVisualMsgsCopy.end();)
+      visualIter != collisionVisualMsgsCopy.end() && !budgetSpent();)
   {
-    if (this->ProcessVisualMsg(*visualIter, Visual::VT_COLLISION))
+    if (budget > 0 && MustWait(**visualIter, waiting))
+      ++visualIter;
+    else if (this->ProcessVisualMsg(*visualIter, Visual::VT_COLLISION))
+    {
       collisionVisualMsgsCopy.erase(visualIter++);
+      constructed = true;
+    }
     else
       ++visualIter;
   }
@@ -2012,41 +2112,33 @@ void Scene::PreRender()
   }
   this->dataPtr->requestMsgs.clear();
 
+  // Put back the messages which could not be processed yet, in front of
+  // those received in the meantime
   {
     std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
 
-    std::copy(sceneMsgsCopy.begin(), sceneMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->sceneMsgs));
-
-    std::copy(modelMsgsCopy.begin(), modelMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->modelMsgs));
-
-    std::copy(sensorMsgsCopy.begin(), sensorMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->sensorMsgs));
-
-    std::copy(lightFactoryMsgsCopy.begin(), lightFactoryMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->lightFactoryMsgs));
-
-    std::copy(lightModifyMsgsCopy.begin(), lightModifyMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->lightModifyMsgs));
-
-    std::copy(modelVisualMsgsCopy.begin(), modelVisualMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->modelVisualMsgs));
-
-    std::copy(linkVisualMsgsCopy.begin(), linkVisualMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->linkVisualMsgs));
-
-    std::copy(visualMsgsCopy.begin(), visualMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->visualMsgs));
-
-    std::copy(collisionVisualMsgsCopy.begin(), collisionVisualMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->collisionVisualMsgs));
-
-    std::copy(jointMsgsCopy.begin(), jointMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->jointMsgs));
-
-    std::copy(linkMsgsCopy.begin(), linkMsgsCopy.end(),
-        std::front_inserter(this->dataPtr->linkMsgs));
+    this->dataPtr->sceneMsgs.splice(
+        this->dataPtr->sceneMsgs.begin(), sceneMsgsCopy);
+    this->dataPtr->modelMsgs.splice(
+        this->dataPtr->modelMsgs.begin(), modelMsgsCopy);
+    this->dataPtr->sensorMsgs.splice(
+        this->dataPtr->sensorMsgs.begin(), sensorMsgsCopy);
+    this->dataPtr->lightFactoryMsgs.splice(
+        this->dataPtr->lightFactoryMsgs.begin(), lightFactoryMsgsCopy);
+    this->dataPtr->lightModifyMsgs.splice(
+        this->dataPtr->lightModifyMsgs.begin(), lightModifyMsgsCopy);
+    this->dataPtr->modelVisualMsgs.splice(
+        this->dataPtr->modelVisualMsgs.begin(), modelVisualMsgsCopy);
+    this->dataPtr->linkVisualMsgs.splice(
+        this->dataPtr->linkVisualMsgs.begin(), linkVisualMsgsCopy);
+    this->dataPtr->visualMsgs.splice(
+        this->dataPtr->visualMsgs.begin(), visualMsgsCopy);
+    this->dataPtr->collisionVisualMsgs.splice(
+        this->dataPtr->collisionVisualMsgs.begin(), collisionVisualMsgsCopy);
+    this->dataPtr->jointMsgs.splice(
+        this->dataPtr->jointMsgs.begin(), jointMsgsCopy);
+    this->dataPtr->linkMsgs.splice(
+        this->dataPtr->linkMsgs.begin(), linkMsgsCopy);
   }
 
   // update the rt shader
@@ -2055,45 +2147,49 @@ void Scene::PreRender()
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
 
-    // Process all the model messages last. Remove pose message from the list
-    // only when a corresponding visual exits. We may receive pose updates
-    // over the wire before  we recieve the visual
-    pIter = this->dataPtr->poseMsgs.begin();
-    while (pIter != this->dataPtr->poseMsgs.end())
+    // Apply the poses received since the last frame in one pass over the
+    // pose table. Poses of visuals which do not exist yet are kept, since
+    // we may receive pose updates over the wire before we receive the
+    // visual.
+    this->dataPtr->poseTable.Collect(common::Time::GetWallTime(),
+        this->dataPtr->poseUpdates);
+    for (const auto &update : this->dataPtr->poseUpdates)
     {
-      Visual_M::iterator iter = this->dataPtr->visuals.find(pIter->first);
-      if (iter != this->dataPtr->visuals.end() && iter->second)
+      VisualPtr vis = update.visual;
+      if (!vis)
+      {
+        Visual_M::iterator iter = this->dataPtr->visuals.find(update.id);
+        if (iter != this->dataPtr->visuals.end() && iter->second)
+        {
+          vis = iter->second;
+          this->dataPtr->poseTable.SetVisual(update.id, vis);
+        }
+      }
+
+      if (vis)
       {
         // If an object is selected, don't let the physics engine move it.
         if (!this->dataPtr->selectedVis
             || this->dataPtr->selectionMode != "move" ||
-            (iter->first != this->dataPtr->selectedVis->GetId() &&
-            !this->dataPtr->selectedVis->IsAncestorOf(iter->second)))
+            (update.id != this->dataPtr->selectedVis->GetId() &&
+            !this->dataPtr->selectedVis->IsAncestorOf(vis)))
         {
-          ignition::math::Pose3d pose = msgs::ConvertIgn(pIter->second);
-          GZ_ASSERT(iter->second, "Visual pointer is NULL");
-          iter->second->SetPose(pose);
-          PoseMsgs_M::iterator prev = pIter++;
-          this->dataPtr->poseMsgs.erase(prev);
+          vis->SetPose(update.pose);
         }
         else
-          ++pIter;
+          this->dataPtr->poseTable.Requeue(update.id);
+        continue;
       }
-      else
+
+      // process light pose messages
+      auto lIter = this->dataPtr->lights.find(update.id);
+      if (lIter != this->dataPtr->lights.end())
       {
-        // process light pose messages
-        auto lIter = this->dataPtr->lights.find(pIter->first);
-        if (lIter != this->dataPtr->lights.end())
-        {
-          ignition::math::Pose3d pose = msgs::ConvertIgn(pIter->second);
-          lIter->second->SetPosition(pose.Pos());
-          lIter->second->SetRotation(pose.Rot());
-          auto prev = pIter++;
-          this->dataPtr->poseMsgs.erase(prev);
-        }
-        else
-          ++pIter;
+        lIter->second->SetPosition(update.pose.Pos());
+        lIter->second->SetRotation(update.pose.Rot());
       }
+      else
+        this->dataPtr->poseTable.Requeue(update.id);
     }
 
     // process skeleton pose msgs
@@ -2725,6 +2821,9 @@ bool Scene::ProcessVisualMsg(ConstVisualPtr &_msg, Visual::VisualType _type)
   {
     if (iter != this->dataPtr->visuals.end())
     {
+      std::lock_guard<std::recursive_mutex> lock(
+          this->dataPtr->poseMsgMutex);
+      this->dataPtr->poseTable.Remove(iter->first);
       this->dataPtr->visuals.erase(iter);
       return true;
     }
@@ -2842,6 +2941,10 @@ bool Scene::ProcessVisualMsg(ConstVisualPtr &_msg, Visual::VisualType _type)
   visual->SetType(_type);
 
   this->dataPtr->visuals[visual->GetId()] = visual;
+  {
+    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
+    this->dataPtr->poseTable.SetVisual(visual->GetId(), visual);
+  }
   if (visual->Name().find("__SKELETON_VISUAL__") != std::string::npos)
   {
     visual->SetVisible(false);
@@ -2869,15 +2972,12 @@ void Scene::OnPoseMsg(ConstPosesStampedPtr &_msg)
   this->dataPtr->sceneSimTimePosesReceived =
     common::Time(_msg->time().sec(), _msg->time().nsec());
 
+  const common::Time received = common::Time::GetWallTime();
   for (int i = 0; i < _msg->pose_size(); ++i)
   {
-    auto p = _msg->pose(i);
-    PoseMsgs_M::iterator iter =
-        this->dataPtr->poseMsgs.find(p.id());
-    if (iter != this->dataPtr->poseMsgs.end())
-      iter->second.CopyFrom(p);
-    else
-      this->dataPtr->poseMsgs.insert(std::make_pair(p.id(), p));
+    const msgs::Pose &p = _msg->pose(i);
+    this->dataPtr->poseTable.Update(p.id(), msgs::ConvertIgn(p),
+        this->dataPtr->sceneSimTimePosesReceived, received);
   }
 }
 
@@ -3283,6 +3383,32 @@ unsigned int Scene::ShadowTextureSize() const
     return this->dataPtr->shadowTextureSize;
 }
 
+/////////////////////////////////////////////////
+void Scene::SetPoseInterpolation(const bool _enable)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
+  this->dataPtr->poseTable.SetInterpolation(_enable);
+}
+
+/////////////////////////////////////////////////
+bool Scene::PoseInterpolation() const
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
+  return this->dataPtr->poseTable.Interpolation();
+}
+
+/////////////////////////////////////////////////
+void Scene::SetConstructionBudget(const double _budget)
+{
+  this->dataPtr->constructionBudget = std::max(_budget, 0.0);
+}
+
+/////////////////////////////////////////////////
+double Scene::ConstructionBudget() const
+{
+  return this->dataPtr->constructionBudget;
+}
+
 /////////////////////////////////////////////////
 void Scene::AddVisual(VisualPtr _vis)
 {
@@ -3293,6 +3419,9 @@ void Scene::AddVisual(VisualPtr _vis)
   }
 
   this->dataPtr->visuals[_vis->GetId()] = _vis;
+
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
+  this->dataPtr->poseTable.SetVisual(_vis->GetId(), _vis);
 }
 
 /////////////////////////////////////////////////
@@ -3320,6 +3449,12 @@ void Scene::RemoveVisual(uint32_t _id)
     }
     this->dataPtr->visuals.erase(iter);
 
+    {
+      std::lock_guard<std::recursive_mutex> lock(
+          this->dataPtr->poseMsgMutex);
+      this->dataPtr->poseTable.Remove(_id);
+    }
+
     this->RemoveVisualizations(vis);
     vis->Fini();
 
@@ -3344,6 +3479,12 @@ void Scene::SetVisualId(VisualPtr _vis, uint32_t _id)
   auto iter = this->dataPtr->visuals.find(_vis->GetId());
   if (iter != this->dataPtr->visuals.end())
   {
+    {
+      std::lock_guard<std::recursive_mutex> lock(
+          this->dataPtr->poseMsgMutex);
+      this->dataPtr->poseTable.SetVisual(_vis->GetId(), VisualPtr());
+      this->dataPtr->poseTable.SetVisual(_id, _vis);
+    }
     this->dataPtr->visuals.erase(_vis->GetId());
     this->dataPtr->visuals[_id] = _vis;
     _vis->SetId(_id);
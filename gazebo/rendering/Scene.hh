@@ -418,6 +418,32 @@ namespace gazebo
       /// \return Size of the shadow texture. The default size is 1024.
       public: unsigned int ShadowTextureSize() const;
 
+      /// \brief Enable or disable the interpolation of the poses received
+      /// from the world. With interpolation, a visual moves smoothly to
+      /// each new pose over the simulation time elapsed since the previous
+      /// one, instead of jumping to it. Disabled by default, unless the
+      /// GAZEBO_POSE_INTERPOLATION environment variable is set to 1.
+      /// \param[in] _enable True to interpolate poses.
+      public: void SetPoseInterpolation(const bool _enable);
+
+      /// \brief Get whether the poses received from the world are
+      /// interpolated.
+      /// \return True if poses are interpolated.
+      public: bool PoseInterpolation() const;
+
+      /// \brief Set the time spent building models and visuals per frame.
+      /// Once it is spent, the remaining ones are built in the next frames,
+      /// closest to the camera first, and meshes are loaded in the
+      /// background. Zero, the default, builds everything received before
+      /// the frame. The GAZEBO_SCENE_CONSTRUCTION_BUDGET environment
+      /// variable sets the initial budget.
+      /// \param[in] _budget Budget in milliseconds, zero for no limit.
+      public: void SetConstructionBudget(const double _budget);
+
+      /// \brief Get the time spent building models and visuals per frame.
+      /// \return Budget in milliseconds, zero if there is no limit.
+      public: double ConstructionBudget() const;
+
       /// \brief Add a visual to the scene
       /// \param[in] _vis Visual to add.
       public: void AddVisual(VisualPtr _vis);
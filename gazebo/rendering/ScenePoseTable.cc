@@ -0,0 +1,342 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include <ignition/math/Quaternion.hh>
+
+#include "gazebo/rendering/ScenePoseTable.hh"
+
+using namespace gazebo;
+using namespace rendering;
+
+/// \brief Ids below this value are mapped to their slot through an array,
+/// larger ids through a hash map.
+static const uint32_t kMaxDenseId = 1u << 20;
+
+/// \brief Slot of an id without a pose.
+static const uint32_t kNoSlot = std::numeric_limits<uint32_t>::max();
+
+/// \brief Longest interpolation in seconds. Poses stamped further apart,
+/// for example after a pause, are reached in this time.
+static const double kMaxInterpolation = 0.25;
+
+namespace gazebo
+{
+  namespace rendering
+  {
+    /// \internal
+    /// \brief Pose state of one id.
+    class ScenePoseEntry
+    {
+      /// \brief Id of the visual.
+      public: uint32_t id = 0;
+
+      /// \brief Pose at the start of the interpolation.
+      public: ignition::math::Pose3d from;
+
+      /// \brief Latest pose received.
+      public: ignition::math::Pose3d to;
+
+      /// \brief Last pose returned by Collect.
+      public: ignition::math::Pose3d shown;
+
+      /// \brief Simulation time of the latest pose, zero if it was not
+      /// stamped.
+      public: common::Time stamp;
+
+      /// \brief Wall time at which the interpolation started.
+      public: common::Time start;
+
+      /// \brief Duration of the interpolation in seconds, zero to jump to
+      /// the latest pose.
+      public: double duration = 0;
+
+      /// \brief True once Collect has returned a pose.
+      public: bool shownValid = false;
+
+      /// \brief True if the id is in the pending list.
+      public: bool pending = false;
+
+      /// \brief Cached visual.
+      public: std::weak_ptr<Visual> visual;
+    };
+
+    /// \internal
+    /// \brief Private data for ScenePoseTable.
+    class ScenePoseTablePrivate
+    {
+      /// \brief Find the slot of an id.
+      /// \param[in] _id The id.
+      /// \return The slot, kNoSlot if the id has no pose.
+      public: uint32_t Find(const uint32_t _id) const
+      {
+        if (_id < kMaxDenseId)
+          return _id < this->slots.size() ? this->slots[_id] : kNoSlot;
+
+        auto iter = this->sparseSlots.find(_id);
+        return iter == this->sparseSlots.end() ? kNoSlot : iter->second;
+      }
+
+      /// \brief Get the entry of an id, adding it if needed.
+      /// \param[in] _id The id.
+      /// \return The entry.
+      public: ScenePoseEntry &Entry(const uint32_t _id)
+      {
+        uint32_t slot = this->Find(_id);
+        if (slot != kNoSlot)
+          return this->entries[slot];
+
+        slot = static_cast<uint32_t>(this->entries.size());
+        this->SetSlot(_id, slot);
+        this->entries.emplace_back();
+        this->entries.back().id = _id;
+        return this->entries.back();
+      }
+
+      /// \brief Map an id to a slot.
+      /// \param[in] _id The id.
+      /// \param[in] _slot The slot, kNoSlot to remove the id.
+      public: void SetSlot(const uint32_t _id, const uint32_t _slot)
+      {
+        if (_id < kMaxDenseId)
+        {
+          if (_id >= this->slots.size())
+          {
+            this->slots.resize(std::max<size_t>(_id + 1,
+                  this->slots.size() * 2), kNoSlot);
+          }
+          this->slots[_id] = _slot;
+        }
+        else if (_slot == kNoSlot)
+          this->sparseSlots.erase(_id);
+        else
+          this->sparseSlots[_id] = _slot;
+      }
+
+      /// \brief Add an entry to the pending list.
+      /// \param[in] _entry The entry.
+      public: void MarkPending(ScenePoseEntry &_entry)
+      {
+        if (_entry.pending)
+          return;
+        _entry.pending = true;
+        this->pending.push_back(_entry.id);
+      }
+
+      /// \brief True to interpolate stamped poses.
+      public: bool interpolation = false;
+
+      /// \brief Pose state of each id with a pose.
+      public: std::vector<ScenePoseEntry> entries;
+
+      /// \brief Slot in entries of each id below kMaxDenseId.
+      public: std::vector<uint32_t> slots;
+
+      /// \brief Slot in entries of each larger id.
+      public: std::unordered_map<uint32_t, uint32_t> sparseSlots;
+
+      /// \brief Ids with a pose to return from Collect.
+      public: std::vector<uint32_t> pending;
+
+      /// \brief Pending ids of the next Collect, kept to reuse memory.
+      public: std::vector<uint32_t> nextPending;
+    };
+  }
+}
+
+/////////////////////////////////////////////////
+ScenePoseTable::ScenePoseTable()
+  : dataPtr(new ScenePoseTablePrivate)
+{
+}
+
+/////////////////////////////////////////////////
+ScenePoseTable::~ScenePoseTable()
+{
+}
+
+/////////////////////////////////////////////////
+void ScenePoseTable::SetInterpolation(const bool _enable)
+{
+  this->dataPtr->interpolation = _enable;
+}
+
+/////////////////////////////////////////////////
+bool ScenePoseTable::Interpolation() const
+{
+  return this->dataPtr->interpolation;
+}
+
+/////////////////////////////////////////////////
+void ScenePoseTable::Update(const uint32_t _id,
+    const ignition::math::Pose3d &_pose, const common::Time &_stamp,
+    const common::Time &_received)
+{
+  ScenePoseEntry &entry = this->dataPtr->Entry(_id);
+
+  entry.duration = 0;
+  if (this->dataPtr->interpolation && entry.shownValid &&
+      entry.stamp != common::Time::Zero && _stamp > entry.stamp)
+  {
+    // Start from the pose shown, so that a pose received in the middle of
+    // an interpolation does not make the visual jump
+    entry.from = entry.shown;
+    entry.start = _received;
+    entry.duration = std::min((_stamp - entry.stamp).Double(),
+        kMaxInterpolation);
+  }
+
+  entry.to = _pose;
+  entry.stamp = _stamp;
+  this->dataPtr->MarkPending(entry);
+}
+
+/////////////////////////////////////////////////
+void ScenePoseTable::Set(const uint32_t _id,
+    const ignition::math::Pose3d &_pose)
+{
+  ScenePoseEntry &entry = this->dataPtr->Entry(_id);
+  entry.to = _pose;
+  entry.stamp = common::Time::Zero;
+  entry.duration = 0;
+  this->dataPtr->MarkPending(entry);
+}
+
+/////////////////////////////////////////////////
+bool ScenePoseTable::Pose(const uint32_t _id,
+    ignition::math::Pose3d &_pose) const
+{
+  const uint32_t slot = this->dataPtr->Find(_id);
+  if (slot == kNoSlot)
+    return false;
+
+  _pose = this->dataPtr->entries[slot].to;
+  return true;
+}
+
+/////////////////////////////////////////////////
+void ScenePoseTable::Collect(const common::Time &_now,
+    std::vector<ScenePoseUpdate> &_updates)
+{
+  auto &d = *this->dataPtr;
+  _updates.clear();
+  _updates.reserve(d.pending.size());
+  d.nextPending.clear();
+
+  for (const uint32_t id : d.pending)
+  {
+    const uint32_t slot = d.Find(id);
+    ScenePoseEntry &entry = d.entries[slot];
+    ignition::math::Pose3d pose = entry.to;
+    bool done = true;
+    if (entry.duration > 0)
+    {
+      const double t = (_now - entry.start).Double() / entry.duration;
+      if (t < 1)
+      {
+        const double alpha = std::max(t, 0.0);
+        pose.Set(entry.from.Pos() + (entry.to.Pos() - entry.from.Pos()) *
+            alpha, ignition::math::Quaterniond::Slerp(alpha,
+              entry.from.Rot(), entry.to.Rot(), true));
+        done = false;
+      }
+    }
+
+    entry.shown = pose;
+    entry.shownValid = true;
+    if (done)
+    {
+      entry.duration = 0;
+      entry.pending = false;
+    }
+    else
+      d.nextPending.push_back(id);
+
+    _updates.emplace_back();
+    ScenePoseUpdate &update = _updates.back();
+    update.id = id;
+    update.pose = pose;
+    update.visual = entry.visual.lock();
+  }
+
+  d.pending.swap(d.nextPending);
+}
+
+/////////////////////////////////////////////////
+void ScenePoseTable::Requeue(const uint32_t _id)
+{
+  const uint32_t slot = this->dataPtr->Find(_id);
+  if (slot != kNoSlot)
+    this->dataPtr->MarkPending(this->dataPtr->entries[slot]);
+}
+
+/////////////////////////////////////////////////
+void ScenePoseTable::SetVisual(const uint32_t _id, VisualPtr _visual)
+{
+  const uint32_t slot = this->dataPtr->Find(_id);
+  if (slot != kNoSlot)
+    this->dataPtr->entries[slot].visual = _visual;
+}
+
+/////////////////////////////////////////////////
+void ScenePoseTable::Remove(const uint32_t _id)
+{
+  auto &d = *this->dataPtr;
+  const uint32_t slot = d.Find(_id);
+  if (slot == kNoSlot)
+    return;
+
+  if (d.entries[slot].pending)
+  {
+    d.pending.erase(std::remove(d.pending.begin(), d.pending.end(), _id),
+        d.pending.end());
+  }
+
+  // Move the last entry into the hole. The pending list refers to ids, so
+  // it stays valid.
+  const uint32_t last = static_cast<uint32_t>(d.entries.size() - 1);
+  if (slot != last)
+  {
+    d.entries[slot] = std::move(d.entries[last]);
+    d.SetSlot(d.entries[slot].id, slot);
+  }
+  d.entries.pop_back();
+  d.SetSlot(_id, kNoSlot);
+}
+
+/////////////////////////////////////////////////
+void ScenePoseTable::Clear()
+{
+  this->dataPtr->entries.clear();
+  this->dataPtr->slots.clear();
+  this->dataPtr->sparseSlots.clear();
+  this->dataPtr->pending.clear();
+}
+
+/////////////////////////////////////////////////
+size_t ScenePoseTable::Count() const
+{
+  return this->dataPtr->entries.size();
+}
+
+/////////////////////////////////////////////////
+size_t ScenePoseTable::PendingCount() const
+{
+  return this->dataPtr->pending.size();
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_RENDERING_SCENEPOSETABLE_HH_
+#define GAZEBO_RENDERING_SCENEPOSETABLE_HH_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <ignition/math/Pose3.hh>
+
+#include "gazebo/common/Time.hh"
+#include "gazebo/rendering/RenderTypes.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace rendering
+  {
+    // Forward declare private data class.
+    class ScenePoseTablePrivate;
+
+    /// \addtogroup gazebo_rendering
+    /// \{
+
+    /// \brief A pose to apply to a visual, see ScenePoseTable::Collect.
+    class GZ_RENDERING_VISIBLE ScenePoseUpdate
+    {
+      /// \brief Id of the visual.
+      public: uint32_t id = 0;
+
+      /// \brief Pose to apply.
+      public: ignition::math::Pose3d pose;
+
+      /// \brief Visual cached with ScenePoseTable::SetVisual, null if it
+      /// is unknown.
+      public: VisualPtr visual;
+    };
+
+    /// \class ScenePoseTable ScenePoseTable.hh rendering/rendering.hh
+    /// \brief Latest pose received for each visual id, stored in a dense
+    /// array indexed through the id.
+    ///
+    /// Poses received from the network are written with Update or Set.
+    /// Collect then returns the poses that changed since the last call in
+    /// a single pass, without looking up every id. With interpolation
+    /// enabled, a stamped pose is reached gradually over the time between
+    /// its stamp and the stamp of the previous pose, so visuals move
+    /// smoothly even when poses arrive at a lower rate than frames are
+    /// rendered.
+    ///
+    /// The table is not thread safe.
+    class GZ_RENDERING_VISIBLE ScenePoseTable
+    {
+      /// \brief Constructor.
+      public: ScenePoseTable();
+
+      /// \brief Destructor.
+      public: ~ScenePoseTable();
+
+      /// \brief Enable or disable interpolation between stamped poses.
+      /// \param[in] _enable True to interpolate.
+      public: void SetInterpolation(const bool _enable);
+
+      /// \brief Get whether stamped poses are interpolated.
+      /// \return True if interpolation is enabled.
+      public: bool Interpolation() const;
+
+      /// \brief Store a pose received with a simulation time stamp.
+      /// \param[in] _id Id of the visual.
+      /// \param[in] _pose The pose.
+      /// \param[in] _stamp Simulation time of the pose.
+      /// \param[in] _received Wall time at which the pose was received.
+      public: void Update(const uint32_t _id,
+                  const ignition::math::Pose3d &_pose,
+                  const common::Time &_stamp,
+                  const common::Time &_received);
+
+      /// \brief Store a pose which is applied as is, without
+      /// interpolation.
+      /// \param[in] _id Id of the visual.
+      /// \param[in] _pose The pose.
+      public: void Set(const uint32_t _id,
+                  const ignition::math::Pose3d &_pose);
+
+      /// \brief Get the latest pose of a visual.
+      /// \param[in] _id Id of the visual.
+      /// \param[out] _pose The pose.
+      /// \return False if no pose was stored for the visual.
+      public: bool Pose(const uint32_t _id,
+                  ignition::math::Pose3d &_pose) const;
+
+      /// \brief Get the poses to apply. A pose is returned once, except
+      /// while it is interpolated, and if it is returned with Requeue.
+      /// \param[in] _now Current wall time.
+      /// \param[out] _updates Poses to apply, replacing the content of
+      /// the vector.
+      public: void Collect(const common::Time &_now,
+                  std::vector<ScenePoseUpdate> &_updates);
+
+      /// \brief Return a pose which could not be applied, so that the
+      /// next Collect returns it again, unless a newer pose was stored.
+      /// \param[in] _id Id of the visual.
+      public: void Requeue(const uint32_t _id);
+
+      /// \brief Cache the visual of an id, returned by Collect with its
+      /// poses. The table keeps a weak reference to the visual.
+      /// \param[in] _id Id of the visual.
+      /// \param[in] _visual The visual.
+      public: void SetVisual(const uint32_t _id, VisualPtr _visual);
+
+      /// \brief Remove the pose and the visual of an id.
+      /// \param[in] _id Id of the visual.
+      public: void Remove(const uint32_t _id);
+
+      /// \brief Remove all the poses.
+      public: void Clear();
+
+      /// \brief Get the number of ids with a pose.
+      /// \return Number of ids.
+      public: size_t Count() const;
+
+      /// \brief Get the number of poses which Collect would return.
+      /// \return Number of poses.
+      public: size_t PendingCount() const;
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<ScenePoseTablePrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
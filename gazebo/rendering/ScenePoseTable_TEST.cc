@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "gazebo/rendering/ScenePoseTable.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+using ignition::math::Pose3d;
+
+class ScenePoseTableTest : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+TEST_F(ScenePoseTableTest, Collect)
+{
+  rendering::ScenePoseTable table;
+  std::vector<rendering::ScenePoseUpdate> updates;
+  table.Collect(common::Time(1, 0), updates);
+  EXPECT_TRUE(updates.empty());
+
+  // Small and large ids, stored twice
+  const uint32_t bigId = 4000000000u;
+  table.Set(7, Pose3d(1, 0, 0, 0, 0, 0));
+  table.Update(bigId, Pose3d(0, 2, 0, 0, 0, 0), common::Time(1, 0),
+      common::Time(1, 0));
+  table.Set(7, Pose3d(3, 0, 0, 0, 0, 0));
+  EXPECT_EQ(2u, table.Count());
+  EXPECT_EQ(2u, table.PendingCount());
+
+  Pose3d pose;
+  EXPECT_TRUE(table.Pose(7, pose));
+  EXPECT_EQ(Pose3d(3, 0, 0, 0, 0, 0), pose);
+  EXPECT_FALSE(table.Pose(8, pose));
+
+  table.Collect(common::Time(1, 0), updates);
+  ASSERT_EQ(2u, updates.size());
+  EXPECT_EQ(7u, updates[0].id);
+  EXPECT_EQ(Pose3d(3, 0, 0, 0, 0, 0), updates[0].pose);
+  EXPECT_TRUE(updates[0].visual == nullptr);
+  EXPECT_EQ(bigId, updates[1].id);
+  EXPECT_EQ(Pose3d(0, 2, 0, 0, 0, 0), updates[1].pose);
+  EXPECT_EQ(0u, table.PendingCount());
+
+  // A pose is returned once, unless requeued
+  table.Collect(common::Time(1, 0), updates);
+  EXPECT_TRUE(updates.empty());
+  table.Requeue(bigId);
+  table.Requeue(9);
+  table.Collect(common::Time(1, 0), updates);
+  ASSERT_EQ(1u, updates.size());
+  EXPECT_EQ(bigId, updates[0].id);
+
+  // Removing an id keeps the others
+  table.Set(7, Pose3d(4, 0, 0, 0, 0, 0));
+  table.Remove(7);
+  EXPECT_EQ(1u, table.Count());
+  EXPECT_EQ(0u, table.PendingCount());
+  EXPECT_FALSE(table.Pose(7, pose));
+  EXPECT_TRUE(table.Pose(bigId, pose));
+  table.Collect(common::Time(1, 0), updates);
+  EXPECT_TRUE(updates.empty());
+
+  table.Clear();
+  EXPECT_EQ(0u, table.Count());
+  EXPECT_FALSE(table.Pose(bigId, pose));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ScenePoseTableTest, Interpolation)
+{
+  rendering::ScenePoseTable table;
+  EXPECT_FALSE(table.Interpolation());
+  table.SetInterpolation(true);
+  EXPECT_TRUE(table.Interpolation());
+
+  // The first pose is applied as is
+  std::vector<rendering::ScenePoseUpdate> updates;
+  table.Update(3, Pose3d(0, 0, 0, 0, 0, 0), common::Time(10, 0),
+      common::Time(100, 0));
+  table.Collect(common::Time(100, 0), updates);
+  ASSERT_EQ(1u, updates.size());
+  EXPECT_EQ(Pose3d(0, 0, 0, 0, 0, 0), updates[0].pose);
+
+  // The next one, stamped 0.1 s later, is reached in 0.1 s
+  table.Update(3, Pose3d(2, 0, 0, 0, 0, 1), common::Time(10, 100000000),
+      common::Time(101, 0));
+  table.Collect(common::Time(101, 50000000), updates);
+  ASSERT_EQ(1u, updates.size());
+  EXPECT_NEAR(1.0, updates[0].pose.Pos().X(), 1e-6);
+  EXPECT_NEAR(0.5, updates[0].pose.Rot().Yaw(), 1e-6);
+  EXPECT_EQ(1u, table.PendingCount());
+
+  table.Collect(common::Time(101, 200000000), updates);
+  ASSERT_EQ(1u, updates.size());
+  EXPECT_EQ(Pose3d(2, 0, 0, 0, 0, 1), updates[0].pose);
+  EXPECT_EQ(0u, table.PendingCount());
+
+  // Unstamped poses and poses with older stamps are not interpolated
+  table.Set(3, Pose3d(5, 0, 0, 0, 0, 0));
+  table.Collect(common::Time(101, 250000000), updates);
+  ASSERT_EQ(1u, updates.size());
+  EXPECT_EQ(Pose3d(5, 0, 0, 0, 0, 0), updates[0].pose);
+  table.Update(3, Pose3d(6, 0, 0, 0, 0, 0), common::Time(5, 0),
+      common::Time(102, 0));
+  table.Collect(common::Time(102, 0), updates);
+  ASSERT_EQ(1u, updates.size());
+  EXPECT_EQ(Pose3d(6, 0, 0, 0, 0, 0), updates[0].pose);
+  table.Update(3, Pose3d(7, 0, 0, 0, 0, 0), common::Time(4, 0),
+      common::Time(102, 0));
+  table.Collect(common::Time(102, 0), updates);
+  ASSERT_EQ(1u, updates.size());
+  EXPECT_EQ(Pose3d(7, 0, 0, 0, 0, 0), updates[0].pose);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -33,6 +33,7 @@
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/rendering/MarkerManager.hh"
 #include "gazebo/rendering/RenderTypes.hh"
+#include "gazebo/rendering/ScenePoseTable.hh"
 #include "gazebo/transport/TransportTypes.hh"
 
 namespace SkyX
@@ -68,10 +69,6 @@ namespace gazebo
     /// \brief List of light messages.
     typedef std::list<boost::shared_ptr<msgs::Light const> > LightMsgs_L;
 
-    /// \typedef PoseMsgs_M.
-    /// \brief List of messages.
-    typedef std::map<uint32_t, msgs::Pose> PoseMsgs_M;
-
     /// \typedef LightPoseMsgs_M.
     /// \brief List of messages.
     typedef std::map<std::string, msgs::Pose> LightPoseMsgs_M;
@@ -181,8 +178,15 @@ namespace gazebo
       /// \brief List of light modify message to process.
       public: LightMsgs_L lightModifyMsgs;
 
-      /// \brief List of pose message to process.
-      public: PoseMsgs_M poseMsgs;
+      /// \brief Latest pose of each visual, to apply on the next frame.
+      public: ScenePoseTable poseTable;
+
+      /// \brief Poses applied in PreRender, kept to reuse memory.
+      public: std::vector<ScenePoseUpdate> poseUpdates;
+
+      /// \brief Milliseconds spent building visuals per frame, zero for
+      /// no limit.
+      public: double constructionBudget = 0;
 
       /// \brief List of pose message to process.
       public: LightPoseMsgs_M lightPoseMsgs;
@@ -15,6 +15,7 @@
  *
 */
 #include <boost/algorithm/string.hpp>
+#include <functional>
 #include <sstream>
 
 #include "gazebo/common/Exception.hh"
@@ -109,15 +110,15 @@ void ContactSensor::Load(const std::string &_worldName)
 
   if (!this->dataPtr->collisions.empty())
   {
-    // request the contact manager to publish messages to a custom topic for
-    // this sensor
+    // request the contact manager to report the contacts of this sensor's
+    // collisions directly to OnContacts
     physics::ContactManager *mgr = this->world->Physics()->GetContactManager();
-    std::string topic = mgr->CreateFilter(this->dataPtr->filterName,
-        this->dataPtr->collisions);
-    if (!this->dataPtr->contactSub)
+    mgr->CreateFilter(this->dataPtr->filterName, this->dataPtr->collisions);
+    if (!this->dataPtr->contactsConnection)
     {
-      this->dataPtr->contactSub = this->node->Subscribe(topic,
-          &ContactSensor::OnContacts, this);
+      this->dataPtr->contactsConnection = mgr->ConnectContacts(
+          this->dataPtr->filterName, std::bind(&ContactSensor::OnContacts,
+          this, std::placeholders::_1));
     }
   }
 }
@@ -137,53 +138,16 @@ bool ContactSensor::UpdateImpl(const bool /*_force*/)
   if (this->dataPtr->incomingContacts.empty())
     return false;
 
-  std::vector<std::string>::iterator collIter;
-  std::string collision1;
-
   // Clear the outgoing contact message.
   this->dataPtr->contactsMsg.clear_contact();
 
-  // Iterate over all the contact messages
-  for (auto iter = this->dataPtr->incomingContacts.begin();
-       iter != this->dataPtr->incomingContacts.end(); ++iter)
+  // The contact manager only reports contacts of the monitored collisions,
+  // so copy all of them to the outgoing message.
+  for (auto const &stepContacts : this->dataPtr->incomingContacts)
   {
-    // Iterate over all the contacts in the message
-    for (int i = 0; i < (*iter)->contact_size(); ++i)
-    {
-      collision1 = (*iter)->contact(i).collision1();
-
-      // Try to find the first collision's name
-      collIter = std::find(this->dataPtr->collisions.begin(),
-          this->dataPtr->collisions.end(), collision1);
-
-      // If unable to find the first collision's name, try the second
-      if (collIter == this->dataPtr->collisions.end())
-      {
-        collision1 = (*iter)->contact(i).collision2();
-        collIter = std::find(this->dataPtr->collisions.begin(),
-            this->dataPtr->collisions.end(), collision1);
-      }
-
-      // If this sensor is monitoring one of the collision's in the
-      // contact, then add the contact to our outgoing message.
-      if (collIter != this->dataPtr->collisions.end())
-      {
-        int count = (*iter)->contact(i).position_size();
-
-        // Check to see if the contact arrays all have the same size.
-        if (count != (*iter)->contact(i).normal_size() ||
-            count != (*iter)->contact(i).wrench_size() ||
-            count != (*iter)->contact(i).depth_size())
-        {
-          gzerr << "Contact message has invalid array sizes\n";
-          continue;
-        }
-
-        // Copy the contact message.
-        msgs::Contact *contactMsg = this->dataPtr->contactsMsg.add_contact();
-        contactMsg->CopyFrom((*iter)->contact(i));
-      }
-    }
+    for (int i = 0; i < stepContacts.contact_size(); ++i)
+      this->dataPtr->contactsMsg.add_contact()->CopyFrom(
+          stepContacts.contact(i));
   }
 
   // Clear the incoming contact list.
@@ -206,6 +170,8 @@ bool ContactSensor::UpdateImpl(const bool /*_force*/)
 //////////////////////////////////////////////////
 void ContactSensor::Fini()
 {
+  this->dataPtr->contactsConnection.reset();
+
   if (this->world && this->world->Running())
   {
     physics::ContactManager *mgr =
@@ -213,7 +179,6 @@ void ContactSensor::Fini()
     mgr->RemoveFilter(this->dataPtr->filterName);
   }
 
-  this->dataPtr->contactSub.reset();
   this->dataPtr->contactsPub.reset();
   Sensor::Fini();
 }
@@ -295,15 +260,19 @@ std::map<std::string, gazebo::physics::Contact> ContactSensor::Contacts(
 }
 
 //////////////////////////////////////////////////
-void ContactSensor::OnContacts(ConstContactsPtr &_msg)
+void ContactSensor::OnContacts(
+    const std::vector<const physics::Contact *> &_contacts)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
 
   // Only store information if the sensor is active
   if (this->IsActive())
   {
-    // Store the contacts message for processing in UpdateImpl
-    this->dataPtr->incomingContacts.push_back(_msg);
+    // Store the contacts for processing in UpdateImpl
+    this->dataPtr->incomingContacts.emplace_back();
+    msgs::Contacts &msg = this->dataPtr->incomingContacts.back();
+    for (auto const &contact : _contacts)
+      contact->FillMsg(*msg.add_contact());
 
     // Prevent the incomingContacts list to grow indefinitely.
     if (this->dataPtr->incomingContacts.size() > 100)
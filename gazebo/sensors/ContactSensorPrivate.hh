@@ -22,6 +22,7 @@
 #include <string>
 #include <mutex>
 
+#include "gazebo/common/Event.hh"
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/msgs/msgs.hh"
 
@@ -39,8 +40,8 @@ namespace gazebo
       /// \brief Output contact information.
       public: transport::PublisherPtr contactsPub;
 
-      /// \brief Subscription to contact messages from the physics engine
-      public: transport::SubscriberPtr contactSub;
+      /// \brief Connection to the contacts of the contact manager filter.
+      public: event::ConnectionPtr contactsConnection;
 
       /// \brief Mutex to protect reads and writes.
       public: mutable std::mutex mutex;
@@ -48,12 +49,9 @@ namespace gazebo
       /// \brief Contacts message used to output sensor data.
       public: msgs::Contacts contactsMsg;
 
-      /// \type ContactMsgs_L
-      /// List of contact messages
-      typedef std::list<boost::shared_ptr<msgs::Contacts const> > ContactMsgs_L;
-
-      /// \brief List of incoming messages.
-      public: ContactMsgs_L incomingContacts;
+      /// \brief Contacts of the steps since the last update, one message
+      /// per step.
+      public: std::list<msgs::Contacts> incomingContacts;
 
       /// \brief Name of filter used to filter contact messages.
       public: std::string filterName;
@@ -0,0 +1,628 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/Matrix3.hh>
+
+#include "gazebo/common/CommonIface.hh"
+#include "gazebo/common/Image.hh"
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshManager.hh"
+
+#include "gazebo/physics/Collision.hh"
+#include "gazebo/physics/Link.hh"
+#include "gazebo/physics/Model.hh"
+#include "gazebo/physics/PhysicsEngine.hh"
+#include "gazebo/physics/Shape.hh"
+#include "gazebo/physics/World.hh"
+
+#include "gazebo/transport/transport.hh"
+
+#include "gazebo/sensors/SensorFactory.hh"
+#include "gazebo/sensors/CpuDepthCameraSensorPrivate.hh"
+#include "gazebo/sensors/CpuDepthCameraSensor.hh"
+
+using namespace gazebo;
+using namespace sensors;
+
+GZ_REGISTER_STATIC_SENSOR("cpu_depth", CpuDepthCameraSensor)
+
+/// \brief Maximum number of instances in a leaf of the tree.
+static const unsigned int kMaxLeafInstances = 2;
+
+/// \brief Size of the traversal stack of the tree. The tree is split at
+/// the median, so its depth is far below this.
+static const unsigned int kStackSize = 64;
+
+//////////////////////////////////////////////////
+CpuDepthCameraSensor::CpuDepthCameraSensor()
+: Sensor(sensors::RAY),
+  dataPtr(new CpuDepthCameraSensorPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+CpuDepthCameraSensor::~CpuDepthCameraSensor()
+{
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCameraSensor::Load(const std::string &_worldName,
+                                sdf::ElementPtr _sdf)
+{
+  Sensor::Load(_worldName, _sdf);
+}
+
+//////////////////////////////////////////////////
+std::string CpuDepthCameraSensor::Topic() const
+{
+  // Same topic as the images of the other cameras
+  std::string topicName = "~/";
+  topicName += this->ParentName() + "/" + this->Name() + "/image";
+  common::replaceAll(topicName, topicName, "::", "/");
+
+  return topicName;
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCameraSensor::Load(const std::string &_worldName)
+{
+  Sensor::Load(_worldName);
+
+  this->dataPtr->parentLink = boost::dynamic_pointer_cast<physics::Link>(
+      this->world->EntityByName(this->ParentName()));
+  if (!this->dataPtr->parentLink)
+  {
+    gzerr << "CPU depth camera[" << this->Name()
+          << "] is not attached to a link" << std::endl;
+  }
+
+  if (this->sdf->HasElement("camera"))
+  {
+    sdf::ElementPtr cameraSdf = this->sdf->GetElement("camera");
+    this->dataPtr->hfov = cameraSdf->Get<double>("horizontal_fov");
+
+    sdf::ElementPtr imageElem = cameraSdf->GetElement("image");
+    this->dataPtr->width = std::max(imageElem->Get<int>("width"), 0);
+    this->dataPtr->height = std::max(imageElem->Get<int>("height"), 0);
+
+    sdf::ElementPtr clipElem = cameraSdf->GetElement("clip");
+    this->dataPtr->nearClip = clipElem->Get<double>("near");
+    this->dataPtr->farClip = clipElem->Get<double>("far");
+
+    if (cameraSdf->HasElement("pose"))
+    {
+      this->dataPtr->cameraPose =
+          cameraSdf->Get<ignition::math::Pose3d>("pose");
+    }
+  }
+  else
+  {
+    gzerr << "CPU depth camera[" << this->Name()
+          << "] has no <camera> element" << std::endl;
+  }
+
+  this->dataPtr->imagePub =
+      this->node->Advertise<msgs::ImageStamped>(this->Topic(), 50);
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCameraSensor::Init()
+{
+  auto &d = *this->dataPtr;
+  if (d.width == 0u || d.height == 0u)
+    gzerr << "image has zero size" << std::endl;
+
+  // Directions through the center of each pixel, on the plane one meter
+  // in front of the camera, so that the distance along a ray is the depth
+  const double tanH = std::tan(d.hfov * 0.5);
+  const double tanV = d.width > 0 ? tanH * d.height / d.width : 0;
+  d.rayDirs.resize(2 * d.width * d.height);
+  for (unsigned int v = 0; v < d.height; ++v)
+  {
+    for (unsigned int u = 0; u < d.width; ++u)
+    {
+      const unsigned int i = v * d.width + u;
+      d.rayDirs[2 * i] =
+          static_cast<float>(-(2.0 * (u + 0.5) / d.width - 1) * tanH);
+      d.rayDirs[2 * i + 1] =
+          static_cast<float>(-(2.0 * (v + 0.5) / d.height - 1) * tanV);
+    }
+  }
+
+  Sensor::Init();
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCameraSensor::Fini()
+{
+  this->dataPtr->imagePub.reset();
+  this->dataPtr->parentLink.reset();
+  this->dataPtr->instances.clear();
+  this->dataPtr->nodes.clear();
+  this->dataPtr->shapes.clear();
+  this->dataPtr->geometries.clear();
+  Sensor::Fini();
+}
+
+//////////////////////////////////////////////////
+bool CpuDepthCameraSensor::UpdateImpl(const bool /*_force*/)
+{
+  auto &d = *this->dataPtr;
+  if (!d.parentLink || d.width == 0u || d.height == 0u)
+    return false;
+
+  // Read the poses and shapes while physics is not stepping, then cast
+  // the rays without holding the lock
+  ignition::math::Pose3d cameraWorldPose;
+  {
+    boost::recursive_mutex::scoped_lock lock(
+        *this->world->Physics()->GetPhysicsUpdateMutex());
+    cameraWorldPose =
+        d.cameraPose + this->pose + d.parentLink->WorldPose();
+    ++d.updateCount;
+    d.instances.clear();
+    d.AddModels(this->world->Models());
+  }
+
+  for (auto iter = d.shapes.begin(); iter != d.shapes.end();)
+  {
+    if (iter->second.seen != d.updateCount)
+      iter = d.shapes.erase(iter);
+    else
+      ++iter;
+  }
+  for (auto iter = d.geometries.begin(); iter != d.geometries.end();)
+  {
+    if (iter->second.expired())
+      iter = d.geometries.erase(iter);
+    else
+      ++iter;
+  }
+  d.BuildTree();
+
+  const unsigned int width = d.width;
+  const unsigned int pixelCount = width * d.height;
+  d.depth.resize(pixelCount);
+  d.points.resize(3 * pixelCount);
+
+  // Axes of the camera in the world
+  const ignition::math::Matrix3d rot(cameraWorldPose.Rot());
+  float axes[3][3];
+  for (int a = 0; a < 3; ++a)
+  {
+    for (int c = 0; c < 3; ++c)
+      axes[c][a] = static_cast<float>(rot(a, c));
+  }
+  const float pos[3] = {
+      static_cast<float>(cameraWorldPose.Pos().X()),
+      static_cast<float>(cameraWorldPose.Pos().Y()),
+      static_cast<float>(cameraWorldPose.Pos().Z())};
+  const float nearClip = static_cast<float>(d.nearClip);
+  const float range = static_cast<float>(d.farClip - d.nearClip);
+  const unsigned int packetSize = common::RayPacket::kSize;
+
+  tbb::parallel_for(tbb::blocked_range<unsigned int>(0, d.height),
+      [&](const tbb::blocked_range<unsigned int> &_rows)
+  {
+    common::RayPacket packet;
+    for (unsigned int row = _rows.begin(); row != _rows.end(); ++row)
+    {
+      for (unsigned int col = 0; col < width; col += packetSize)
+      {
+        const unsigned int first = row * width + col;
+        packet.count = std::min(packetSize, width - col);
+        for (unsigned int i = 0; i < packet.count; ++i)
+        {
+          const float y = d.rayDirs[2 * (first + i)];
+          const float z = d.rayDirs[2 * (first + i) + 1];
+          for (int a = 0; a < 3; ++a)
+          {
+            packet.dir[a][i] = axes[0][a] + y * axes[1][a] + z * axes[2][a];
+            packet.origin[a][i] = pos[a] + nearClip * packet.dir[a][i];
+          }
+          packet.dist[i] = range;
+        }
+        packet.Prepare();
+        d.Intersect(packet);
+
+        for (unsigned int i = 0; i < packet.count; ++i)
+        {
+          const unsigned int p = first + i;
+          float *point = &d.points[3 * p];
+          if (packet.dist[i] < range)
+          {
+            const float depth = nearClip + packet.dist[i];
+            d.depth[p] = depth;
+            point[0] = depth;
+            point[1] = depth * d.rayDirs[2 * p];
+            point[2] = depth * d.rayDirs[2 * p + 1];
+          }
+          else
+          {
+            // Ranges beyond the far clip plane are +inf, as per REP 117
+            d.depth[p] = ignition::math::INF_F;
+            point[0] = point[1] = point[2] = ignition::math::NAN_F;
+          }
+        }
+      }
+    }
+  });
+
+  this->lastMeasurementTime = this->world->SimTime();
+
+  if (d.imagePub && d.imagePub->HasConnections())
+  {
+    msgs::ImageStamped msg;
+    msgs::Set(msg.mutable_time(), this->lastMeasurementTime);
+    msg.mutable_image()->set_width(d.width);
+    msg.mutable_image()->set_height(d.height);
+    msg.mutable_image()->set_pixel_format(common::Image::R_FLOAT32);
+    msg.mutable_image()->set_step(d.width * sizeof(float));
+    msg.mutable_image()->set_data(d.depth.data(),
+        pixelCount * sizeof(float));
+    d.imagePub->Publish(msg);
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+const float *CpuDepthCameraSensor::DepthData() const
+{
+  return this->dataPtr->depth.empty() ? nullptr :
+      this->dataPtr->depth.data();
+}
+
+//////////////////////////////////////////////////
+const float *CpuDepthCameraSensor::PointCloudData() const
+{
+  return this->dataPtr->points.empty() ? nullptr :
+      this->dataPtr->points.data();
+}
+
+//////////////////////////////////////////////////
+unsigned int CpuDepthCameraSensor::ImageWidth() const
+{
+  return this->dataPtr->width;
+}
+
+//////////////////////////////////////////////////
+unsigned int CpuDepthCameraSensor::ImageHeight() const
+{
+  return this->dataPtr->height;
+}
+
+//////////////////////////////////////////////////
+double CpuDepthCameraSensor::HFOV() const
+{
+  return this->dataPtr->hfov;
+}
+
+//////////////////////////////////////////////////
+double CpuDepthCameraSensor::NearClip() const
+{
+  return this->dataPtr->nearClip;
+}
+
+//////////////////////////////////////////////////
+double CpuDepthCameraSensor::FarClip() const
+{
+  return this->dataPtr->farClip;
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCameraSensorPrivate::AddModels(const physics::Model_V &_models)
+{
+  for (auto const &model : _models)
+  {
+    for (auto const &link : model->GetLinks())
+    {
+      for (auto const &collision : link->GetCollisions())
+      {
+        const common::TriangleBVH *bvh = this->Triangles(collision);
+        ignition::math::Vector3d min, max;
+        if (!bvh || !bvh->Bounds(min, max))
+          continue;
+
+        const ignition::math::Pose3d &pose = collision->WorldPose();
+        const ignition::math::Matrix3d rot(pose.Rot());
+        const ignition::math::Vector3d center =
+            pose.Pos() + pose.Rot().RotateVector((min + max) * 0.5);
+        const ignition::math::Vector3d half = (max - min) * 0.5;
+
+        CpuDepthInstance instance;
+        instance.bvh = bvh;
+        for (int a = 0; a < 3; ++a)
+        {
+          // The world to shape rotation is the transpose of rot
+          double extent = 0;
+          for (int c = 0; c < 3; ++c)
+          {
+            instance.rot[3 * a + c] = static_cast<float>(rot(c, a));
+            extent += std::abs(rot(a, c)) * half[c];
+          }
+          instance.pos[a] = static_cast<float>(pose.Pos()[a]);
+          instance.min[a] = static_cast<float>(center[a] - extent);
+          instance.max[a] = static_cast<float>(center[a] + extent);
+        }
+        this->instances.push_back(instance);
+      }
+    }
+
+    this->AddModels(model->NestedModels());
+  }
+}
+
+//////////////////////////////////////////////////
+const common::TriangleBVH *CpuDepthCameraSensorPrivate::Triangles(
+    const physics::CollisionPtr &_collision)
+{
+  CpuDepthShape &entry = this->shapes[_collision->GetId()];
+  entry.seen = this->updateCount;
+
+  physics::ShapePtr shape = _collision->GetShape();
+  if (!shape)
+    return nullptr;
+
+  if (entry.shape != shape || entry.scale != shape->Scale())
+  {
+    entry.shape = shape;
+    entry.scale = shape->Scale();
+    msgs::Geometry geom;
+    shape->FillMsg(geom);
+    entry.bvh = this->MakeTriangles(geom);
+  }
+
+  return entry.bvh.get();
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<common::TriangleBVH>
+CpuDepthCameraSensorPrivate::MakeTriangles(const msgs::Geometry &_geom)
+{
+  const std::string key = _geom.SerializeAsString();
+  auto iter = this->geometries.find(key);
+  if (iter != this->geometries.end())
+  {
+    std::shared_ptr<common::TriangleBVH> bvh = iter->second.lock();
+    if (bvh)
+      return bvh;
+  }
+
+  auto bvh = std::make_shared<common::TriangleBVH>();
+  common::MeshManager *meshManager = common::MeshManager::Instance();
+  switch (_geom.type())
+  {
+    case msgs::Geometry::BOX:
+    {
+      bvh->AddMesh(*meshManager->GetMesh("unit_box"),
+          msgs::ConvertIgn(_geom.box().size()));
+      break;
+    }
+    case msgs::Geometry::SPHERE:
+    {
+      const double diameter = 2 * _geom.sphere().radius();
+      bvh->AddMesh(*meshManager->GetMesh("unit_sphere"),
+          ignition::math::Vector3d(diameter, diameter, diameter));
+      break;
+    }
+    case msgs::Geometry::CYLINDER:
+    {
+      const double diameter = 2 * _geom.cylinder().radius();
+      bvh->AddMesh(*meshManager->GetMesh("unit_cylinder"),
+          ignition::math::Vector3d(diameter, diameter,
+            _geom.cylinder().length()));
+      break;
+    }
+    case msgs::Geometry::PLANE:
+    {
+      // Two triangles facing the normal, u x v being the normal
+      const ignition::math::Vector3d normal =
+          msgs::ConvertIgn(_geom.plane().normal()).Normalize();
+      const ignition::math::Vector2d size =
+          msgs::ConvertIgn(_geom.plane().size());
+      ignition::math::Vector3d u = normal.Perpendicular().Normalize();
+      ignition::math::Vector3d v = normal.Cross(u);
+      u *= size.X() * 0.5;
+      v *= size.Y() * 0.5;
+      bvh->AddTriangle(-u - v, u - v, u + v);
+      bvh->AddTriangle(-u - v, u + v, v - u);
+      break;
+    }
+    case msgs::Geometry::MESH:
+    {
+      const std::string &filename = _geom.mesh().filename();
+      const common::Mesh *mesh = meshManager->GetMesh(filename);
+      if (!mesh)
+        mesh = meshManager->GetMesh(common::find_file(filename));
+      if (!mesh)
+      {
+        gzerr << "Mesh[" << filename << "] is not loaded" << std::endl;
+        return nullptr;
+      }
+
+      const ignition::math::Vector3d scale =
+          msgs::ConvertIgn(_geom.mesh().scale());
+      if (_geom.mesh().has_submesh() && !_geom.mesh().submesh().empty())
+      {
+        const common::SubMesh *subMesh =
+            mesh->GetSubMesh(_geom.mesh().submesh());
+        if (!subMesh)
+        {
+          gzerr << "Mesh[" << filename << "] has no submesh["
+                << _geom.mesh().submesh() << "]" << std::endl;
+          return nullptr;
+        }
+
+        if (_geom.mesh().center_submesh())
+        {
+          common::SubMesh centered(subMesh);
+          centered.Center(ignition::math::Vector3d::Zero);
+          bvh->AddSubMesh(centered, scale);
+        }
+        else
+          bvh->AddSubMesh(*subMesh, scale);
+      }
+      else
+        bvh->AddMesh(*mesh, scale);
+      break;
+    }
+    default:
+    {
+      gzwarn << "Shapes of type["
+             << msgs::ConvertGeometryType(_geom.type())
+             << "] are not seen by CPU depth cameras" << std::endl;
+      return nullptr;
+    }
+  }
+
+  bvh->Build();
+  this->geometries[key] = bvh;
+  return bvh;
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCameraSensorPrivate::BuildTree()
+{
+  this->nodes.clear();
+  const unsigned int count = static_cast<unsigned int>(
+      this->instances.size());
+  if (count == 0)
+    return;
+
+  struct Task
+  {
+    unsigned int node;
+    unsigned int begin;
+    unsigned int end;
+  };
+
+  this->nodes.reserve(2 * count);
+  this->nodes.emplace_back();
+  std::vector<Task> tasks;
+  tasks.push_back({0, 0, count});
+
+  while (!tasks.empty())
+  {
+    const Task task = tasks.back();
+    tasks.pop_back();
+
+    CpuDepthNode &node = this->nodes[task.node];
+    std::fill(node.min, node.min + 3, FLT_MAX);
+    std::fill(node.max, node.max + 3, -FLT_MAX);
+    for (unsigned int i = task.begin; i < task.end; ++i)
+    {
+      for (int a = 0; a < 3; ++a)
+      {
+        node.min[a] = std::min(node.min[a], this->instances[i].min[a]);
+        node.max[a] = std::max(node.max[a], this->instances[i].max[a]);
+      }
+    }
+    node.first = task.begin;
+    node.count = task.end - task.begin;
+    if (node.count <= kMaxLeafInstances)
+      continue;
+
+    // Split at the median of the longest axis
+    int axis = 0;
+    for (int a = 1; a < 3; ++a)
+    {
+      if (node.max[a] - node.min[a] > node.max[axis] - node.min[axis])
+        axis = a;
+    }
+    const unsigned int mid = task.begin + node.count / 2;
+    std::nth_element(this->instances.begin() + task.begin,
+        this->instances.begin() + mid, this->instances.begin() + task.end,
+        [axis](const CpuDepthInstance &_a, const CpuDepthInstance &_b)
+        {
+          return _a.min[axis] + _a.max[axis] < _b.min[axis] + _b.max[axis];
+        });
+
+    node.first = static_cast<unsigned int>(this->nodes.size());
+    node.count = 0;
+    const unsigned int child = node.first;
+    this->nodes.emplace_back();
+    this->nodes.emplace_back();
+    tasks.push_back({child + 1, mid, task.end});
+    tasks.push_back({child, task.begin, mid});
+  }
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCameraSensorPrivate::Intersect(
+    common::RayPacket &_packet) const
+{
+  if (this->nodes.empty())
+    return;
+
+  const unsigned int size = common::RayPacket::kSize;
+  unsigned int stack[kStackSize];
+  unsigned int top = 0;
+  stack[top++] = 0;
+  while (top > 0)
+  {
+    const CpuDepthNode &node = this->nodes[stack[--top]];
+    if (!_packet.HitsBox(node.min, node.max))
+      continue;
+
+    if (node.count == 0)
+    {
+      stack[top++] = node.first + 1;
+      stack[top++] = node.first;
+      continue;
+    }
+
+    for (unsigned int n = node.first; n < node.first + node.count; ++n)
+    {
+      const CpuDepthInstance &instance = this->instances[n];
+      if (!_packet.HitsBox(instance.min, instance.max))
+        continue;
+
+      // Move the rays into the frame of the shape. Rotations keep the
+      // length of the directions, so distances are unchanged.
+      common::RayPacket local;
+      local.count = _packet.count;
+      for (unsigned int i = 0; i < size; ++i)
+      {
+        const float o[3] = {
+            _packet.origin[0][i] - instance.pos[0],
+            _packet.origin[1][i] - instance.pos[1],
+            _packet.origin[2][i] - instance.pos[2]};
+        for (int a = 0; a < 3; ++a)
+        {
+          const float *row = &instance.rot[3 * a];
+          local.origin[a][i] = row[0] * o[0] + row[1] * o[1] + row[2] * o[2];
+          local.dir[a][i] = row[0] * _packet.dir[0][i] +
+              row[1] * _packet.dir[1][i] + row[2] * _packet.dir[2][i];
+        }
+        local.dist[i] = _packet.dist[i];
+      }
+      local.Prepare();
+      instance.bvh->Intersect(local);
+
+      for (unsigned int i = 0; i < _packet.count; ++i)
+        _packet.dist[i] = local.dist[i];
+    }
+  }
+}
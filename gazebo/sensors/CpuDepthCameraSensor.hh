@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_SENSORS_CPUDEPTHCAMERASENSOR_HH_
+#define GAZEBO_SENSORS_CPUDEPTHCAMERASENSOR_HH_
+
+#include <memory>
+#include <string>
+
+#include <sdf/sdf.hh>
+
+#include "gazebo/sensors/Sensor.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace sensors
+  {
+    // Forward declare private data class
+    class CpuDepthCameraSensorPrivate;
+
+    /// \addtogroup gazebo_sensors
+    /// \{
+
+    /// \class CpuDepthCameraSensor CpuDepthCameraSensor.hh sensors/sensors.hh
+    /// \brief Depth camera computed on the CPU, without a render engine.
+    ///
+    /// The sensor is selected with the "cpu_depth" sensor type, and reads
+    /// the same <camera> element as the "depth" sensor. Instead of
+    /// rendering the visuals, it casts one ray per pixel against the
+    /// collision shapes of the world, using a TriangleBVH per shape and
+    /// packets of rays spread over several threads. It publishes the
+    /// same depth images as DepthCameraSensor, on the same topic.
+    ///
+    /// Boxes, spheres, cylinders, planes and meshes are seen. Faces are
+    /// only seen from outside, so the shapes of the link the camera is
+    /// attached to do not hide the view when the camera is inside them.
+    class GZ_SENSORS_VISIBLE CpuDepthCameraSensor : public Sensor
+    {
+      /// \brief Constructor
+      public: CpuDepthCameraSensor();
+
+      /// \brief Destructor
+      public: virtual ~CpuDepthCameraSensor();
+
+      // Documentation inherited
+      public: virtual void Load(const std::string &_worldName,
+                                sdf::ElementPtr _sdf);
+
+      // Documentation inherited
+      public: virtual void Load(const std::string &_worldName);
+
+      // Documentation inherited
+      public: virtual void Init();
+
+      // Documentation inherited
+      public: virtual void Fini();
+
+      // Documentation inherited
+      public: virtual std::string Topic() const;
+
+      /// \brief Get the depth of each pixel, row by row. Depths beyond
+      /// the far clip plane are infinite.
+      /// \return The depths, null before the first update.
+      public: const float *DepthData() const;
+
+      /// \brief Get the point seen by each pixel in the frame of the
+      /// camera, row by row, as x, y and z. Pixels which see nothing up
+      /// to the far clip plane are NaN.
+      /// \return The points, null before the first update.
+      public: const float *PointCloudData() const;
+
+      /// \brief Get the width of the image.
+      /// \return Width in pixels.
+      public: unsigned int ImageWidth() const;
+
+      /// \brief Get the height of the image.
+      /// \return Height in pixels.
+      public: unsigned int ImageHeight() const;
+
+      /// \brief Get the horizontal field of view.
+      /// \return Field of view in radians.
+      public: double HFOV() const;
+
+      /// \brief Get the near clip distance.
+      /// \return Near clip distance.
+      public: double NearClip() const;
+
+      /// \brief Get the far clip distance.
+      /// \return Far clip distance.
+      public: double FarClip() const;
+
+      // Documentation inherited
+      protected: virtual bool UpdateImpl(const bool _force);
+
+      /// \internal
+      /// \brief Private data pointer
+      private: std::unique_ptr<CpuDepthCameraSensorPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_SENSORS_CPUDEPTHCAMERASENSOR_PRIVATE_HH_
+#define GAZEBO_SENSORS_CPUDEPTHCAMERASENSOR_PRIVATE_HH_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/common/TriangleBVH.hh"
+#include "gazebo/msgs/msgs.hh"
+#include "gazebo/physics/PhysicsTypes.hh"
+#include "gazebo/transport/TransportTypes.hh"
+
+namespace gazebo
+{
+  namespace sensors
+  {
+    /// \internal
+    /// \brief Triangles of a collision shape, in the frame of the shape.
+    class CpuDepthShape
+    {
+      /// \brief Shape the triangles were made from.
+      public: physics::ShapePtr shape;
+
+      /// \brief Scale of the shape when the triangles were made.
+      public: ignition::math::Vector3d scale;
+
+      /// \brief The triangles, null if the shape is not seen.
+      public: std::shared_ptr<common::TriangleBVH> bvh;
+
+      /// \brief Last update in which the collision was found.
+      public: unsigned int seen = 0;
+    };
+
+    /// \internal
+    /// \brief A shape placed in the world, for one update.
+    class CpuDepthInstance
+    {
+      /// \brief Rotation from the world to the frame of the shape, row
+      /// by row.
+      public: float rot[9];
+
+      /// \brief Position of the shape in the world.
+      public: float pos[3];
+
+      /// \brief Minimum corner of the box of the shape in the world.
+      public: float min[3];
+
+      /// \brief Maximum corner of the box of the shape in the world.
+      public: float max[3];
+
+      /// \brief The triangles.
+      public: const common::TriangleBVH *bvh = nullptr;
+    };
+
+    /// \internal
+    /// \brief Node of the tree of instances, laid out as the nodes of
+    /// common::TriangleBVH.
+    class CpuDepthNode
+    {
+      /// \brief Minimum corner of the box of the node.
+      public: float min[3];
+
+      /// \brief Maximum corner of the box of the node.
+      public: float max[3];
+
+      /// \brief First instance of a leaf, or first child of an inner
+      /// node. The second child follows the first.
+      public: unsigned int first = 0;
+
+      /// \brief Number of instances of a leaf, zero for an inner node.
+      public: unsigned int count = 0;
+    };
+
+    /// \internal
+    /// \brief CPU depth camera sensor private data.
+    class CpuDepthCameraSensorPrivate
+    {
+      /// \brief Gather the collision shapes of the world.
+      /// \param[in] _models Models to add, with their nested models.
+      public: void AddModels(const physics::Model_V &_models);
+
+      /// \brief Get the triangles of a collision, made the first time the
+      /// collision is seen and when its scale changes.
+      /// \param[in] _collision The collision.
+      /// \return The triangles, null if the shape is not seen.
+      public: const common::TriangleBVH *Triangles(
+                  const physics::CollisionPtr &_collision);
+
+      /// \brief Make the triangles of a shape. Shapes with the same
+      /// geometry share their triangles.
+      /// \param[in] _geom Geometry of the shape.
+      /// \return The triangles, null if the shape is not seen.
+      public: std::shared_ptr<common::TriangleBVH> MakeTriangles(
+                  const msgs::Geometry &_geom);
+
+      /// \brief Sort the instances into a tree.
+      public: void BuildTree();
+
+      /// \brief Cast the rays of a packet against the instances.
+      /// \param[in,out] _packet Rays, in the world, prepared.
+      public: void Intersect(common::RayPacket &_packet) const;
+
+      /// \brief Publisher of the depth images.
+      public: transport::PublisherPtr imagePub;
+
+      /// \brief Link the camera is attached to.
+      public: physics::LinkPtr parentLink;
+
+      /// \brief Pose of the camera relative to the sensor.
+      public: ignition::math::Pose3d cameraPose;
+
+      /// \brief Image width.
+      public: unsigned int width = 0;
+
+      /// \brief Image height.
+      public: unsigned int height = 0;
+
+      /// \brief Horizontal field of view in radians.
+      public: double hfov = 1.047;
+
+      /// \brief Near clip distance.
+      public: double nearClip = 0.1;
+
+      /// \brief Far clip distance.
+      public: double farClip = 100;
+
+      /// \brief Direction of the ray of each pixel in the frame of the
+      /// camera, as y and z, x being 1.
+      public: std::vector<float> rayDirs;
+
+      /// \brief Depth of each pixel.
+      public: std::vector<float> depth;
+
+      /// \brief Point seen by each pixel, as x, y and z.
+      public: std::vector<float> points;
+
+      /// \brief Number of updates, used to forget removed collisions.
+      public: unsigned int updateCount = 0;
+
+      /// \brief Triangles of each collision, by collision id.
+      public: std::map<uint32_t, CpuDepthShape> shapes;
+
+      /// \brief Triangles of each geometry, by serialized geometry
+      /// message.
+      public: std::map<std::string, std::weak_ptr<common::TriangleBVH>>
+                  geometries;
+
+      /// \brief Shapes placed in the world for the current update.
+      public: std::vector<CpuDepthInstance> instances;
+
+      /// \brief Tree of the instances.
+      public: std::vector<CpuDepthNode> nodes;
+    };
+  }
+}
+#endif
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/sensors/CpuDepthCameraSensor.hh"
+
+using namespace gazebo;
+
+class CpuDepthCameraSensor_TEST : public ServerFixture
+{
+};
+
+// A camera one meter above the ground, looking down
+static std::string cpuDepthSensorString =
+"<sdf version='1.6'>"
+"  <sensor name='cpu_depth' type='cpu_depth'>"
+"    <always_on>1</always_on>"
+"    <update_rate>10</update_rate>"
+"    <pose>0 0 1 0 1.5707963 0</pose>"
+"    <camera>"
+"      <horizontal_fov>1.0</horizontal_fov>"
+"      <image>"
+"        <width>64</width>"
+"        <height>48</height>"
+"      </image>"
+"      <clip>"
+"        <near>0.1</near>"
+"        <far>10</far>"
+"      </clip>"
+"    </camera>"
+"  </sensor>"
+"</sdf>";
+
+/////////////////////////////////////////////////
+TEST_F(CpuDepthCameraSensor_TEST, GroundAndBox)
+{
+  Load("worlds/empty.world", true);
+  sensors::SensorManager *mgr = sensors::SensorManager::Instance();
+
+  sdf::ElementPtr sdf(new sdf::Element);
+  sdf::initFile("sensor.sdf", sdf);
+  sdf::readString(cpuDepthSensorString, sdf);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+  physics::ModelPtr model = world->ModelByName("ground_plane");
+  ASSERT_TRUE(model != nullptr);
+  physics::LinkPtr link = model->GetLink("link");
+  ASSERT_TRUE(link != nullptr);
+
+  std::string sensorName = mgr->CreateSensor(sdf, "default",
+      "ground_plane::link", link->GetId());
+  EXPECT_EQ(std::string("default::ground_plane::link::cpu_depth"),
+      sensorName);
+  mgr->Update();
+
+  sensors::CpuDepthCameraSensorPtr sensor =
+      std::dynamic_pointer_cast<sensors::CpuDepthCameraSensor>(
+      mgr->GetSensor(sensorName));
+  ASSERT_TRUE(sensor != nullptr);
+  EXPECT_EQ(64u, sensor->ImageWidth());
+  EXPECT_EQ(48u, sensor->ImageHeight());
+  EXPECT_DOUBLE_EQ(1.0, sensor->HFOV());
+  EXPECT_DOUBLE_EQ(0.1, sensor->NearClip());
+  EXPECT_DOUBLE_EQ(10.0, sensor->FarClip());
+  EXPECT_EQ(std::string("~/ground_plane/link/cpu_depth/image"),
+      sensor->Topic());
+
+  // The ground is perpendicular to the view, so every pixel is at the
+  // same depth
+  sensor->Update(true);
+  const float *depth = sensor->DepthData();
+  const float *points = sensor->PointCloudData();
+  ASSERT_TRUE(depth != nullptr);
+  ASSERT_TRUE(points != nullptr);
+  const unsigned int width = sensor->ImageWidth();
+  const unsigned int height = sensor->ImageHeight();
+  for (unsigned int i = 0; i < width * height; ++i)
+  {
+    EXPECT_NEAR(1.0, depth[i], 1e-4);
+    EXPECT_NEAR(1.0, points[3 * i], 1e-4);
+  }
+
+  // The top left pixel sees left and up
+  EXPECT_GT(points[1], 0.0);
+  EXPECT_GT(points[2], 0.0);
+
+  // A box under the camera, its top half a meter below
+  SpawnBox("box", ignition::math::Vector3d(0.5, 0.5, 0.5),
+      ignition::math::Vector3d(0, 0, 0.25));
+  sensor->Update(true);
+  depth = sensor->DepthData();
+  const unsigned int center = (height / 2) * width + width / 2;
+  EXPECT_NEAR(0.5, depth[center], 1e-4);
+  EXPECT_NEAR(1.0, depth[0], 1e-4);
+
+  // Looking up, nothing is seen
+  sensor->SetPose(ignition::math::Pose3d(0, 0, 1, 0, -1.5707963, 0));
+  sensor->Update(true);
+  depth = sensor->DepthData();
+  points = sensor->PointCloudData();
+  for (unsigned int i = 0; i < width * height; ++i)
+  {
+    EXPECT_TRUE(std::isinf(depth[i]));
+    EXPECT_TRUE(std::isnan(points[3 * i]));
+  }
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
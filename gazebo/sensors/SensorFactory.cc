@@ -27,6 +27,7 @@
 void RegisterAltimeterSensor();
 void RegisterCameraSensor();
 void RegisterContactSensor();
+void RegisterCpuDepthCameraSensor();
 void RegisterDepthCameraSensor();
 void RegisterForceTorqueSensor();
 void RegisterGpsSensor();
@@ -56,6 +57,7 @@ void SensorFactory::RegisterAll()
   RegisterAltimeterSensor();
   RegisterCameraSensor();
   RegisterContactSensor();
+  RegisterCpuDepthCameraSensor();
   RegisterDepthCameraSensor();
   RegisterForceTorqueSensor();
   RegisterGpsSensor();
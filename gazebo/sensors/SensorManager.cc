@@ -18,6 +18,7 @@
 #include <boost/bind.hpp>
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Time.hh"
+#include "gazebo/common/Trace.hh"
 
 #include "gazebo/physics/PhysicsIface.hh"
 #include "gazebo/physics/PhysicsEngine.hh"
@@ -546,6 +547,8 @@ bool SensorManager::SensorContainer::Running() const
 //////////////////////////////////////////////////
 void SensorManager::SensorContainer::RunLoop()
 {
+  common::Trace::SetThreadName("sensors");
+
   this->stop = false;
 
   physics::WorldPtr world = physics::get_world();
@@ -656,6 +659,8 @@ void SensorManager::SensorContainer::RunLoop()
 //////////////////////////////////////////////////
 void SensorManager::SensorContainer::Update(bool _force)
 {
+  GZ_TRACE_SCOPE("SensorManager::SensorContainer::Update");
+
   boost::recursive_mutex::scoped_lock lock(this->mutex);
 
   if (this->sensors.empty())
@@ -775,6 +780,8 @@ void SensorManager::SensorContainer::RemoveSensors()
 //////////////////////////////////////////////////
 void SensorManager::ImageSensorContainer::Update(bool _force)
 {
+  GZ_TRACE_SCOPE("SensorManager::ImageSensorContainer::Update");
+
   // Prerender phase
   event::Events::preRender();
 
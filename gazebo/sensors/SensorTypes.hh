@@ -39,6 +39,7 @@ namespace gazebo
     class MagnetometerSensor;
     class MultiCameraSensor;
     class DepthCameraSensor;
+    class CpuDepthCameraSensor;
     class ContactSensor;
     class ImuSensor;
     class GpuRaySensor;
@@ -83,6 +84,10 @@ namespace gazebo
     /// \brief Shared pointer to DepthCameraSensor
     typedef std::shared_ptr<DepthCameraSensor> DepthCameraSensorPtr;
 
+    /// \def CpuDepthCameraSensorPtr
+    /// \brief Shared pointer to CpuDepthCameraSensor
+    typedef std::shared_ptr<CpuDepthCameraSensor> CpuDepthCameraSensorPtr;
+
     /// \def WideAngleCameraSensorPtr
     /// \brief Shared pointer to WideAngleCameraSensor
     typedef std::shared_ptr<WideAngleCameraSensor> WideAngleCameraSensorPtr;
@@ -167,6 +172,10 @@ namespace gazebo
     /// \brief Vector of DepthCameraSensor shared pointers
     typedef std::vector<DepthCameraSensorPtr> DepthCameraSensor_V;
 
+    /// \def CpuDepthCameraSensor_V
+    /// \brief Vector of CpuDepthCameraSensor shared pointers
+    typedef std::vector<CpuDepthCameraSensorPtr> CpuDepthCameraSensor_V;
+
     /// \def ContactSensor_V
     /// \brief Vector of ContactSensor shared pointers
     typedef std::vector<ContactSensorPtr> ContactSensor_V;
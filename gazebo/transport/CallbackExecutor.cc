@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gazebo/common/Trace.hh"
+#include "gazebo/transport/Node.hh"
+#include "gazebo/transport/CallbackExecutor.hh"
+
+namespace gazebo
+{
+namespace transport
+{
+/////////////////////////////////////////////////
+class CallbackExecutorPrivate
+{
+  /// \brief Protects all members but the threads.
+  public: mutable std::mutex mutex;
+
+  /// \brief Signaled when a node is queued or the executor stops.
+  public: std::condition_variable queuedCond;
+
+  /// \brief Signaled when a node was processed.
+  public: std::condition_variable doneCond;
+
+  /// \brief Nodes waiting for a thread, in scheduling order.
+  public: std::deque<NodePtr> queue;
+
+  /// \brief Nodes in the queue or being processed.
+  public: std::set<NodePtr> scheduled;
+
+  /// \brief Nodes being processed.
+  public: std::set<NodePtr> running;
+
+  /// \brief Nodes scheduled again while being processed.
+  public: std::set<NodePtr> rescheduled;
+
+  /// \brief True once the threads must exit.
+  public: bool stop = false;
+
+  /// \brief The threads.
+  public: std::vector<std::thread> threads;
+};
+
+/////////////////////////////////////////////////
+CallbackExecutor::CallbackExecutor(const unsigned int _threads)
+  : dataPtr(new CallbackExecutorPrivate)
+{
+  for (unsigned int i = 0; i < std::max(1u, _threads); ++i)
+    this->dataPtr->threads.emplace_back(&CallbackExecutor::Run, this);
+}
+
+/////////////////////////////////////////////////
+CallbackExecutor::~CallbackExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->stop = true;
+  }
+  this->dataPtr->queuedCond.notify_all();
+  this->dataPtr->doneCond.notify_all();
+
+  for (auto &thread : this->dataPtr->threads)
+    thread.join();
+}
+
+/////////////////////////////////////////////////
+void CallbackExecutor::Schedule(const NodePtr &_node)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    if (this->dataPtr->running.count(_node))
+    {
+      // Queued again once processed, so that a node never runs on two
+      // threads at once and its messages stay in order.
+      this->dataPtr->rescheduled.insert(_node);
+      return;
+    }
+    if (!this->dataPtr->scheduled.insert(_node).second)
+      return;
+    this->dataPtr->queue.push_back(_node);
+  }
+  this->dataPtr->queuedCond.notify_one();
+}
+
+/////////////////////////////////////////////////
+void CallbackExecutor::Wait()
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->doneCond.wait(lock, [this]
+      {
+        return this->dataPtr->stop || this->dataPtr->scheduled.empty();
+      });
+}
+
+/////////////////////////////////////////////////
+unsigned int CallbackExecutor::ThreadCount() const
+{
+  return this->dataPtr->threads.size();
+}
+
+/////////////////////////////////////////////////
+unsigned int CallbackExecutor::QueuedNodeCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->queue.size();
+}
+
+/////////////////////////////////////////////////
+void CallbackExecutor::Run()
+{
+  common::Trace::SetThreadName("transport callbacks");
+
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  while (true)
+  {
+    this->dataPtr->queuedCond.wait(lock, [this]
+        {
+          return this->dataPtr->stop || !this->dataPtr->queue.empty();
+        });
+    if (this->dataPtr->stop)
+      break;
+
+    NodePtr node = this->dataPtr->queue.front();
+    this->dataPtr->queue.pop_front();
+    this->dataPtr->running.insert(node);
+
+    lock.unlock();
+    node->ProcessIncoming();
+    lock.lock();
+
+    this->dataPtr->running.erase(node);
+    if (this->dataPtr->rescheduled.erase(node))
+    {
+      // Queue the node again behind the others, so that a busy node does
+      // not hold a thread.
+      this->dataPtr->queue.push_back(node);
+      this->dataPtr->queuedCond.notify_one();
+    }
+    else
+    {
+      this->dataPtr->scheduled.erase(node);
+      this->dataPtr->doneCond.notify_all();
+    }
+  }
+}
+}
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_TRANSPORT_CALLBACKEXECUTOR_HH_
+#define GAZEBO_TRANSPORT_CALLBACKEXECUTOR_HH_
+
+#include <memory>
+
+#include "gazebo/transport/TransportTypes.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace transport
+  {
+    // Forward declare private data class
+    class CallbackExecutorPrivate;
+
+    /// \addtogroup gazebo_transport
+    /// \{
+
+    /// \class CallbackExecutor CallbackExecutor.hh transport/transport.hh
+    /// \brief Pool of threads that run the subscriber callbacks of nodes.
+    ///
+    /// Each node is processed by a single thread at a time, so the
+    /// callbacks of a node keep the order in which messages arrived, while
+    /// different nodes are processed in parallel. A node scheduled while it
+    /// is being processed is queued again once done, so no message is left
+    /// waiting.
+    ///
+    /// TopicManager uses an executor when the
+    /// GAZEBO_TRANSPORT_CALLBACK_THREADS environment variable is greater
+    /// than zero. Otherwise all callbacks run on the ConnectionManager
+    /// thread.
+    class GZ_TRANSPORT_VISIBLE CallbackExecutor
+    {
+      /// \brief Constructor. Starts the threads.
+      /// \param[in] _threads Number of threads, at least one.
+      public: explicit CallbackExecutor(const unsigned int _threads);
+
+      /// \brief Destructor. Stops the threads, nodes that were not
+      /// processed yet are dropped.
+      public: ~CallbackExecutor();
+
+      /// \brief Schedule the incoming messages of a node to be processed.
+      /// \param[in] _node The node.
+      public: void Schedule(const NodePtr &_node);
+
+      /// \brief Wait until every scheduled node was processed.
+      public: void Wait();
+
+      /// \brief Get the number of threads.
+      /// \return Number of threads.
+      public: unsigned int ThreadCount() const;
+
+      /// \brief Get the number of nodes waiting for a thread.
+      /// \return Number of nodes.
+      public: unsigned int QueuedNodeCount() const;
+
+      /// \brief Process scheduled nodes until stopped.
+      private: void Run();
+
+      /// \internal
+      /// \brief Private data pointer
+      private: std::unique_ptr<CallbackExecutorPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
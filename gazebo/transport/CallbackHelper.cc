@@ -58,3 +58,15 @@ unsigned int CallbackHelper::GetId() const
 {
   return this->id;
 }
+
+/////////////////////////////////////////////////
+QueuePolicy CallbackHelper::GetQueuePolicy() const
+{
+  return this->queuePolicy;
+}
+
+/////////////////////////////////////////////////
+void CallbackHelper::SetQueuePolicy(const QueuePolicy &_policy)
+{
+  this->queuePolicy = _policy;
+}
@@ -29,6 +29,7 @@
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/common/Exception.hh"
 
+#include "gazebo/transport/QueuePolicy.hh"
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/util/system.hh"
 
@@ -87,6 +88,16 @@ namespace gazebo
       /// \return The unique ID of this callback.
       public: unsigned int GetId() const;
 
+      /// \brief Get how incoming messages are queued for this callback.
+      /// \return The queue policy.
+      public: QueuePolicy GetQueuePolicy() const;
+
+      /// \brief Set how incoming messages are queued for this callback.
+      /// This function should only be used by the Transport library, before
+      /// the callback is added to a node.
+      /// \param[in] _policy The queue policy.
+      public: void SetQueuePolicy(const QueuePolicy &_policy);
+
       /// \brief True means that the callback helper will get the last
       /// published message on the topic.
       protected: bool latching;
@@ -99,6 +110,9 @@ namespace gazebo
 
       /// \brief The unique id of this callback.
       private: unsigned int id;
+
+      /// \brief How incoming messages are queued for this callback.
+      private: QueuePolicy queuePolicy;
     };
 
     /// \brief boost shared pointer to transport::CallbackHelper
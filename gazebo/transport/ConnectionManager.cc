@@ -14,11 +14,15 @@
  * limitations under the License.
  *
 */
+#include <cstdlib>
+#include <sstream>
+
 #include <boost/bind.hpp>
 
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Events.hh"
+#include "gazebo/common/Trace.hh"
 #include "gazebo/transport/TopicManager.hh"
 #include "gazebo/transport/ConnectionManager.hh"
 
@@ -61,6 +65,7 @@ ConnectionManager::ConnectionManager()
 {
   this->tmpIndex = 0;
   this->initialized = false;
+  this->discoveryInterest = false;
   this->stop = false;
   this->stopped = true;
 
@@ -191,6 +196,26 @@ bool ConnectionManager::Init(const std::string &_masterHost,
 
   this->initialized = true;
 
+  // Publisher announcements can be batched for this client
+  this->masterConn->EnqueueMsg(
+      msgs::Package("announcement_batching", msgs::Empty()));
+
+  char *discoveryEnv = getenv("GAZEBO_DISCOVERY_NAMESPACES");
+  if (discoveryEnv && !this->discoveryInterest)
+  {
+    std::vector<std::string> interest;
+    std::istringstream stream(discoveryEnv);
+    std::string ns;
+    while (std::getline(stream, ns, ':'))
+    {
+      if (!ns.empty())
+        interest.push_back(ns);
+    }
+    this->SetDiscoveryInterest(interest);
+  }
+  else if (this->discoveryInterest)
+    this->SetDiscoveryInterest(this->discoveryNamespaces);
+
   // Tell the user what address will be publicized to other nodes.
   gzmsg << "Publicized address: "
         << this->masterConn->GetLocalHostname() << std::endl;
@@ -251,6 +276,8 @@ void ConnectionManager::Stop()
 //////////////////////////////////////////////////
 void ConnectionManager::RunUpdate()
 {
+  GZ_TRACE_SCOPE("ConnectionManager::RunUpdate");
+
   std::list<ConnectionPtr>::iterator iter;
   std::list<ConnectionPtr>::iterator endIter;
 
@@ -301,6 +328,8 @@ void ConnectionManager::RunUpdate()
 //////////////////////////////////////////////////
 void ConnectionManager::Run()
 {
+  common::Trace::SetThreadName("transport");
+
   boost::mutex::scoped_lock lock(this->updateMutex);
 
   this->stopped = false;
@@ -349,7 +378,44 @@ void ConnectionManager::ProcessMessage(const std::string &_data)
   msgs::Packet packet;
   packet.ParseFromString(_data);
 
-  if (packet.type() == "publisher_add")
+  if (packet.type() == "publishers_add")
+  {
+    msgs::Publishers result;
+    result.ParseFromString(packet.serialized_data());
+
+    boost::recursive_mutex::scoped_lock lock(this->listMutex);
+    for (int i = 0; i < result.publisher_size(); ++i)
+      this->publishers.push_back(result.publisher(i));
+  }
+  else if (packet.type() == "publishers_del")
+  {
+    msgs::Publishers result;
+    result.ParseFromString(packet.serialized_data());
+
+    boost::recursive_mutex::scoped_lock lock(this->listMutex);
+    for (int i = 0; i < result.publisher_size(); ++i)
+    {
+      const msgs::Publish &pub = result.publisher(i);
+      this->publishers.remove_if([&pub](const msgs::Publish &_p)
+          {
+            return _p.topic() == pub.topic() && _p.host() == pub.host() &&
+                   _p.port() == pub.port();
+          });
+    }
+  }
+  // The master sends a new list of publishers when the discovery interest
+  // changes
+  else if (packet.type() == "publishers_init")
+  {
+    msgs::Publishers result;
+    result.ParseFromString(packet.serialized_data());
+
+    boost::recursive_mutex::scoped_lock lock(this->listMutex);
+    this->publishers.clear();
+    for (int i = 0; i < result.publisher_size(); ++i)
+      this->publishers.push_back(result.publisher(i));
+  }
+  else if (packet.type() == "publisher_add")
   {
     msgs::Publish result;
     result.ParseFromString(packet.serialized_data());
@@ -567,6 +633,23 @@ void ConnectionManager::GetTopicNamespaces(std::list<std::string> &_namespaces)
   }
 }
 
+//////////////////////////////////////////////////
+void ConnectionManager::SetDiscoveryInterest(
+    const std::vector<std::string> &_namespaces)
+{
+  this->discoveryInterest = true;
+  this->discoveryNamespaces = _namespaces;
+
+  // Sent again by Init otherwise
+  if (!this->initialized)
+    return;
+
+  msgs::GzString_V msg;
+  for (auto const &ns : _namespaces)
+    msg.add_data(ns);
+  this->masterConn->EnqueueMsg(msgs::Package("discovery_interest", msg));
+}
+
 //////////////////////////////////////////////////
 void ConnectionManager::Unsubscribe(const msgs::Subscribe &_sub)
 {
@@ -125,6 +125,16 @@ namespace gazebo
       /// \param[out] _namespaces The list of namespace is written here
       public: void GetTopicNamespaces(std::list<std::string> &_namespaces);
 
+      /// \brief Ask the master to only announce the publishers in the given
+      /// topic namespaces, and on the topics subscribed to. By default every
+      /// publisher is announced. GetAllPublishers only lists the announced
+      /// publishers. The GAZEBO_DISCOVERY_NAMESPACES environment variable
+      /// sets the initial interest, as a colon separated list.
+      /// \param[in] _namespaces World names or topic name prefixes, such as
+      /// "default" or "/gazebo/default/pioneer".
+      public: void SetDiscoveryInterest(
+                  const std::vector<std::string> &_namespaces);
+
       /// \brief Find a connection that matches a host and port
       /// \param[in] _host The host of the connection
       /// \param[in] _port The port of the connection
@@ -189,6 +199,13 @@ namespace gazebo
 
       private: std::list<msgs::Publish> publishers;
       private: std::list<std::string> namespaces;
+
+      /// \brief True if the master should only announce the publishers in
+      /// discoveryNamespaces.
+      private: bool discoveryInterest;
+
+      /// \brief Topic namespaces to be told about.
+      private: std::vector<std::string> discoveryNamespaces;
       private: std::list<std::string> masterMessages;
 
       /// \brief Condition used for synchronization
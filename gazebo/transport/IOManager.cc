@@ -17,7 +17,12 @@
 #include <atomic>
 #include <boost/bind.hpp>
 #include <boost/thread/thread.hpp>
+#include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
+
+#include "gazebo/common/Console.hh"
 #include "gazebo/transport/IOManager.hh"
 
 namespace gazebo
@@ -36,8 +41,8 @@ class IOManagerPrivate
   /// \brief Reference count of connections using this IOManager.
   public: std::atomic_int count;
 
-  /// \brief Thread for IOManager.
-  public: boost::thread *thread = nullptr;
+  /// \brief Threads running the IO service.
+  public: std::vector<boost::thread *> threads;
 };
 
 /////////////////////////////////////////////////
@@ -48,8 +53,32 @@ IOManager::IOManager()
   this->dataPtr->work = new boost::asio::io_service::work(
       *this->dataPtr->io_service);
   this->dataPtr->count = 0;
-  this->dataPtr->thread = new boost::thread(boost::bind(
-      &boost::asio::io_service::run, this->dataPtr->io_service));
+
+  int threads = 1;
+  const char *threadsEnv = getenv("GAZEBO_TRANSPORT_IO_THREADS");
+  if (threadsEnv)
+  {
+    try
+    {
+      threads = std::stoi(threadsEnv);
+    }
+    catch(...)
+    {
+      threads = 0;
+    }
+    if (threads < 1)
+    {
+      gzerr << "Invalid GAZEBO_TRANSPORT_IO_THREADS[" << threadsEnv
+            << "], using one IO thread\n";
+      threads = 1;
+    }
+  }
+
+  for (int i = 0; i < threads; ++i)
+  {
+    this->dataPtr->threads.push_back(new boost::thread(boost::bind(
+        &boost::asio::io_service::run, this->dataPtr->io_service)));
+  }
 }
 
 /////////////////////////////////////////////////
@@ -72,12 +101,18 @@ void IOManager::Stop()
 {
   this->dataPtr->io_service->reset();
   this->dataPtr->io_service->stop();
-  if (this->dataPtr->thread)
+  for (auto &thread : this->dataPtr->threads)
   {
-    this->dataPtr->thread->join();
-    delete this->dataPtr->thread;
-    this->dataPtr->thread = nullptr;
+    thread->join();
+    delete thread;
   }
+  this->dataPtr->threads.clear();
+}
+
+/////////////////////////////////////////////////
+unsigned int IOManager::ThreadCount() const
+{
+  return this->dataPtr->threads.size();
 }
 
 /////////////////////////////////////////////////
@@ -32,6 +32,12 @@ namespace gazebo
 
     /// \class IOManager IOManager.hh transport/transport.hh
     /// \brief Manages boost::asio IO
+    ///
+    /// The IO service is run by the number of threads given by the
+    /// GAZEBO_TRANSPORT_IO_THREADS environment variable, one by default.
+    /// Each connection keeps a single read in flight and serializes its
+    /// writes, so messages of a connection stay in order while separate
+    /// connections are served in parallel.
     class GZ_TRANSPORT_VISIBLE IOManager
     {
       /// \brief Constructor
@@ -57,6 +63,10 @@ namespace gazebo
       /// \brief Stop the IO service
       public: void Stop();
 
+      /// \brief Get the number of threads running the IO service.
+      /// \return Number of threads, zero once stopped.
+      public: unsigned int ThreadCount() const;
+
       /// \internal
       /// \brief Pointer to private data.
       private: IOManagerPrivate *dataPtr;
@@ -16,6 +16,7 @@
 */
 #include <boost/algorithm/string.hpp>
 #include <boost/bind.hpp>
+#include <algorithm>
 #include "gazebo/transport/TransportIface.hh"
 #include "gazebo/transport/Node.hh"
 
@@ -26,6 +27,23 @@ unsigned int Node::idCounter = 0;
 
 extern void dummy_callback_fn(uint32_t);
 
+/////////////////////////////////////////////////
+/// \brief Drop the oldest messages of a queue above a limit.
+/// \param[in,out] _queue The queue.
+/// \param[in] _limit Maximum number of messages.
+/// \return Number of dropped messages.
+template<typename T>
+static unsigned int TrimQueue(std::list<T> &_queue, const unsigned int _limit)
+{
+  unsigned int dropped = 0;
+  while (_queue.size() > _limit)
+  {
+    _queue.pop_front();
+    ++dropped;
+  }
+  return dropped;
+}
+
 /////////////////////////////////////////////////
 Node::Node()
 {
@@ -67,6 +85,11 @@ void Node::Fini()
     boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
     this->callbacks.clear();
   }
+
+  {
+    boost::mutex::scoped_lock lock(this->queueMutex);
+    this->queueLimits.clear();
+  }
 }
 
 //////////////////////////////////////////////////
@@ -194,8 +217,24 @@ void Node::ProcessPublishers()
 /////////////////////////////////////////////////
 bool Node::HandleData(const std::string &_topic, const std::string &_msg)
 {
-  boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
-  this->incomingMsgs[_topic].push_back(_msg);
+  boost::mutex::scoped_lock lock(this->queueMutex);
+  auto &queue = this->incomingMsgs[_topic];
+  queue.push_back(_msg);
+  if (this->incomingDepth++ == 0)
+    this->incomingSince = common::Time::GetWallTime();
+
+  // Enforce the queue policy before the message is deserialized
+  auto limit = this->queueLimits.find(_topic);
+  if (limit != this->queueLimits.end())
+  {
+    const unsigned int dropped = TrimQueue(queue, limit->second);
+    if (dropped > 0)
+    {
+      this->incomingDepth -= dropped;
+      this->droppedMsgs[_topic] += dropped;
+    }
+  }
+
   ConnectionManager::Instance()->TriggerUpdate();
   return true;
 }
@@ -203,8 +242,24 @@ bool Node::HandleData(const std::string &_topic, const std::string &_msg)
 /////////////////////////////////////////////////
 bool Node::HandleMessage(const std::string &_topic, MessagePtr _msg)
 {
-  boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
-  this->incomingMsgsLocal[_topic].push_back(_msg);
+  boost::mutex::scoped_lock lock(this->queueMutex);
+  auto &queue = this->incomingMsgsLocal[_topic];
+  queue.push_back(_msg);
+  if (this->incomingDepth++ == 0)
+    this->incomingSince = common::Time::GetWallTime();
+
+  // Enforce the queue policy before the message is deserialized
+  auto limit = this->queueLimits.find(_topic);
+  if (limit != this->queueLimits.end())
+  {
+    const unsigned int dropped = TrimQueue(queue, limit->second);
+    if (dropped > 0)
+    {
+      this->incomingDepth -= dropped;
+      this->droppedMsgs[_topic] += dropped;
+    }
+  }
+
   ConnectionManager::Instance()->TriggerUpdate();
   return true;
 }
@@ -214,10 +269,33 @@ void Node::ProcessIncoming()
 {
   boost::recursive_mutex::scoped_lock lock(this->processIncomingMutex);
 
-  if (!this->initialized ||
-      (this->incomingMsgs.empty() && this->incomingMsgsLocal.empty()))
+  if (!this->initialized)
     return;
 
+  // Take the queued messages, so that messages received while the callbacks
+  // run are queued, and trimmed, without waiting for them.
+  std::map<std::string, std::list<std::string> > msgs;
+  std::map<std::string, std::list<MessagePtr> > msgsLocal;
+  unsigned int count = 0;
+  {
+    boost::mutex::scoped_lock lock2(this->queueMutex);
+    if (this->incomingMsgs.empty() && this->incomingMsgsLocal.empty())
+      return;
+
+    const int64_t latency = static_cast<int64_t>(
+        (common::Time::GetWallTime() - this->incomingSince).Double() * 1e9);
+    this->incomingLatency = latency;
+    if (latency > this->maxIncomingLatency)
+      this->maxIncomingLatency = latency;
+
+    msgs.swap(this->incomingMsgs);
+    msgsLocal.swap(this->incomingMsgsLocal);
+    for (const auto &queue : msgs)
+      count += queue.second.size();
+    for (const auto &queue : msgsLocal)
+      count += queue.second.size();
+  }
+
   Callback_M::iterator cbIter;
   Callback_L::iterator liter;
 
@@ -228,8 +306,8 @@ void Node::ProcessIncoming()
     std::map<std::string, std::list<std::string> >::iterator endIter;
 
     boost::recursive_mutex::scoped_lock lock2(this->incomingMutex);
-    inIter = this->incomingMsgs.begin();
-    endIter = this->incomingMsgs.end();
+    inIter = msgs.begin();
+    endIter = msgs.end();
 
     for (; inIter != endIter; ++inIter)
     {
@@ -256,8 +334,6 @@ void Node::ProcessIncoming()
         }
       }
     }
-
-    this->incomingMsgs.clear();
   }
 
   {
@@ -266,8 +342,8 @@ void Node::ProcessIncoming()
     std::map<std::string, std::list<MessagePtr> >::iterator endIter;
 
     boost::recursive_mutex::scoped_lock lock2(this->incomingMutex);
-    inIter = this->incomingMsgsLocal.begin();
-    endIter = this->incomingMsgsLocal.end();
+    inIter = msgsLocal.begin();
+    endIter = msgsLocal.end();
 
     for (; inIter != endIter; ++inIter)
     {
@@ -293,11 +369,44 @@ void Node::ProcessIncoming()
         }
       }
     }
+  }
 
-    this->incomingMsgsLocal.clear();
+  {
+    boost::mutex::scoped_lock lock2(this->queueMutex);
+    this->incomingDepth -= count;
+
+    // Messages that arrived during the callbacks wait from now on
+    if (this->incomingDepth > 0)
+      this->incomingSince = common::Time::GetWallTime();
   }
 }
 
+/////////////////////////////////////////////////
+unsigned int Node::IncomingQueueDepth() const
+{
+  return this->incomingDepth;
+}
+
+/////////////////////////////////////////////////
+common::Time Node::IncomingLatency() const
+{
+  return common::Time(this->incomingLatency / 1e9);
+}
+
+/////////////////////////////////////////////////
+common::Time Node::MaxIncomingLatency() const
+{
+  return common::Time(this->maxIncomingLatency / 1e9);
+}
+
+/////////////////////////////////////////////////
+uint64_t Node::DroppedMessageCount(const std::string &_topic) const
+{
+  boost::mutex::scoped_lock lock(this->queueMutex);
+  auto iter = this->droppedMsgs.find(_topic);
+  return iter != this->droppedMsgs.end() ? iter->second : 0;
+}
+
 //////////////////////////////////////////////////
 void Node::InsertLatchedMsg(const std::string &_topic, const std::string &_msg)
 {
@@ -386,4 +495,34 @@ void Node::RemoveCallback(const std::string &_topic, unsigned int _id)
       }
     }
   }
+
+  this->UpdateQueueLimit(_topic);
+}
+
+/////////////////////////////////////////////////
+void Node::UpdateQueueLimit(const std::string &_topic)
+{
+  // Messages are shared by the callbacks of a topic, so the largest depth
+  // wins, and a single unbounded callback makes the queue unbounded.
+  unsigned int limit = 0;
+  Callback_M::const_iterator iter = this->callbacks.find(_topic);
+  if (iter != this->callbacks.end())
+  {
+    for (const auto &cb : iter->second)
+    {
+      const unsigned int depth = cb->GetQueuePolicy().GetDepth();
+      if (depth == 0)
+      {
+        limit = 0;
+        break;
+      }
+      limit = std::max(limit, depth);
+    }
+  }
+
+  boost::mutex::scoped_lock lock(this->queueMutex);
+  if (limit > 0)
+    this->queueLimits[_topic] = limit;
+  else
+    this->queueLimits.erase(_topic);
 }
@@ -21,11 +21,14 @@
 #include <tbb/task.h>
 #include <boost/bind.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#include <atomic>
 #include <map>
 #include <list>
 #include <string>
 #include <vector>
 
+#include "gazebo/common/Time.hh"
+#include "gazebo/transport/QueuePolicy.hh"
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/transport/TopicManager.hh"
 #include "gazebo/util/system.hh"
@@ -236,20 +239,26 @@ namespace gazebo
       /// \param[in] _obj Class instance to be used on receipt of new message
       /// \param[in] _latching If true, latch latest incoming message;
       /// otherwise don't latch
+      /// \param[in] _queuePolicy How incoming messages are queued until the
+      /// callback runs
       /// \return Pointer to new Subscriber object
       public: template<typename M, typename T>
       SubscriberPtr Subscribe(const std::string &_topic,
           void(T::*_fp)(const boost::shared_ptr<M const> &), T *_obj,
-          bool _latching = false)
+          bool _latching = false,
+          const QueuePolicy &_queuePolicy = QueuePolicy())
       {
         SubscribeOptions ops;
         std::string decodedTopic = this->DecodeTopicName(_topic);
         ops.template Init<M>(decodedTopic, shared_from_this(), _latching);
+        ops.SetQueuePolicy(_queuePolicy);
 
         {
           boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
           this->callbacks[decodedTopic].push_back(CallbackHelperPtr(
                 new CallbackHelperT<M>(boost::bind(_fp, _obj, _1), _latching)));
+          this->callbacks[decodedTopic].back()->SetQueuePolicy(_queuePolicy);
+          this->UpdateQueueLimit(decodedTopic);
         }
 
         SubscriberPtr result =
@@ -265,20 +274,26 @@ namespace gazebo
       /// \param[in] _fp Function to be called on receipt of new message
       /// \param[in] _latching If true, latch latest incoming message;
       /// otherwise don't latch
+      /// \param[in] _queuePolicy How incoming messages are queued until the
+      /// callback runs
       /// \return Pointer to new Subscriber object
       public: template<typename M>
       SubscriberPtr Subscribe(const std::string &_topic,
           void(*_fp)(const boost::shared_ptr<M const> &),
-                     bool _latching = false)
+                     bool _latching = false,
+                     const QueuePolicy &_queuePolicy = QueuePolicy())
       {
         SubscribeOptions ops;
         std::string decodedTopic = this->DecodeTopicName(_topic);
         ops.template Init<M>(decodedTopic, shared_from_this(), _latching);
+        ops.SetQueuePolicy(_queuePolicy);
 
         {
           boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
           this->callbacks[decodedTopic].push_back(
               CallbackHelperPtr(new CallbackHelperT<M>(_fp, _latching)));
+          this->callbacks[decodedTopic].back()->SetQueuePolicy(_queuePolicy);
+          this->UpdateQueueLimit(decodedTopic);
         }
 
         SubscriberPtr result =
@@ -295,20 +310,26 @@ namespace gazebo
       /// \param[in] _obj Class instance to be used on receipt of new message
       /// \param[in] _latching If true, latch latest incoming message;
       /// otherwise don't latch
+      /// \param[in] _queuePolicy How incoming messages are queued until the
+      /// callback runs
       /// \return Pointer to new Subscriber object
       template<typename T>
       SubscriberPtr Subscribe(const std::string &_topic,
           void(T::*_fp)(const std::string &), T *_obj,
-          bool _latching = false)
+          bool _latching = false,
+          const QueuePolicy &_queuePolicy = QueuePolicy())
       {
         SubscribeOptions ops;
         std::string decodedTopic = this->DecodeTopicName(_topic);
         ops.Init(decodedTopic, shared_from_this(), _latching);
+        ops.SetQueuePolicy(_queuePolicy);
 
         {
           boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
           this->callbacks[decodedTopic].push_back(CallbackHelperPtr(
                 new RawCallbackHelper(boost::bind(_fp, _obj, _1))));
+          this->callbacks[decodedTopic].back()->SetQueuePolicy(_queuePolicy);
+          this->UpdateQueueLimit(decodedTopic);
         }
 
         SubscriberPtr result =
@@ -325,18 +346,24 @@ namespace gazebo
       /// \param[in] _fp Function to be called on receipt of new message
       /// \param[in] _latching If true, latch latest incoming message;
       /// otherwise don't latch
+      /// \param[in] _queuePolicy How incoming messages are queued until the
+      /// callback runs
       /// \return Pointer to new Subscriber object
       SubscriberPtr Subscribe(const std::string &_topic,
-          void(*_fp)(const std::string &), bool _latching = false)
+          void(*_fp)(const std::string &), bool _latching = false,
+          const QueuePolicy &_queuePolicy = QueuePolicy())
       {
         SubscribeOptions ops;
         std::string decodedTopic = this->DecodeTopicName(_topic);
         ops.Init(decodedTopic, shared_from_this(), _latching);
+        ops.SetQueuePolicy(_queuePolicy);
 
         {
           boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
           this->callbacks[decodedTopic].push_back(
               CallbackHelperPtr(new RawCallbackHelper(_fp)));
+          this->callbacks[decodedTopic].back()->SetQueuePolicy(_queuePolicy);
+          this->UpdateQueueLimit(decodedTopic);
         }
 
         SubscriberPtr result =
@@ -360,6 +387,26 @@ namespace gazebo
       /// \return true if the message was handled successfully, false otherwise
       public: bool HandleMessage(const std::string &_topic, MessagePtr _msg);
 
+      /// \brief Get the number of received messages waiting for their
+      /// callbacks.
+      /// \return Number of messages.
+      public: unsigned int IncomingQueueDepth() const;
+
+      /// \brief Get how long the oldest message of the last processed batch
+      /// waited before its callbacks ran.
+      /// \return Wall clock latency.
+      public: common::Time IncomingLatency() const;
+
+      /// \brief Get the largest IncomingLatency() of the node.
+      /// \return Wall clock latency.
+      public: common::Time MaxIncomingLatency() const;
+
+      /// \brief Get the number of messages of a topic dropped because of
+      /// the queue policies of its subscriptions.
+      /// \param[in] _topic Fully qualified name of the topic.
+      /// \return Number of dropped messages.
+      public: uint64_t DroppedMessageCount(const std::string &_topic) const;
+
       /// \brief Add a latched message to the node for publication.
       ///
       /// This is called when a subscription is connected to a
@@ -390,6 +437,11 @@ namespace gazebo
       /// \param[in] _id Id of the callback.
       public: void RemoveCallback(const std::string &_topic, unsigned int _id);
 
+      /// \brief Update the maximum number of queued messages of a topic from
+      /// the queue policies of its callbacks. incomingMutex must be locked.
+      /// \param[in] _topic Fully qualified name of the topic.
+      private: void UpdateQueueLimit(const std::string &_topic);
+
       /// \internal
       /// \brief Private implementation of Init() and TryInit()
       /// \param[in] _space Namespace to initialize this Node to. Use an empty
@@ -423,10 +475,35 @@ namespace gazebo
       private: boost::mutex publisherDeleteMutex;
       private: boost::recursive_mutex incomingMutex;
 
+      /// \brief Protects the queues of incoming messages, their limits and
+      /// counters. Not held while the callbacks run.
+      private: mutable boost::mutex queueMutex;
+
       /// \brief make sure we don't call ProcessingIncoming simultaneously
       /// from separate threads.
       private: boost::recursive_mutex processIncomingMutex;
 
+      /// \brief Number of messages in incomingMsgs and incomingMsgsLocal.
+      private: std::atomic<unsigned int> incomingDepth{0};
+
+      /// \brief Wall time at which the oldest waiting message arrived.
+      /// Protected by queueMutex.
+      private: common::Time incomingSince;
+
+      /// \brief Latency of the last processed batch, in nanoseconds.
+      private: std::atomic<int64_t> incomingLatency{0};
+
+      /// \brief Largest latency of a processed batch, in nanoseconds.
+      private: std::atomic<int64_t> maxIncomingLatency{0};
+
+      /// \brief Maximum number of queued messages per topic. Topics without
+      /// a limit are not in the map. Protected by queueMutex.
+      private: std::map<std::string, unsigned int> queueLimits;
+
+      /// \brief Number of dropped messages per topic. Protected by
+      /// queueMutex.
+      private: std::map<std::string, uint64_t> droppedMsgs;
+
       private: bool initialized;
     };
     /// \}
@@ -14,16 +14,222 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
 #include "gazebo/transport/TopicManager.hh"
 #include "gazebo/transport/ConnectionManager.hh"
 #include "gazebo/transport/PublicationTransport.hh"
+#include "gazebo/transport/ShmRing.hh"
 #include "gazebo/common/WeakBind.hh"
 
 using namespace gazebo;
 using namespace transport;
 
+namespace gazebo
+{
+  namespace transport
+  {
+    /// \internal
+    /// \brief Delivers the messages of a PublicationTransport from a shared
+    /// memory ring and from the socket, in order, on a single thread.
+    ///
+    /// The advertiser writes a control frame "a" followed by the number of
+    /// messages it sent through the socket before it opened the ring, and a
+    /// control frame "s" in place of each later message that it had to
+    /// send through the socket.
+    class ShmDelivery
+    {
+      /// \brief Deliver messages until Stop is called.
+      public: void Run();
+
+      /// \brief Queue a message read from the socket.
+      /// \param[in] _data The message.
+      public: void Push(const std::string &_data);
+
+      /// \brief Stop delivering messages, and close the ring.
+      public: void Stop();
+
+      /// \brief Set the callback messages are delivered to.
+      /// \param[in] _cb The callback.
+      public: void SetCallback(
+                  const boost::function<void(const std::string &)> &_cb);
+
+      /// \brief Deliver a message.
+      /// \param[in] _data The message.
+      private: void Deliver(const std::string &_data);
+
+      /// \brief Deliver the next message from the socket, waiting for it.
+      /// \return False if stopped.
+      private: bool DeliverSocket();
+
+      /// \brief Ring offered to the advertiser.
+      public: ShmRingPtr ring;
+
+      /// \brief Number of messages delivered from the socket, including
+      /// the ones delivered before the ring was created.
+      public: uint64_t socketDelivered = 0;
+
+      /// \brief Callback messages are delivered to.
+      private: boost::function<void(const std::string &)> callback;
+
+      /// \brief Messages read from the socket, not delivered yet.
+      private: std::deque<std::string> socketMsgs;
+
+      /// \brief True once the advertiser opened the ring.
+      private: bool attached = false;
+
+      /// \brief True once stopped.
+      private: bool stop = false;
+
+      /// \brief Protects the members above.
+      private: std::mutex mutex;
+
+      /// \brief Notified when a message is queued, or when stopped.
+      private: std::condition_variable condition;
+    };
+  }
+}
+
+/////////////////////////////////////////////////
+void ShmDelivery::Run()
+{
+  std::string data;
+  bool control;
+  while (true)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      if (this->stop)
+        return;
+    }
+
+    if (this->ring->Read(data, control, common::Time(0, 100000000)))
+    {
+      if (!control)
+        this->Deliver(data);
+      else if (data.size() == 1 + sizeof(uint64_t) && data[0] == 'a')
+      {
+        // Messages sent through the socket before the ring come first
+        uint64_t before;
+        std::memcpy(&before, &data[1], sizeof(before));
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->attached = true;
+        }
+        while (this->socketDelivered < before)
+        {
+          if (!this->DeliverSocket())
+            return;
+        }
+      }
+      else if (data == "s")
+      {
+        if (!this->DeliverSocket())
+          return;
+      }
+      else
+        gzerr << "Unknown shared memory control frame\n";
+      continue;
+    }
+
+    // Either side closed the ring, and it's empty. The remaining messages
+    // come through the socket.
+    if (!this->ring->IsOpen())
+    {
+      while (this->DeliverSocket())
+        continue;
+      return;
+    }
+
+    // Until the advertiser opens the ring, which it may never do, the
+    // messages from the socket are delivered as they come. The queue is
+    // looked at before the ring: a message sent after the ring was opened
+    // is only queued once the "a" frame is in the ring.
+    size_t count;
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      if (this->attached)
+        continue;
+      count = this->socketMsgs.size();
+    }
+    if (!this->ring->Empty())
+      continue;
+    for (size_t i = 0; i < count; ++i)
+      this->DeliverSocket();
+  }
+}
+
+/////////////////////////////////////////////////
+void ShmDelivery::Push(const std::string &_data)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->socketMsgs.push_back(_data);
+  }
+  this->condition.notify_all();
+  this->ring->Wake();
+}
+
+/////////////////////////////////////////////////
+void ShmDelivery::Stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stop = true;
+  }
+  this->condition.notify_all();
+  this->ring->Close();
+}
+
+/////////////////////////////////////////////////
+void ShmDelivery::SetCallback(
+    const boost::function<void(const std::string &)> &_cb)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->callback = _cb;
+}
+
+/////////////////////////////////////////////////
+void ShmDelivery::Deliver(const std::string &_data)
+{
+  boost::function<void(const std::string &)> cb;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    cb = this->callback;
+  }
+
+  if (!_data.empty() && cb)
+    cb(_data);
+}
+
+/////////////////////////////////////////////////
+bool ShmDelivery::DeliverSocket()
+{
+  std::string data;
+  {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->condition.wait(lock, [this]
+        {
+          return this->stop || !this->socketMsgs.empty();
+        });
+    if (this->stop)
+      return false;
+
+    data.swap(this->socketMsgs.front());
+    this->socketMsgs.pop_front();
+  }
+
+  ++this->socketDelivered;
+  this->Deliver(data);
+  return true;
+}
+
 int PublicationTransport::counter = 0;
 
 /////////////////////////////////////////////////
@@ -38,6 +244,12 @@ PublicationTransport::PublicationTransport(const std::string &_topic,
 /////////////////////////////////////////////////
 PublicationTransport::~PublicationTransport()
 {
+  if (this->shmDelivery)
+  {
+    this->shmDelivery->Stop();
+    this->shmThread.join();
+  }
+
   if (this->connection)
   {
     msgs::Subscribe sub;
@@ -65,6 +277,10 @@ void PublicationTransport::Init(const ConnectionPtr &_conn, bool _latched)
   sub.set_port(this->connection->GetLocalPort());
   sub.set_latching(_latched);
 
+  const std::string remote = this->connection->GetRemoteAddress();
+  this->sameHost = remote == this->connection->GetLocalAddress() ||
+      remote.compare(0, 4, "127.") == 0;
+
   this->connection->EnqueueMsg(msgs::Package("sub", sub));
 
   // Put this in PublicationTransportPtr
@@ -79,6 +295,8 @@ void PublicationTransport::AddCallback(
     const boost::function<void(const std::string &)> &cb_)
 {
   this->callback = cb_;
+  if (this->shmDelivery)
+    this->shmDelivery->SetCallback(cb_);
 }
 
 /////////////////////////////////////////////////
@@ -92,12 +310,57 @@ void PublicationTransport::OnPublish(const std::string &_data)
 
     if (!_data.empty())
     {
+      // Once there is a ring, its thread delivers all the messages
+      if (this->shmDelivery)
+      {
+        this->shmDelivery->Push(_data);
+        return;
+      }
+
       if (this->callback)
         (this->callback)(_data);
+      ++this->socketCount;
+
+      if (this->sameHost && !this->shmRequested &&
+          _data.size() >= ShmRing::MinMessageSize)
+      {
+        this->RequestShm(_data.size());
+      }
     }
   }
 }
 
+/////////////////////////////////////////////////
+void PublicationTransport::RequestShm(const size_t _size)
+{
+  this->shmRequested = true;
+
+  if (!ShmRing::Enabled())
+    return;
+
+  // Room for a few messages of the size that triggered the request
+  size_t capacity = std::min(std::max(_size * 8, ShmRing::MinCapacity),
+      ShmRing::MaxCapacity);
+
+  ShmRingPtr ring(new ShmRing());
+  if (!ring->Create(ShmRing::UniqueName(), capacity) ||
+      _size > ring->MaxMessageSize())
+  {
+    return;
+  }
+
+  this->shmDelivery.reset(new ShmDelivery);
+  this->shmDelivery->ring = ring;
+  this->shmDelivery->socketDelivered = this->socketCount;
+  this->shmDelivery->SetCallback(this->callback);
+  this->shmThread = std::thread(&ShmDelivery::Run, this->shmDelivery);
+
+  // The advertiser keeps using the socket if it can't open the ring
+  msgs::GzString msg;
+  msg.set_data(ring->Name());
+  this->connection->EnqueueMsg(msgs::Package("shm", msg));
+}
+
 /////////////////////////////////////////////////
 const ConnectionPtr PublicationTransport::GetConnection() const
 {
@@ -119,6 +382,9 @@ std::string PublicationTransport::GetMsgType() const
 /////////////////////////////////////////////////
 void PublicationTransport::Fini()
 {
+  if (this->shmDelivery)
+    this->shmDelivery->Stop();
+
   /// Cancel all async operatiopns.
   if (this->connection)
   {
@@ -20,9 +20,13 @@
 
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <thread>
 
 #include "gazebo/transport/Connection.hh"
+#include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/common/Event.hh"
 #include "gazebo/util/system.hh"
 
@@ -30,6 +34,9 @@ namespace gazebo
 {
   namespace transport
   {
+    // Forward declare the shared memory delivery state
+    class ShmDelivery;
+
     /// \addtogroup gazebo_transport
     /// \{
 
@@ -37,6 +44,12 @@ namespace gazebo
     /// transport/transport.hh
     /// \brief Reads data from a remote advertiser, and passes the data
     /// along to local subscribers
+    ///
+    /// When the advertiser runs on the same host and sends large messages,
+    /// the transport offers it a shared memory ring, see ShmRing, and
+    /// receives the following messages through the ring instead of the
+    /// socket. From then on, a single thread delivers the messages from
+    /// both the ring and the socket, in the order they were published.
     class GZ_TRANSPORT_VISIBLE PublicationTransport :
         public boost::enable_shared_from_this<PublicationTransport>
     {
@@ -79,6 +92,12 @@ namespace gazebo
       /// \param[in] _data Data to be published.
       private: void OnPublish(const std::string &_data);
 
+      /// \brief Create a shared memory ring and offer it to the remote
+      /// advertiser. Only attempted once per transport.
+      /// \param[in] _size Size of the message that triggered the request,
+      /// used to size the ring.
+      private: void RequestShm(const size_t _size);
+
       /// \brief The topic for this publication transport.
       private: std::string topic;
 
@@ -96,6 +115,23 @@ namespace gazebo
 
       /// \brief The unique id for the publication transport.
       private: int id;
+
+      /// \brief True if the remote advertiser runs on this host.
+      private: bool sameHost = false;
+
+      /// \brief True once a shared memory ring has been requested.
+      private: bool shmRequested = false;
+
+      /// \brief Number of messages delivered from the socket before a
+      /// shared memory ring was created.
+      private: uint64_t socketCount = 0;
+
+      /// \brief Delivers the messages once a shared memory ring was
+      /// created, null before.
+      private: std::shared_ptr<ShmDelivery> shmDelivery;
+
+      /// \brief Thread running shmDelivery.
+      private: std::thread shmThread;
     };
     /// \}
   }
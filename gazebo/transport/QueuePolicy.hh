@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_TRANSPORT_QUEUEPOLICY_HH_
+#define GAZEBO_TRANSPORT_QUEUEPOLICY_HH_
+
+#include <algorithm>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace transport
+  {
+    /// \addtogroup gazebo_transport
+    /// \{
+
+    /// \class QueuePolicy QueuePolicy.hh transport/transport.hh
+    /// \brief How a node queues the messages of a subscription until its
+    /// callbacks run.
+    ///
+    /// The policy is enforced when a message is received, before it is
+    /// deserialized, by dropping the oldest queued messages of the topic.
+    /// Dropped messages are counted, see Subscriber::DroppedMessageCount.
+    ///
+    /// Messages are queued per node and topic, so when several
+    /// subscriptions of a node share a topic the least restrictive policy
+    /// applies to all of them.
+    class GZ_TRANSPORT_VISIBLE QueuePolicy
+    {
+      /// \brief Kinds of policy.
+      public: enum Type
+              {
+                /// \brief Queue every message, the default.
+                KEEP_ALL,
+
+                /// \brief Keep the newest messages, up to a depth.
+                KEEP_LAST,
+
+                /// \brief Keep only the newest message.
+                CONFLATE
+              };
+
+      /// \brief Constructor. Queue every message.
+      public: QueuePolicy() = default;
+
+      /// \brief Keep the newest messages, dropping the oldest ones.
+      /// \param[in] _depth Maximum number of queued messages, at least one.
+      /// \return The policy.
+      public: static QueuePolicy KeepLast(const unsigned int _depth)
+              {
+                QueuePolicy policy;
+                policy.type = KEEP_LAST;
+                policy.depth = std::max(_depth, 1u);
+                return policy;
+              }
+
+      /// \brief Keep only the newest message, for subscribers that only
+      /// need the latest state.
+      /// \return The policy.
+      public: static QueuePolicy Conflate()
+              {
+                QueuePolicy policy;
+                policy.type = CONFLATE;
+                policy.depth = 1;
+                return policy;
+              }
+
+      /// \brief Get the kind of policy.
+      /// \return The kind of policy.
+      public: Type GetType() const
+              {
+                return this->type;
+              }
+
+      /// \brief Get the maximum number of queued messages.
+      /// \return The depth, 0 if unbounded.
+      public: unsigned int GetDepth() const
+              {
+                return this->depth;
+              }
+
+      /// \brief Kind of policy.
+      private: Type type = KEEP_ALL;
+
+      /// \brief Maximum number of queued messages, 0 if unbounded.
+      private: unsigned int depth = 0;
+    };
+    /// \}
+  }
+}
+#endif
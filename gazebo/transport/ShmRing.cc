@@ -0,0 +1,590 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <semaphore.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <new>
+#include <random>
+#include <sstream>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/transport/ShmRing.hh"
+
+using namespace gazebo;
+using namespace transport;
+
+#ifndef _WIN32
+namespace
+{
+  /// \brief Identifies a gazebo ring segment.
+  const uint32_t kMagic = 0x475a5352;
+
+  /// \brief Version of the segment layout.
+  const uint32_t kVersion = 1;
+
+  /// \brief Frame size marking the unused tail of the ring, the next frame
+  /// starts at offset zero.
+  const uint64_t kWrapMarker = UINT64_MAX;
+
+  /// \brief Flag in the size prefix of a control frame.
+  const uint64_t kControlFlag = uint64_t(1) << 63;
+
+  /// \brief Frames are aligned so that the size prefix is always aligned.
+  const uint64_t kAlignment = sizeof(uint64_t);
+
+  /// \brief Space that messages leave free for control frames.
+  const uint64_t kControlReserve = 4096;
+
+  /// \brief Layout of the start of the segment, followed by the ring data.
+  struct ShmRingHeader
+  {
+    /// \brief Must be kMagic.
+    uint32_t magic;
+
+    /// \brief Must be kVersion.
+    uint32_t version;
+
+    /// \brief Size of the ring data in bytes.
+    uint64_t capacity;
+
+    /// \brief Total number of bytes written, only modified by the producer.
+    std::atomic<uint64_t> head;
+
+    /// \brief Total number of bytes read, only modified by the consumer.
+    std::atomic<uint64_t> tail;
+
+    /// \brief Non zero once either side closed the ring.
+    std::atomic<uint32_t> closed;
+
+    /// \brief Non zero once the producer opened the ring and removed its
+    /// name.
+    std::atomic<uint32_t> attached;
+
+    /// \brief Posted by the producer for each message and on close.
+    sem_t dataReady;
+  };
+
+  static_assert(std::atomic<uint64_t>::is_always_lock_free,
+      "shared memory ring needs lock free 64 bit atomics");
+
+  /// \brief Offset of the ring data from the start of the segment.
+  const size_t kDataOffset = (sizeof(ShmRingHeader) + 63) & ~size_t(63);
+
+  /// \brief Size of a frame holding a message, including its size prefix.
+  /// \param[in] _size Message size.
+  /// \return Frame size.
+  uint64_t FrameSize(const uint64_t _size)
+  {
+    return sizeof(uint64_t) + ((_size + kAlignment - 1) & ~(kAlignment - 1));
+  }
+}
+#endif
+
+namespace gazebo
+{
+  namespace transport
+  {
+    /// \internal
+    /// \brief ShmRing private data
+    class ShmRingPrivate
+    {
+      /// \brief Name of the segment.
+      public: std::string name;
+
+      /// \brief True if this side created the segment.
+      public: bool owner = false;
+
+      /// \brief Start of the mapping.
+      public: void *mapping = nullptr;
+
+      /// \brief Size of the mapping.
+      public: size_t mappingSize = 0;
+
+#ifndef _WIN32
+      /// \brief Segment header, at the start of the mapping.
+      public: ShmRingHeader *header = nullptr;
+#endif
+
+      /// \brief Ring data, following the header.
+      public: char *data = nullptr;
+
+      /// \brief Size of the ring data. Kept apart from the header, which
+      /// the other side could overwrite.
+      public: uint64_t capacity = 0;
+
+      /// \brief Set by Wake, makes Read return.
+      public: std::atomic<bool> wakeRequested{false};
+
+      /// \brief Serializes producers within this process.
+      public: std::mutex writeMutex;
+
+      /// \brief Write a frame, producer side.
+      /// \param[in] _data Content of the frame.
+      /// \param[in] _reserve Space to leave free after the frame.
+      /// \param[in] _flags Flags of the size prefix.
+      /// \return False if the ring is full.
+      public: bool WriteFrame(const std::string &_data,
+                  const uint64_t _reserve, const uint64_t _flags);
+    };
+  }
+}
+
+const size_t ShmRing::MinMessageSize;
+const size_t ShmRing::MaxControlSize;
+const size_t ShmRing::MinCapacity;
+const size_t ShmRing::MaxCapacity;
+
+/////////////////////////////////////////////////
+ShmRing::ShmRing()
+  : dataPtr(new ShmRingPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+ShmRing::~ShmRing()
+{
+  this->Close();
+
+#ifndef _WIN32
+  if (this->dataPtr->mapping)
+  {
+    // The producer removes the name once attached
+    if (this->dataPtr->owner && !this->dataPtr->header->attached)
+      shm_unlink(this->dataPtr->name.c_str());
+
+    if (this->dataPtr->owner)
+      sem_destroy(&this->dataPtr->header->dataReady);
+    munmap(this->dataPtr->mapping, this->dataPtr->mappingSize);
+  }
+#endif
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::Create(const std::string &_name, const size_t _capacity)
+{
+#ifdef _WIN32
+  return false;
+#else
+  if (this->dataPtr->mapping)
+  {
+    gzerr << "Shared memory ring [" << this->dataPtr->name
+          << "] is already mapped\n";
+    return false;
+  }
+
+  int fd = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0)
+  {
+    gzwarn << "Unable to create shared memory segment [" << _name << "]: "
+           << strerror(errno) << std::endl;
+    return false;
+  }
+
+  uint64_t capacity = _capacity & ~(kAlignment - 1);
+  size_t size = kDataOffset + capacity;
+
+  // Reserve the memory now, a sparse segment would raise SIGBUS on first
+  // write once /dev/shm is full.
+  if (ftruncate(fd, size) != 0 || posix_fallocate(fd, 0, size) != 0)
+  {
+    gzwarn << "Unable to reserve " << size << " bytes of shared memory for ["
+           << _name << "]\n";
+    close(fd);
+    shm_unlink(_name.c_str());
+    return false;
+  }
+
+  void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+      fd, 0);
+  close(fd);
+
+  if (mapping == MAP_FAILED)
+  {
+    gzwarn << "Unable to map shared memory segment [" << _name << "]: "
+           << strerror(errno) << std::endl;
+    shm_unlink(_name.c_str());
+    return false;
+  }
+
+  ShmRingHeader *header = new (mapping) ShmRingHeader;
+  header->capacity = capacity;
+  header->head = 0;
+  header->tail = 0;
+  header->closed = 0;
+  header->attached = 0;
+  if (sem_init(&header->dataReady, 1, 0) != 0)
+  {
+    gzwarn << "Unable to create shared semaphore for [" << _name << "]\n";
+    munmap(mapping, size);
+    shm_unlink(_name.c_str());
+    return false;
+  }
+  header->version = kVersion;
+
+  // Written last, a producer only accepts the segment once it's complete.
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = kMagic;
+
+  this->dataPtr->name = _name;
+  this->dataPtr->owner = true;
+  this->dataPtr->mapping = mapping;
+  this->dataPtr->mappingSize = size;
+  this->dataPtr->header = header;
+  this->dataPtr->data = static_cast<char *>(mapping) + kDataOffset;
+  this->dataPtr->capacity = capacity;
+
+  return true;
+#endif
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::Open(const std::string &_name)
+{
+#ifdef _WIN32
+  return false;
+#else
+  if (this->dataPtr->mapping)
+  {
+    gzerr << "Shared memory ring [" << this->dataPtr->name
+          << "] is already mapped\n";
+    return false;
+  }
+
+  int fd = shm_open(_name.c_str(), O_RDWR, 0600);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) <= kDataOffset)
+  {
+    close(fd);
+    return false;
+  }
+
+  size_t size = st.st_size;
+  void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+      fd, 0);
+  close(fd);
+
+  if (mapping == MAP_FAILED)
+    return false;
+
+  ShmRingHeader *header = static_cast<ShmRingHeader *>(mapping);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (header->magic != kMagic || header->version != kVersion ||
+      kDataOffset + header->capacity != size)
+  {
+    gzwarn << "Shared memory segment [" << _name
+           << "] is not a valid gazebo ring\n";
+    munmap(mapping, size);
+    return false;
+  }
+
+  // Both sides have the segment mapped now. Removing the name means its
+  // memory is released once both unmap it, even if one of them crashes.
+  shm_unlink(_name.c_str());
+  header->attached = 1;
+
+  this->dataPtr->name = _name;
+  this->dataPtr->owner = false;
+  this->dataPtr->mapping = mapping;
+  this->dataPtr->mappingSize = size;
+  this->dataPtr->header = header;
+  this->dataPtr->data = static_cast<char *>(mapping) + kDataOffset;
+  this->dataPtr->capacity = header->capacity;
+
+  return true;
+#endif
+}
+
+/////////////////////////////////////////////////
+void ShmRing::Close()
+{
+#ifndef _WIN32
+  if (!this->dataPtr->header)
+    return;
+
+  if (this->dataPtr->header->closed.exchange(1) == 0)
+    sem_post(&this->dataPtr->header->dataReady);
+#endif
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::IsOpen() const
+{
+#ifdef _WIN32
+  return false;
+#else
+  return this->dataPtr->header && !this->dataPtr->header->closed;
+#endif
+}
+
+/////////////////////////////////////////////////
+std::string ShmRing::Name() const
+{
+  return this->dataPtr->name;
+}
+
+/////////////////////////////////////////////////
+size_t ShmRing::MaxMessageSize() const
+{
+#ifdef _WIN32
+  return 0;
+#else
+  if (!this->dataPtr->header)
+    return 0;
+
+  // Leave room for a wrap marker in front of the frame, and for control
+  // frames after it
+  return (this->dataPtr->capacity - kControlReserve) / 2 -
+      2 * sizeof(uint64_t);
+#endif
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::Write(const std::string &_data)
+{
+#ifdef _WIN32
+  return false;
+#else
+  if (!this->IsOpen() || _data.size() > this->MaxMessageSize())
+    return false;
+
+  return this->dataPtr->WriteFrame(_data, kControlReserve, 0);
+#endif
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::WriteControl(const std::string &_data)
+{
+#ifdef _WIN32
+  return false;
+#else
+  if (!this->IsOpen() || _data.size() > MaxControlSize)
+    return false;
+
+  return this->dataPtr->WriteFrame(_data, 0, kControlFlag);
+#endif
+}
+
+/////////////////////////////////////////////////
+bool ShmRingPrivate::WriteFrame(const std::string &_data,
+    const uint64_t _reserve, const uint64_t _flags)
+{
+#ifdef _WIN32
+  return false;
+#else
+  std::lock_guard<std::mutex> lock(this->writeMutex);
+
+  const uint64_t frameSize = FrameSize(_data.size());
+
+  uint64_t head = this->header->head.load(std::memory_order_relaxed);
+  const uint64_t tail = this->header->tail.load(std::memory_order_acquire);
+
+  // Frames don't wrap, skip the end of the ring if the frame doesn't fit.
+  uint64_t offset = head % this->capacity;
+  uint64_t skip = (this->capacity - offset < frameSize) ?
+      this->capacity - offset : 0;
+
+  if (head + skip + frameSize + _reserve - tail > this->capacity)
+    return false;
+
+  if (skip > 0)
+  {
+    std::memcpy(this->data + offset, &kWrapMarker, sizeof(kWrapMarker));
+    head += skip;
+    offset = 0;
+  }
+
+  const uint64_t size = _data.size() | _flags;
+  std::memcpy(this->data + offset, &size, sizeof(size));
+  std::memcpy(this->data + offset + sizeof(size), _data.data(),
+      _data.size());
+
+  this->header->head.store(head + frameSize, std::memory_order_release);
+  sem_post(&this->header->dataReady);
+
+  return true;
+#endif
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::Read(std::string &_data, const common::Time &_timeout)
+{
+  bool control = true;
+  while (control)
+  {
+    if (!this->Read(_data, control, _timeout))
+      return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::Read(std::string &_data, bool &_control,
+    const common::Time &_timeout)
+{
+#ifdef _WIN32
+  return false;
+#else
+  ShmRingHeader *header = this->dataPtr->header;
+  if (!header)
+    return false;
+
+  const uint64_t capacity = this->dataPtr->capacity;
+
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += _timeout.sec;
+  deadline.tv_nsec += _timeout.nsec;
+  if (deadline.tv_nsec >= 1000000000)
+  {
+    deadline.tv_sec += 1;
+    deadline.tv_nsec -= 1000000000;
+  }
+
+  while (true)
+  {
+    uint64_t tail = header->tail.load(std::memory_order_relaxed);
+    const uint64_t head = header->head.load(std::memory_order_acquire);
+
+    if (tail == head)
+    {
+      if (header->closed || this->dataPtr->wakeRequested.exchange(false))
+        return false;
+
+      // The semaphore can be ahead of the ring when several messages were
+      // read after a single wake up, so an empty ring just waits again.
+      if (sem_timedwait(&header->dataReady, &deadline) != 0 &&
+          errno == ETIMEDOUT)
+      {
+        return false;
+      }
+      continue;
+    }
+
+    // Everything read from the segment is checked before it is used, the
+    // other side may have written garbage.
+    const uint64_t used = head - tail;
+    const uint64_t offset = tail % capacity;
+    uint64_t size;
+    if (used <= capacity && used % kAlignment == 0)
+    {
+      std::memcpy(&size, this->dataPtr->data + offset, sizeof(size));
+
+      if (size == kWrapMarker)
+      {
+        if (offset != 0 && capacity - offset <= used)
+        {
+          header->tail.store(tail + capacity - offset,
+              std::memory_order_release);
+          continue;
+        }
+      }
+      else
+      {
+        _control = (size & kControlFlag) != 0;
+        size &= ~kControlFlag;
+        if (size <= capacity - offset - sizeof(size) &&
+            FrameSize(size) <= used)
+        {
+          _data.assign(this->dataPtr->data + offset + sizeof(size), size);
+          header->tail.store(tail + FrameSize(size),
+              std::memory_order_release);
+          return true;
+        }
+      }
+    }
+
+    gzerr << "Shared memory ring [" << this->dataPtr->name
+          << "] is corrupt, closing it\n";
+    this->Close();
+    header->tail.store(head, std::memory_order_release);
+    return false;
+  }
+#endif
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::Empty() const
+{
+#ifdef _WIN32
+  return true;
+#else
+  const ShmRingHeader *header = this->dataPtr->header;
+  return !header || header->head.load(std::memory_order_acquire) ==
+      header->tail.load(std::memory_order_relaxed);
+#endif
+}
+
+/////////////////////////////////////////////////
+void ShmRing::Wake()
+{
+#ifndef _WIN32
+  if (!this->dataPtr->header)
+    return;
+
+  this->dataPtr->wakeRequested = true;
+  sem_post(&this->dataPtr->header->dataReady);
+#endif
+}
+
+/////////////////////////////////////////////////
+std::string ShmRing::UniqueName()
+{
+  static std::atomic<unsigned int> counter(0);
+  static std::mt19937 generator{std::random_device{}()};
+  static std::mutex generatorMutex;
+
+  unsigned int salt;
+  {
+    std::lock_guard<std::mutex> lock(generatorMutex);
+    salt = generator();
+  }
+
+  std::ostringstream stream;
+  stream << "/gazebo_shm_"
+#ifndef _WIN32
+         << getpid() << "_"
+#endif
+         << counter++ << "_" << std::hex << salt;
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+bool ShmRing::Enabled()
+{
+#ifdef _WIN32
+  return false;
+#else
+  const char *env = std::getenv("GAZEBO_SHM_TRANSPORT");
+  return !env || std::string(env) != "0";
+#endif
+}
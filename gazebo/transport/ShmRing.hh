@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_TRANSPORT_SHMRING_HH_
+#define GAZEBO_TRANSPORT_SHMRING_HH_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "gazebo/common/Time.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace transport
+  {
+    // Forward declare private data class
+    class ShmRingPrivate;
+
+    /// \addtogroup gazebo_transport
+    /// \{
+
+    /// \class ShmRing ShmRing.hh transport/transport.hh
+    /// \brief A single producer, single consumer ring buffer of messages
+    /// in a POSIX shared memory segment.
+    ///
+    /// The consumer creates and owns the segment, the producer opens it by
+    /// name and removes the name once attached, so the segment goes away
+    /// with the last side that has it mapped, even if the other side
+    /// crashed. Messages are written contiguously, so a message never
+    /// wraps around the end of the ring, and the consumer is woken up
+    /// through a process shared semaphore. This is used to move large
+    /// messages between processes on the same host without going through
+    /// a socket.
+    ///
+    /// Besides messages, the producer can write small control frames,
+    /// which are kept apart from messages on the consumer side and can
+    /// still be written when the ring is too full for another message.
+    ///
+    /// Shared memory is not supported on Windows, where Create and Open
+    /// always fail.
+    class GZ_TRANSPORT_VISIBLE ShmRing
+    {
+      /// \brief Constructor.
+      public: ShmRing();
+
+      /// \brief Destructor. Closes the ring, and removes the segment if this
+      /// is the consumer side.
+      public: ~ShmRing();
+
+      /// \brief Create a new segment, as the consumer.
+      /// \param[in] _name Name of the segment, see UniqueName.
+      /// \param[in] _capacity Size of the ring in bytes.
+      /// \return False if the segment could not be created or its memory
+      /// could not be reserved.
+      public: bool Create(const std::string &_name, const size_t _capacity);
+
+      /// \brief Open an existing segment, as the producer. The name of the
+      /// segment is removed, so it can't be opened again.
+      /// \param[in] _name Name of the segment.
+      /// \return False if the segment does not exist or is not a valid ring.
+      public: bool Open(const std::string &_name);
+
+      /// \brief Close the ring. Both sides see the ring as closed
+      /// afterwards, and a consumer blocked in Read returns.
+      public: void Close();
+
+      /// \brief Get whether the ring is mapped and not closed by either
+      /// side.
+      /// \return True if messages can be exchanged.
+      public: bool IsOpen() const;
+
+      /// \brief Get the name of the segment.
+      /// \return Segment name, empty if not created or opened.
+      public: std::string Name() const;
+
+      /// \brief Get the largest message that fits in the ring.
+      /// \return Maximum message size in bytes.
+      public: size_t MaxMessageSize() const;
+
+      /// \brief Write a message, producer side. Never blocks.
+      /// \param[in] _data Message to write.
+      /// \return False if the ring is closed, full, or the message is larger
+      /// than MaxMessageSize.
+      public: bool Write(const std::string &_data);
+
+      /// \brief Write a control frame, producer side. Never blocks. Control
+      /// frames may use the space Write keeps free.
+      /// \param[in] _data Content of the frame, at most MaxControlSize
+      /// bytes.
+      /// \return False if the ring is closed or full.
+      public: bool WriteControl(const std::string &_data);
+
+      /// \brief Read the next message, consumer side. Control frames are
+      /// skipped.
+      /// \param[out] _data Message read.
+      /// \param[in] _timeout Maximum time to wait for a message.
+      /// \return False if no message arrived before the timeout, if Wake
+      /// was called, or if the ring is closed and empty.
+      public: bool Read(std::string &_data, const common::Time &_timeout);
+
+      /// \brief Read the next message or control frame, consumer side.
+      /// Frames written before the ring was closed are still read.
+      ///
+      /// A frame that doesn't fit in the ring means the segment is
+      /// corrupt, the ring is closed and nothing is read.
+      /// \param[out] _data Content of the frame.
+      /// \param[out] _control True if the frame is a control frame.
+      /// \param[in] _timeout Maximum time to wait for a frame.
+      /// \return False if no frame arrived before the timeout, if Wake was
+      /// called, or if the ring is closed and empty.
+      public: bool Read(std::string &_data, bool &_control,
+                        const common::Time &_timeout);
+
+      /// \brief Get whether there is nothing left to read.
+      /// \return True if the ring is empty, or not mapped.
+      public: bool Empty() const;
+
+      /// \brief Make a Read that is waiting, or the next one, return
+      /// early, consumer side.
+      public: void Wake();
+
+      /// \brief Generate a segment name that is unique to this process.
+      /// \return Segment name.
+      public: static std::string UniqueName();
+
+      /// \brief Get whether the shared memory transport is enabled. It is
+      /// enabled by default on platforms that support it, and can be turned
+      /// off by setting the GAZEBO_SHM_TRANSPORT environment variable to 0.
+      /// \return True if enabled.
+      public: static bool Enabled();
+
+      /// \brief Messages smaller than this are not worth a shared memory
+      /// ring and keep going through the socket.
+      public: static const size_t MinMessageSize = 64 * 1024;
+
+      /// \brief Largest control frame.
+      public: static const size_t MaxControlSize = 64;
+
+      /// \brief Smallest ring created for a topic.
+      public: static const size_t MinCapacity = 4 * 1024 * 1024;
+
+      /// \brief Largest ring created for a topic.
+      public: static const size_t MaxCapacity = 256 * 1024 * 1024;
+
+      /// \internal
+      /// \brief Private data pointer
+      private: std::unique_ptr<ShmRingPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "gazebo/transport/ShmRing.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class ShmRing : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+TEST_F(ShmRing, CreateOpen)
+{
+  std::string name = transport::ShmRing::UniqueName();
+  EXPECT_NE(name, transport::ShmRing::UniqueName());
+
+  // Nothing to open yet
+  transport::ShmRing writer;
+  EXPECT_FALSE(writer.Open(name));
+  EXPECT_FALSE(writer.IsOpen());
+  EXPECT_FALSE(writer.Write("data"));
+
+  {
+    transport::ShmRing reader;
+    ASSERT_TRUE(reader.Create(name, 1024 * 1024));
+    EXPECT_TRUE(reader.IsOpen());
+    EXPECT_EQ(name, reader.Name());
+    EXPECT_GT(reader.MaxMessageSize(), 256u * 1024u);
+
+    // Names are exclusive
+    transport::ShmRing other;
+    EXPECT_FALSE(other.Create(name, 1024 * 1024));
+
+    EXPECT_TRUE(writer.Open(name));
+    EXPECT_EQ(reader.MaxMessageSize(), writer.MaxMessageSize());
+
+    // Too large for the ring
+    std::string large(writer.MaxMessageSize() + 1, 'x');
+    EXPECT_FALSE(writer.Write(large));
+
+    // Nothing to read
+    std::string data;
+    EXPECT_FALSE(reader.Read(data, common::Time(0, 1000000)));
+
+    EXPECT_TRUE(writer.Write("hello"));
+    EXPECT_TRUE(reader.Read(data, common::Time(0, 1000000)));
+    EXPECT_EQ("hello", data);
+
+    // Closing either side closes both
+    writer.Close();
+    EXPECT_FALSE(writer.IsOpen());
+    EXPECT_FALSE(reader.IsOpen());
+    EXPECT_FALSE(writer.Write("hello"));
+    EXPECT_FALSE(reader.Read(data, common::Time(0, 1000000)));
+  }
+
+  // The segment is removed with the reader
+  transport::ShmRing late;
+  EXPECT_FALSE(late.Open(name));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ShmRing, Full)
+{
+  std::string name = transport::ShmRing::UniqueName();
+  transport::ShmRing reader;
+  ASSERT_TRUE(reader.Create(name, 64 * 1024));
+  transport::ShmRing writer;
+  ASSERT_TRUE(writer.Open(name));
+
+  // Fill the ring, the writer never blocks
+  std::string msg(10000, 'a');
+  int written = 0;
+  while (writer.Write(msg))
+    ++written;
+  EXPECT_GT(written, 0);
+  EXPECT_LE(written * msg.size(), 64u * 1024u);
+
+  // Drain it, then it accepts messages again
+  std::string data;
+  for (int i = 0; i < written; ++i)
+  {
+    EXPECT_TRUE(reader.Read(data, common::Time(0, 1000000)));
+    EXPECT_EQ(msg, data);
+  }
+  EXPECT_FALSE(reader.Read(data, common::Time(0, 1000000)));
+  EXPECT_TRUE(writer.Write(msg));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ShmRing, Stream)
+{
+  std::string name = transport::ShmRing::UniqueName();
+  transport::ShmRing reader;
+  ASSERT_TRUE(reader.Create(name, 1024 * 1024));
+  transport::ShmRing writer;
+  ASSERT_TRUE(writer.Open(name));
+
+  // Messages of varying size wrap around the ring many times and arrive
+  // in order.
+  const int count = 2000;
+  std::thread producer([&writer, count]()
+  {
+    for (int i = 0; i < count;)
+    {
+      std::string msg(100 + (i * 7919) % 200000, static_cast<char>(i % 128));
+      if (writer.Write(msg))
+        ++i;
+      else
+        std::this_thread::yield();
+    }
+  });
+
+  std::string data;
+  for (int i = 0; i < count; ++i)
+  {
+    ASSERT_TRUE(reader.Read(data, common::Time(5, 0)));
+    EXPECT_EQ(100u + (i * 7919) % 200000, data.size());
+    EXPECT_EQ(static_cast<char>(i % 128), data.back());
+  }
+
+  producer.join();
+}
+
+/////////////////////////////////////////////////
+TEST_F(ShmRing, Unlinked)
+{
+  std::string name = transport::ShmRing::UniqueName();
+  transport::ShmRing reader;
+  ASSERT_TRUE(reader.Create(name, 1024 * 1024));
+  transport::ShmRing writer;
+  ASSERT_TRUE(writer.Open(name));
+
+  // Once both sides are attached the name is gone, so the memory is
+  // released even if a side crashes without cleaning up
+  transport::ShmRing other;
+  EXPECT_FALSE(other.Open(name));
+  EXPECT_GT(0, shm_open(name.c_str(), O_RDWR, 0600));
+
+  std::string data;
+  EXPECT_TRUE(writer.Write("hello"));
+  EXPECT_TRUE(reader.Read(data, common::Time(0, 1000000)));
+  EXPECT_EQ("hello", data);
+}
+
+/////////////////////////////////////////////////
+TEST_F(ShmRing, Control)
+{
+  std::string name = transport::ShmRing::UniqueName();
+  transport::ShmRing reader;
+  ASSERT_TRUE(reader.Create(name, 64 * 1024));
+  transport::ShmRing writer;
+  ASSERT_TRUE(writer.Open(name));
+
+  std::string large(transport::ShmRing::MaxControlSize + 1, 'c');
+  EXPECT_FALSE(writer.WriteControl(large));
+
+  EXPECT_TRUE(writer.WriteControl("first"));
+  EXPECT_TRUE(writer.Write("message"));
+  EXPECT_TRUE(writer.WriteControl("second"));
+
+  std::string data;
+  bool control = false;
+  EXPECT_TRUE(reader.Read(data, control, common::Time(0, 1000000)));
+  EXPECT_TRUE(control);
+  EXPECT_EQ("first", data);
+  EXPECT_TRUE(reader.Read(data, control, common::Time(0, 1000000)));
+  EXPECT_FALSE(control);
+  EXPECT_EQ("message", data);
+  EXPECT_TRUE(reader.Read(data, control, common::Time(0, 1000000)));
+  EXPECT_TRUE(control);
+  EXPECT_EQ("second", data);
+
+  // Control frames still fit when messages don't
+  std::string msg(10000, 'a');
+  while (writer.Write(msg))
+    continue;
+  EXPECT_TRUE(writer.WriteControl("full"));
+
+  // Reading messages only skips control frames, and what was written
+  // before closing is still read
+  writer.Close();
+  EXPECT_FALSE(reader.Empty());
+  int count = 0;
+  while (reader.Read(data, common::Time(0, 1000000)))
+  {
+    EXPECT_EQ(msg, data);
+    ++count;
+  }
+  EXPECT_GT(count, 0);
+  EXPECT_TRUE(reader.Empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ShmRing, Wake)
+{
+  std::string name = transport::ShmRing::UniqueName();
+  transport::ShmRing reader;
+  ASSERT_TRUE(reader.Create(name, 64 * 1024));
+
+  auto start = std::chrono::steady_clock::now();
+  std::thread waker([&reader]()
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    reader.Wake();
+  });
+
+  std::string data;
+  EXPECT_FALSE(reader.Read(data, common::Time(10, 0)));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  EXPECT_TRUE(reader.IsOpen());
+  waker.join();
+}
+
+/////////////////////////////////////////////////
+TEST_F(ShmRing, Corrupt)
+{
+  std::string name = transport::ShmRing::UniqueName();
+  transport::ShmRing reader;
+  ASSERT_TRUE(reader.Create(name, 64 * 1024));
+
+  // Map the segment as a misbehaving producer would, before the name is
+  // removed
+  int fd = shm_open(name.c_str(), O_RDWR, 0600);
+  ASSERT_GE(fd, 0);
+  struct stat st;
+  ASSERT_EQ(0, fstat(fd, &st));
+  char *mapping = static_cast<char *>(mmap(nullptr, st.st_size,
+      PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+  close(fd);
+  ASSERT_NE(MAP_FAILED, static_cast<void *>(mapping));
+
+  transport::ShmRing writer;
+  ASSERT_TRUE(writer.Open(name));
+  EXPECT_TRUE(writer.Write("corrupt me"));
+
+  // Make the size of the frame larger than the ring
+  char *frame = static_cast<char *>(memmem(mapping, st.st_size,
+      "corrupt me", 10));
+  ASSERT_NE(nullptr, frame);
+  const uint64_t size = uint64_t(1) << 40;
+  std::memcpy(frame - sizeof(size), &size, sizeof(size));
+
+  std::string data;
+  EXPECT_FALSE(reader.Read(data, common::Time(0, 1000000)));
+  EXPECT_FALSE(reader.IsOpen());
+  EXPECT_FALSE(writer.Write("hello"));
+
+  munmap(mapping, st.st_size);
+}
+
+/////////////////////////////////////////////////
+TEST_F(ShmRing, CrossProcess)
+{
+  std::string name = transport::ShmRing::UniqueName();
+  transport::ShmRing reader;
+  ASSERT_TRUE(reader.Create(name, 1024 * 1024));
+
+  // The producer runs in another process, with a control frame after
+  // every tenth message
+  const int count = 500;
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0)
+  {
+    transport::ShmRing writer;
+    if (!writer.Open(name))
+      _exit(1);
+
+    for (int i = 0; i < count; ++i)
+    {
+      std::string msg(100 + (i * 7919) % 200000, static_cast<char>(i % 128));
+      while (!writer.Write(msg))
+        std::this_thread::yield();
+      if (i % 10 == 9)
+      {
+        while (!writer.WriteControl(std::to_string(i)))
+          std::this_thread::yield();
+      }
+    }
+    _exit(0);
+  }
+
+  std::string data;
+  bool control;
+  for (int i = 0; i < count; ++i)
+  {
+    ASSERT_TRUE(reader.Read(data, control, common::Time(5, 0)));
+    EXPECT_FALSE(control);
+    EXPECT_EQ(100u + (i * 7919) % 200000, data.size());
+    EXPECT_EQ(static_cast<char>(i % 128), data.back());
+    if (i % 10 == 9)
+    {
+      ASSERT_TRUE(reader.Read(data, control, common::Time(5, 0)));
+      EXPECT_TRUE(control);
+      EXPECT_EQ(std::to_string(i), data);
+    }
+  }
+
+  int status = -1;
+  EXPECT_EQ(pid, waitpid(pid, &status, 0));
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(0, WEXITSTATUS(status));
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -21,6 +21,7 @@
 #include <boost/shared_ptr.hpp>
 #include <string>
 #include "gazebo/transport/CallbackHelper.hh"
+#include "gazebo/transport/QueuePolicy.hh"
 #include "gazebo/util/system.hh"
 
 namespace gazebo
@@ -103,10 +104,29 @@ namespace gazebo
                 return this->latching;
               }
 
+      /// \brief Set how the node queues incoming messages until the
+      /// callback runs.
+      /// \param[in] _policy The queue policy.
+      public: void SetQueuePolicy(const QueuePolicy &_policy)
+              {
+                this->queuePolicy = _policy;
+              }
+
+      /// \brief Get how the node queues incoming messages until the
+      /// callback runs.
+      /// \return The queue policy.
+      public: QueuePolicy GetQueuePolicy() const
+              {
+                return this->queuePolicy;
+              }
+
       private: std::string topic;
       private: std::string msgType;
       private: NodePtr node;
       private: bool latching;
+
+      /// \brief How incoming messages are queued.
+      private: QueuePolicy queuePolicy;
     };
     /// \}
   }
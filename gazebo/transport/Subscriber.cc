@@ -53,6 +53,14 @@ void Subscriber::Unsubscribe() const
   }
 }
 
+//////////////////////////////////////////////////
+uint64_t Subscriber::DroppedMessageCount() const
+{
+  if (this->node)
+    return this->node->DroppedMessageCount(this->topic);
+  return 0;
+}
+
 //////////////////////////////////////////////////
 void Subscriber::SetCallbackId(unsigned int _id)
 {
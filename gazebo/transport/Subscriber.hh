@@ -21,6 +21,7 @@
 #ifndef GAZEBO_TRANSPORT_SUBSCRIBER_HH_
 #define GAZEBO_TRANSPORT_SUBSCRIBER_HH_
 
+#include <cstdint>
 #include <string>
 #include <boost/shared_ptr.hpp>
 
@@ -65,6 +66,12 @@ namespace gazebo
       /// \brief Unsubscribe from the topic
       public: void Unsubscribe() const;
 
+      /// \brief Get the number of messages of the topic that the node
+      /// dropped because of the queue policy. The count is shared by the
+      /// subscriptions of the node to the same topic.
+      /// \return Number of dropped messages.
+      public: uint64_t DroppedMessageCount() const;
+
       /// \brief Topic this object is subscribe to.
       private: std::string topic;
 
@@ -14,9 +14,13 @@
  * limitations under the License.
  *
 */
+#include <cstring>
+
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
+#include "gazebo/common/WeakBind.hh"
 #include "gazebo/transport/ConnectionManager.hh"
+#include "gazebo/transport/ShmRing.hh"
 #include "gazebo/transport/SubscriptionTransport.hh"
 
 using namespace gazebo;
@@ -32,6 +36,9 @@ SubscriptionTransport::SubscriptionTransport()
 //////////////////////////////////////////////////
 SubscriptionTransport::~SubscriptionTransport()
 {
+  if (this->shm)
+    this->shm->Close();
+
   ConnectionManager::Instance()->RemoveConnection(this->connection);
   this->connection.reset();
 }
@@ -41,6 +48,68 @@ void SubscriptionTransport::Init(ConnectionPtr _conn, bool _latching)
 {
   this->connection = _conn;
   this->latching = _latching;
+
+  // Keep reading for control packets sent after the subscription
+  if (this->connection->IsOpen())
+  {
+    this->connection->AsyncRead(
+        common::weakBind(&SubscriptionTransport::OnControl,
+          this->shared_from_this(), this->connection, _1));
+  }
+}
+
+//////////////////////////////////////////////////
+void SubscriptionTransport::OnControl(ConnectionPtr _conn,
+    const std::string &_data)
+{
+  if (!_data.empty())
+  {
+    msgs::Packet packet;
+    packet.ParseFromString(_data);
+
+    if (packet.type() == "shm")
+    {
+      msgs::GzString msg;
+      msg.ParseFromString(packet.serialized_data());
+
+      ShmRingPtr ring(new ShmRing());
+      if (ring->Open(msg.data()))
+      {
+        // The first frame tells the subscriber how many messages were sent
+        // through the socket before the ring, and are to be delivered first
+        std::lock_guard<std::mutex> lock(this->shmMutex);
+        std::string attach(1 + sizeof(this->socketCount), 'a');
+        std::memcpy(&attach[1], &this->socketCount, sizeof(this->socketCount));
+        if (ring->WriteControl(attach))
+          this->shm = ring;
+        else
+          ring->Close();
+      }
+      else
+      {
+        gzwarn << "Unable to open shared memory ring [" << msg.data()
+               << "], using the socket instead\n";
+      }
+    }
+    else
+    {
+      gzerr << "Unexpected packet type[" << packet.type()
+            << "] from a subscriber\n";
+    }
+  }
+
+  if (_conn->IsOpen())
+  {
+    _conn->AsyncRead(common::weakBind(&SubscriptionTransport::OnControl,
+          this->shared_from_this(), _conn, _1));
+  }
+}
+
+//////////////////////////////////////////////////
+bool SubscriptionTransport::UsingShm() const
+{
+  std::lock_guard<std::mutex> lock(this->shmMutex);
+  return this->shm != nullptr;
 }
 
 //////////////////////////////////////////////////
@@ -58,7 +127,35 @@ bool SubscriptionTransport::HandleData(const std::string &_newdata,
   bool result = false;
   if (this->connection->IsOpen())
   {
-    this->connection->EnqueueMsg(_newdata, _cb, _id);
+    bool written = false;
+    {
+      std::lock_guard<std::mutex> lock(this->shmMutex);
+      if (this->shm)
+      {
+        written = this->shm->Write(_newdata);
+
+        // A message that doesn't fit goes through the socket, after a
+        // control frame telling the subscriber to wait for it. If even that
+        // doesn't fit, close the ring, the subscriber reads what is left in
+        // it before going back to the socket.
+        if (!written && !this->shm->WriteControl("s"))
+        {
+          this->shm->Close();
+          this->shm.reset();
+        }
+      }
+
+      if (!written)
+      {
+        this->connection->EnqueueMsg(_newdata, _cb, _id);
+        ++this->socketCount;
+      }
+    }
+
+    // The message is in the subscriber's memory already
+    if (written && !_cb.empty())
+      _cb(_id);
+
     result = true;
   }
   else
@@ -17,8 +17,11 @@
 #ifndef _SUBSCRIPTIONTRANSPORT_HH_
 #define _SUBSCRIPTIONTRANSPORT_HH_
 
+#include <boost/enable_shared_from_this.hpp>
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
+#include <cstdint>
+#include <mutex>
 #include <string>
 
 #include "Connection.hh"
@@ -36,7 +39,14 @@ namespace gazebo
     /// transport/transport.hh
     /// \brief Handles sending data over the wire to
     /// remote subscribers
-    class GZ_TRANSPORT_VISIBLE SubscriptionTransport : public CallbackHelper
+    ///
+    /// If the remote subscriber offers a shared memory ring, see ShmRing,
+    /// messages are written to the ring instead of the socket. A message
+    /// that doesn't fit in the ring still goes through the socket, and a
+    /// control frame in the ring tells the subscriber where it belongs, so
+    /// the subscriber gets the messages in order.
+    class GZ_TRANSPORT_VISIBLE SubscriptionTransport : public CallbackHelper,
+      public boost::enable_shared_from_this<SubscriptionTransport>
     {
       /// \brief Constructor
       public: SubscriptionTransport();
@@ -71,7 +81,27 @@ namespace gazebo
       /// is tied to a  remote connection
       public: virtual bool IsLocal() const;
 
+      /// \brief Get whether messages are sent through shared memory.
+      /// \return True if the remote subscriber's ring is in use.
+      public: bool UsingShm() const;
+
+      /// \brief Called when the remote subscriber sends a control packet
+      /// after the initial subscription.
+      /// \param[in] _conn Connection the packet was read from.
+      /// \param[in] _data The packet.
+      private: void OnControl(ConnectionPtr _conn, const std::string &_data);
+
       private: ConnectionPtr connection;
+
+      /// \brief Ring offered by the remote subscriber.
+      private: ShmRingPtr shm;
+
+      /// \brief Number of messages sent through the socket.
+      private: uint64_t socketCount = 0;
+
+      /// \brief Protects shm and socketCount, and keeps the order of the
+      /// messages the same in the ring and the socket.
+      private: mutable std::mutex shmMutex;
     };
     /// \}
   }
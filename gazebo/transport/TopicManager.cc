@@ -18,7 +18,12 @@
 #include <tbb/blocked_range.h>
 
 #include <boost/function.hpp>
+#include <cstdlib>
+#include <string>
+
+#include "gazebo/common/Console.hh"
 #include "gazebo/msgs/msgs.hh"
+#include "gazebo/transport/CallbackExecutor.hh"
 #include "gazebo/transport/Node.hh"
 #include "gazebo/transport/Publication.hh"
 #include "gazebo/transport/TopicManager.hh"
@@ -72,6 +77,24 @@ void TopicManager::Init()
   this->advertisedTopicsEnd = this->advertisedTopics.end();
   this->subscribedNodes.clear();
   this->nodes.clear();
+
+  int threads = 0;
+  const char *threadsEnv = getenv("GAZEBO_TRANSPORT_CALLBACK_THREADS");
+  if (threadsEnv)
+  {
+    try
+    {
+      threads = std::stoi(threadsEnv);
+    }
+    catch(...)
+    {
+      gzerr << "Invalid GAZEBO_TRANSPORT_CALLBACK_THREADS[" << threadsEnv
+            << "], running callbacks on the connection manager thread\n";
+    }
+  }
+
+  if (threads > 0 && !this->executor)
+    this->executor.reset(new CallbackExecutor(threads));
 }
 
 //////////////////////////////////////////////////
@@ -81,6 +104,12 @@ void TopicManager::Fini()
   this->ProcessNodes(true);
   // ConnectionManager::Instance()->RunUpdate();
 
+  if (this->executor)
+  {
+    this->executor->Wait();
+    this->executor.reset();
+  }
+
   PublicationPtr_M::iterator iter;
   for (iter = this->advertisedTopics.begin();
        iter != this->advertisedTopics.end(); ++iter)
@@ -193,7 +222,15 @@ void TopicManager::ProcessNodes(bool _onlyOut)
 
       for (int i = 0; i < s; ++i)
       {
-        this->nodes[i]->ProcessIncoming();
+        // With an executor, nodes run their callbacks in parallel
+        if (this->executor)
+        {
+          if (this->nodes[i]->IncomingQueueDepth() > 0)
+            this->executor->Schedule(this->nodes[i]);
+        }
+        else
+          this->nodes[i]->ProcessIncoming();
+
         if (this->pauseIncoming)
           break;
       }
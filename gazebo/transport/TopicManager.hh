@@ -20,6 +20,7 @@
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
 #include <map>
+#include <memory>
 #include <list>
 #include <string>
 #include <vector>
@@ -262,6 +263,11 @@ namespace gazebo
 
       private: bool pauseIncoming;
 
+      /// \brief Runs the subscriber callbacks when
+      /// GAZEBO_TRANSPORT_CALLBACK_THREADS is greater than zero, null
+      /// otherwise.
+      private: std::unique_ptr<CallbackExecutor> executor;
+
       // Singleton implementation
       private: friend class SingletonT<TopicManager>;
     };
@@ -16,6 +16,7 @@
  */
 #include <functional>
 #include <iomanip>
+#include <sstream>
 #include <ignition/math/SignalStats.hh>
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/CommonIface.hh"
@@ -59,6 +60,10 @@ DiagnosticManager::DiagnosticManager()
 #endif
 
   this->dataPtr->logPath = this->dataPtr->logPath / "diagnostics" / timeStr;
+
+  const char *traceEnv = common::getEnv("GAZEBO_TRACE");
+  if (traceEnv && std::string(traceEnv) == "1")
+    this->SetTracing(true);
 }
 
 //////////////////////////////////////////////////
@@ -75,6 +80,7 @@ void DiagnosticManager::Fini()
   this->dataPtr->timers.clear();
 
   this->dataPtr->pub.reset();
+  this->dataPtr->traceSub.reset();
   if (this->dataPtr->node)
     this->dataPtr->node->Fini();
   this->dataPtr->node.reset();
@@ -90,6 +96,9 @@ void DiagnosticManager::Init(const std::string &_worldName)
   this->dataPtr->pub =
     this->dataPtr->node->Advertise<msgs::Diagnostics>("~/diagnostics");
 
+  this->dataPtr->traceSub = this->dataPtr->node->Subscribe(
+      "~/diagnostics/trace", &DiagnosticManager::OnTrace, this);
+
   this->dataPtr->updateConnection = event::Events::ConnectWorldUpdateBegin(
       std::bind(&DiagnosticManager::Update, this, std::placeholders::_1));
 }
@@ -100,6 +109,60 @@ boost::filesystem::path DiagnosticManager::LogPath() const
   return this->dataPtr->logPath;
 }
 
+//////////////////////////////////////////////////
+void DiagnosticManager::SetTracing(const bool _enable)
+{
+  common::Trace::SetEnabled(_enable);
+}
+
+//////////////////////////////////////////////////
+bool DiagnosticManager::Tracing() const
+{
+  return common::Trace::Enabled();
+}
+
+//////////////////////////////////////////////////
+bool DiagnosticManager::ExportTrace(const std::string &_filename)
+{
+  std::string filename = _filename;
+  if (filename.empty())
+  {
+    if (!boost::filesystem::exists(this->dataPtr->logPath))
+      boost::filesystem::create_directories(this->dataPtr->logPath);
+    filename = (this->dataPtr->logPath / "trace.json").string();
+  }
+
+  if (!common::Trace::Export(filename))
+    return false;
+
+  gzmsg << "Wrote " << common::Trace::EventCount() << " trace events to "
+        << filename << std::endl;
+  return true;
+}
+
+//////////////////////////////////////////////////
+void DiagnosticManager::OnTrace(ConstGzStringPtr &_msg)
+{
+  std::istringstream stream(_msg->data());
+  std::string command, filename;
+  stream >> command;
+  std::getline(stream >> std::ws, filename);
+
+  if (command == "start")
+    this->SetTracing(true);
+  else if (command == "stop")
+    this->SetTracing(false);
+  else if (command == "clear")
+    common::Trace::Clear();
+  else if (command == "export")
+    this->ExportTrace(filename);
+  else
+  {
+    gzerr << "Unknown trace command[" << _msg->data() << "], must be one of "
+          << "start, stop, clear or export [filename]\n";
+  }
+}
+
 //////////////////////////////////////////////////
 void DiagnosticManager::Update(const common::UpdateInfo &_info)
 {
@@ -25,6 +25,8 @@
 #include "gazebo/common/UpdateInfo.hh"
 #include "gazebo/common/SingletonT.hh"
 #include "gazebo/common/Timer.hh"
+#include "gazebo/common/Trace.hh"
+#include "gazebo/msgs/msgs.hh"
 
 #include "gazebo/util/UtilTypes.hh"
 #include "gazebo/util/system.hh"
@@ -74,6 +76,14 @@ namespace gazebo
 
     /// \class DiagnosticManager Diagnostics.hh util/util.hh
     /// \brief A diagnostic manager class
+    ///
+    /// Besides the DIAG_TIMER timers, which are only compiled in with
+    /// ENABLE_DIAGNOSTICS, the manager controls the always available
+    /// scope tracing of common::Trace. Tracing is started at launch when
+    /// the GAZEBO_TRACE environment variable is set to 1, and at runtime by
+    /// publishing a GzString on ~/diagnostics/trace with one of:
+    /// "start", "stop", "clear", or "export [filename]". The default export
+    /// file is trace.json in LogPath().
     class GZ_UTIL_VISIBLE DiagnosticManager :
       public SingletonT<DiagnosticManager>
     {
@@ -130,6 +140,25 @@ namespace gazebo
       /// \return The path in which logs are stored.
       public: boost::filesystem::path LogPath() const;
 
+      /// \brief Start or stop recording trace events.
+      /// \param[in] _enable True to start recording.
+      public: void SetTracing(const bool _enable);
+
+      /// \brief Get whether trace events are being recorded.
+      /// \return True if recording.
+      public: bool Tracing() const;
+
+      /// \brief Export the recorded trace events in the Chrome trace event
+      /// format.
+      /// \param[in] _filename File to write, trace.json in LogPath() if
+      /// empty.
+      /// \return False if the file could not be written.
+      public: bool ExportTrace(const std::string &_filename = "");
+
+      /// \brief Handle a trace control command.
+      /// \param[in] _msg Command, see the class description.
+      private: void OnTrace(ConstGzStringPtr &_msg);
+
       /// \brief Publishes diagnostic information.
       /// \param[in] _info World update information.
       private: void Update(const common::UpdateInfo &_info);
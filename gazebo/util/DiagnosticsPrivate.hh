@@ -48,6 +48,9 @@ namespace gazebo
       /// \brief Publisher of diagnostic data.
       public: transport::PublisherPtr pub;
 
+      /// \brief Subscriber to trace control commands.
+      public: transport::SubscriberPtr traceSub;
+
       /// \brief The message to output
       public: msgs::Diagnostics msg;
 
@@ -43,6 +43,28 @@ TEST_F(DiagnosticsTest, Diagnostics)
   EXPECT_TRUE(mgr->Time(0) <= after - prev);
 }
 
+/////////////////////////////////////////////////
+TEST_F(DiagnosticsTest, Tracing)
+{
+  util::DiagnosticManager *mgr = util::DiagnosticManager::Instance();
+  ASSERT_TRUE(mgr != NULL);
+
+  mgr->SetTracing(true);
+  EXPECT_TRUE(mgr->Tracing());
+  EXPECT_TRUE(common::Trace::Enabled());
+  {
+    GZ_TRACE_SCOPE("DiagnosticsTest::Tracing");
+  }
+  mgr->SetTracing(false);
+  EXPECT_FALSE(mgr->Tracing());
+  EXPECT_GE(common::Trace::EventCount(), 1u);
+
+  // Export to the default location
+  EXPECT_TRUE(mgr->ExportTrace());
+  EXPECT_TRUE(boost::filesystem::exists(mgr->LogPath() / "trace.json"));
+  boost::filesystem::remove(mgr->LogPath() / "trace.json");
+}
+
 
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
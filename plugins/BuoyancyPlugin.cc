@@ -15,14 +15,299 @@
  *
 */
 
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <cmath>
+#include <set>
+#include <string>
+
+#include <ignition/math/Matrix3.hh>
+
 #include "gazebo/common/Assert.hh"
+#include "gazebo/common/CommonIface.hh"
 #include "gazebo/common/Events.hh"
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshManager.hh"
 #include "plugins/BuoyancyPlugin.hh"
 
 using namespace gazebo;
 
 GZ_REGISTER_MODEL_PLUGIN(BuoyancyPlugin)
 
+namespace
+{
+  /// \brief Number of segments around tessellated spheres and cylinders.
+  const unsigned int kSegments = 24;
+
+  /// \brief Number of latitude bands of tessellated spheres.
+  const unsigned int kBands = 12;
+
+  /// \brief Triangles of a collision shape in the shape frame.
+  struct Triangles
+  {
+    /// \brief Vertices.
+    std::vector<ignition::math::Vector3d> vertices;
+
+    /// \brief Vertex indices, three per triangle.
+    std::vector<unsigned int> indices;
+  };
+
+  /// \brief Add a triangle of a convex shape centered on the origin,
+  /// oriented to face away from the origin.
+  /// \param[in,out] _tris Triangles to add to.
+  /// \param[in] _a First vertex index.
+  /// \param[in] _b Second vertex index.
+  /// \param[in] _c Third vertex index.
+  void AddConvexTriangle(Triangles &_tris, const unsigned int _a,
+      const unsigned int _b, const unsigned int _c)
+  {
+    const auto &a = _tris.vertices[_a];
+    const auto &b = _tris.vertices[_b];
+    const auto &c = _tris.vertices[_c];
+    const bool outward = (b - a).Cross(c - a).Dot(a + b + c) >= 0;
+    _tris.indices.push_back(_a);
+    _tris.indices.push_back(outward ? _b : _c);
+    _tris.indices.push_back(outward ? _c : _b);
+  }
+
+  /// \brief Get the volume enclosed by outward facing triangles.
+  /// \param[in] _tris Closed triangle mesh.
+  /// \return Volume.
+  double Volume(const Triangles &_tris)
+  {
+    double volume = 0;
+    for (size_t i = 0; i + 2 < _tris.indices.size(); i += 3)
+    {
+      volume += _tris.vertices[_tris.indices[i]].Dot(
+          _tris.vertices[_tris.indices[i + 1]].Cross(
+          _tris.vertices[_tris.indices[i + 2]])) / 6.0;
+    }
+    return volume;
+  }
+
+  /// \brief Triangulate a box.
+  /// \param[in] _size Size of the box.
+  /// \return Triangles of the box.
+  Triangles Box(const ignition::math::Vector3d &_size)
+  {
+    Triangles tris;
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      tris.vertices.push_back(ignition::math::Vector3d(
+          (i & 1) ? _size.X() * 0.5 : -_size.X() * 0.5,
+          (i & 2) ? _size.Y() * 0.5 : -_size.Y() * 0.5,
+          (i & 4) ? _size.Z() * 0.5 : -_size.Z() * 0.5));
+    }
+
+    // Corners of each face, in order around the face
+    const unsigned int faces[6][4] = {{0, 1, 3, 2}, {4, 5, 7, 6},
+        {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 3, 7, 5}};
+    for (const auto &face : faces)
+    {
+      AddConvexTriangle(tris, face[0], face[1], face[2]);
+      AddConvexTriangle(tris, face[0], face[2], face[3]);
+    }
+    return tris;
+  }
+
+  /// \brief Triangulate a sphere, scaled to have the volume of the
+  /// sphere.
+  /// \param[in] _radius Radius of the sphere.
+  /// \return Triangles of the sphere.
+  Triangles Sphere(const double _radius)
+  {
+    Triangles tris;
+    for (unsigned int i = 0; i <= kBands; ++i)
+    {
+      const double lat = IGN_PI * i / kBands;
+      for (unsigned int j = 0; j < kSegments; ++j)
+      {
+        const double lon = 2 * IGN_PI * j / kSegments;
+        tris.vertices.push_back(_radius * ignition::math::Vector3d(
+            std::sin(lat) * std::cos(lon), std::sin(lat) * std::sin(lon),
+            std::cos(lat)));
+      }
+    }
+
+    for (unsigned int i = 0; i < kBands; ++i)
+    {
+      for (unsigned int j = 0; j < kSegments; ++j)
+      {
+        const unsigned int a = i * kSegments + j;
+        const unsigned int b = i * kSegments + (j + 1) % kSegments;
+        const unsigned int c = a + kSegments;
+        const unsigned int d = b + kSegments;
+
+        // The triangles touching the poles are degenerate
+        if (i + 1 < kBands)
+          AddConvexTriangle(tris, a, c, d);
+        if (i > 0)
+          AddConvexTriangle(tris, a, d, b);
+      }
+    }
+
+    const double scale = std::cbrt(
+        4.0 / 3.0 * IGN_PI * std::pow(_radius, 3) / Volume(tris));
+    for (auto &v : tris.vertices)
+      v *= scale;
+    return tris;
+  }
+
+  /// \brief Triangulate a cylinder along Z, scaled to have the volume of
+  /// the cylinder.
+  /// \param[in] _radius Radius of the cylinder.
+  /// \param[in] _length Length of the cylinder.
+  /// \return Triangles of the cylinder.
+  Triangles Cylinder(const double _radius, const double _length)
+  {
+    // Polygons with the area of the circle
+    const double radius = _radius * std::sqrt(2 * IGN_PI /
+        (kSegments * std::sin(2 * IGN_PI / kSegments)));
+
+    Triangles tris;
+    tris.vertices.push_back(ignition::math::Vector3d(0, 0, -_length * 0.5));
+    tris.vertices.push_back(ignition::math::Vector3d(0, 0, _length * 0.5));
+    for (unsigned int j = 0; j < kSegments; ++j)
+    {
+      const double lon = 2 * IGN_PI * j / kSegments;
+      tris.vertices.push_back(ignition::math::Vector3d(
+          radius * std::cos(lon), radius * std::sin(lon), -_length * 0.5));
+      tris.vertices.push_back(ignition::math::Vector3d(
+          radius * std::cos(lon), radius * std::sin(lon), _length * 0.5));
+    }
+
+    for (unsigned int j = 0; j < kSegments; ++j)
+    {
+      const unsigned int a = 2 + 2 * j;
+      const unsigned int b = 2 + 2 * ((j + 1) % kSegments);
+      AddConvexTriangle(tris, 0, a, b);
+      AddConvexTriangle(tris, 1, a + 1, b + 1);
+      AddConvexTriangle(tris, a, b, b + 1);
+      AddConvexTriangle(tris, a, b + 1, a + 1);
+    }
+    return tris;
+  }
+
+  /// \brief Add the triangles of a submesh.
+  /// \param[in] _submesh The submesh.
+  /// \param[in] _scale Scale of the mesh.
+  /// \param[in,out] _tris Triangles to add to, as oriented in the mesh.
+  void AppendSubMesh(const common::SubMesh &_submesh,
+      const ignition::math::Vector3d &_scale, Triangles &_tris)
+  {
+    if (_submesh.GetPrimitiveType() != common::SubMesh::TRIANGLES)
+      return;
+
+    const unsigned int offset = _tris.vertices.size();
+    for (unsigned int v = 0; v < _submesh.GetVertexCount(); ++v)
+      _tris.vertices.push_back(_submesh.Vertex(v) * _scale);
+    for (unsigned int j = 0; j + 2 < _submesh.GetIndexCount(); j += 3)
+    {
+      _tris.indices.push_back(offset + _submesh.GetIndex(j));
+      _tris.indices.push_back(offset + _submesh.GetIndex(j + 1));
+      _tris.indices.push_back(offset + _submesh.GetIndex(j + 2));
+    }
+  }
+
+  /// \brief Get the triangles of a mesh shape, or of the submesh named in
+  /// its <submesh> element.
+  /// \param[in] _mesh The mesh.
+  /// \param[in] _scale Scale of the mesh.
+  /// \param[in] _meshElem The <mesh> element of the shape.
+  /// \param[out] _tris Triangles of the shape, as oriented in the mesh.
+  /// \return False if the submesh is not found.
+  bool MeshTriangles(const common::Mesh &_mesh,
+      const ignition::math::Vector3d &_scale, sdf::ElementPtr _meshElem,
+      Triangles &_tris)
+  {
+    _tris = Triangles();
+    if (_meshElem && _meshElem->HasElement("submesh"))
+    {
+      sdf::ElementPtr submeshElem = _meshElem->GetElement("submesh");
+      const std::string name = submeshElem->Get<std::string>("name");
+      if (name != "__default__" && !name.empty())
+      {
+        const common::SubMesh *submesh = _mesh.GetSubMesh(name);
+        if (!submesh)
+          return false;
+
+        // Center the submesh like MeshShape does
+        common::SubMesh centered(submesh);
+        if (submeshElem->HasElement("center") &&
+            submeshElem->Get<bool>("center"))
+        {
+          centered.Center(ignition::math::Vector3d::Zero);
+        }
+        AppendSubMesh(centered, _scale, _tris);
+        return true;
+      }
+    }
+
+    for (unsigned int i = 0; i < _mesh.GetSubMeshCount(); ++i)
+      AppendSubMesh(*_mesh.GetSubMesh(i), _scale, _tris);
+    return true;
+  }
+
+  /// \brief Get the triangles of a collision shape.
+  /// \param[in] _shape The shape.
+  /// \param[out] _tris Triangles of the shape in the shape frame.
+  /// \return False if the shape can not be triangulated.
+  bool ShapeTriangles(const physics::ShapePtr &_shape, Triangles &_tris)
+  {
+    if (auto box = boost::dynamic_pointer_cast<physics::BoxShape>(_shape))
+    {
+      _tris = Box(box->Size());
+      return true;
+    }
+    if (auto sphere =
+        boost::dynamic_pointer_cast<physics::SphereShape>(_shape))
+    {
+      _tris = Sphere(sphere->GetRadius());
+      return true;
+    }
+    if (auto cylinder =
+        boost::dynamic_pointer_cast<physics::CylinderShape>(_shape))
+    {
+      _tris = Cylinder(cylinder->GetRadius(), cylinder->GetLength());
+      return true;
+    }
+    if (auto meshShape =
+        boost::dynamic_pointer_cast<physics::MeshShape>(_shape))
+    {
+      common::MeshManager *meshManager = common::MeshManager::Instance();
+      const common::Mesh *mesh = meshManager->GetMesh(meshShape->GetMeshURI());
+      if (!mesh)
+        mesh = meshManager->Load(common::find_file(meshShape->GetMeshURI()));
+      if (!mesh)
+        return false;
+
+      return MeshTriangles(*mesh, meshShape->Size(), meshShape->GetSDF(),
+          _tris) && !_tris.indices.empty();
+    }
+    return false;
+  }
+
+  /// \brief Add the triangles of a collision to the mesh of its link.
+  /// \param[in] _tris Triangles in the collision frame.
+  /// \param[in] _pose Pose of the collision in the link frame.
+  /// \param[in,out] _mesh Mesh of the link.
+  void Append(const Triangles &_tris, const ignition::math::Pose3d &_pose,
+      BuoyancyMesh &_mesh)
+  {
+    const unsigned int offset = _mesh.x.size();
+    for (const auto &vertex : _tris.vertices)
+    {
+      const ignition::math::Vector3d v = _pose.CoordPositionAdd(vertex);
+      _mesh.x.push_back(v.X());
+      _mesh.y.push_back(v.Y());
+      _mesh.z.push_back(v.Z());
+    }
+    for (const auto index : _tris.indices)
+      _mesh.indices.push_back(offset + index);
+  }
+}
+
 /////////////////////////////////////////////////
 BuoyancyPlugin::BuoyancyPlugin()
   // Density of liquid water at 1 atm pressure and 15 degrees Celsius.
@@ -46,6 +331,57 @@ void BuoyancyPlugin::Load(physics::ModelPtr _model, sdf::ElementPtr _sdf)
     this->fluidDensity = this->sdf->Get<double>("fluid_density");
   }
 
+  if (this->sdf->HasElement("water_surface"))
+  {
+    this->hasSurface = true;
+    sdf::ElementPtr surfaceElem = this->sdf->GetElement("water_surface");
+    if (surfaceElem->HasElement("level"))
+      this->surfaceLevel = surfaceElem->Get<double>("level");
+
+    const double gravity = world->Gravity().Length() > 0 ?
+        world->Gravity().Length() : 9.80665;
+    for (sdf::ElementPtr waveElem = surfaceElem->HasElement("wave") ?
+         surfaceElem->GetElement("wave") : nullptr; waveElem;
+         waveElem = waveElem->GetNextElement("wave"))
+    {
+      BuoyancyWave wave;
+      if (waveElem->HasElement("amplitude"))
+        wave.amplitude = waveElem->Get<double>("amplitude");
+
+      const double wavelength = waveElem->HasElement("wavelength") ?
+          waveElem->Get<double>("wavelength") : 0;
+      if (wavelength <= 0)
+      {
+        gzwarn << "Nonpositive wavelength specified in BuoyancyPlugin, "
+               << "skipping wave" << std::endl;
+        continue;
+      }
+      wave.wavenumber = 2 * IGN_PI / wavelength;
+
+      const double period = waveElem->HasElement("period") ?
+          waveElem->Get<double>("period") : 0;
+      wave.frequency = period > 0 ? 2 * IGN_PI / period :
+          std::sqrt(gravity * wave.wavenumber);
+
+      if (waveElem->HasElement("direction"))
+      {
+        wave.direction = waveElem->Get<ignition::math::Vector2d>("direction");
+        if (wave.direction.Length() <= 0)
+        {
+          gzwarn << "Zero wave direction specified in BuoyancyPlugin, using "
+                 << "1 0" << std::endl;
+          wave.direction.Set(1, 0);
+        }
+        wave.direction.Normalize();
+      }
+
+      if (waveElem->HasElement("phase"))
+        wave.phase = waveElem->Get<double>("phase");
+
+      this->waves.push_back(wave);
+    }
+  }
+
   // Get "center of volume" and "volume" that were inputted in SDF
   // SDF input is recommended for mesh or polylines collision shapes
   if (this->sdf->HasElement("link"))
@@ -117,6 +453,11 @@ void BuoyancyPlugin::Load(physics::ModelPtr _model, sdf::ElementPtr _sdf)
     }
   }
 
+  // Links whose properties were given by the user
+  std::set<int> userLinks;
+  for (const auto &props : this->volPropsMap)
+    userLinks.insert(props.first);
+
   // For links the user didn't input, precompute the center of volume and
   // density. This will be accurate for simple shapes.
   for (auto link : this->model->GetLinks())
@@ -141,6 +482,35 @@ void BuoyancyPlugin::Load(physics::ModelPtr _model, sdf::ElementPtr _sdf)
       this->volPropsMap[id].volume = volumeSum;
     }
   }
+
+  this->links.clear();
+  for (auto link : this->model->GetLinks())
+  {
+    BuoyancyLink buoyancyLink;
+    buoyancyLink.link = link;
+    buoyancyLink.props = this->volPropsMap[link->GetId()];
+
+    // Build the mesh clipped against the water surface
+    if (this->hasSurface && userLinks.count(link->GetId()) == 0)
+    {
+      for (auto collision : link->GetCollisions())
+      {
+        Triangles tris;
+        if (!ShapeTriangles(collision->GetShape(), tris))
+        {
+          gzwarn << "Unable to triangulate collision ["
+                 << collision->GetScopedName() << "] in BuoyancyPlugin, "
+                 << "link [" << link->GetName() << "] is assumed to be "
+                 << "fully submerged" << std::endl;
+          buoyancyLink.mesh = BuoyancyMesh();
+          break;
+        }
+        Append(tris, collision->RelativePose(), buoyancyLink.mesh);
+      }
+    }
+
+    this->links.push_back(buoyancyLink);
+  }
 }
 
 /////////////////////////////////////////////////
@@ -153,9 +523,46 @@ void BuoyancyPlugin::Init()
 /////////////////////////////////////////////////
 void BuoyancyPlugin::OnUpdate()
 {
-  for (auto link : this->model->GetLinks())
+  const ignition::math::Vector3d gravity =
+      this->model->GetWorld()->Gravity();
+
+  // Clip the links against the water surface, each link only writes its own
+  // state
+  if (this->hasSurface)
+  {
+    const double time = this->model->GetWorld()->SimTime().Double();
+    if (this->links.size() > 1)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, this->links.size()),
+          [&](const tbb::blocked_range<size_t> &_range)
+          {
+            for (size_t i = _range.begin(); i != _range.end(); ++i)
+            {
+              if (!this->links[i].mesh.indices.empty())
+                this->Submerge(this->links[i], time);
+            }
+          });
+    }
+    else if (!this->links.empty() && !this->links[0].mesh.indices.empty())
+    {
+      this->Submerge(this->links[0], time);
+    }
+  }
+
+  for (auto &buoyancyLink : this->links)
   {
-    VolumeProperties volumeProperties = this->volPropsMap[link->GetId()];
+    if (!buoyancyLink.mesh.indices.empty())
+    {
+      if (buoyancyLink.volume > 0)
+      {
+        buoyancyLink.link->AddForceAtWorldPosition(
+            -this->fluidDensity * buoyancyLink.volume * gravity,
+            buoyancyLink.center);
+      }
+      continue;
+    }
+
+    const VolumeProperties &volumeProperties = buoyancyLink.props;
     double volume = volumeProperties.volume;
     GZ_ASSERT(volume > 0, "Nonpositive volume found in volume properties!");
 
@@ -163,14 +570,124 @@ void BuoyancyPlugin::OnUpdate()
     // buoyancy = -(mass*gravity)*fluid_density/object_density
     // object_density = mass/volume, so the mass term cancels.
     // Therefore,
-    ignition::math::Vector3d buoyancy =
-        -this->fluidDensity * volume * this->model->GetWorld()->Gravity();
+    ignition::math::Vector3d buoyancy = -this->fluidDensity * volume * gravity;
 
-    ignition::math::Pose3d linkFrame = link->WorldPose();
+    ignition::math::Pose3d linkFrame = buoyancyLink.link->WorldPose();
     // rotate buoyancy into the link frame before applying the force.
     ignition::math::Vector3d buoyancyLinkFrame =
         linkFrame.Rot().Inverse().RotateVector(buoyancy);
 
-    link->AddLinkForce(buoyancyLinkFrame, volumeProperties.cov);
+    buoyancyLink.link->AddLinkForce(buoyancyLinkFrame, volumeProperties.cov);
+  }
+}
+
+/////////////////////////////////////////////////
+double BuoyancyPlugin::SurfaceHeight(const double _x, const double _y,
+    const double _time, ignition::math::Vector2d &_gradient) const
+{
+  double height = this->surfaceLevel;
+  _gradient.Set(0, 0);
+  for (const auto &wave : this->waves)
+  {
+    const double angle = wave.wavenumber *
+        (wave.direction.X() * _x + wave.direction.Y() * _y) -
+        wave.frequency * _time + wave.phase;
+    height += wave.amplitude * std::cos(angle);
+    _gradient -= wave.direction *
+        (wave.amplitude * wave.wavenumber * std::sin(angle));
+  }
+  return height;
+}
+
+/////////////////////////////////////////////////
+void BuoyancyPlugin::Submerge(BuoyancyLink &_link, const double _time) const
+{
+  const ignition::math::Pose3d pose = _link.link->WorldPose();
+
+  // Plane tangent to the water surface below the link origin
+  ignition::math::Vector2d gradient;
+  const ignition::math::Vector3d origin(pose.Pos().X(), pose.Pos().Y(),
+      this->SurfaceHeight(pose.Pos().X(), pose.Pos().Y(), _time, gradient));
+  const ignition::math::Vector3d normal =
+      ignition::math::Vector3d(-gradient.X(), -gradient.Y(), 1).Normalize();
+
+  // Transform the vertices relative to the plane origin and get their
+  // depth. The loop has no branches so that the compiler vectorizes it.
+  const ignition::math::Matrix3d rot(pose.Rot());
+  const ignition::math::Vector3d offset = pose.Pos() - origin;
+  const double r00 = rot(0, 0), r01 = rot(0, 1), r02 = rot(0, 2);
+  const double r10 = rot(1, 0), r11 = rot(1, 1), r12 = rot(1, 2);
+  const double r20 = rot(2, 0), r21 = rot(2, 1), r22 = rot(2, 2);
+  const double ox = offset.X(), oy = offset.Y(), oz = offset.Z();
+  const double nx = normal.X(), ny = normal.Y(), nz = normal.Z();
+
+  const size_t count = _link.mesh.x.size();
+  _link.world.x.resize(count);
+  _link.world.y.resize(count);
+  _link.world.z.resize(count);
+  _link.depth.resize(count);
+
+  const double *lx = _link.mesh.x.data();
+  const double *ly = _link.mesh.y.data();
+  const double *lz = _link.mesh.z.data();
+  double *wx = _link.world.x.data();
+  double *wy = _link.world.y.data();
+  double *wz = _link.world.z.data();
+  double *depth = _link.depth.data();
+  for (size_t i = 0; i < count; ++i)
+  {
+    wx[i] = r00 * lx[i] + r01 * ly[i] + r02 * lz[i] + ox;
+    wy[i] = r10 * lx[i] + r11 * ly[i] + r12 * lz[i] + oy;
+    wz[i] = r20 * lx[i] + r21 * ly[i] + r22 * lz[i] + oz;
+    depth[i] = nx * wx[i] + ny * wy[i] + nz * wz[i];
+  }
+
+  // Sum the tetrahedra between the plane origin and the submerged part of
+  // each triangle. The cap closing the submerged volume lies in the plane,
+  // so its tetrahedra are flat and it can be left out.
+  double volume = 0;
+  ignition::math::Vector3d moment;
+  const std::vector<unsigned int> &indices = _link.mesh.indices;
+  for (size_t t = 0; t + 2 < indices.size(); t += 3)
+  {
+    const unsigned int idx[3] = {indices[t], indices[t + 1], indices[t + 2]};
+    if (depth[idx[0]] >= 0 && depth[idx[1]] >= 0 && depth[idx[2]] >= 0)
+      continue;
+
+    // Clip the triangle, keeping the vertex order
+    ignition::math::Vector3d poly[4];
+    unsigned int size = 0;
+    for (unsigned int k = 0; k < 3; ++k)
+    {
+      const unsigned int cur = idx[k];
+      const unsigned int next = idx[(k + 1) % 3];
+      const ignition::math::Vector3d p(wx[cur], wy[cur], wz[cur]);
+      if (depth[cur] < 0)
+        poly[size++] = p;
+      if ((depth[cur] < 0) != (depth[next] < 0))
+      {
+        const double s = depth[cur] / (depth[cur] - depth[next]);
+        poly[size++] = p + (ignition::math::Vector3d(wx[next], wy[next],
+            wz[next]) - p) * s;
+      }
+    }
+
+    for (unsigned int k = 1; k + 1 < size; ++k)
+    {
+      const double v = poly[0].Dot(poly[k].Cross(poly[k + 1])) / 6.0;
+      volume += v;
+      moment += v * (poly[0] + poly[k] + poly[k + 1]) * 0.25;
+    }
+  }
+
+  if (volume > 1e-12)
+  {
+    _link.volume = volume;
+    _link.center = origin + moment / volume;
+  }
+  else
+  {
+    _link.volume = 0;
+    _link.center = pose.Pos();
   }
 }
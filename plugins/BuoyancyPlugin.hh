@@ -19,6 +19,8 @@
 #define GAZEBO_PLUGINS_BUOYANCYPLUGIN_HH_
 
 #include <map>
+#include <vector>
+#include <ignition/math/Vector2.hh>
 #include <ignition/math/Vector3.hh>
 
 #include "gazebo/common/Event.hh"
@@ -40,6 +42,72 @@ namespace gazebo
     public: double volume;
   };
 
+  /// \brief Closed triangle mesh of the collisions of a link, in the link
+  /// frame. Coordinates are stored in separate arrays so that the per vertex
+  /// work of the hydrostatics runs over contiguous memory.
+  class BuoyancyMesh
+  {
+    /// \brief X coordinates of the vertices.
+    public: std::vector<double> x;
+
+    /// \brief Y coordinates of the vertices.
+    public: std::vector<double> y;
+
+    /// \brief Z coordinates of the vertices.
+    public: std::vector<double> z;
+
+    /// \brief Vertex indices, three per triangle, counter clockwise when
+    /// seen from outside.
+    public: std::vector<unsigned int> indices;
+  };
+
+  /// \brief A sinusoidal wave of the water surface.
+  class BuoyancyWave
+  {
+    /// \brief Amplitude in meters.
+    public: double amplitude = 0;
+
+    /// \brief Wave number, 2 pi over the wavelength.
+    public: double wavenumber = 0;
+
+    /// \brief Angular frequency, 2 pi over the period.
+    public: double frequency = 0;
+
+    /// \brief Unit direction of travel in the XY plane.
+    public: ignition::math::Vector2d direction = {1, 0};
+
+    /// \brief Phase in radians.
+    public: double phase = 0;
+  };
+
+  /// \brief Per link buoyancy state, resolved once on load.
+  class BuoyancyLink
+  {
+    /// \brief The link.
+    public: physics::LinkPtr link;
+
+    /// \brief Volume properties used when the link has no mesh.
+    public: VolumeProperties props;
+
+    /// \brief Collision mesh, empty if the link is always fully submerged.
+    public: BuoyancyMesh mesh;
+
+    /// \brief Vertices in the world frame, relative to the water plane
+    /// origin, reused every step.
+    public: BuoyancyMesh world;
+
+    /// \brief Signed distance of each vertex to the water plane, reused
+    /// every step.
+    public: std::vector<double> depth;
+
+    /// \brief Submerged volume computed in the last step.
+    public: double volume = 0;
+
+    /// \brief Center of the submerged volume in the world frame, computed
+    /// in the last step.
+    public: ignition::math::Vector3d center;
+  };
+
   /// \brief A plugin that simulates buoyancy of an object immersed in fluid.
   /// All SDF parameters are optional.
   /// <fluid_density> sets the density of the fluid that surrounds the buoyant
@@ -57,6 +125,27 @@ namespace gazebo
   /// to compute these properties from the link collision shapes. This
   /// computation will not be accurate if the object is not composed of simple
   /// collision shapes.
+  /// Without a <water_surface>, links are assumed to be fully submerged. With
+  /// one, the collision shapes of links without a <link> block (boxes,
+  /// spheres, cylinders and closed meshes) are clipped against the water
+  /// surface every step, and the buoyancy force is applied at the center of
+  /// the submerged volume. For example:
+  /// <water_surface>
+  ///   <level>0</level>
+  ///   <wave>
+  ///     <amplitude>0.2</amplitude>
+  ///     <wavelength>8</wavelength>
+  ///     <period>2.3</period>
+  ///     <direction>1 0</direction>
+  ///     <phase>0</phase>
+  ///   </wave>
+  /// </water_surface>
+  /// <level> Height of the calm surface in the world frame, default 0.
+  /// <wave> Sinusoidal waves added to the level, any number. The period
+  /// defaults to the deep water dispersion relation, and the direction and
+  /// phase to 1 0 and 0. Each link is clipped against the plane tangent to
+  /// the surface below the link origin, so wavelengths should be large
+  /// compared to the links.
   class GZ_PLUGIN_VISIBLE BuoyancyPlugin : public ModelPlugin
   {
     /// \brief Constructor.
@@ -72,6 +161,21 @@ namespace gazebo
     /// \brief Callback for World Update events.
     protected: virtual void OnUpdate();
 
+    /// \brief Get the height of the water surface.
+    /// \param[in] _x X position in the world frame.
+    /// \param[in] _y Y position in the world frame.
+    /// \param[in] _time Simulation time in seconds.
+    /// \param[out] _gradient Slope of the surface along X and Y.
+    /// \return Height of the surface in the world frame.
+    protected: double SurfaceHeight(const double _x, const double _y,
+                   const double _time, ignition::math::Vector2d &_gradient)
+                   const;
+
+    /// \brief Compute the submerged volume and its center for a link.
+    /// \param[in,out] _link Link to update.
+    /// \param[in] _time Simulation time in seconds.
+    protected: void Submerge(BuoyancyLink &_link, const double _time) const;
+
     /// \brief Connection to World Update events.
     protected: event::ConnectionPtr updateConnection;
 
@@ -88,6 +192,19 @@ namespace gazebo
     /// \brief Map of <link ID, point> pairs mapping link IDs to the CoV (center
     /// of volume) and volume of the link.
     protected: std::map<int, VolumeProperties> volPropsMap;
+
+    /// \brief Links of the model and their buoyancy state.
+    protected: std::vector<BuoyancyLink> links;
+
+    /// \brief True if a water surface is given, false if the links are
+    /// always fully submerged.
+    protected: bool hasSurface = false;
+
+    /// \brief Height of the calm water surface in the world frame.
+    protected: double surfaceLevel = 0;
+
+    /// \brief Waves of the water surface.
+    protected: std::vector<BuoyancyWave> waves;
   };
 }
 
@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "plugins/BuoyancyPlugin.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class BuoyancyPluginTest : public ServerFixture
+{
+  public: BuoyancyPluginTest()
+  {
+    this->Load("worlds/blank.world", true);
+    this->world = physics::get_world("default");
+  }
+
+  /// \brief Spawn a model with a single link and collision.
+  /// \param[in] _name Name of the model.
+  /// \param[in] _pose Pose of the model.
+  /// \param[in] _geometry Contents of the collision's <geometry>.
+  /// \return The model.
+  protected: physics::ModelPtr Spawn(const std::string &_name,
+      const std::string &_pose, const std::string &_geometry)
+  {
+    std::ostringstream sdf;
+    sdf << "<sdf version='1.6'>"
+        << "<model name='" << _name << "'>"
+        << "  <pose>" << _pose << "</pose>"
+        << "  <link name='link'>"
+        << "    <collision name='collision'>"
+        << "      <geometry>" << _geometry << "</geometry>"
+        << "    </collision>"
+        << "  </link>"
+        << "</model>"
+        << "</sdf>";
+    this->SpawnSDF(sdf.str());
+    return this->world->ModelByName(_name);
+  }
+
+  /// \brief Get a plugin element.
+  /// \param[in] _contents Contents of the <plugin> element.
+  /// \return The element.
+  protected: sdf::ElementPtr PluginSDF(const std::string &_contents)
+  {
+    std::ostringstream sdfStr;
+    sdfStr << "<sdf version='1.6'>"
+           << "<model name='m'>"
+           << "  <plugin name='buoyancy' filename='libBuoyancyPlugin.so'>"
+           << _contents
+           << "  </plugin>"
+           << "</model>"
+           << "</sdf>";
+    sdf::SDFPtr sdfParsed(new sdf::SDF());
+    sdf::init(sdfParsed);
+    sdf::readString(sdfStr.str(), sdfParsed);
+    return sdfParsed->Root()->GetElement("model")->GetElement("plugin");
+  }
+
+  protected: physics::WorldPtr world;
+};
+
+/// \brief Gives access to the clipped volume of the links.
+class TestBuoyancyPlugin : public BuoyancyPlugin
+{
+  public: using BuoyancyPlugin::links;
+  public: using BuoyancyPlugin::Submerge;
+  public: using BuoyancyPlugin::SurfaceHeight;
+};
+
+/// \brief Flat water at the level 0.
+static const char *kFlatWater =
+    "<water_surface><level>0</level></water_surface>";
+
+/////////////////////////////////////////////////
+TEST_F(BuoyancyPluginTest, HalfSubmergedBox)
+{
+  physics::ModelPtr model = this->Spawn("box", "0 0 0 0 0 0",
+      "<box><size>1 2 1</size></box>");
+  ASSERT_NE(nullptr, model);
+
+  TestBuoyancyPlugin plugin;
+  plugin.Load(model, this->PluginSDF(kFlatWater));
+  ASSERT_EQ(1u, plugin.links.size());
+  ASSERT_FALSE(plugin.links[0].mesh.indices.empty());
+
+  plugin.Submerge(plugin.links[0], 0);
+  EXPECT_NEAR(1.0, plugin.links[0].volume, 1e-9);
+  EXPECT_NEAR(0.0, plugin.links[0].center.X(), 1e-9);
+  EXPECT_NEAR(0.0, plugin.links[0].center.Y(), 1e-9);
+  EXPECT_NEAR(-0.25, plugin.links[0].center.Z(), 1e-9);
+
+  // Fully out of the water and fully submerged
+  model->SetWorldPose(ignition::math::Pose3d(0, 0, 1, 0, 0, 0));
+  plugin.Submerge(plugin.links[0], 0);
+  EXPECT_DOUBLE_EQ(0.0, plugin.links[0].volume);
+
+  model->SetWorldPose(ignition::math::Pose3d(0, 0, -3, 0, 0, 0));
+  plugin.Submerge(plugin.links[0], 0);
+  EXPECT_NEAR(2.0, plugin.links[0].volume, 1e-9);
+  EXPECT_NEAR(-3.0, plugin.links[0].center.Z(), 1e-9);
+}
+
+/////////////////////////////////////////////////
+TEST_F(BuoyancyPluginTest, HalfSubmergedSphere)
+{
+  const double radius = 0.5;
+  physics::ModelPtr model = this->Spawn("sphere", "0 0 0 0 0 0",
+      "<sphere><radius>0.5</radius></sphere>");
+  ASSERT_NE(nullptr, model);
+
+  TestBuoyancyPlugin plugin;
+  plugin.Load(model, this->PluginSDF(kFlatWater));
+  ASSERT_EQ(1u, plugin.links.size());
+
+  // The tessellation has the volume of the sphere and is symmetric about
+  // the equator. The centroid of a half sphere is 3/8 of the radius deep.
+  plugin.Submerge(plugin.links[0], 0);
+  EXPECT_NEAR(2.0 / 3.0 * IGN_PI * std::pow(radius, 3),
+      plugin.links[0].volume, 1e-9);
+  EXPECT_NEAR(0.0, plugin.links[0].center.X(), 1e-9);
+  EXPECT_NEAR(0.0, plugin.links[0].center.Y(), 1e-9);
+  EXPECT_NEAR(-3.0 / 8.0 * radius, plugin.links[0].center.Z(), 5e-3);
+}
+
+/////////////////////////////////////////////////
+TEST_F(BuoyancyPluginTest, TiltedMesh)
+{
+  // A 2 m cube scaled to 1 m, rolled 45 degrees so that its section is a
+  // diamond with the lower half submerged
+  const std::string uri = std::string(PROJECT_SOURCE_PATH) +
+      "/test/data/box.dae";
+  physics::ModelPtr model = this->Spawn("mesh", "0 0 0 0.785398163 0 0",
+      "<mesh><uri>" + uri + "</uri><scale>0.5 0.5 0.5</scale>"
+      "<submesh><name>Cube</name><center>true</center></submesh></mesh>");
+  ASSERT_NE(nullptr, model);
+
+  TestBuoyancyPlugin plugin;
+  plugin.Load(model, this->PluginSDF(kFlatWater));
+  ASSERT_EQ(1u, plugin.links.size());
+  ASSERT_FALSE(plugin.links[0].mesh.indices.empty());
+
+  // The centroid of the lower triangle of the diamond is a third of its
+  // height below the water
+  plugin.Submerge(plugin.links[0], 0);
+  EXPECT_NEAR(0.5, plugin.links[0].volume, 1e-6);
+  EXPECT_NEAR(0.0, plugin.links[0].center.X(), 1e-6);
+  EXPECT_NEAR(0.0, plugin.links[0].center.Y(), 1e-6);
+  EXPECT_NEAR(-std::sqrt(0.5) / 3.0, plugin.links[0].center.Z(), 1e-6);
+}
+
+/////////////////////////////////////////////////
+TEST_F(BuoyancyPluginTest, MissingSubmesh)
+{
+  const std::string uri = std::string(PROJECT_SOURCE_PATH) +
+      "/test/data/box.dae";
+  physics::ModelPtr model = this->Spawn("mesh", "0 0 0 0 0 0",
+      "<mesh><uri>" + uri + "</uri>"
+      "<submesh><name>NotThere</name></submesh></mesh>");
+  ASSERT_NE(nullptr, model);
+
+  // A link that can not be triangulated is always fully submerged
+  TestBuoyancyPlugin plugin;
+  plugin.Load(model, this->PluginSDF(kFlatWater));
+  ASSERT_EQ(1u, plugin.links.size());
+  EXPECT_TRUE(plugin.links[0].mesh.indices.empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(BuoyancyPluginTest, Wave)
+{
+  physics::ModelPtr model = this->Spawn("box", "0 0 0 0 0 0",
+      "<box><size>1 1 1</size></box>");
+  ASSERT_NE(nullptr, model);
+
+  TestBuoyancyPlugin plugin;
+  plugin.Load(model, this->PluginSDF(
+      "<water_surface><level>0</level><wave>"
+      "  <amplitude>0.2</amplitude>"
+      "  <wavelength>8</wavelength>"
+      "  <period>2</period>"
+      "</wave></water_surface>"));
+  ASSERT_EQ(1u, plugin.links.size());
+
+  // A crest over the box, the surface is flat and 0.2 m high
+  ignition::math::Vector2d gradient;
+  EXPECT_NEAR(0.2, plugin.SurfaceHeight(0, 0, 0, gradient), 1e-9);
+  EXPECT_NEAR(0.0, gradient.Length(), 1e-9);
+  plugin.Submerge(plugin.links[0], 0);
+  EXPECT_NEAR(0.7, plugin.links[0].volume, 1e-9);
+  EXPECT_NEAR(0.0, plugin.links[0].center.X(), 1e-9);
+  EXPECT_NEAR(-0.15, plugin.links[0].center.Z(), 1e-9);
+
+  // A quarter period later the surface crosses the box center with a
+  // slope rising along X. The plane through the center halves the box,
+  // and the submerged half leans toward the side where the water is high.
+  const double slope = 0.2 * 2 * IGN_PI / 8;
+  EXPECT_NEAR(0.0, plugin.SurfaceHeight(0, 0, 0.5, gradient), 1e-9);
+  EXPECT_NEAR(slope, gradient.X(), 1e-9);
+  EXPECT_NEAR(0.0, gradient.Y(), 1e-9);
+  plugin.Submerge(plugin.links[0], 0.5);
+  EXPECT_NEAR(0.5, plugin.links[0].volume, 1e-9);
+  EXPECT_GT(plugin.links[0].center.X(), 0.0);
+  EXPECT_NEAR(0.0, plugin.links[0].center.Y(), 1e-9);
+  EXPECT_LT(plugin.links[0].center.Z() - slope * plugin.links[0].center.X(),
+      0.0);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
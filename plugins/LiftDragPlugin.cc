@@ -163,8 +163,10 @@ void LiftDragPlugin::Load(physics::ModelPtr _model,
 void LiftDragPlugin::OnUpdate()
 {
   GZ_ASSERT(this->link, "Link was NULL");
-  // get linear velocity at cp in inertial frame
-  ignition::math::Vector3d vel = this->link->WorldLinearVel(this->cp);
+  // get airspeed at cp in inertial frame, the wind of the link is zero
+  // unless wind is enabled for it
+  ignition::math::Vector3d vel = this->link->WorldLinearVel(this->cp) -
+      this->link->WorldWindLinearVel();
   ignition::math::Vector3d velI = vel;
   velI.Normalize();
 
@@ -334,18 +334,13 @@ void SimpleTrackedVehiclePlugin::DriveTracks(
   // For each contact, compute the friction force direction and speed of
   // surface movement.
   ////////////////////////////////////////////////////////////////////////
-  size_t i = 0;
-  const auto contacts = this->contactManager->GetContacts();
+  // Only the contacts of this vehicle's links, not all the contacts of
+  // the world
   const auto model = this->body->GetModel();
+  const auto &contacts = this->contactManager->ModelContacts(model.get());
 
   for (auto contact : contacts)
   {
-    // Beware! There may be invalid contacts beyond GetContactCount()...
-    if (i == this->contactManager->GetContactCount())
-      break;
-
-    ++i;
-
     if (contact->collision1->GetSurface()->collideWithoutContact ||
       contact->collision2->GetSurface()->collideWithoutContact)
       continue;
@@ -361,13 +356,6 @@ void SimpleTrackedVehiclePlugin::DriveTracks(
       continue;
     }
 
-    if (model != contact->collision1->GetLink()->GetModel() &&
-        model != contact->collision2->GetLink()->GetModel())
-    {
-      // Verify one of the collisions' bodies is a track of this vehicle
-      continue;
-    }
-
     dBodyID body1 = dynamic_cast<physics::ODELink&>(
       *contact->collision1->GetLink()).GetODEId();
     dBodyID body2 = dynamic_cast<physics::ODELink& >(
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include "gazebo/physics/physics.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class BuoyancyTest : public ServerFixture
+{
+};
+
+/////////////////////////////////////////////////
+// A box floating on flat water settles at the draft where the weight of
+// the displaced water equals its own weight.
+TEST_F(BuoyancyTest, FloatingBoxDraft)
+{
+  Load("worlds/blank.world", true, "ode");
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  // 1 m cube of 300 kg in water of 1000 kg/m^3, 0.3 m of it under water
+  const double mass = 300;
+  const double density = 1000;
+  const double draft = mass / density;
+
+  std::ostringstream sdf;
+  sdf << "<sdf version='1.6'>"
+      << "<model name='box'>"
+      << "  <pose>0 0 0 0 0 0</pose>"
+      << "  <link name='link'>"
+      << "    <inertial>"
+      << "      <mass>" << mass << "</mass>"
+      << "      <inertia>"
+      << "        <ixx>50</ixx><iyy>50</iyy><izz>50</izz>"
+      << "      </inertia>"
+      << "    </inertial>"
+      << "    <velocity_decay>"
+      << "      <linear>0.01</linear>"
+      << "      <angular>0.01</angular>"
+      << "    </velocity_decay>"
+      << "    <collision name='collision'>"
+      << "      <geometry><box><size>1 1 1</size></box></geometry>"
+      << "    </collision>"
+      << "  </link>"
+      << "  <plugin name='buoyancy' filename='libBuoyancyPlugin.so'>"
+      << "    <fluid_density>" << density << "</fluid_density>"
+      << "    <water_surface><level>0</level></water_surface>"
+      << "  </plugin>"
+      << "</model>"
+      << "</sdf>";
+  SpawnSDF(sdf.str());
+  physics::ModelPtr model = world->ModelByName("box");
+  ASSERT_TRUE(model != NULL);
+
+  // Starts half submerged, so it rises and bobs until the damping stops it
+  world->Step(10000);
+
+  const ignition::math::Pose3d pose = model->WorldPose();
+  EXPECT_NEAR(0.5 - draft, pose.Pos().Z(), 1e-2);
+  EXPECT_NEAR(0.0, pose.Pos().X(), 1e-3);
+  EXPECT_NEAR(0.0, pose.Pos().Y(), 1e-3);
+  EXPECT_NEAR(0.0, pose.Rot().Euler().X(), 1e-3);
+  EXPECT_NEAR(0.0, pose.Rot().Euler().Y(), 1e-3);
+  EXPECT_NEAR(0.0, model->WorldLinearVel().Length(), 1e-2);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -78,6 +78,7 @@ class HeightmapTest : public ServerFixture,
 
 /// \brief Test loading a heightmap and verify cache files are created
   public: void HeightmapCache();
+  public: void DEMTiledBulkRead();
 
   public: void NotSquareImage();
   public: void InvalidSizeImage();
@@ -778,6 +779,52 @@ void HeightmapTest::HeightmapCache()
   EXPECT_FALSE(common::exists(cachePathBk));
 }
 
+/////////////////////////////////////////////////
+void HeightmapTest::DEMTiledBulkRead()
+{
+#ifdef HAVE_GDAL
+  Load("worlds/dem_tiled.world", true, "ode");
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_NE(world, nullptr);
+
+  physics::ModelPtr model = GetModel("heightmap");
+  ASSERT_NE(model, nullptr);
+  physics::HeightmapShapePtr shape =
+    boost::dynamic_pointer_cast<physics::HeightmapShape>(
+        model->GetLink("link")->GetCollision("collision")->GetShape());
+  ASSERT_NE(shape, nullptr);
+  ASSERT_TRUE(shape->Tiled());
+
+  // Keep a single tile paged in
+  shape->SetTileBudget(1);
+  world->Step(10);
+  const size_t tileCount = shape->TileCount();
+  EXPECT_LE(tileCount, 1u);
+
+  // Reading the whole heightfield does not page it in
+  msgs::Geometry msg;
+  shape->FillHeights(msg);
+  common::Image image = shape->GetImage();
+  EXPECT_EQ(tileCount, shape->TileCount());
+
+  const int size = shape->VertexCount().X();
+  ASSERT_EQ(size * size, msg.heightmap().heights_size());
+  for (int y = 0; y < size; y += 7)
+  {
+    for (int x = 0; x < size; x += 7)
+    {
+      EXPECT_FLOAT_EQ(shape->GetHeight(x, size - y - 1),
+          msg.heightmap().heights(y * size + x));
+    }
+  }
+  EXPECT_GT(image.GetWidth(), 0u);
+
+  // The box still lands on the terrain
+  world->Step(1200);
+  EXPECT_GE(GetModel("box")->WorldPose().Pos().Z(), shape->GetMinHeight());
+#endif
+}
+
 /////////////////////////////////////////////////
 void HeightmapTest::TerrainCollision(const std::string &_physicsEngine,
                                      const std::string &_dartCollision)
@@ -1101,6 +1148,12 @@ TEST_F(HeightmapTest, HeightmapCache)
   HeightmapCache();
 }
 
+/////////////////////////////////////////////////
+TEST_F(HeightmapTest, DEMTiledBulkRead)
+{
+  DEMTiledBulkRead();
+}
+
 INSTANTIATE_TEST_CASE_P(PhysicsEngines, HeightmapTest, PHYSICS_ENGINE_VALUES,);  // NOLINT
 
 /////////////////////////////////////////////////
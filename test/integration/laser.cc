@@ -38,6 +38,7 @@ class LaserTest : public ServerFixture,
   public: void LaserVertical(const std::string &_physicsEngine);
   public: void LaserScanResolution(const std::string &_physicsEngine);
   public: void LaserStrictUpdateRate(const std::string &_physicsEngine);
+  public: void LaserStaticSpace(const std::string &_physicsEngine);
 
   private: void OnNewUpdate(int* _msgCounter);
 };
@@ -669,6 +670,46 @@ TEST_P(LaserTest, LaserStrictUpdateRate)
   LaserStrictUpdateRate(GetParam());
 }
 
+void LaserTest::LaserStaticSpace(const std::string &_physicsEngine)
+{
+  if (_physicsEngine != "ode")
+  {
+    gzdbg << "Static space is only available in ODE" << std::endl;
+    return;
+  }
+
+  // The static boxes of this world are kept out of the world space
+  Load("worlds/ode_broadphase.world", true, _physicsEngine);
+
+  std::string modelName = "ray_model";
+  std::string raySensorName = "ray_sensor";
+  double minRange = 0.1;
+  double maxRange = 5.0;
+  unsigned int samples = 3;
+
+  // Three rays facing static_box_1, 1.5 m ahead
+  SpawnRaySensor(modelName, raySensorName,
+      ignition::math::Vector3d(3, 0, 0.5), ignition::math::Vector3d::Zero,
+      -0.1, 0.1, 0, 0, minRange, maxRange, 0.01, samples, 1, 1, 1);
+
+  sensors::SensorPtr sensor = sensors::get_sensor(raySensorName);
+  sensors::RaySensorPtr raySensor =
+    std::dynamic_pointer_cast<sensors::RaySensor>(sensor);
+  ASSERT_TRUE(raySensor != NULL);
+
+  raySensor->Init();
+  raySensor->Update(true);
+
+  EXPECT_NEAR(raySensor->Range(samples / 2), 1.5, LASER_TOL);
+  EXPECT_NEAR(raySensor->Range(0), 1.5 / cos(0.1), LASER_TOL);
+  EXPECT_NEAR(raySensor->Range(samples - 1), 1.5 / cos(0.1), LASER_TOL);
+}
+
+TEST_P(LaserTest, LaserStaticSpace)
+{
+  LaserStaticSpace(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(PhysicsEngines, LaserTest, PHYSICS_ENGINE_VALUES,);  // NOLINT
 
 int main(int argc, char **argv)
@@ -0,0 +1,408 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/bind.hpp>
+
+#include "gazebo/Master.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class MasterTest : public ServerFixture
+{
+};
+
+/// \brief Packets received by a client of the master.
+struct MasterClientState
+{
+  /// \brief Connection to the master.
+  transport::ConnectionPtr conn;
+
+  /// \brief Packets received after the initial ones.
+  std::vector<msgs::Packet> packets;
+
+  /// \brief Protects packets.
+  std::mutex mutex;
+};
+
+/////////////////////////////////////////////////
+void OnMasterClientRead(std::shared_ptr<MasterClientState> _state,
+    const std::string &_data)
+{
+  if (_data.empty())
+    return;
+
+  msgs::Packet packet;
+  packet.ParseFromString(_data);
+  {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    _state->packets.push_back(packet);
+  }
+
+  if (_state->conn->IsOpen())
+  {
+    _state->conn->AsyncRead(
+        boost::bind(&OnMasterClientRead, _state, _1));
+  }
+}
+
+/// \brief A raw client of the master, as a ConnectionManager would be.
+class MasterClient
+{
+  /// \brief Connect to a master and read the initial packets.
+  /// \param[in] _port Port of the master.
+  public: explicit MasterClient(const unsigned int _port)
+          : state(new MasterClientState)
+  {
+    this->state->conn.reset(new transport::Connection());
+    if (!this->state->conn->Connect("127.0.0.1", _port))
+      return;
+
+    // version_init, topic_namepaces_init, publishers_init
+    std::string data;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (!this->state->conn->Read(data))
+        return;
+    }
+
+    this->state->conn->AsyncRead(
+        boost::bind(&OnMasterClientRead, this->state, _1));
+  }
+
+  /// \brief Destructor, disconnects.
+  public: ~MasterClient()
+  {
+    this->Disconnect();
+  }
+
+  /// \brief Send a packet to the master.
+  /// \param[in] _type Type of the packet.
+  /// \param[in] _msg Content of the packet.
+  public: void Send(const std::string &_type,
+                    const google::protobuf::Message &_msg)
+  {
+    this->state->conn->EnqueueMsg(msgs::Package(_type, _msg), true);
+  }
+
+  /// \brief Advertise a topic.
+  /// \param[in] _topic Name of the topic.
+  /// \param[in] _port Port the publisher listens on.
+  /// \return The publish message.
+  public: msgs::Publish Advertise(const std::string &_topic,
+                                  const unsigned int _port)
+  {
+    msgs::Publish pub;
+    pub.set_topic(_topic);
+    pub.set_msg_type("gazebo.msgs.GzString");
+    pub.set_host("127.0.0.1");
+    pub.set_port(_port);
+    this->Send("advertise", pub);
+    return pub;
+  }
+
+  /// \brief Subscribe to a topic.
+  /// \param[in] _topic Name of the topic.
+  public: void Subscribe(const std::string &_topic)
+  {
+    msgs::Subscribe sub;
+    sub.set_topic(_topic);
+    sub.set_msg_type("gazebo.msgs.GzString");
+    sub.set_host("127.0.0.1");
+    sub.set_port(this->state->conn->GetLocalPort());
+    this->Send("subscribe", sub);
+  }
+
+  /// \brief Close the connection to the master.
+  public: void Disconnect()
+  {
+    if (this->state->conn)
+      this->state->conn->Shutdown();
+  }
+
+  /// \brief Get the topics of the publishers in the packets of a type
+  /// received so far.
+  /// \param[in] _type Packet type.
+  /// \return Topic of each publisher, in order.
+  public: std::vector<std::string> Topics(const std::string &_type)
+  {
+    std::vector<std::string> topics;
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    for (auto const &packet : this->state->packets)
+    {
+      if (packet.type() != _type)
+        continue;
+
+      if (_type == "publishers_add" || _type == "publishers_del")
+      {
+        msgs::Publishers pubs;
+        pubs.ParseFromString(packet.serialized_data());
+        for (int i = 0; i < pubs.publisher_size(); ++i)
+          topics.push_back(pubs.publisher(i).topic());
+      }
+      else
+      {
+        msgs::Publish pub;
+        pub.ParseFromString(packet.serialized_data());
+        topics.push_back(pub.topic());
+      }
+    }
+    return topics;
+  }
+
+  /// \brief Get the number of packets of a type received so far.
+  /// \param[in] _type Packet type.
+  /// \return Number of packets.
+  public: size_t Count(const std::string &_type)
+  {
+    size_t count = 0;
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    for (auto const &packet : this->state->packets)
+      count += packet.type() == _type;
+    return count;
+  }
+
+  /// \brief Shared with the read callbacks.
+  public: std::shared_ptr<MasterClientState> state;
+};
+
+/// \brief Runs a master on a free port.
+class MasterRunner
+{
+  /// \brief Constructor.
+  public: MasterRunner()
+  {
+    // Find a free port
+    transport::ConnectionPtr probe(new transport::Connection());
+    probe->Listen(0, [](const transport::ConnectionPtr &) {});
+    this->port = probe->GetLocalPort();
+    probe->Shutdown();
+    probe.reset();
+
+    this->master.Init(this->port);
+  }
+
+  /// \brief Run the master until a condition holds.
+  /// \param[in] _cond The condition.
+  /// \return False if the condition still doesn't hold after 5 seconds.
+  public: bool RunUntil(const std::function<bool()> &_cond)
+  {
+    for (int i = 0; i < 500; ++i)
+    {
+      this->master.RunOnce();
+      if (_cond())
+        return true;
+      common::Time::MSleep(10);
+    }
+    return false;
+  }
+
+  /// \brief Run the master for a tenth of a second, letting messages
+  /// arrive.
+  public: void RunBriefly()
+  {
+    for (int i = 0; i < 10; ++i)
+    {
+      this->master.RunOnce();
+      common::Time::MSleep(10);
+    }
+  }
+
+  /// \brief The master.
+  public: Master master;
+
+  /// \brief Port of the master.
+  public: unsigned int port = 0;
+};
+
+/////////////////////////////////////////////////
+// A client that never opts in gets one publisher_add and publisher_del per
+// publisher, as before batching.
+TEST_F(MasterTest, LegacyClient)
+{
+  MasterRunner runner;
+  MasterClient legacy(runner.port);
+  MasterClient publisher(runner.port);
+
+  msgs::Publish pub = publisher.Advertise("/gazebo/default/a", 12000);
+  publisher.Advertise("/gazebo/default/b", 12000);
+  ASSERT_TRUE(runner.RunUntil([&legacy]()
+      {
+        return legacy.Count("publisher_add") == 2u;
+      }));
+  EXPECT_EQ(std::vector<std::string>({"/gazebo/default/a",
+      "/gazebo/default/b"}), legacy.Topics("publisher_add"));
+  EXPECT_EQ(0u, legacy.Count("publishers_add"));
+
+  publisher.Send("unadvertise", pub);
+  ASSERT_TRUE(runner.RunUntil([&legacy]()
+      {
+        return legacy.Count("publisher_del") == 1u;
+      }));
+  EXPECT_EQ(std::vector<std::string>({"/gazebo/default/a"}),
+      legacy.Topics("publisher_del"));
+  EXPECT_EQ(0u, legacy.Count("publishers_del"));
+}
+
+/////////////////////////////////////////////////
+// A client that opts in gets batches, a client that doesn't still gets
+// single announcements.
+TEST_F(MasterTest, Batched)
+{
+  MasterRunner runner;
+  MasterClient batched(runner.port);
+  MasterClient legacy(runner.port);
+  MasterClient publisher(runner.port);
+
+  batched.Send("announcement_batching", msgs::Empty());
+  runner.RunBriefly();
+
+  // Both advertisements are processed in the same iteration of the master
+  publisher.Advertise("/gazebo/default/a", 12000);
+  publisher.Advertise("/gazebo/default/b", 12000);
+  common::Time::MSleep(200);
+  ASSERT_TRUE(runner.RunUntil([&]()
+      {
+        return batched.Topics("publishers_add").size() == 2u &&
+               legacy.Count("publisher_add") == 2u;
+      }));
+  EXPECT_EQ(1u, batched.Count("publishers_add"));
+  EXPECT_EQ(0u, batched.Count("publisher_add"));
+  EXPECT_EQ(0u, legacy.Count("publishers_add"));
+
+  // Removals are batched the same way when the publisher goes away
+  publisher.Disconnect();
+  ASSERT_TRUE(runner.RunUntil([&]()
+      {
+        return batched.Topics("publishers_del").size() == 2u &&
+               legacy.Count("publisher_del") == 2u;
+      }));
+  EXPECT_EQ(0u, batched.Count("publisher_del"));
+  EXPECT_EQ(0u, legacy.Count("publishers_del"));
+  EXPECT_EQ(0u, runner.master.Statistics().topics);
+}
+
+/////////////////////////////////////////////////
+// A subscriber that registers before the publisher is told about the
+// publisher, even outside its discovery interest.
+TEST_F(MasterTest, SubscribeBeforeAdvertise)
+{
+  MasterRunner runner;
+  MasterClient subscriber(runner.port);
+  MasterClient publisher(runner.port);
+
+  msgs::GzString_V interest;
+  interest.add_data("other_world");
+  subscriber.Send("discovery_interest", interest);
+  subscriber.Subscribe("/gazebo/default/a");
+  runner.RunBriefly();
+  EXPECT_EQ(1u, runner.master.Statistics().topics);
+
+  publisher.Advertise("/gazebo/default/a", 12000);
+  publisher.Advertise("/gazebo/default/b", 12000);
+  ASSERT_TRUE(runner.RunUntil([&subscriber]()
+      {
+        return subscriber.Count("publisher_advertise") == 1u &&
+               !subscriber.Topics("publishers_add").empty();
+      }));
+  runner.RunBriefly();
+
+  EXPECT_EQ(std::vector<std::string>({"/gazebo/default/a"}),
+      subscriber.Topics("publisher_advertise"));
+
+  // Not told about the other topic, which it neither subscribes to nor is
+  // interested in
+  EXPECT_EQ(std::vector<std::string>({"/gazebo/default/a"}),
+      subscriber.Topics("publishers_add"));
+  EXPECT_EQ(2u, runner.master.Statistics().topics);
+}
+
+/////////////////////////////////////////////////
+// Unadvertising tells the subscribers and the clients that were told about
+// the publisher.
+TEST_F(MasterTest, Unadvertise)
+{
+  MasterRunner runner;
+  MasterClient subscriber(runner.port);
+  MasterClient publisher(runner.port);
+
+  subscriber.Subscribe("/gazebo/default/a");
+  runner.RunBriefly();
+  msgs::Publish pub = publisher.Advertise("/gazebo/default/a", 12000);
+  ASSERT_TRUE(runner.RunUntil([&subscriber]()
+      {
+        return subscriber.Count("publisher_advertise") == 1u;
+      }));
+
+  publisher.Send("unadvertise", pub);
+  ASSERT_TRUE(runner.RunUntil([&subscriber]()
+      {
+        return subscriber.Count("unadvertise") == 1u &&
+               subscriber.Count("publisher_del") == 1u;
+      }));
+  EXPECT_EQ(std::vector<std::string>({"/gazebo/default/a"}),
+      subscriber.Topics("unadvertise"));
+
+  // The topic is kept for the subscriber
+  EXPECT_EQ(1u, runner.master.Statistics().topics);
+}
+
+/////////////////////////////////////////////////
+// A client that goes away with announcements still queued for it is
+// removed cleanly, and the others still get theirs.
+TEST_F(MasterTest, DisconnectWithPending)
+{
+  MasterRunner runner;
+  MasterClient leaving(runner.port);
+  MasterClient staying(runner.port);
+  MasterClient publisher(runner.port);
+  runner.RunBriefly();
+
+  // Queue announcements for the leaving client, which disconnects before
+  // they are written
+  publisher.Advertise("/gazebo/default/a", 12000);
+  common::Time::MSleep(100);
+  leaving.Disconnect();
+  publisher.Advertise("/gazebo/default/b", 12000);
+
+  ASSERT_TRUE(runner.RunUntil([&staying]()
+      {
+        return staying.Count("publisher_add") == 2u;
+      }));
+  runner.RunBriefly();
+
+  // The publisher going away is announced to the remaining client
+  publisher.Disconnect();
+  ASSERT_TRUE(runner.RunUntil([&staying]()
+      {
+        return staying.Count("publisher_del") == 2u;
+      }));
+  EXPECT_EQ(0u, runner.master.Statistics().topics);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -15,7 +15,9 @@
  *
 */
 
+#include <cmath>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -46,6 +48,7 @@ class PhysicsTest : public ServerFixture,
   public: void JointDampingTest(const std::string &_physicsEngine);
   public: void DropStuff(const std::string &_physicsEngine);
   public: void SpawnFixedJoint(const std::string &_physicsEngine);
+  public: void PosePublishedOnDrop(const std::string &_physicsEngine);
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -1569,6 +1572,67 @@ TEST_P(PhysicsTest, SpawnFixedJoint)
   SpawnFixedJoint(GetParam());
 }
 
+/////////////////////////////////////////////////
+std::mutex g_dropMutex;
+std::vector<double> g_dropHeights;
+
+/////////////////////////////////////////////////
+void OnDropPoses(ConstPosesStampedPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_dropMutex);
+  for (int i = 0; i < _msg->pose_size(); ++i)
+  {
+    if (_msg->pose(i).name() == "drop_box")
+      g_dropHeights.push_back(_msg->pose(i).position().z());
+  }
+}
+
+/////////////////////////////////////////////////
+// This test verifies that the poses of models moved by the physics engine
+// are published on ~/pose/info.
+void PhysicsTest::PosePublishedOnDrop(const std::string &_physicsEngine)
+{
+  Load("worlds/empty.world", true, _physicsEngine);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  transport::NodePtr node(new transport::Node());
+  node->Init("default");
+  transport::SubscriberPtr sub = node->Subscribe("~/pose/info",
+      &OnDropPoses);
+
+  SpawnBox("drop_box", ignition::math::Vector3d::One,
+      ignition::math::Vector3d(0, 0, 3));
+  physics::ModelPtr model = world->ModelByName("drop_box");
+  ASSERT_TRUE(model != NULL);
+
+  // Fall for half a second
+  world->Step(500);
+  const double z = model->WorldPose().Pos().Z();
+  EXPECT_LT(z, 2.5);
+
+  std::vector<double> heights;
+  for (int i = 0; i < 100; ++i)
+  {
+    common::Time::MSleep(10);
+    std::lock_guard<std::mutex> lock(g_dropMutex);
+    heights = g_dropHeights;
+    if (!heights.empty() && std::abs(heights.back() - z) < 1e-6)
+      break;
+  }
+
+  // The published pose follows the fall
+  ASSERT_GT(heights.size(), 1u);
+  EXPECT_LT(heights.back(), heights.front());
+  EXPECT_NEAR(z, heights.back(), 1e-6);
+}
+
+TEST_P(PhysicsTest, PosePublishedOnDrop)
+{
+  PosePublishedOnDrop(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(PhysicsEngines, PhysicsTest, PHYSICS_ENGINE_VALUES,);  // NOLINT
 
 int main(int argc, char **argv)
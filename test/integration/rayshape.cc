@@ -25,6 +25,7 @@ class RayShapeTest : public ServerFixture,
                      public testing::WithParamInterface<const char*>
 {
   public: void Standalone(const std::string &_physicsEngine);
+  public: void StaticSpace(const std::string &_physicsEngine);
 };
 
 /////////////////////////////////////////////////
@@ -76,6 +77,49 @@ TEST_P(RayShapeTest, Standalone)
   Standalone(GetParam());
 }
 
+/////////////////////////////////////////////////
+void RayShapeTest::StaticSpace(const std::string &_physicsEngine)
+{
+  if (_physicsEngine != "ode")
+  {
+    gzdbg << "Static space is only available in ODE" << std::endl;
+    return;
+  }
+
+  // The static boxes and the ground plane of this world are kept out of
+  // the world space
+  Load("worlds/ode_broadphase.world", true, _physicsEngine);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  gazebo::physics::RayShapePtr ray =
+    boost::dynamic_pointer_cast<gazebo::physics::RayShape>(
+        world->Physics()->CreateShape("ray",
+          gazebo::physics::CollisionPtr()));
+  ASSERT_TRUE(ray != NULL);
+
+  double dist;
+  std::string entity;
+
+  ray->SetPoints(ignition::math::Vector3d(3, 0, 0.5),
+                 ignition::math::Vector3d(10, 0, 0.5));
+  ray->GetIntersection(dist, entity);
+  EXPECT_NEAR(dist, 1.5, 1e-4);
+  EXPECT_EQ(entity, "static_box_1::link::collision");
+
+  ray->SetPoints(ignition::math::Vector3d(3, 2, 1),
+                 ignition::math::Vector3d(3, 2, -1));
+  ray->GetIntersection(dist, entity);
+  EXPECT_NEAR(dist, 1.0, 1e-4);
+  EXPECT_EQ(entity, "ground_plane::link::collision");
+}
+
+/////////////////////////////////////////////////
+TEST_P(RayShapeTest, StaticSpace)
+{
+  StaticSpace(GetParam());
+}
+
 /////////////////////////////////////////////////
 INSTANTIATE_TEST_CASE_P(PhysicsEngines, RayShapeTest,
     ::testing::Values("ode"),);  // NOLINT
@@ -18,6 +18,12 @@
 #ifndef _WIN32
 #include <unistd.h>
 #endif
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "gazebo/test/ServerFixture.hh"
 
 using namespace gazebo;
@@ -788,6 +794,234 @@ TEST_F(TransportTest, TryInit)
   EXPECT_EQ(physics::get_world()->Name(), node->GetTopicNamespace());
 }
 
+/////////////////////////////////////////////////
+std::vector<double> g_conflated;
+std::vector<double> g_keptLast;
+std::vector<double> g_keptAll;
+std::mutex g_queueMutex;
+
+void ReceiveConflated(ConstVector3dPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_queueMutex);
+  g_conflated.push_back(_msg->x());
+}
+
+void ReceiveKeptLast(ConstVector3dPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_queueMutex);
+  g_keptLast.push_back(_msg->x());
+}
+
+void ReceiveKeptAll(ConstVector3dPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_queueMutex);
+  g_keptAll.push_back(_msg->x());
+}
+
+/////////////////////////////////////////////////
+// Queue policies bound the incoming queues of a node, dropping the oldest
+// messages, while the newest message is always delivered.
+TEST_F(TransportTest, QueuePolicy)
+{
+  this->Load("worlds/empty.world");
+
+  transport::NodePtr conflateNode(new transport::Node());
+  conflateNode->Init();
+  transport::NodePtr keepLastNode(new transport::Node());
+  keepLastNode->Init();
+  transport::NodePtr keepAllNode(new transport::Node());
+  keepAllNode->Init();
+
+  std::string topic = "/gazebo/" + conflateNode->GetTopicNamespace() +
+      "/queue_policy";
+
+  auto conflateSub = conflateNode->Subscribe(topic, &ReceiveConflated,
+      false, transport::QueuePolicy::Conflate());
+  auto keepLastSub = keepLastNode->Subscribe(topic, &ReceiveKeptLast,
+      false, transport::QueuePolicy::KeepLast(3));
+  auto keepAllSub = keepAllNode->Subscribe(topic, &ReceiveKeptAll);
+
+  // Hand the messages straight to the nodes, faster than they are processed
+  const int count = 1000;
+  for (int i = 0; i < count; ++i)
+  {
+    transport::MessagePtr msg(new msgs::Vector3d(msgs::Convert(
+        ignition::math::Vector3d(i, 0, 0))));
+    conflateNode->HandleMessage(topic, msg);
+    keepLastNode->HandleMessage(topic, msg);
+    keepAllNode->HandleMessage(topic, msg);
+
+    // At most one queued message, plus one being processed
+    EXPECT_LE(conflateNode->IncomingQueueDepth(), 2u);
+    EXPECT_LE(keepLastNode->IncomingQueueDepth(), 6u);
+  }
+
+  for (int i = 0; i < 300; ++i)
+  {
+    if (conflateNode->IncomingQueueDepth() == 0 &&
+        keepLastNode->IncomingQueueDepth() == 0 &&
+        keepAllNode->IncomingQueueDepth() == 0)
+    {
+      break;
+    }
+    common::Time::MSleep(10);
+  }
+
+  std::lock_guard<std::mutex> lock(g_queueMutex);
+  for (auto received : {&g_conflated, &g_keptLast, &g_keptAll})
+  {
+    ASSERT_FALSE(received->empty());
+    EXPECT_DOUBLE_EQ(count - 1, received->back());
+    for (size_t i = 1; i < received->size(); ++i)
+      EXPECT_LT((*received)[i - 1], (*received)[i]);
+  }
+
+  // Every message was either delivered or dropped
+  EXPECT_EQ(static_cast<uint64_t>(count),
+      g_conflated.size() + conflateSub->DroppedMessageCount());
+  EXPECT_EQ(static_cast<uint64_t>(count),
+      g_keptLast.size() + keepLastSub->DroppedMessageCount());
+  EXPECT_EQ(static_cast<size_t>(count), g_keptAll.size());
+  EXPECT_EQ(0u, keepAllSub->DroppedMessageCount());
+}
+
+#ifndef _WIN32
+/////////////////////////////////////////////////
+/// \brief Send messages of mixed sizes from a SubscriptionTransport to a
+/// PublicationTransport over a loopback connection, the way the
+/// ConnectionManager links two processes.
+/// \param[in] _expectShm True if the link is expected to switch to shared
+/// memory.
+void SharedMemoryLink(const bool _expectShm)
+{
+  std::mutex mutex;
+  transport::ConnectionPtr accepted;
+  transport::ConnectionPtr server(new transport::Connection());
+  server->Listen(0, [&](const transport::ConnectionPtr &_conn)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        accepted = _conn;
+      });
+
+  transport::ConnectionPtr client(new transport::Connection());
+  ASSERT_TRUE(client->Connect("127.0.0.1", server->GetLocalPort()));
+
+  // These connections are not managed, write their queues here
+  std::atomic<bool> done(false);
+  std::thread writer([&]()
+      {
+        while (!done)
+        {
+          client->ProcessWriteQueue();
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (accepted)
+              accepted->ProcessWriteQueue();
+          }
+          common::Time::MSleep(1);
+        }
+      });
+
+  std::vector<int> received;
+  transport::PublicationTransportPtr subLink(
+      new transport::PublicationTransport("~/shm_link", "msg::GzString"));
+  subLink->AddCallback([&](const std::string &_data)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(std::stoi(_data.substr(0, 8)));
+      });
+  subLink->Init(client, false);
+
+  // The advertiser side reads the subscription first
+  transport::ConnectionPtr pubConn;
+  for (int i = 0; i < 500 && !pubConn; ++i)
+  {
+    common::Time::MSleep(10);
+    std::lock_guard<std::mutex> lock(mutex);
+    pubConn = accepted;
+  }
+  ASSERT_TRUE(pubConn != nullptr);
+  std::string subData;
+  ASSERT_TRUE(pubConn->Read(subData));
+
+  transport::SubscriptionTransportPtr pubLink(
+      new transport::SubscriptionTransport());
+  pubLink->Init(pubConn, false);
+
+  // Large and small messages, and a few too large for the ring which
+  // still go through the socket
+  const int count = 60;
+  auto send = [&](const int _i)
+  {
+    size_t size = 100;
+    if (_i % 3 == 0)
+      size = 100 * 1024;
+    if (_i == 40 || _i == 41)
+      size = 3 * 1024 * 1024;
+    char index[9];
+    snprintf(index, sizeof(index), "%08d", _i);
+    std::string data(size, 'x');
+    data.replace(0, 8, index);
+    EXPECT_TRUE(pubLink->HandleData(data, [](uint32_t) {}, 0));
+  };
+
+  // The first messages go through the socket, the first large one makes
+  // the subscriber offer a ring
+  int i = 0;
+  for (; i < 10; ++i)
+    send(i);
+  for (int j = 0; j < 300 && !pubLink->UsingShm(); ++j)
+    common::Time::MSleep(10);
+  EXPECT_EQ(_expectShm, pubLink->UsingShm());
+
+  for (; i < count; ++i)
+    send(i);
+
+  for (int j = 0; j < 500; ++j)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (received.size() >= static_cast<size_t>(count))
+        break;
+    }
+    common::Time::MSleep(10);
+  }
+
+  // Nothing lost, nothing reordered, whichever way each message went
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(static_cast<size_t>(count), received.size());
+    for (int j = 0; j < count; ++j)
+      EXPECT_EQ(j, received[j]);
+  }
+  EXPECT_EQ(_expectShm, pubLink->UsingShm());
+
+  subLink->Fini();
+  subLink.reset();
+  pubLink.reset();
+  done = true;
+  writer.join();
+}
+
+/////////////////////////////////////////////////
+TEST_F(TransportTest, SharedMemoryLink)
+{
+  Load("worlds/empty.world");
+  SharedMemoryLink(true);
+}
+
+/////////////////////////////////////////////////
+TEST_F(TransportTest, SharedMemoryDisabled)
+{
+  Load("worlds/empty.world");
+
+  // Without shared memory everything keeps going through the socket
+  setenv("GAZEBO_SHM_TRANSPORT", "0", 1);
+  SharedMemoryLink(false);
+  unsetenv("GAZEBO_SHM_TRANSPORT");
+}
+#endif
+
 /////////////////////////////////////////////////
 // Main
 int main(int argc, char **argv)
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "gazebo/transport/transport.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class TransportCallbackExecutorTest : public ServerFixture
+{
+};
+
+std::mutex g_mutex;
+std::vector<int> g_fastData;
+std::vector<int> g_slowData;
+std::atomic<bool> g_slowBlocked(false);
+std::atomic<bool> g_slowRelease(false);
+
+/////////////////////////////////////////////////
+void ReceiveFast(ConstIntPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_fastData.push_back(_msg->data());
+}
+
+/////////////////////////////////////////////////
+void ReceiveSlow(ConstIntPtr &_msg)
+{
+  {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_slowData.push_back(_msg->data());
+  }
+
+  // Block on the first message until the test releases the node
+  if (_msg->data() == 0)
+  {
+    g_slowBlocked = true;
+    while (!g_slowRelease)
+      common::Time::MSleep(10);
+  }
+}
+
+/////////////////////////////////////////////////
+// A node stuck in a callback must not delay the callbacks of other nodes,
+// and each node must receive its messages in order.
+TEST_F(TransportCallbackExecutorTest, SlowNode)
+{
+  this->Load("worlds/empty.world");
+
+  transport::NodePtr slowNode(new transport::Node());
+  slowNode->Init();
+  transport::NodePtr fastNode(new transport::Node());
+  fastNode->Init();
+
+  transport::SubscriberPtr slowSub =
+    slowNode->Subscribe("~/executor_test", &ReceiveSlow);
+  transport::SubscriberPtr fastSub =
+    fastNode->Subscribe("~/executor_test", &ReceiveFast);
+
+  transport::PublisherPtr pub =
+    this->node->Advertise<msgs::Int>("~/executor_test");
+  pub->WaitForConnection();
+
+  const int count = 10;
+  for (int i = 0; i < count; ++i)
+  {
+    msgs::Int msg;
+    msg.set_data(i);
+    pub->Publish(msg);
+  }
+
+  // The fast node receives everything while the slow node is blocked
+  for (int i = 0; i < 500; ++i)
+  {
+    {
+      std::lock_guard<std::mutex> lock(g_mutex);
+      if (g_fastData.size() == static_cast<size_t>(count))
+        break;
+    }
+    common::Time::MSleep(10);
+  }
+  EXPECT_TRUE(g_slowBlocked);
+  {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    ASSERT_EQ(static_cast<size_t>(count), g_fastData.size());
+    for (int i = 0; i < count; ++i)
+      EXPECT_EQ(i, g_fastData[i]);
+    EXPECT_EQ(1u, g_slowData.size());
+  }
+  EXPECT_GT(slowNode->IncomingQueueDepth(), 0u);
+
+  // Hold the slow node long enough to measure its latency
+  common::Time::MSleep(200);
+  g_slowRelease = true;
+
+  for (int i = 0; i < 500; ++i)
+  {
+    {
+      std::lock_guard<std::mutex> lock(g_mutex);
+      if (g_slowData.size() == static_cast<size_t>(count))
+        break;
+    }
+    common::Time::MSleep(10);
+  }
+  {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    ASSERT_EQ(static_cast<size_t>(count), g_slowData.size());
+    for (int i = 0; i < count; ++i)
+      EXPECT_EQ(i, g_slowData[i]);
+  }
+
+  EXPECT_EQ(0u, slowNode->IncomingQueueDepth());
+  EXPECT_GE(slowNode->MaxIncomingLatency(), common::Time(0.2));
+  EXPECT_LT(fastNode->MaxIncomingLatency(), common::Time(0.2));
+}
+
+/////////////////////////////////////////////////
+// Main
+int main(int argc, char **argv)
+{
+  // The executor is created when the transport is initialized
+  setenv("GAZEBO_TRANSPORT_CALLBACK_THREADS", "2", 1);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -174,6 +174,14 @@ TEST_P(WorldEnvPopulationTest, LoadEnvironment)
   LoadEnvironment(GetParam());
 }
 
+////////////////////////////////////////////////////////////////////////
+TEST_P(WorldEnvPopulationTest, LoadEnvironmentInstancing)
+{
+  setenv("GAZEBO_POPULATION_INSTANCING", "1", 1);
+  LoadEnvironment(GetParam());
+  unsetenv("GAZEBO_POPULATION_INSTANCING");
+}
+
 INSTANTIATE_TEST_CASE_P(PhysicsEngines, WorldEnvPopulationTest,
                         PHYSICS_ENGINE_VALUES,);  // NOLINT
 
@@ -0,0 +1,587 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// Throughput benchmark of World::Step on procedurally generated worlds.
+//
+// Each scenario is stepped with every available physics engine, and the
+// results are written as JSON to the file given by GAZEBO_BENCHMARK_OUTPUT,
+// world_step_benchmark.json by default. Each result holds the step rate,
+// the growth of the peak resident memory while loading and stepping the
+// world, and the average time per step of each DIAG_TIMER phase when
+// gazebo is built with ENABLE_DIAGNOSTICS. Each scenario runs in a child
+// process of its own, so that its memory does not depend on the scenarios
+// that ran before it.
+//
+// When GAZEBO_BENCHMARK_BASELINE names a file written by a previous run,
+// a scenario fails if its step rate dropped, or its memory grew, by more
+// than GAZEBO_BENCHMARK_TOLERANCE (0.25 by default) of the baseline.
+// GAZEBO_BENCHMARK_STEPS sets the number of measured steps, 1000 by
+// default.
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_physics_generator.hh"
+
+using namespace gazebo;
+
+/// \brief Result of one scenario with one physics engine.
+struct BenchmarkResult
+{
+  /// \brief Physics engine and scenario, such as ode/free_bodies.
+  std::string name;
+
+  /// \brief Number of measured steps.
+  unsigned int steps = 0;
+
+  /// \brief Measured steps per wall clock second.
+  double stepsPerSecond = 0;
+
+  /// \brief Growth of the peak resident memory in kB, -1 if unknown.
+  int64_t rssGrowthKb = -1;
+
+  /// \brief Average time per step of each diagnostic phase, in
+  /// microseconds.
+  std::map<std::string, double> phases;
+};
+
+std::mutex g_resultsMutex;
+std::vector<BenchmarkResult> g_results;
+
+/// \brief Path of this executable, run again for each scenario.
+std::string g_benchmarkPath;
+
+/// \brief Set in the child process of a scenario: file its result is
+/// written to.
+std::string g_childOutput;
+
+/////////////////////////////////////////////////
+/// \brief Get an environment variable.
+/// \param[in] _name Name of the variable.
+/// \param[in] _default Value returned if the variable is not set.
+/// \return The value.
+std::string Env(const std::string &_name, const std::string &_default)
+{
+  const char *value = getenv(_name.c_str());
+  return value ? std::string(value) : _default;
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the peak resident memory of the process.
+/// \return Peak resident memory in kB, 0 if unknown.
+int64_t PeakResidentKb()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+  return usage.ru_maxrss;
+}
+
+/////////////////////////////////////////////////
+/// \brief Write a string as a JSON string literal.
+/// \param[in] _out Output stream.
+/// \param[in] _str String to write.
+void WriteJsonString(std::ostream &_out, const std::string &_str)
+{
+  _out << '"';
+  for (const char c : _str)
+  {
+    if (c == '"' || c == '\\')
+      _out << '\\';
+    _out << c;
+  }
+  _out << '"';
+}
+
+/////////////////////////////////////////////////
+/// \brief Write the results, one per line so that baselines can be read
+/// back without a JSON parser.
+/// \param[in] _filename File to write.
+void WriteResults(const std::string &_filename)
+{
+  std::ofstream out(_filename.c_str(), std::ios::out | std::ios::trunc);
+  if (!out.is_open())
+  {
+    gzerr << "Unable to open benchmark output[" << _filename << "]\n";
+    return;
+  }
+
+  out << "{\"results\": [";
+  for (size_t i = 0; i < g_results.size(); ++i)
+  {
+    const BenchmarkResult &result = g_results[i];
+    out << (i ? "," : "") << "\n{\"name\": ";
+    WriteJsonString(out, result.name);
+    out << ", \"steps\": " << result.steps
+        << ", \"steps_per_second\": " << result.stepsPerSecond
+        << ", \"rss_growth_kb\": " << result.rssGrowthKb
+        << ", \"phases_us\": {";
+    bool first = true;
+    for (const auto &phase : result.phases)
+    {
+      out << (first ? "" : ", ");
+      WriteJsonString(out, phase.first);
+      out << ": " << phase.second;
+      first = false;
+    }
+    out << "}}";
+  }
+  out << "\n]}\n";
+
+  gzmsg << "Wrote " << g_results.size() << " benchmark results to "
+        << _filename << std::endl;
+}
+
+/////////////////////////////////////////////////
+/// \brief Read results written by WriteResults.
+/// \param[in] _filename File to read.
+/// \param[out] _results Results by name.
+/// \return False if the file could not be read.
+bool ReadResults(const std::string &_filename,
+    std::map<std::string, BenchmarkResult> &_results)
+{
+  std::ifstream in(_filename.c_str());
+  if (!in.is_open())
+    return false;
+
+  const std::regex nameRegex("\"name\": \"([^\"]+)\"");
+  const std::regex stepsRegex("\"steps\": ([0-9]+)");
+  const std::regex rateRegex("\"steps_per_second\": ([-+.0-9eE]+)");
+  const std::regex rssRegex("\"rss_growth_kb\": (-?[0-9]+)");
+  const std::regex phasesRegex("\"phases_us\": \\{([^}]*)\\}");
+  const std::regex phaseRegex("\"([^\"]+)\": ([-+.0-9eE]+)");
+
+  std::string line;
+  while (std::getline(in, line))
+  {
+    std::smatch name, rate;
+    if (!std::regex_search(line, name, nameRegex) ||
+        !std::regex_search(line, rate, rateRegex))
+    {
+      continue;
+    }
+
+    BenchmarkResult &result = _results[name[1]];
+    result.name = name[1];
+    result.stepsPerSecond = std::stod(rate[1]);
+
+    // Older results have no memory
+    std::smatch steps, rss, phases;
+    if (std::regex_search(line, steps, stepsRegex))
+      result.steps = std::stoul(steps[1]);
+    if (std::regex_search(line, rss, rssRegex))
+      result.rssGrowthKb = std::stoll(rss[1]);
+    if (std::regex_search(line, phases, phasesRegex))
+    {
+      const std::string list = phases[1];
+      for (std::sregex_iterator iter(list.begin(), list.end(), phaseRegex);
+          iter != std::sregex_iterator(); ++iter)
+      {
+        result.phases[(*iter)[1]] = std::stod((*iter)[2]);
+      }
+    }
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+/// \brief Build the SDF of a world holding a ground plane.
+/// \param[in] _models SDF of the models.
+/// \return The world.
+std::string World(const std::string &_models)
+{
+  std::ostringstream sdf;
+  sdf << "<sdf version='1.6'><world name='default'>"
+      << "<model name='ground_plane'><static>true</static><link name='link'>"
+      << "<collision name='collision'><geometry><plane>"
+      << "<normal>0 0 1</normal><size>200 200</size>"
+      << "</plane></geometry></collision></link></model>"
+      << _models
+      << "</world></sdf>";
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Build the SDF of a link with a single geometry.
+/// \param[in] _name Name of the link.
+/// \param[in] _pose Pose of the link.
+/// \param[in] _geometry SDF of the geometry.
+/// \param[in] _extra Extra SDF placed in the link, such as sensors.
+/// \return The link.
+std::string Link(const std::string &_name, const ignition::math::Pose3d &_pose,
+    const std::string &_geometry, const std::string &_extra = "")
+{
+  std::ostringstream sdf;
+  sdf << "<link name='" << _name << "'><pose>" << _pose << "</pose>"
+      << "<inertial><mass>1</mass><inertia><ixx>0.1</ixx><iyy>0.1</iyy>"
+      << "<izz>0.1</izz></inertia></inertial>"
+      << "<collision name='collision'><geometry>" << _geometry
+      << "</geometry></collision>"
+      << "<visual name='visual'><geometry>" << _geometry
+      << "</geometry></visual>"
+      << _extra << "</link>";
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Bodies spread apart above the ground, that only touch the ground
+/// once they fell.
+/// \param[in] _count Number of bodies.
+/// \return The world.
+std::string FreeBodies(const unsigned int _count)
+{
+  std::ostringstream sdf;
+  for (unsigned int i = 0; i < _count; ++i)
+  {
+    const std::string geometry = i % 2 ?
+        "<sphere><radius>0.2</radius></sphere>" :
+        "<box><size>0.4 0.4 0.4</size></box>";
+    sdf << "<model name='body_" << i << "'>"
+        << Link("link", ignition::math::Pose3d(
+               (i % 16) * 2.0, (i / 16) * 2.0, 0.5 + (i % 5), 0, 0, 0),
+               geometry)
+        << "</model>";
+  }
+  return World(sdf.str());
+}
+
+/////////////////////////////////////////////////
+/// \brief A chain of links attached with revolute joints to the world.
+/// \param[in] _dof Number of joints.
+/// \return The world.
+std::string Chain(const unsigned int _dof)
+{
+  std::ostringstream sdf;
+  sdf << "<model name='chain'>";
+  for (unsigned int i = 0; i < _dof; ++i)
+  {
+    sdf << Link("link_" + std::to_string(i),
+        ignition::math::Pose3d(0, 0.25 * i, _dof * 0.3, 0, 0, 0),
+        "<box><size>0.05 0.2 0.05</size></box>")
+        << "<joint name='joint_" << i << "' type='revolute'>"
+        << "<parent>" << (i ? "link_" + std::to_string(i - 1) : "world")
+        << "</parent><child>link_" << i << "</child>"
+        << "<pose>0 -0.125 0 0 0 0</pose>"
+        << "<axis><xyz>" << (i % 2) << " 0 " << (1 - i % 2) << "</xyz>"
+        << "<dynamics><damping>0.01</damping></dynamics></axis></joint>";
+  }
+  sdf << "</model>";
+  return World(sdf.str());
+}
+
+/////////////////////////////////////////////////
+/// \brief A pyramid of boxes resting on each other, which keeps a constant
+/// number of contacts.
+/// \param[in] _levels Number of levels of the pyramid.
+/// \return The world.
+std::string Contacts(const unsigned int _levels)
+{
+  std::ostringstream sdf;
+  unsigned int count = 0;
+  for (unsigned int z = 0; z < _levels; ++z)
+  {
+    const unsigned int side = _levels - z;
+    for (unsigned int x = 0; x < side; ++x)
+    {
+      for (unsigned int y = 0; y < side; ++y)
+      {
+        sdf << "<model name='box_" << count++ << "'>"
+            << Link("link", ignition::math::Pose3d(
+                   x * 0.5 + z * 0.25, y * 0.5 + z * 0.25, 0.25 + z * 0.5,
+                   0, 0, 0), "<box><size>0.5 0.5 0.5</size></box>")
+            << "</model>";
+      }
+    }
+  }
+  return World(sdf.str());
+}
+
+/////////////////////////////////////////////////
+/// \brief Bodies carrying a ray sensor and an IMU.
+/// \param[in] _count Number of bodies.
+/// \return The world.
+std::string Sensors(const unsigned int _count)
+{
+  const std::string sensors =
+      "<sensor name='ray' type='ray'><update_rate>100</update_rate><ray>"
+      "<scan><horizontal><samples>640</samples><min_angle>-1.5</min_angle>"
+      "<max_angle>1.5</max_angle></horizontal></scan>"
+      "<range><min>0.1</min><max>10</max></range></ray></sensor>"
+      "<sensor name='imu' type='imu'><update_rate>1000</update_rate>"
+      "</sensor>";
+
+  std::ostringstream sdf;
+  for (unsigned int i = 0; i < _count; ++i)
+  {
+    sdf << "<model name='sensor_" << i << "'>"
+        << Link("link", ignition::math::Pose3d(
+               (i % 8) * 2.0, (i / 8) * 2.0, 0.2, 0, 0, 0),
+               "<box><size>0.4 0.4 0.4</size></box>", sensors)
+        << "</model>";
+  }
+  return World(sdf.str());
+}
+
+/////////////////////////////////////////////////
+/// \brief Bodies whose collisions are triangle meshes.
+/// \param[in] _count Number of bodies.
+/// \return The world.
+std::string Meshes(const unsigned int _count)
+{
+  const std::string mesh = "<mesh><uri>file://" TEST_PATH
+      "/data/cordless_drill/meshes/cordless_drill.dae</uri></mesh>";
+
+  std::ostringstream sdf;
+  for (unsigned int i = 0; i < _count; ++i)
+  {
+    sdf << "<model name='mesh_" << i << "'>"
+        << Link("link", ignition::math::Pose3d(
+               (i % 8) * 1.0, (i / 8) * 1.0, 0.5 + (i % 3) * 0.5, 0, 0, 0),
+               mesh)
+        << "</model>";
+  }
+  return World(sdf.str());
+}
+
+/////////////////////////////////////////////////
+class WorldStepBenchmark : public ServerFixture,
+                           public testing::WithParamInterface<const char*>
+{
+  /// \brief Run the current test in a child process, check its result
+  /// against the baseline and record it. In the child process, measure
+  /// the scenario instead.
+  /// \param[in] _physicsEngine Type of physics engine to use.
+  /// \param[in] _scenario Name of the scenario.
+  /// \param[in] _sdf SDF of the world.
+  public: void Run(const std::string &_physicsEngine,
+              const std::string &_scenario, const std::string &_sdf);
+
+  /// \brief Load a world, step it and record the result.
+  /// \param[in] _physicsEngine Type of physics engine to use.
+  /// \param[in] _scenario Name of the scenario.
+  /// \param[in] _sdf SDF of the world.
+  public: void Measure(const std::string &_physicsEngine,
+              const std::string &_scenario, const std::string &_sdf);
+
+  /// \brief Accumulate the diagnostic phase times.
+  /// \param[in] _msg Diagnostics message.
+  public: void OnDiagnostics(ConstDiagnosticsPtr &_msg);
+
+  /// \brief True while the measured steps run.
+  public: std::atomic<bool> measuring{false};
+
+  /// \brief Protects the phase times.
+  public: std::mutex phaseMutex;
+
+  /// \brief Accumulated phase times in seconds.
+  public: std::map<std::string, double> phases;
+};
+
+/////////////////////////////////////////////////
+void WorldStepBenchmark::OnDiagnostics(ConstDiagnosticsPtr &_msg)
+{
+  if (!this->measuring)
+    return;
+
+  std::lock_guard<std::mutex> lock(this->phaseMutex);
+  for (const auto &time : _msg->time())
+    this->phases[time.name()] += msgs::Convert(time.elapsed()).Double();
+}
+
+/////////////////////////////////////////////////
+void WorldStepBenchmark::Run(const std::string &_physicsEngine,
+    const std::string &_scenario, const std::string &_sdf)
+{
+  if (!g_childOutput.empty())
+  {
+    this->Measure(_physicsEngine, _scenario, _sdf);
+    return;
+  }
+
+  const double tolerance = std::stod(Env("GAZEBO_BENCHMARK_TOLERANCE",
+      "0.25"));
+
+  // A fresh process per scenario, so that the peak resident memory is not
+  // left high by the scenarios that ran before
+  const ::testing::TestInfo *info =
+      ::testing::UnitTest::GetInstance()->current_test_info();
+  const boost::filesystem::path childOutput =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gz_benchmark_%%%%%%%%.json");
+  const std::string cmd = "GAZEBO_BENCHMARK_CHILD_OUTPUT=\"" +
+      childOutput.string() + "\" \"" + g_benchmarkPath +
+      "\" --gtest_filter=" + info->test_case_name() + "." + info->name();
+  EXPECT_EQ(0, std::system(cmd.c_str())) << "Child process failed";
+
+  std::map<std::string, BenchmarkResult> childResults;
+  const bool read = ReadResults(childOutput.string(), childResults);
+  boost::filesystem::remove(childOutput);
+  ASSERT_TRUE(read) << "Unable to read child result[" << childOutput << "]";
+
+  auto child = childResults.find(_physicsEngine + "/" + _scenario);
+  ASSERT_TRUE(child != childResults.end());
+  const BenchmarkResult &result = child->second;
+
+  gzmsg << result.name << ": " << result.stepsPerSecond << " steps/s, "
+        << result.rssGrowthKb << " kB\n";
+
+  const std::string baselineFile = Env("GAZEBO_BENCHMARK_BASELINE", "");
+  if (!baselineFile.empty())
+  {
+    std::map<std::string, BenchmarkResult> baseline;
+    EXPECT_TRUE(ReadResults(baselineFile, baseline))
+      << "Unable to read baseline[" << baselineFile << "]";
+
+    auto iter = baseline.find(result.name);
+    if (iter != baseline.end())
+    {
+      EXPECT_GE(result.stepsPerSecond,
+          iter->second.stepsPerSecond * (1.0 - tolerance))
+        << result.name << " step rate regressed";
+
+      // Allow a few MB of allocator noise for small worlds
+      if (iter->second.rssGrowthKb >= 0)
+      {
+        EXPECT_LE(result.rssGrowthKb,
+            iter->second.rssGrowthKb * (1.0 + tolerance) + 4096)
+          << result.name << " memory regressed";
+      }
+    }
+    else
+      gzwarn << "No baseline for " << result.name << std::endl;
+  }
+
+  std::lock_guard<std::mutex> lock(g_resultsMutex);
+  g_results.push_back(result);
+}
+
+/////////////////////////////////////////////////
+void WorldStepBenchmark::Measure(const std::string &_physicsEngine,
+    const std::string &_scenario, const std::string &_sdf)
+{
+  const unsigned int steps = std::stoul(Env("GAZEBO_BENCHMARK_STEPS", "1000"));
+  const int64_t startKb = PeakResidentKb();
+
+  const boost::filesystem::path worldFile =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gz_benchmark_%%%%%%%%.world");
+  {
+    std::ofstream out(worldFile.string().c_str());
+    out << _sdf;
+  }
+
+  Load(worldFile.string(), true, _physicsEngine);
+  boost::filesystem::remove(worldFile);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  transport::SubscriberPtr sub = this->node->Subscribe("~/diagnostics",
+      &WorldStepBenchmark::OnDiagnostics, this);
+
+  // Let the bodies settle and the caches warm up
+  world->Step(100);
+
+  this->measuring = true;
+  const common::Time start = common::Time::GetWallTime();
+  world->Step(steps);
+  const common::Time elapsed = common::Time::GetWallTime() - start;
+
+  // Wait for the last diagnostics messages
+  common::Time::MSleep(200);
+  this->measuring = false;
+  sub.reset();
+
+  BenchmarkResult result;
+  result.name = _physicsEngine + "/" + _scenario;
+  result.steps = steps;
+  result.stepsPerSecond = steps / std::max(elapsed.Double(), 1e-9);
+  result.rssGrowthKb = PeakResidentKb() - startKb;
+  {
+    std::lock_guard<std::mutex> lock(this->phaseMutex);
+    for (const auto &phase : this->phases)
+      result.phases[phase.first] = phase.second * 1e6 / steps;
+  }
+
+  std::lock_guard<std::mutex> lock(g_resultsMutex);
+  g_results.push_back(result);
+}
+
+/////////////////////////////////////////////////
+TEST_P(WorldStepBenchmark, FreeBodies)
+{
+  Run(GetParam(), "free_bodies", FreeBodies(256));
+}
+
+/////////////////////////////////////////////////
+TEST_P(WorldStepBenchmark, Chain)
+{
+  Run(GetParam(), "chain", Chain(32));
+}
+
+/////////////////////////////////////////////////
+TEST_P(WorldStepBenchmark, Contacts)
+{
+  Run(GetParam(), "contacts", Contacts(6));
+}
+
+/////////////////////////////////////////////////
+TEST_P(WorldStepBenchmark, Sensors)
+{
+  Run(GetParam(), "sensors", Sensors(16));
+}
+
+/////////////////////////////////////////////////
+TEST_P(WorldStepBenchmark, Meshes)
+{
+  if (std::string(GetParam()) == "simbody")
+  {
+    gzerr << "Skipping Meshes for physics engine [simbody], which does not "
+          << "support mesh collisions.\n";
+    return;
+  }
+  Run(GetParam(), "meshes", Meshes(32));
+}
+
+INSTANTIATE_TEST_CASE_P(PhysicsEngines, WorldStepBenchmark,
+                        PHYSICS_ENGINE_VALUES,);  // NOLINT
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  g_benchmarkPath = argv[0];
+  g_childOutput = Env("GAZEBO_BENCHMARK_CHILD_OUTPUT", "");
+
+  const int result = RUN_ALL_TESTS();
+  if (g_childOutput.empty())
+    WriteResults(Env("GAZEBO_BENCHMARK_OUTPUT", "world_step_benchmark.json"));
+  else
+    WriteResults(g_childOutput);
+  return result;
+}